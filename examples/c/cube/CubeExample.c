@@ -34,6 +34,7 @@
 
 #define WINDOW_WIDTH 800
 #define WINDOW_HEIGHT 600
+#define PIPELINE_CACHE_FILE "cube_pipeline_cache.bin"
 #define CUBE_COUNT 3
 #define COLOR_FORMAT GFX_FORMAT_B8G8R8A8_UNORM_SRGB
 #define DEPTH_FORMAT GFX_FORMAT_DEPTH32_FLOAT
@@ -166,6 +167,9 @@ typedef struct {
 
     // Application settings
     Settings settings;
+
+    // Set when the device was seeded from PIPELINE_CACHE_FILE
+    bool pipelineCacheLoaded;
 } CubeApp;
 
 // Private function declarations
@@ -205,6 +209,8 @@ static GfxPlatformWindowHandle getPlatformWindowHandle(GLFWwindow* window);
 static float getCurrentTime(void);
 static void* loadBinaryFile(const char* filepath, size_t* outSize);
 static void* loadTextFile(const char* filepath, size_t* outSize);
+static void* loadPipelineCache(size_t* outSize);
+static void savePipelineCache(GfxDevice device);
 
 // Matrix/Vector math function declarations
 static void matrixIdentity(float* matrix);
@@ -352,7 +358,20 @@ static bool createGraphics(CubeApp* app)
     deviceDesc.enabledExtensions = deviceExtensions;
     deviceDesc.enabledExtensionCount = 2;
 
-    if (gfxAdapterCreateDevice(app->adapter, &deviceDesc, &app->device) != GFX_RESULT_SUCCESS) {
+    // Seed the pipeline cache from the previous run so pipelines are not recompiled
+    GfxDevicePipelineCacheDescriptor pipelineCacheDesc = {};
+    pipelineCacheDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR;
+    pipelineCacheDesc.pNext = NULL;
+    pipelineCacheDesc.initialData = loadPipelineCache(&pipelineCacheDesc.initialDataSize);
+    // Only counts as warm if the driver accepted the data, it is ignored after a driver update
+    pipelineCacheDesc.initialDataAccepted = &app->pipelineCacheLoaded;
+    if (pipelineCacheDesc.initialData) {
+        deviceDesc.pNext = &pipelineCacheDesc;
+    }
+
+    GfxResult deviceResult = gfxAdapterCreateDevice(app->adapter, &deviceDesc, &app->device);
+    free((void*)pipelineCacheDesc.initialData);
+    if (deviceResult != GFX_RESULT_SUCCESS) {
         fprintf(stderr, "Failed to create device\n");
         return false;
     }
@@ -424,6 +443,7 @@ static void destroyGraphics(CubeApp* app)
         app->surface = NULL;
     }
     if (app->device) {
+        savePipelineCache(app->device);
         gfxDeviceDestroy(app->device);
         app->device = NULL;
     }
@@ -1620,10 +1640,13 @@ static bool createRenderPipeline(CubeApp* app)
     pipelineDesc.bindGroupLayouts = bindGroupLayouts;
     pipelineDesc.bindGroupLayoutCount = 2;
 
+    float pipelineStart = getCurrentTime();
     if (gfxDeviceCreateRenderPipeline(app->device, &pipelineDesc, &app->renderPipeline) != GFX_RESULT_SUCCESS) {
         fprintf(stderr, "Failed to create render pipeline\n");
         return false;
     }
+    printf("Render pipeline created in %.2f ms (%s pipeline cache)\n",
+        (getCurrentTime() - pipelineStart) * 1000.0f, app->pipelineCacheLoaded ? "warm" : "cold");
 
     return true;
 }
@@ -1704,6 +1727,39 @@ static float getCurrentTime(void)
 #endif
 }
 
+// Reads the pipeline cache saved by the previous run
+// Returns NULL without logging if there is no cache file yet (first run)
+static void* loadPipelineCache(size_t* outSize)
+{
+    FILE* file = fopen(PIPELINE_CACHE_FILE, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fclose(file);
+    return loadBinaryFile(PIPELINE_CACHE_FILE, outSize);
+}
+
+static void savePipelineCache(GfxDevice device)
+{
+    size_t dataSize = 0;
+    if (gfxDeviceGetPipelineCacheData(device, &dataSize, NULL) != GFX_RESULT_SUCCESS || dataSize == 0) {
+        return; // Not supported by this backend
+    }
+    void* data = malloc(dataSize);
+    if (!data) {
+        return;
+    }
+    if (gfxDeviceGetPipelineCacheData(device, &dataSize, data) == GFX_RESULT_SUCCESS) {
+        FILE* file = fopen(PIPELINE_CACHE_FILE, "wb");
+        if (file) {
+            fwrite(data, 1, dataSize, file);
+            fclose(file);
+            printf("Saved pipeline cache (%zu bytes) to %s\n", dataSize, PIPELINE_CACHE_FILE);
+        }
+    }
+    free(data);
+}
+
 // Helper function to load binary files (SPIR-V shaders)
 static void* loadBinaryFile(const char* filepath, size_t* outSize)
 {
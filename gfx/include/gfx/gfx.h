@@ -46,6 +46,9 @@
 // Special size value to map entire buffer from offset (used with gfxBufferMap)
 #define GFX_WHOLE_SIZE 0
 
+// Maximum immediate data (push constant) bytes per pipeline, see GfxImmediateDataRange
+#define GFX_MAX_IMMEDIATE_DATA_SIZE 128
+
 // ============================================================================
 // ERROR HANDLING
 // ============================================================================
@@ -235,6 +238,8 @@
 //   gfxQueueSubmit(queue, &submitDesc); // submitDesc contains encoder
 //   → Encoder is BORROWED by gfxQueueSubmit (reads commands, doesn't store encoder)
 //   → After submit returns, you can destroy the encoder
+//   → Exception: a submit held back by GfxDeviceSubmitDescriptor::deferSubmits still
+//     references the encoder's commands; keep the encoder until the batch was flushed
 //   → Encoder must remain valid during the submit call
 //   → Commands are copied to internal GPU command buffer
 //
@@ -260,13 +265,16 @@
 // GPU SYNCHRONIZATION:
 //
 //   gfxQueueSubmit(queue, &submitDesc);
-//   gfxBufferDestroy(buffer); // DANGER!
+//   gfxBufferDestroy(buffer); // Safe, destruction is deferred
 //   → Submit is ASYNCHRONOUS - GPU may still be using buffer
-//   → Application MUST wait for GPU completion before destroying:
+//   → Buffers, textures and bind groups are destroyed once the work submitted before the
+//     destroy call completed; gfxQueueSubmit, gfxDevicePoll and gfxDeviceWaitIdle release them
+//   → Vulkan without timeline semaphore support destroys them right away; there, and for all
+//     other objects, the application MUST wait for GPU completion before destroying:
 //
 //   gfxQueueSubmit(queue, &submitDesc);
 //   gfxFenceWait(submitDesc.signalFence, UINT64_MAX);
-//   gfxBufferDestroy(buffer); // Now safe
+//   gfxTextureViewDestroy(view); // Now safe
 //
 // MAPPING LIFETIME:
 //
@@ -325,7 +333,7 @@
 //   → Example: Thread A and B both call commands on encoderA (NOT OK - undefined behavior)
 //
 // Queue Operations (Thread-Safe):
-//   ✓ gfxQueueSubmit() - Internal synchronization, safe to call from multiple threads
+//   ✓ gfxQueueSubmit() / gfxQueueSubmitBatch() - Internal synchronization, safe to call from multiple threads
 //   ✓ gfxQueueWriteBuffer() - Internal synchronization
 //   ✓ gfxQueueWriteTexture() - Internal synchronization
 //   → The implementation uses a mutex internally for queue operations
@@ -335,8 +343,10 @@
 //   ✗ gfxBufferDestroy(buffer)
 //   ✗ gfxTextureDestroy(texture)
 //   → Application must ensure no other thread is using the object
-//   → Application must ensure GPU has finished using the object (use fences)
-//   → Destroying an object while the GPU is using it is undefined behavior
+//   → Buffers, textures and bind groups still in use by the GPU are destroyed later, once
+//     the work submitted before the destroy call completed (see GPU SYNCHRONIZATION)
+//   → For other objects, application must ensure GPU has finished using them (use fences);
+//     destroying those while the GPU is using them is undefined behavior
 //
 // Synchronization Objects (Thread-Safe):
 //   ✓ gfxFenceWait() - Can be called from multiple threads on same fence
@@ -367,6 +377,7 @@
 // - GfxLogCallback may be called from ANY thread, including internal library threads
 // - Log callbacks must be thread-safe if they access shared state
 // - Log callbacks should not call GFX functions (may deadlock)
+// - Async pipeline creation callbacks run on an internal thread (see gfxDeviceCreateRenderPipelineAsync)
 //
 // BACKEND DIFFERENCES:
 // - Vulkan: All thread-safety guarantees are honored
@@ -621,6 +632,9 @@ typedef enum {
     GFX_BUFFER_USAGE_UNIFORM = 1 << 6,
     GFX_BUFFER_USAGE_STORAGE = 1 << 7,
     GFX_BUFFER_USAGE_INDIRECT = 1 << 8,
+    // Buffer stays mapped for its whole lifetime; see gfxBufferGetMappedPointer.
+    // Requires GFX_MEMORY_PROPERTY_HOST_VISIBLE.
+    GFX_BUFFER_USAGE_MAP_PERSISTENT = 1 << 9,
     GFX_BUFFER_USAGE_MAX_ENUM = 0x7FFFFFFF
 } GfxBufferUsageFlagBits;
 typedef uint32_t GfxBufferUsageFlags;
@@ -817,6 +831,25 @@ typedef enum {
     GFX_QUERY_TYPE_MAX_ENUM = 0x7FFFFFFF
 } GfxQueryType;
 
+typedef enum {
+    GFX_COMMAND_TYPE_SET_PIPELINE = 0,
+    GFX_COMMAND_TYPE_SET_BIND_GROUP = 1,
+    GFX_COMMAND_TYPE_SET_VERTEX_BUFFER = 2,
+    GFX_COMMAND_TYPE_SET_INDEX_BUFFER = 3,
+    GFX_COMMAND_TYPE_SET_VIEWPORT = 4,
+    GFX_COMMAND_TYPE_SET_SCISSOR_RECT = 5,
+    GFX_COMMAND_TYPE_DRAW = 6,
+    GFX_COMMAND_TYPE_DRAW_INDEXED = 7,
+    GFX_COMMAND_TYPE_MAX_ENUM = 0x7FFFFFFF
+} GfxCommandType;
+
+typedef enum {
+    GFX_VALIDATION_LEVEL_FULL = 0, // Handles, pointers and descriptor contents (default)
+    GFX_VALIDATION_LEVEL_HANDLES_ONLY = 1, // Null handle/pointer checks only
+    GFX_VALIDATION_LEVEL_DISABLED = 2, // No argument validation at all
+    GFX_VALIDATION_LEVEL_MAX_ENUM = 0x7FFFFFFF
+} GfxValidationLevel;
+
 // Structure types for extensibility (Vulkan-style)
 typedef enum {
     GFX_STRUCTURE_TYPE_INSTANCE_DESCRIPTOR = 1,
@@ -847,6 +880,11 @@ typedef enum {
     GFX_STRUCTURE_TYPE_COMPUTE_PASS_BEGIN_DESCRIPTOR = 26,
     GFX_STRUCTURE_TYPE_PRESENT_DESCRIPTOR = 27,
     GFX_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_DESCRIPTOR = 28,
+    GFX_STRUCTURE_TYPE_INSTANCE_VALIDATION_DESCRIPTOR = 29,
+    GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR = 30,
+    GFX_STRUCTURE_TYPE_RENDER_BUNDLE_ENCODER_DESCRIPTOR = 31,
+    GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_COMPILE_DESCRIPTOR = 32,
+    GFX_STRUCTURE_TYPE_DEVICE_SUBMIT_DESCRIPTOR = 33,
     GFX_STRUCTURE_TYPE_MAX_ENUM = 0x7FFFFFFF
 } GfxStructureType;
 
@@ -874,6 +912,8 @@ typedef struct GfxChainHeader {
 #define GFX_DEVICE_EXTENSION_TIMELINE_SEMAPHORE "gfx_timeline_semaphore"
 #define GFX_DEVICE_EXTENSION_MULTIVIEW "gfx_multiview"
 #define GFX_DEVICE_EXTENSION_ANISOTROPIC_FILTERING "gfx_anisotropic_filtering"
+#define GFX_DEVICE_EXTENSION_UPLOAD_QUEUE "gfx_upload_queue"
+#define GFX_DEVICE_EXTENSION_DRAW_INDIRECT_COUNT "gfx_draw_indirect_count"
 
 // ============================================================================
 // Forward Declarations (Opaque Handles)
@@ -892,6 +932,8 @@ typedef struct GfxRenderPipeline_T* GfxRenderPipeline;
 typedef struct GfxComputePipeline_T* GfxComputePipeline;
 typedef struct GfxCommandEncoder_T* GfxCommandEncoder;
 typedef struct GfxRenderPassEncoder_T* GfxRenderPassEncoder;
+typedef struct GfxRenderBundleEncoder_T* GfxRenderBundleEncoder;
+typedef struct GfxRenderBundle_T* GfxRenderBundle;
 typedef struct GfxComputePassEncoder_T* GfxComputePassEncoder;
 typedef struct GfxBindGroup_T* GfxBindGroup;
 typedef struct GfxBindGroupLayout_T* GfxBindGroupLayout;
@@ -908,6 +950,9 @@ typedef struct GfxQuerySet_T* GfxQuerySet;
 // ============================================================================
 
 typedef void (*GfxLogCallback)(GfxLogLevel level, const char* message, void* userData);
+// pipeline is NULL unless result is GFX_RESULT_SUCCESS
+typedef void (*GfxCreateRenderPipelineCallback)(GfxResult result, GfxRenderPipeline pipeline, void* userData);
+typedef void (*GfxCreateComputePipelineCallback)(GfxResult result, GfxComputePipeline pipeline, void* userData);
 
 // ============================================================================
 // Core Structures
@@ -1176,6 +1221,19 @@ typedef struct {
     uint32_t enabledExtensionCount;
 } GfxInstanceDescriptor;
 
+// Chain into GfxInstanceDescriptor::pNext to select how much argument validation the backend does.
+// The level is backend-wide: it applies to every object of that backend. It is taken from the
+// first instance created while no other instance of the backend is alive (GFX_VALIDATION_LEVEL_FULL
+// when this struct is absent). Creating more instances never changes it: a later instance that
+// asks for a different level runs at the first one's level and a warning is logged. Once all
+// instances of the backend are destroyed, the next instance picks the level again.
+// Builds configured with GFX_DISABLE_VALIDATION ignore it and never validate.
+typedef struct {
+    GfxStructureType sType; // Must be GFX_STRUCTURE_TYPE_INSTANCE_VALIDATION_DESCRIPTOR
+    const void* pNext;
+    GfxValidationLevel level;
+} GfxInstanceValidationDescriptor;
+
 // Adapter selection: specify either an index OR a preference
 // Set adapterIndex to UINT32_MAX to use preference-based selection
 typedef struct {
@@ -1242,6 +1300,27 @@ typedef struct {
     uint32_t maxTextureArrayLayers;
 } GfxDeviceLimits;
 
+// Device memory statistics
+// Reports the backend's device memory sub-allocator. fragmentation is 0 when all free space
+// inside reserved blocks is contiguous and approaches 1 as it splits into small ranges.
+typedef struct {
+    uint64_t blockCount;
+    uint64_t dedicatedAllocationCount;
+    uint64_t allocationCount;
+    uint64_t reservedBytes;
+    uint64_t usedBytes;
+    uint64_t largestFreeRange;
+    float fragmentation;
+} GfxDeviceMemoryStats;
+
+// Command encoder statistics, for profiling
+// Counts what the encoder did since the last gfxCommandEncoderBegin; pass encoders add theirs
+// when they end. filteredCommandCount is the number of pipeline, bind group, vertex/index buffer,
+// viewport and scissor calls dropped because the same value was already bound. WebGPU reports 0.
+typedef struct {
+    uint64_t filteredCommandCount;
+} GfxCommandEncoderStats;
+
 // Queue family properties
 typedef struct {
     GfxQueueFlags flags;
@@ -1265,6 +1344,44 @@ typedef struct {
     uint32_t enabledExtensionCount;
 } GfxDeviceDescriptor;
 
+// Chain into GfxDeviceDescriptor::pNext to seed the device's pipeline cache with data previously
+// returned by gfxDeviceGetPipelineCacheData (typically loaded from disk at startup).
+// Data written by a different driver or GPU is detected and ignored; the cache then starts empty.
+// The data only needs to stay valid for the duration of gfxAdapterCreateDevice.
+// WebGPU: Ignored (initialDataAccepted is set to false)
+typedef struct {
+    GfxStructureType sType; // Must be GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR
+    const void* pNext;
+    const void* initialData;
+    size_t initialDataSize;
+    bool* initialDataAccepted; // Optional, set by a successful gfxAdapterCreateDevice; false if initialData was ignored
+} GfxDevicePipelineCacheDescriptor;
+
+// Chain into GfxDeviceDescriptor::pNext to size the pool of threads that compile pipelines
+// created with gfxDeviceCreate*PipelineAsync. The threads are started on the first async call.
+// WebGPU: Ignored (the implementation compiles asynchronous pipelines itself)
+typedef struct {
+    GfxStructureType sType; // Must be GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_COMPILE_DESCRIPTOR
+    const void* pNext;
+    uint32_t threadCount; // 0 = pick from the number of CPU cores
+} GfxDevicePipelineCompileDescriptor;
+
+// Chain into GfxDeviceDescriptor::pNext to defer queue submits. A deferred submit is held back
+// and merged with the following ones into a single vkQueueSubmit, made when a submit signals a
+// fence or at the next flush point: gfxQueueFlush, gfxQueueWaitIdle, gfxDeviceWaitIdle,
+// gfxSemaphoreWait, presenting, submitting the uploads staged by gfxQueueWriteTexture or
+// gfxQueueWriteBuffer to device-local memory, and gfxDeviceUploadBuffer/gfxDeviceUploadTexture.
+// Work on other queues or polling with gfxSemaphoreGetValue does not flush; call gfxQueueFlush
+// first.
+// The command encoders of a held back submit must not be destroyed, reset or re-begun until it
+// was flushed; the batch refers to their recorded commands rather than copying them.
+// WebGPU: Ignored
+typedef struct {
+    GfxStructureType sType; // Must be GFX_STRUCTURE_TYPE_DEVICE_SUBMIT_DESCRIPTOR
+    const void* pNext;
+    bool deferSubmits;
+} GfxDeviceSubmitDescriptor;
+
 typedef struct {
     GfxStructureType sType;
     const void* pNext;
@@ -1421,6 +1538,17 @@ typedef struct {
     float depthBiasClamp;
 } GfxDepthStencilState;
 
+// Range of immediate data (push constants) readable by the given shader stages.
+// WebGPU: Emulated with a uniform buffer bound at group bindGroupLayoutCount, binding 0,
+//         with a dynamic offset. Shaders declare it there as var<uniform>; the group is reserved.
+//         It counts against the device's 4 bind groups, so a pipeline with immediate data can
+//         use at most 3 of its own; more returns GFX_RESULT_ERROR_INVALID_ARGUMENT.
+typedef struct {
+    GfxShaderStageFlags visibility;
+    uint32_t offset; // Multiple of 4
+    uint32_t size; // Multiple of 4, offset + size <= GFX_MAX_IMMEDIATE_DATA_SIZE
+} GfxImmediateDataRange;
+
 typedef struct {
     GfxStructureType sType;
     const void* pNext;
@@ -1434,6 +1562,9 @@ typedef struct {
     // Bind group layouts for the pipeline
     const GfxBindGroupLayout* bindGroupLayouts;
     uint32_t bindGroupLayoutCount;
+    // Immediate data ranges, set with gfxRenderPassEncoderSetImmediateData
+    const GfxImmediateDataRange* immediateDataRanges;
+    uint32_t immediateDataRangeCount;
 } GfxRenderPipelineDescriptor;
 
 typedef struct {
@@ -1445,6 +1576,9 @@ typedef struct {
     // Bind group layouts for the pipeline
     const GfxBindGroupLayout* bindGroupLayouts;
     uint32_t bindGroupLayoutCount;
+    // Immediate data ranges, set with gfxComputePassEncoderSetImmediateData
+    const GfxImmediateDataRange* immediateDataRanges;
+    uint32_t immediateDataRangeCount;
 } GfxComputePipelineDescriptor;
 
 typedef struct {
@@ -1535,6 +1669,14 @@ typedef struct {
     const char* label;
 } GfxCommandEncoderDescriptor;
 
+// Render bundle encoder descriptor: bundles can be executed in any render pass compatible with renderPass
+typedef struct {
+    GfxStructureType sType;
+    const void* pNext;
+    const char* label;
+    GfxRenderPass renderPass;
+} GfxRenderBundleEncoderDescriptor;
+
 typedef struct {
     GfxStructureType sType;
     const void* pNext;
@@ -1544,6 +1686,7 @@ typedef struct {
     // Wait semaphores (must be signaled before execution)
     GfxSemaphore* waitSemaphores;
     uint64_t* waitValues; // For timeline semaphores, NULL for binary
+    GfxPipelineStageFlags* waitStageMasks; // Stages that wait on each semaphore, NULL (or NONE entries) for the defaults
     uint32_t waitSemaphoreCount;
 
     // Signal semaphores (will be signaled after execution)
@@ -1563,6 +1706,113 @@ typedef struct {
     uint32_t waitSemaphoreCount;
 } GfxPresentDescriptor;
 
+// One record of a render pass command stream (see gfxRenderPassEncoderExecuteCommandStream).
+// Plain memory with no API calls involved, so streams can be filled on any thread.
+typedef struct {
+    GfxCommandType type;
+    union {
+        struct {
+            GfxRenderPipeline pipeline;
+        } setPipeline;
+        struct {
+            uint32_t index;
+            GfxBindGroup bindGroup;
+            const uint32_t* dynamicOffsets; // Must stay valid until the stream is executed
+            uint32_t dynamicOffsetCount;
+        } setBindGroup;
+        struct {
+            uint32_t slot;
+            GfxBuffer buffer;
+            uint64_t offset;
+            uint64_t size;
+        } setVertexBuffer;
+        struct {
+            GfxBuffer buffer;
+            GfxIndexFormat format;
+            uint64_t offset;
+            uint64_t size;
+        } setIndexBuffer;
+        GfxViewport setViewport;
+        GfxScissorRect setScissorRect;
+        struct {
+            uint32_t vertexCount;
+            uint32_t instanceCount;
+            uint32_t firstVertex;
+            uint32_t firstInstance;
+        } draw;
+        struct {
+            uint32_t indexCount;
+            uint32_t instanceCount;
+            uint32_t firstIndex;
+            int32_t baseVertex;
+            uint32_t firstInstance;
+        } drawIndexed;
+    };
+} GfxCommand;
+
+// ============================================================================
+// Proc Table
+// ============================================================================
+
+// Hot-path entry points bound directly to a device's backend (see gfxDeviceGetProcTable).
+// Calling through these skips the per-call handle lookup and backend dispatch performed by
+// the equivalent gfx* functions; arguments are validated the same way.
+typedef GfxResult (*PFN_gfxQueueSubmit)(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor);
+typedef GfxResult (*PFN_gfxQueueWriteBuffer)(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size);
+typedef GfxResult (*PFN_gfxCommandEncoderBegin)(GfxCommandEncoder commandEncoder);
+typedef GfxResult (*PFN_gfxCommandEncoderEnd)(GfxCommandEncoder commandEncoder);
+typedef GfxResult (*PFN_gfxCommandEncoderCopyBufferToBuffer)(GfxCommandEncoder commandEncoder, const GfxCopyBufferToBufferDescriptor* descriptor);
+typedef GfxResult (*PFN_gfxCommandEncoderPipelineBarrier)(GfxCommandEncoder commandEncoder, const GfxPipelineBarrierDescriptor* descriptor);
+typedef GfxResult (*PFN_gfxRenderPassEncoderSetPipeline)(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline);
+typedef GfxResult (*PFN_gfxRenderPassEncoderSetBindGroup)(GfxRenderPassEncoder renderPassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+typedef GfxResult (*PFN_gfxRenderPassEncoderSetVertexBuffer)(GfxRenderPassEncoder renderPassEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size);
+typedef GfxResult (*PFN_gfxRenderPassEncoderSetIndexBuffer)(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size);
+typedef GfxResult (*PFN_gfxRenderPassEncoderSetViewport)(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport);
+typedef GfxResult (*PFN_gfxRenderPassEncoderSetScissorRect)(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor);
+typedef GfxResult (*PFN_gfxRenderPassEncoderDraw)(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+typedef GfxResult (*PFN_gfxRenderPassEncoderDrawIndexed)(GfxRenderPassEncoder renderPassEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
+typedef GfxResult (*PFN_gfxRenderPassEncoderDrawIndirect)(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset);
+typedef GfxResult (*PFN_gfxRenderPassEncoderDrawIndexedIndirect)(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset);
+typedef GfxResult (*PFN_gfxRenderPassEncoderEnd)(GfxRenderPassEncoder renderPassEncoder);
+typedef GfxResult (*PFN_gfxComputePassEncoderSetPipeline)(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline);
+typedef GfxResult (*PFN_gfxComputePassEncoderSetBindGroup)(GfxComputePassEncoder computePassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+typedef GfxResult (*PFN_gfxComputePassEncoderDispatch)(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ);
+typedef GfxResult (*PFN_gfxComputePassEncoderDispatchIndirect)(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset);
+typedef GfxResult (*PFN_gfxComputePassEncoderEnd)(GfxComputePassEncoder computePassEncoder);
+
+// Only valid for objects created from the device the table was queried from
+typedef struct {
+    // Queue
+    PFN_gfxQueueSubmit queueSubmit;
+    PFN_gfxQueueWriteBuffer queueWriteBuffer;
+
+    // CommandEncoder
+    PFN_gfxCommandEncoderBegin commandEncoderBegin;
+    PFN_gfxCommandEncoderEnd commandEncoderEnd;
+    PFN_gfxCommandEncoderCopyBufferToBuffer commandEncoderCopyBufferToBuffer;
+    PFN_gfxCommandEncoderPipelineBarrier commandEncoderPipelineBarrier;
+
+    // RenderPassEncoder
+    PFN_gfxRenderPassEncoderSetPipeline renderPassEncoderSetPipeline;
+    PFN_gfxRenderPassEncoderSetBindGroup renderPassEncoderSetBindGroup;
+    PFN_gfxRenderPassEncoderSetVertexBuffer renderPassEncoderSetVertexBuffer;
+    PFN_gfxRenderPassEncoderSetIndexBuffer renderPassEncoderSetIndexBuffer;
+    PFN_gfxRenderPassEncoderSetViewport renderPassEncoderSetViewport;
+    PFN_gfxRenderPassEncoderSetScissorRect renderPassEncoderSetScissorRect;
+    PFN_gfxRenderPassEncoderDraw renderPassEncoderDraw;
+    PFN_gfxRenderPassEncoderDrawIndexed renderPassEncoderDrawIndexed;
+    PFN_gfxRenderPassEncoderDrawIndirect renderPassEncoderDrawIndirect;
+    PFN_gfxRenderPassEncoderDrawIndexedIndirect renderPassEncoderDrawIndexedIndirect;
+    PFN_gfxRenderPassEncoderEnd renderPassEncoderEnd;
+
+    // ComputePassEncoder
+    PFN_gfxComputePassEncoderSetPipeline computePassEncoderSetPipeline;
+    PFN_gfxComputePassEncoderSetBindGroup computePassEncoderSetBindGroup;
+    PFN_gfxComputePassEncoderDispatch computePassEncoderDispatch;
+    PFN_gfxComputePassEncoderDispatchIndirect computePassEncoderDispatchIndirect;
+    PFN_gfxComputePassEncoderEnd computePassEncoderEnd;
+} GfxProcTable;
+
 // ============================================================================
 // Platform Specific
 // ============================================================================
@@ -1700,15 +1950,56 @@ GFX_API GfxResult gfxDeviceDestroy(GfxDevice device);
 GFX_API GfxResult gfxDeviceGetQueue(GfxDevice device, GfxQueue* outQueue);
 GFX_API GfxResult gfxDeviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, GfxQueue* outQueue);
 GFX_API GfxResult gfxDeviceWaitIdle(GfxDevice device);
+// Releases destroyed resources the GPU is done with, without waiting for anything.
+// Vulkan: Buffers, textures and bind groups are destroyed once the queues pass the work
+//         submitted before their destroy call; gfxQueueSubmit and gfxDeviceWaitIdle release them
+//         as well. Call this when not submitting for a while so they are not kept around.
+//         Without timeline semaphore support they are destroyed right away instead.
+// WebGPU: Processes pending events, the implementation keeps in-use objects alive itself
+GFX_API GfxResult gfxDevicePoll(GfxDevice device);
 GFX_API GfxResult gfxDeviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits);
+// Vulkan: Returns statistics of the device memory sub-allocator
+// WebGPU: Returns GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED (memory is managed by the implementation)
+GFX_API GfxResult gfxDeviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats);
+// Pipeline cache contents, to be written to disk and passed back through
+// GfxDevicePipelineCacheDescriptor on the next run so pipelines are not recompiled.
+// Vulkan-style query: call with data=NULL to get the size, then call again with an allocated buffer.
+// WebGPU: Returns GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED (caching is left to the implementation)
+GFX_API GfxResult gfxDeviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data);
+// Upload queue (requires GFX_DEVICE_EXTENSION_UPLOAD_QUEUE)
+// Uploads run on a transfer-only queue when the adapter has one, overlapping with rendering.
+// Each upload returns a value of the device's upload timeline semaphore; submits that use the
+// uploaded resource must wait on that value (this also hands queue ownership to the waiting queue).
+// The semaphore is owned by the device and must not be destroyed.
+// Vulkan: On a transfer-only queue an upload waits for the work submitted to the default queue
+//         before it (which flushes submits held back there), so it never overwrites data that
+//         work still reads.
+// Vulkan: Texture uploads that do not cover a whole mip level, and depth/stencil textures, are
+//         staged on the default queue instead and are ordered before its next submit.
+// WebGPU: Returns GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED (use gfxQueueWriteBuffer/gfxQueueWriteTexture)
+GFX_API GfxResult gfxDeviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore);
+GFX_API GfxResult gfxDeviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue);
+GFX_API GfxResult gfxDeviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue);
 GFX_API GfxResult gfxDeviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported);
 // Helper to deduce access flags from texture layout
 // Vulkan: Returns explicit access flags based on layout
 // WebGPU: Returns GFX_ACCESS_NONE (implicit synchronization)
 GFX_API GfxAccessFlags gfxDeviceGetAccessFlagsForLayout(GfxDevice device, GfxTextureLayout layout);
+// Fills outProcTable with hot-path function pointers bound directly to the device's backend.
+// Intended for renderers issuing very large numbers of encoder calls; the regular gfx* functions
+// remain the general-purpose API.
+GFX_API GfxResult gfxDeviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable);
 
 // Queue functions
 GFX_API GfxResult gfxQueueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor);
+// Same as calling gfxQueueSubmit for each descriptor in order, with as few driver submits as
+// possible: one per descriptor that signals a fence, plus one for the descriptors after the last
+// Vulkan: Each descriptor becomes one VkSubmitInfo of the same vkQueueSubmit
+// WebGPU: The command buffers of all descriptors go into one wgpuQueueSubmit
+GFX_API GfxResult gfxQueueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount);
+// Submits the work held back by deferred submits (see GfxDeviceSubmitDescriptor)
+// WebGPU: No-op
+GFX_API GfxResult gfxQueueFlush(GfxQueue queue);
 GFX_API GfxResult gfxQueueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size);
 GFX_API GfxResult gfxQueueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout);
 GFX_API GfxResult gfxQueueWaitIdle(GfxQueue queue);
@@ -1738,6 +2029,12 @@ GFX_API GfxResult gfxBufferDestroy(GfxBuffer buffer);
 GFX_API GfxResult gfxBufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo);
 GFX_API GfxResult gfxBufferGetNativeHandle(GfxBuffer buffer, void** outHandle);
 GFX_API GfxResult gfxBufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void** outMappedPointer);
+// Returns the start of the persistent mapping of a buffer created with GFX_BUFFER_USAGE_MAP_PERSISTENT.
+// The pointer stays valid until the buffer is destroyed and never requires gfxBufferUnmap; use
+// gfxBufferFlushMappedRange/gfxBufferInvalidateMappedRange for memory that is not HOST_COHERENT.
+// Vulkan: Supported
+// WebGPU: Returns GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED (buffers cannot stay mapped while in use)
+GFX_API GfxResult gfxBufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer);
 GFX_API GfxResult gfxBufferUnmap(GfxBuffer buffer);
 GFX_API GfxResult gfxBufferFlushMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size);
 GFX_API GfxResult gfxBufferInvalidateMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size);
@@ -1772,10 +2069,20 @@ GFX_API GfxResult gfxBindGroupDestroy(GfxBindGroup bindGroup);
 
 // RenderPipeline functions
 GFX_API GfxResult gfxDeviceCreateRenderPipeline(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxRenderPipeline* outPipeline);
+// Compiles the pipeline in the background and passes it to callback, which may run on another thread
+// and is called exactly once if this returns GFX_RESULT_SUCCESS (never otherwise).
+// The descriptor is copied, but the shaders, bind group layouts and render pass it references
+// must stay alive until the callback ran. gfxDeviceWaitIdle waits for all pending callbacks;
+// call it before destroying the device.
+// Vulkan: Compiled on the device's pipeline compile threads (see GfxDevicePipelineCompileDescriptor)
+// WebGPU: Uses wgpuDeviceCreateRenderPipelineAsync
+GFX_API GfxResult gfxDeviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback, void* userData);
 GFX_API GfxResult gfxRenderPipelineDestroy(GfxRenderPipeline renderPipeline);
 
 // ComputePipeline functions
 GFX_API GfxResult gfxDeviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline);
+// Same as gfxDeviceCreateRenderPipelineAsync for compute pipelines
+GFX_API GfxResult gfxDeviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData);
 GFX_API GfxResult gfxComputePipelineDestroy(GfxComputePipeline computePipeline);
 
 // RenderPass functions
@@ -1783,6 +2090,10 @@ GFX_API GfxResult gfxDeviceCreateRenderPass(GfxDevice device, const GfxRenderPas
 GFX_API GfxResult gfxRenderPassDestroy(GfxRenderPass renderPass);
 
 // Framebuffer functions
+// Cheap to recreate every frame: Vulkan keeps released framebuffers and returns the same native
+// framebuffer for the same views, extent and compatible render pass until a view is destroyed.
+// Where VK_KHR_imageless_framebuffer is supported, views with the same format, usage, size and
+// layers share it instead, so one native framebuffer serves every swapchain image.
 GFX_API GfxResult gfxDeviceCreateFramebuffer(GfxDevice device, const GfxFramebufferDescriptor* descriptor, GfxFramebuffer* outFramebuffer);
 GFX_API GfxResult gfxFramebufferDestroy(GfxFramebuffer framebuffer);
 
@@ -1803,6 +2114,7 @@ GFX_API GfxResult gfxCommandEncoderWriteTimestamp(GfxCommandEncoder commandEncod
 GFX_API GfxResult gfxCommandEncoderResolveQuerySet(GfxCommandEncoder commandEncoder, GfxQuerySet querySet, uint32_t firstQuery, uint32_t queryCount, GfxBuffer destinationBuffer, uint64_t destinationOffset);
 GFX_API GfxResult gfxCommandEncoderEnd(GfxCommandEncoder commandEncoder);
 GFX_API GfxResult gfxCommandEncoderBegin(GfxCommandEncoder commandEncoder);
+GFX_API GfxResult gfxCommandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats);
 
 // RenderPassEncoder functions
 GFX_API GfxResult gfxRenderPassEncoderSetPipeline(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline);
@@ -1811,17 +2123,67 @@ GFX_API GfxResult gfxRenderPassEncoderSetVertexBuffer(GfxRenderPassEncoder rende
 GFX_API GfxResult gfxRenderPassEncoderSetIndexBuffer(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size);
 GFX_API GfxResult gfxRenderPassEncoderSetViewport(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport);
 GFX_API GfxResult gfxRenderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor);
+// Updates size bytes of immediate data at offset for the following draws. The bytes must be
+// covered by the immediate data ranges of the current pipeline, other bytes keep their values.
+// Render bundles cannot use pipelines with immediate data.
+GFX_API GfxResult gfxRenderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size);
 GFX_API GfxResult gfxRenderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
 GFX_API GfxResult gfxRenderPassEncoderDrawIndexed(GfxRenderPassEncoder renderPassEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
 GFX_API GfxResult gfxRenderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset);
 GFX_API GfxResult gfxRenderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset);
+// Records drawCount indirect draws read from indirectBuffer, stride bytes apart (0 = tightly packed).
+// Vulkan: Issued as a single draw when the device supports multiDrawIndirect, otherwise one draw per command.
+// WebGPU: Issued as one draw per command.
+GFX_API GfxResult gfxRenderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride);
+GFX_API GfxResult gfxRenderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride);
+// Like the MultiDraw functions, but the draw count is read on the GPU from countBuffer (clamped to maxDrawCount).
+// Requires GFX_DEVICE_EXTENSION_DRAW_INDIRECT_COUNT, returns GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED otherwise.
+// WebGPU: Not supported.
+GFX_API GfxResult gfxRenderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride);
+GFX_API GfxResult gfxRenderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride);
+// Records a whole command stream with a single dispatch. The stream is validated up front;
+// if any record is invalid nothing is recorded and an error is returned.
+GFX_API GfxResult gfxRenderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount);
 GFX_API GfxResult gfxRenderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex);
 GFX_API GfxResult gfxRenderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder renderPassEncoder);
+// Executes pre-recorded render bundles. Pass state (pipeline, bind groups, buffers) is not
+// inherited by bundles and is undefined after this call. To run on both backends, set the
+// viewport and scissor on the pass and inside each bundle: WebGPU uses the pass values, Vulkan
+// the bundle values (see gfxRenderBundleEncoderSetViewport).
+// Vulkan: A render pass records either bundles or inline commands, whichever comes first;
+//         mixing both returns GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED. Setting the pass viewport
+//         or scissor counts as neither and only affects inline draws.
+GFX_API GfxResult gfxRenderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount);
 GFX_API GfxResult gfxRenderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder);
 
+// RenderBundleEncoder functions
+// A bundle encoder is used by one thread at a time, so separate encoders can record draw ranges of
+// the same render pass in parallel. Finished bundles can be executed in any number of passes and
+// frames, until they are destroyed.
+// Vulkan: Recorded into a secondary command buffer
+GFX_API GfxResult gfxDeviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder);
+GFX_API GfxResult gfxRenderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder);
+GFX_API GfxResult gfxRenderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline);
+GFX_API GfxResult gfxRenderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+GFX_API GfxResult gfxRenderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size);
+GFX_API GfxResult gfxRenderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size);
+// Vulkan: Bundles do not inherit the pass viewport and scissor, so bundles that draw must set both.
+// WebGPU: Validated and ignored, bundles use the viewport and scissor of the render pass.
+GFX_API GfxResult gfxRenderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport);
+GFX_API GfxResult gfxRenderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor);
+GFX_API GfxResult gfxRenderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+GFX_API GfxResult gfxRenderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
+// Ends recording; the encoder accepts no further commands but must still be destroyed
+GFX_API GfxResult gfxRenderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle);
+
+// RenderBundle functions
+// The bundle must not be in use by pending submissions
+GFX_API GfxResult gfxRenderBundleDestroy(GfxRenderBundle renderBundle);
+
 // ComputePassEncoder functions
 GFX_API GfxResult gfxComputePassEncoderSetPipeline(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline);
 GFX_API GfxResult gfxComputePassEncoderSetBindGroup(GfxComputePassEncoder computePassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+GFX_API GfxResult gfxComputePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size);
 GFX_API GfxResult gfxComputePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ);
 GFX_API GfxResult gfxComputePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset);
 GFX_API GfxResult gfxComputePassEncoderEnd(GfxComputePassEncoder computePassEncoder);
@@ -1829,6 +2191,8 @@ GFX_API GfxResult gfxComputePassEncoderEnd(GfxComputePassEncoder computePassEnco
 // Fence functions
 GFX_API GfxResult gfxDeviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence);
 GFX_API GfxResult gfxFenceDestroy(GfxFence fence);
+// WebGPU: A submit signaling a fence returns without waiting; the fence is signaled once the
+//         queue's work-done future for that submit completes, which these poll and wait on
 GFX_API GfxResult gfxFenceGetStatus(GfxFence fence, bool* isSignaled);
 GFX_API GfxResult gfxFenceWait(GfxFence fence, uint64_t timeoutNs);
 GFX_API GfxResult gfxFenceReset(GfxFence fence);
@@ -1838,6 +2202,7 @@ GFX_API GfxResult gfxDeviceCreateSemaphore(GfxDevice device, const GfxSemaphoreD
 GFX_API GfxResult gfxSemaphoreDestroy(GfxSemaphore semaphore);
 GFX_API GfxResult gfxSemaphoreGetType(GfxSemaphore semaphore, GfxSemaphoreType* outType);
 GFX_API GfxResult gfxSemaphoreSignal(GfxSemaphore semaphore, uint64_t value);
+// WebGPU: Timeline values signaled by a submit are reached once its work completed, like fences
 GFX_API GfxResult gfxSemaphoreWait(GfxSemaphore semaphore, uint64_t value, uint64_t timeoutNs);
 GFX_API GfxResult gfxSemaphoreGetValue(GfxSemaphore semaphore, uint64_t* outValue);
 
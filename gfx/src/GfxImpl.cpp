@@ -5,6 +5,8 @@
 
 #include <gfx/gfx.h>
 
+#include <memory>
+
 // ============================================================================
 // Common Macros for Boilerplate Code
 // ============================================================================
@@ -16,11 +18,11 @@
         if (!device || !descriptor || !out##TypeName) {                                                                              \
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;                                                                                \
         }                                                                                                                            \
-        auto backend = gfx::backend::BackendManager::instance().getBackend(device);                                                  \
+        GfxBackend backendType = GFX_BACKEND_AUTO;                                                                                   \
+        auto backend = gfx::backend::BackendManager::instance().getBackend(device, &backendType);                                    \
         if (!backend) {                                                                                                              \
             return GFX_RESULT_ERROR_NOT_FOUND;                                                                                       \
         }                                                                                                                            \
-        GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(device);                                    \
         Gfx##TypeName native##TypeName = nullptr;                                                                                    \
         GfxResult result = backend->deviceCreate##funcName(device, descriptor, &native##TypeName);                                   \
         if (result != GFX_RESULT_SUCCESS) {                                                                                          \
@@ -30,6 +32,40 @@
         return GFX_RESULT_SUCCESS;                                                                                                   \
     }
 
+// Macro to generate async pipeline create functions. The backend calls back with its native
+// handle, which is wrapped here before the user's callback sees it.
+#define DEVICE_CREATE_ASYNC_FUNC(TypeName)                                                                                                                            \
+    GfxResult gfxDeviceCreate##TypeName##Async(GfxDevice device, const Gfx##TypeName##Descriptor* descriptor, GfxCreate##TypeName##Callback callback, void* userData) \
+    {                                                                                                                                                                 \
+        if (!device || !descriptor || !callback) {                                                                                                                    \
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;                                                                                                                 \
+        }                                                                                                                                                             \
+        GfxBackend backendType = GFX_BACKEND_AUTO;                                                                                                                    \
+        auto backend = gfx::backend::BackendManager::instance().getBackend(device, &backendType);                                                                     \
+        if (!backend) {                                                                                                                                               \
+            return GFX_RESULT_ERROR_NOT_FOUND;                                                                                                                        \
+        }                                                                                                                                                             \
+        struct Request {                                                                                                                                              \
+            GfxBackend backendType;                                                                                                                                   \
+            GfxCreate##TypeName##Callback callback;                                                                                                                   \
+            void* userData;                                                                                                                                           \
+        };                                                                                                                                                            \
+        auto* request = new Request{ backendType, callback, userData };                                                                                               \
+        auto onComplete = [](GfxResult result, Gfx##TypeName native##TypeName, void* requestData) {                                                                   \
+            std::unique_ptr<Request> request(static_cast<Request*>(requestData));                                                                                     \
+            Gfx##TypeName wrapped##TypeName = nullptr;                                                                                                                \
+            if (native##TypeName) {                                                                                                                                   \
+                wrapped##TypeName = gfx::backend::BackendManager::instance().wrap(request->backendType, native##TypeName);                                            \
+            }                                                                                                                                                         \
+            request->callback(result, wrapped##TypeName, request->userData);                                                                                          \
+        };                                                                                                                                                            \
+        GfxResult result = backend->deviceCreate##TypeName##Async(device, descriptor, onComplete, request);                                                           \
+        if (result != GFX_RESULT_SUCCESS) {                                                                                                                           \
+            delete request;                                                                                                                                           \
+        }                                                                                                                                                             \
+        return result;                                                                                                                                                \
+    }
+
 // Macro for destroy functions
 #define DESTROY_FUNC(TypeName, typeName)                                              \
     GfxResult gfx##TypeName##Destroy(Gfx##TypeName typeName)                          \
@@ -53,11 +89,11 @@
         if (!device || !descriptor || !out##TypeName) {                                                                                    \
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;                                                                                      \
         }                                                                                                                                  \
-        auto backend = gfx::backend::BackendManager::instance().getBackend(device);                                                        \
+        GfxBackend backendType = GFX_BACKEND_AUTO;                                                                                         \
+        auto backend = gfx::backend::BackendManager::instance().getBackend(device, &backendType);                                          \
         if (!backend) {                                                                                                                    \
             return GFX_RESULT_ERROR_NOT_FOUND;                                                                                             \
         }                                                                                                                                  \
-        GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(device);                                          \
         Gfx##TypeName native##TypeName = nullptr;                                                                                          \
         GfxResult result = backend->deviceImport##TypeName(device, descriptor, &native##TypeName);                                         \
         if (result != GFX_RESULT_SUCCESS) {                                                                                                \
@@ -265,12 +301,12 @@ GfxResult gfxInstanceRequestAdapter(GfxInstance instance, const GfxAdapterDescri
     if (!instance || !descriptor || !outAdapter) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(instance);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(instance, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(instance);
     GfxAdapter nativeAdapter = nullptr;
     GfxResult result = backend->instanceRequestAdapter(instance, descriptor, &nativeAdapter);
     if (result != GFX_RESULT_SUCCESS) {
@@ -286,12 +322,12 @@ GfxResult gfxInstanceEnumerateAdapters(GfxInstance instance, uint32_t* adapterCo
     if (!instance || !adapterCount) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(instance);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(instance, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(instance);
     GfxResult result = backend->instanceEnumerateAdapters(instance, adapterCount, adapters);
 
     // Wrap adapters for backend tracking
@@ -315,12 +351,12 @@ GfxResult gfxAdapterCreateDevice(GfxAdapter adapter, const GfxDeviceDescriptor*
     if (!adapter || !descriptor || !outDevice) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(adapter);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(adapter, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(adapter);
     GfxDevice nativeDevice = nullptr;
     GfxResult result = backend->adapterCreateDevice(adapter, descriptor, &nativeDevice);
     if (result != GFX_RESULT_SUCCESS) {
@@ -414,12 +450,12 @@ GfxResult gfxDeviceGetQueue(GfxDevice device, GfxQueue* outQueue)
     if (!device || !outQueue) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(device);
     GfxQueue nativeQueue = nullptr;
     GfxResult result = backend->deviceGetQueue(device, &nativeQueue);
     if (result != GFX_RESULT_SUCCESS) {
@@ -435,12 +471,12 @@ GfxResult gfxDeviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex,
     if (!device || !outQueue) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(device);
     GfxQueue nativeQueue = nullptr;
     GfxResult result = backend->deviceGetQueueByIndex(device, queueFamilyIndex, queueIndex, &nativeQueue);
     if (result != GFX_RESULT_SUCCESS) {
@@ -463,6 +499,18 @@ GfxResult gfxDeviceWaitIdle(GfxDevice device)
     return backend->deviceWaitIdle(device);
 }
 
+GfxResult gfxDevicePoll(GfxDevice device)
+{
+    if (!device) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->devicePoll(device);
+}
+
 GfxResult gfxDeviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits)
 {
     if (!device || !outLimits) {
@@ -475,6 +523,75 @@ GfxResult gfxDeviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits)
     return backend->deviceGetLimits(device, outLimits);
 }
 
+GfxResult gfxDeviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats)
+{
+    if (!device || !outStats) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->deviceGetMemoryStats(device, outStats);
+}
+
+GfxResult gfxDeviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data)
+{
+    if (!device || !dataSize) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->deviceGetPipelineCacheData(device, dataSize, data);
+}
+
+GfxResult gfxDeviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore)
+{
+    if (!device || !outSemaphore) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device, &backendType);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+
+    GfxSemaphore nativeSemaphore = nullptr;
+    GfxResult result = backend->deviceGetUploadSemaphore(device, &nativeSemaphore);
+    if (result != GFX_RESULT_SUCCESS) {
+        return result;
+    }
+
+    *outSemaphore = gfx::backend::BackendManager::instance().wrap(backendType, nativeSemaphore);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult gfxDeviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue)
+{
+    if (!device || !buffer || !data || !outSignalValue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->deviceUploadBuffer(device, buffer, offset, data, size, outSignalValue);
+}
+
+GfxResult gfxDeviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue)
+{
+    if (!device || !texture || !origin || !extent || !data || !outSignalValue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->deviceUploadTexture(device, texture, origin, extent, mipLevel, data, dataSize, finalLayout, outSignalValue);
+}
+
 GfxResult gfxDeviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported)
 {
     if (!device || !outSupported) {
@@ -487,6 +604,18 @@ GfxResult gfxDeviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType fo
     return backend->deviceSupportsShaderFormat(device, format, outSupported);
 }
 
+GfxResult gfxDeviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable)
+{
+    if (!device || !outProcTable) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(device);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->deviceGetProcTable(device, outProcTable);
+}
+
 GfxAccessFlags gfxDeviceGetAccessFlagsForLayout(GfxDevice device, GfxTextureLayout layout)
 {
     if (!device) {
@@ -516,6 +645,30 @@ GfxResult gfxQueueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescri
     return backend->queueSubmit(queue, submitDescriptor);
 }
 
+GfxResult gfxQueueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount)
+{
+    if (!queue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(queue);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->queueSubmitBatch(queue, submitDescriptors, submitCount);
+}
+
+GfxResult gfxQueueFlush(GfxQueue queue)
+{
+    if (!queue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(queue);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->queueFlush(queue);
+}
+
 GfxResult gfxQueueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size)
 {
     if (!queue) {
@@ -719,6 +872,18 @@ GfxResult gfxBufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void**
     return backend->bufferMap(buffer, offset, size, outMappedPointer);
 }
 
+GfxResult gfxBufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer)
+{
+    if (!buffer || !outMappedPointer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(buffer);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->bufferGetMappedPointer(buffer, outMappedPointer);
+}
+
 GfxResult gfxBufferUnmap(GfxBuffer buffer)
 {
     if (!buffer) {
@@ -810,12 +975,12 @@ GfxResult gfxTextureCreateView(GfxTexture texture, const GfxTextureViewDescripto
     if (!texture || !outView) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(texture);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(texture, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(texture);
     GfxTextureView nativeView = nullptr;
     GfxResult result = backend->textureCreateView(texture, descriptor, &nativeView);
     if (result != GFX_RESULT_SUCCESS) {
@@ -866,6 +1031,8 @@ DESTROY_FUNC(BindGroup, bindGroup)
 
 DEVICE_CREATE_FUNC(RenderPipeline, RenderPipeline)
 
+DEVICE_CREATE_ASYNC_FUNC(RenderPipeline)
+
 DESTROY_FUNC(RenderPipeline, renderPipeline)
 
 // ============================================================================
@@ -874,6 +1041,8 @@ DESTROY_FUNC(RenderPipeline, renderPipeline)
 
 DEVICE_CREATE_FUNC(ComputePipeline, ComputePipeline)
 
+DEVICE_CREATE_ASYNC_FUNC(ComputePipeline)
+
 DESTROY_FUNC(ComputePipeline, computePipeline)
 
 // ============================================================================
@@ -905,12 +1074,12 @@ GfxResult gfxCommandEncoderBeginRenderPass(GfxCommandEncoder encoder, const GfxR
     if (!encoder || !outEncoder) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(encoder);
     GfxRenderPassEncoder nativePass = nullptr;
     GfxResult result = backend->commandEncoderBeginRenderPass(encoder, beginDescriptor, &nativePass);
     if (result != GFX_RESULT_SUCCESS) {
@@ -926,12 +1095,12 @@ GfxResult gfxCommandEncoderBeginComputePass(GfxCommandEncoder encoder, const Gfx
     if (!encoder || !outEncoder) {
         return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder, &backendType);
     if (!backend) {
         return GFX_RESULT_ERROR_NOT_FOUND;
     }
 
-    GfxBackend backendType = gfx::backend::BackendManager::instance().getBackendType(encoder);
     GfxComputePassEncoder nativePass = nullptr;
     GfxResult result = backend->commandEncoderBeginComputePass(encoder, beginDescriptor, &nativePass);
     if (result != GFX_RESULT_SUCCESS) {
@@ -1086,6 +1255,18 @@ GfxResult gfxCommandEncoderBegin(GfxCommandEncoder commandEncoder)
     return backend->commandEncoderBegin(commandEncoder);
 }
 
+GfxResult gfxCommandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats)
+{
+    if (!commandEncoder || !outStats) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(commandEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->commandEncoderGetStats(commandEncoder, outStats);
+}
+
 // ============================================================================
 // RenderPassEncoder Functions
 // ============================================================================
@@ -1162,6 +1343,18 @@ GfxResult gfxRenderPassEncoderSetScissorRect(GfxRenderPassEncoder encoder, const
     return backend->renderPassEncoderSetScissorRect(encoder, scissor);
 }
 
+GfxResult gfxRenderPassEncoderSetImmediateData(GfxRenderPassEncoder encoder, uint32_t offset, const void* data, uint32_t size)
+{
+    if (!encoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderSetImmediateData(encoder, offset, data, size);
+}
+
 GfxResult gfxRenderPassEncoderDraw(GfxRenderPassEncoder encoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
 {
     if (!encoder) {
@@ -1212,6 +1405,66 @@ GfxResult gfxRenderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder encoder,
     return backend->renderPassEncoderDrawIndexedIndirect(encoder, indirectBuffer, indirectOffset);
 }
 
+GfxResult gfxRenderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder encoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride)
+{
+    if (!encoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderMultiDrawIndirect(encoder, indirectBuffer, indirectOffset, drawCount, stride);
+}
+
+GfxResult gfxRenderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder encoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride)
+{
+    if (!encoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderMultiDrawIndexedIndirect(encoder, indirectBuffer, indirectOffset, drawCount, stride);
+}
+
+GfxResult gfxRenderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder encoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    if (!encoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderMultiDrawIndirectCount(encoder, indirectBuffer, indirectOffset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+GfxResult gfxRenderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder encoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    if (!encoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderMultiDrawIndexedIndirectCount(encoder, indirectBuffer, indirectOffset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+GfxResult gfxRenderPassEncoderExecuteCommandStream(GfxRenderPassEncoder encoder, const GfxCommand* commands, uint32_t commandCount)
+{
+    if (!encoder || (commandCount > 0 && !commands)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderExecuteCommandStream(encoder, commands, commandCount);
+}
+
 GfxResult gfxRenderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex)
 {
     if (!renderPassEncoder || !querySet) {
@@ -1236,6 +1489,18 @@ GfxResult gfxRenderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder renderPassE
     return backend->renderPassEncoderEndOcclusionQuery(renderPassEncoder);
 }
 
+GfxResult gfxRenderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount)
+{
+    if (!renderPassEncoder || (bundleCount > 0 && !bundles)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderPassEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderPassEncoderExecuteBundles(renderPassEncoder, bundles, bundleCount);
+}
+
 GfxResult gfxRenderPassEncoderEnd(GfxRenderPassEncoder encoder)
 {
     if (!encoder) {
@@ -1276,6 +1541,18 @@ GfxResult gfxComputePassEncoderSetBindGroup(GfxComputePassEncoder encoder, uint3
     return backend->computePassEncoderSetBindGroup(encoder, groupIndex, bindGroup, dynamicOffsets, dynamicOffsetCount);
 }
 
+GfxResult gfxComputePassEncoderSetImmediateData(GfxComputePassEncoder encoder, uint32_t offset, const void* data, uint32_t size)
+{
+    if (!encoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(encoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->computePassEncoderSetImmediateData(encoder, offset, data, size);
+}
+
 GfxResult gfxComputePassEncoderDispatch(GfxComputePassEncoder encoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ)
 {
     if (!encoder) {
@@ -1312,6 +1589,137 @@ GfxResult gfxComputePassEncoderEnd(GfxComputePassEncoder encoder)
     return backend->computePassEncoderEnd(encoder);
 }
 
+// ============================================================================
+// RenderBundleEncoder Functions
+// ============================================================================
+
+DEVICE_CREATE_FUNC(RenderBundleEncoder, RenderBundleEncoder)
+
+DESTROY_FUNC(RenderBundleEncoder, renderBundleEncoder)
+
+GfxResult gfxRenderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderSetPipeline(renderBundleEncoder, pipeline);
+}
+
+GfxResult gfxRenderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderSetBindGroup(renderBundleEncoder, index, bindGroup, dynamicOffsets, dynamicOffsetCount);
+}
+
+GfxResult gfxRenderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderSetVertexBuffer(renderBundleEncoder, slot, buffer, offset, size);
+}
+
+GfxResult gfxRenderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderSetIndexBuffer(renderBundleEncoder, buffer, format, offset, size);
+}
+
+GfxResult gfxRenderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderSetViewport(renderBundleEncoder, viewport);
+}
+
+GfxResult gfxRenderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderSetScissorRect(renderBundleEncoder, scissor);
+}
+
+GfxResult gfxRenderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderDraw(renderBundleEncoder, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+GfxResult gfxRenderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+    return backend->renderBundleEncoderDrawIndexed(renderBundleEncoder, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+}
+
+GfxResult gfxRenderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle)
+{
+    if (!renderBundleEncoder || !outBundle) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = gfx::backend::BackendManager::instance().getBackend(renderBundleEncoder, &backendType);
+    if (!backend) {
+        return GFX_RESULT_ERROR_NOT_FOUND;
+    }
+
+    GfxRenderBundle nativeBundle = nullptr;
+    GfxResult result = backend->renderBundleEncoderFinish(renderBundleEncoder, &nativeBundle);
+    if (result != GFX_RESULT_SUCCESS) {
+        return result;
+    }
+
+    *outBundle = gfx::backend::BackendManager::instance().wrap(backendType, nativeBundle);
+    return GFX_RESULT_SUCCESS;
+}
+
+// ============================================================================
+// RenderBundle Functions
+// ============================================================================
+
+DESTROY_FUNC(RenderBundle, renderBundle)
+
 // ============================================================================
 // Fence Functions
 // ============================================================================
@@ -29,11 +29,20 @@ public:
     virtual GfxResult deviceGetQueue(GfxDevice device, GfxQueue* outQueue) const = 0;
     virtual GfxResult deviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, GfxQueue* outQueue) const = 0;
     virtual GfxResult deviceWaitIdle(GfxDevice device) const = 0;
+    virtual GfxResult devicePoll(GfxDevice device) const = 0;
     virtual GfxResult deviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits) const = 0;
+    virtual GfxResult deviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats) const = 0;
+    virtual GfxResult deviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data) const = 0;
+    virtual GfxResult deviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore) const = 0;
+    virtual GfxResult deviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue) const = 0;
+    virtual GfxResult deviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue) const = 0;
     virtual GfxResult deviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported) const = 0;
+    virtual GfxResult deviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable) const = 0;
 
     // Queue functions
     virtual GfxResult queueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor) const = 0;
+    virtual GfxResult queueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount) const = 0;
+    virtual GfxResult queueFlush(GfxQueue queue) const = 0;
     virtual GfxResult queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const = 0;
     virtual GfxResult queueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout) const = 0;
     virtual GfxResult queueWaitIdle(GfxQueue queue) const = 0;
@@ -61,6 +70,7 @@ public:
     virtual GfxResult bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo) const = 0;
     virtual GfxResult bufferGetNativeHandle(GfxBuffer buffer, void** outHandle) const = 0;
     virtual GfxResult bufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void** outMappedPointer) const = 0;
+    virtual GfxResult bufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer) const = 0;
     virtual GfxResult bufferUnmap(GfxBuffer buffer) const = 0;
     virtual GfxResult bufferFlushMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const = 0;
     virtual GfxResult bufferInvalidateMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const = 0;
@@ -95,10 +105,12 @@ public:
 
     // RenderPipeline functions
     virtual GfxResult deviceCreateRenderPipeline(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxRenderPipeline* outPipeline) const = 0;
+    virtual GfxResult deviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback, void* userData) const = 0;
     virtual GfxResult renderPipelineDestroy(GfxRenderPipeline renderPipeline) const = 0;
 
     // ComputePipeline functions
     virtual GfxResult deviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline) const = 0;
+    virtual GfxResult deviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData) const = 0;
     virtual GfxResult computePipelineDestroy(GfxComputePipeline computePipeline) const = 0;
 
     // RenderPass functions
@@ -126,6 +138,7 @@ public:
     virtual GfxResult commandEncoderResolveQuerySet(GfxCommandEncoder commandEncoder, GfxQuerySet querySet, uint32_t firstQuery, uint32_t queryCount, GfxBuffer destinationBuffer, uint64_t destinationOffset) const = 0;
     virtual GfxResult commandEncoderEnd(GfxCommandEncoder commandEncoder) const = 0;
     virtual GfxResult commandEncoderBegin(GfxCommandEncoder commandEncoder) const = 0;
+    virtual GfxResult commandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats) const = 0;
 
     // RenderPassEncoder functions
     virtual GfxResult renderPassEncoderSetPipeline(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline) const = 0;
@@ -134,21 +147,45 @@ public:
     virtual GfxResult renderPassEncoderSetIndexBuffer(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const = 0;
     virtual GfxResult renderPassEncoderSetViewport(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport) const = 0;
     virtual GfxResult renderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor) const = 0;
+    virtual GfxResult renderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size) const = 0;
     virtual GfxResult renderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const = 0;
     virtual GfxResult renderPassEncoderDrawIndexed(GfxRenderPassEncoder renderPassEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const = 0;
     virtual GfxResult renderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const = 0;
     virtual GfxResult renderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const = 0;
+    virtual GfxResult renderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const = 0;
+    virtual GfxResult renderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const = 0;
+    virtual GfxResult renderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const = 0;
+    virtual GfxResult renderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const = 0;
+    virtual GfxResult renderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount) const = 0;
     virtual GfxResult renderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex) const = 0;
     virtual GfxResult renderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder renderPassEncoder) const = 0;
+    virtual GfxResult renderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount) const = 0;
     virtual GfxResult renderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder) const = 0;
 
     // ComputePassEncoder functions
     virtual GfxResult computePassEncoderSetPipeline(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline) const = 0;
     virtual GfxResult computePassEncoderSetBindGroup(GfxComputePassEncoder computePassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const = 0;
+    virtual GfxResult computePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size) const = 0;
     virtual GfxResult computePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ) const = 0;
     virtual GfxResult computePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const = 0;
     virtual GfxResult computePassEncoderEnd(GfxComputePassEncoder computePassEncoder) const = 0;
 
+    // RenderBundleEncoder functions
+    virtual GfxResult deviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder) const = 0;
+    virtual GfxResult renderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder) const = 0;
+    virtual GfxResult renderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline) const = 0;
+    virtual GfxResult renderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const = 0;
+    virtual GfxResult renderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size) const = 0;
+    virtual GfxResult renderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const = 0;
+    virtual GfxResult renderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport) const = 0;
+    virtual GfxResult renderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor) const = 0;
+    virtual GfxResult renderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const = 0;
+    virtual GfxResult renderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const = 0;
+    virtual GfxResult renderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle) const = 0;
+
+    // RenderBundle functions
+    virtual GfxResult renderBundleDestroy(GfxRenderBundle renderBundle) const = 0;
+
     // Fence functions
     virtual GfxResult deviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence) const = 0;
     virtual GfxResult fenceDestroy(GfxFence fence) const = 0;
@@ -10,23 +10,38 @@ BackendManager& BackendManager::instance()
 
 std::shared_ptr<const IBackend> BackendManager::getBackend(GfxBackend backend)
 {
-    if (backend >= 0 && backend < GFX_BACKEND_AUTO) {
-        return m_backends[backend];
+    if (backend < 0 || backend >= GFX_BACKEND_AUTO) {
+        return nullptr;
     }
-    return nullptr;
+    SCOPED_LOCK(m_backendMutex);
+    return m_backends[backend];
 }
 
-std::shared_ptr<const IBackend> BackendManager::getBackend(void* handle)
+#ifndef GFX_STATIC_BACKEND_TYPE
+const IBackend* BackendManager::getBackend(void* handle, GfxBackend* outBackendType)
 {
     if (!handle) {
         return nullptr;
     }
-    SCOPED_LOCK(m_mutex);
-    auto it = m_handles.find(handle);
-    if (it == m_handles.end()) {
+
+    GfxBackend backend = GFX_BACKEND_AUTO;
+    {
+        HandleShard& shard = shardFor(handle);
+        SCOPED_SHARED_LOCK(shard.mutex);
+        auto it = shard.handles.find(handle);
+        if (it == shard.handles.end()) {
+            return nullptr;
+        }
+        backend = it->second.backend;
+    }
+
+    if (backend < 0 || backend >= GFX_BACKEND_AUTO) {
         return nullptr;
     }
-    return getBackend(it->second.backend);
+    if (outBackendType) {
+        *outBackendType = backend;
+    }
+    return m_backendPointers[backend].load(std::memory_order_acquire);
 }
 
 GfxBackend BackendManager::getBackendType(void* handle)
@@ -34,9 +49,10 @@ GfxBackend BackendManager::getBackendType(void* handle)
     if (!handle) {
         return GFX_BACKEND_AUTO;
     }
-    SCOPED_LOCK(m_mutex);
-    auto it = m_handles.find(handle);
-    if (it == m_handles.end()) {
+    HandleShard& shard = shardFor(handle);
+    SCOPED_SHARED_LOCK(shard.mutex);
+    auto it = shard.handles.find(handle);
+    if (it == shard.handles.end()) {
         return GFX_BACKEND_AUTO;
     }
     return it->second.backend;
@@ -47,9 +63,11 @@ void BackendManager::unwrap(void* handle)
     if (!handle) {
         return;
     }
-    SCOPED_LOCK(m_mutex);
-    m_handles.erase(handle);
+    HandleShard& shard = shardFor(handle);
+    SCOPED_LOCK(shard.mutex);
+    shard.handles.erase(handle);
 }
+#endif
 
 bool BackendManager::loadBackend(GfxBackend backend, std::unique_ptr<const IBackend> backendImpl)
 {
@@ -57,10 +75,17 @@ bool BackendManager::loadBackend(GfxBackend backend, std::unique_ptr<const IBack
         return false;
     }
 
-    SCOPED_LOCK(m_mutex);
+    SCOPED_LOCK(m_backendMutex);
     if (!m_backends[backend]) {
         // Convert unique_ptr to shared_ptr for storage and reference counting
         m_backends[backend] = std::move(backendImpl);
+#ifdef GFX_STATIC_BACKEND_TYPE
+        if (backend == GFX_STATIC_BACKEND_TYPE) {
+            m_staticBackend.store(dynamic_cast<const StaticBackend*>(m_backends[backend].get()), std::memory_order_release);
+        }
+#else
+        m_backendPointers[backend].store(m_backends[backend].get(), std::memory_order_release);
+#endif
     }
     return true;
 }
@@ -71,7 +96,15 @@ void BackendManager::unloadBackend(GfxBackend backend)
         return;
     }
 
-    SCOPED_LOCK(m_mutex);
+    SCOPED_LOCK(m_backendMutex);
+    // Unpublish first so handle lookups stop handing out the pointer being released
+#ifdef GFX_STATIC_BACKEND_TYPE
+    if (backend == GFX_STATIC_BACKEND_TYPE) {
+        m_staticBackend.store(nullptr, std::memory_order_release);
+    }
+#else
+    m_backendPointers[backend].store(nullptr, std::memory_order_release);
+#endif
     // Simply reset the shared_ptr - it will automatically delete when ref count reaches 0
     m_backends[backend].reset();
 }
@@ -5,9 +5,22 @@
 
 #include "IBackend.h"
 
+// Static single-backend build: the C API binds directly to the one compiled-in backend
+#if defined(GFX_STATIC_BACKEND_VULKAN)
+#include "vulkan/Backend.h"
+#define GFX_STATIC_BACKEND_TYPE GFX_BACKEND_VULKAN
+#elif defined(GFX_STATIC_BACKEND_WEBGPU)
+#include "webgpu/Backend.h"
+#define GFX_STATIC_BACKEND_TYPE GFX_BACKEND_WEBGPU
+#endif
+
 #ifndef GFX_HAS_EMSCRIPTEN
 #include <mutex>
+#include <shared_mutex>
 #endif
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 
@@ -21,10 +34,20 @@ struct NoOpLock {
 };
 struct NoOpMutex {};
 #define SCOPED_LOCK(mutex) NoOpLock _lock(mutex)
+#define SCOPED_SHARED_LOCK(mutex) NoOpLock _lock(mutex)
 using Mutex = NoOpMutex;
+using SharedMutex = NoOpMutex;
 #else
 #define SCOPED_LOCK(mutex) std::scoped_lock _lock(mutex)
+#define SCOPED_SHARED_LOCK(mutex) std::shared_lock _lock(mutex)
 using Mutex = std::mutex;
+using SharedMutex = std::shared_mutex;
+#endif
+
+#if defined(GFX_STATIC_BACKEND_VULKAN)
+using StaticBackend = vulkan::Backend;
+#elif defined(GFX_STATIC_BACKEND_WEBGPU)
+using StaticBackend = webgpu::Backend;
 #endif
 
 // Handle metadata stores backend info
@@ -34,6 +57,12 @@ struct HandleMeta {
 };
 
 // Singleton class to manage backend state
+//
+// Handle lookups happen on every C API call, so the handle table is split into
+// independently locked shards selected by a hash of the handle address. Lookups
+// only take a shared (reader) lock on a single shard, which means threads that
+// record into different encoders never contend on the same lock; wrap/unwrap
+// (object creation/destruction) are the only writers.
 class BackendManager {
 public:
     static BackendManager& instance();
@@ -45,7 +74,40 @@ public:
     BackendManager& operator=(BackendManager&&) = delete;
 
     std::shared_ptr<const IBackend> getBackend(GfxBackend backend);
-    std::shared_ptr<const IBackend> getBackend(void* handle);
+
+#ifdef GFX_STATIC_BACKEND_TYPE
+    // Static single-backend build: every handle belongs to the compiled-in backend, so there is
+    // no handle table at all. The returned type is the concrete (final) backend class, which
+    // lets the compiler devirtualize and inline the call chain down to the component.
+    const StaticBackend* getBackend(void* handle, GfxBackend* outBackendType = nullptr)
+    {
+        const StaticBackend* staticBackend = m_staticBackend.load(std::memory_order_acquire);
+        if (!handle || !staticBackend) {
+            return nullptr;
+        }
+        if (outBackendType) {
+            *outBackendType = GFX_STATIC_BACKEND_TYPE;
+        }
+        return staticBackend;
+    }
+
+    template <typename T>
+    T wrap(GfxBackend, T nativeHandle)
+    {
+        return nativeHandle;
+    }
+
+    void unwrap(void*) {}
+
+    GfxBackend getBackendType(void* handle)
+    {
+        return handle && m_staticBackend.load(std::memory_order_acquire) ? GFX_STATIC_BACKEND_TYPE : GFX_BACKEND_AUTO;
+    }
+#else
+    // Hot path: returns a non-owning pointer so no reference count is touched per call.
+    // The backend stays alive as long as objects created from it exist.
+    // If outBackendType is provided, it receives the handle's backend type from the same lookup.
+    const IBackend* getBackend(void* handle, GfxBackend* outBackendType = nullptr);
 
     template <typename T>
     T wrap(GfxBackend backend, T nativeHandle)
@@ -53,13 +115,15 @@ public:
         if (!nativeHandle) {
             return nullptr;
         }
-        SCOPED_LOCK(m_mutex);
-        m_handles[nativeHandle] = { backend, nativeHandle };
+        HandleShard& shard = shardFor(nativeHandle);
+        SCOPED_LOCK(shard.mutex);
+        shard.handles[nativeHandle] = { backend, nativeHandle };
         return nativeHandle;
     }
 
     void unwrap(void* handle);
     GfxBackend getBackendType(void* handle);
+#endif
 
     // Backend loading/unloading with automatic reference counting via shared_ptr
     bool loadBackend(GfxBackend backend, std::unique_ptr<const IBackend> backendImpl);
@@ -69,11 +133,48 @@ private:
     BackendManager();
     ~BackendManager() = default;
 
+#ifdef GFX_STATIC_BACKEND_TYPE
+    std::atomic<const StaticBackend*> m_staticBackend{ nullptr };
+#else
+    // Must be a power of two
+    static constexpr size_t HANDLE_SHARD_COUNT = 64;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Aligned so neighbouring shard locks never share a cache line
+    struct alignas(CACHE_LINE_SIZE) HandleShard {
+        SharedMutex mutex;
+        std::unordered_map<void*, HandleMeta> handles;
+    };
+
+    static size_t shardIndex(const void* handle)
+    {
+        // Object addresses are at least 8/16-byte aligned, so mix the high bits down before
+        // masking off the low bits
+        uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return static_cast<size_t>(key & (HANDLE_SHARD_COUNT - 1));
+    }
+
+    HandleShard& shardFor(const void* handle)
+    {
+        return m_handleShards[shardIndex(handle)];
+    }
+#endif
+
+    // Owning table, guarded by m_backendMutex
     std::shared_ptr<const IBackend> m_backends[GFX_BACKEND_AUTO];
-    Mutex m_mutex;
-    std::unordered_map<void*, HandleMeta> m_handles;
+    Mutex m_backendMutex;
+#ifndef GFX_STATIC_BACKEND_TYPE
+    // Published copies of m_backends for handle lookups, which must not take m_backendMutex
+    std::atomic<const IBackend*> m_backendPointers[GFX_BACKEND_AUTO] = {};
+#endif
+#ifndef GFX_STATIC_BACKEND_TYPE
+    HandleShard m_handleShards[HANDLE_SHARD_COUNT];
+#endif
 };
 
 } // namespace gfx::backend
 
-#endif // GFX_BACKEND_MANAGER_H
\ No newline at end of file
+#endif // GFX_MANAGER_H
@@ -80,22 +80,67 @@ GfxResult Backend::deviceWaitIdle(GfxDevice device) const
     return m_systemComponent.deviceWaitIdle(device);
 }
 
+GfxResult Backend::devicePoll(GfxDevice device) const
+{
+    return m_systemComponent.devicePoll(device);
+}
+
 GfxResult Backend::deviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits) const
 {
     return m_systemComponent.deviceGetLimits(device, outLimits);
 }
 
+GfxResult Backend::deviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats) const
+{
+    return m_systemComponent.deviceGetMemoryStats(device, outStats);
+}
+
+GfxResult Backend::deviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data) const
+{
+    return m_systemComponent.deviceGetPipelineCacheData(device, dataSize, data);
+}
+
+GfxResult Backend::deviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore) const
+{
+    return m_systemComponent.deviceGetUploadSemaphore(device, outSemaphore);
+}
+
+GfxResult Backend::deviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue) const
+{
+    return m_systemComponent.deviceUploadBuffer(device, buffer, offset, data, size, outSignalValue);
+}
+
+GfxResult Backend::deviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue) const
+{
+    return m_systemComponent.deviceUploadTexture(device, texture, origin, extent, mipLevel, data, dataSize, finalLayout, outSignalValue);
+}
+
 GfxResult Backend::deviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported) const
 {
     return m_systemComponent.deviceSupportsShaderFormat(device, format, outSupported);
 }
 
+GfxResult Backend::deviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable) const
+{
+    return m_commandComponent.deviceGetProcTable(device, outProcTable);
+}
+
 // Queue functions
 GfxResult Backend::queueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor) const
 {
     return m_systemComponent.queueSubmit(queue, submitDescriptor);
 }
 
+GfxResult Backend::queueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount) const
+{
+    return m_systemComponent.queueSubmitBatch(queue, submitDescriptors, submitCount);
+}
+
+GfxResult Backend::queueFlush(GfxQueue queue) const
+{
+    return m_systemComponent.queueFlush(queue);
+}
+
 GfxResult Backend::queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const
 {
     return m_systemComponent.queueWriteBuffer(queue, buffer, offset, data, size);
@@ -203,6 +248,11 @@ GfxResult Backend::bufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, v
     return m_resourceComponent.bufferMap(buffer, offset, size, outMappedPointer);
 }
 
+GfxResult Backend::bufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer) const
+{
+    return m_resourceComponent.bufferGetMappedPointer(buffer, outMappedPointer);
+}
+
 GfxResult Backend::bufferUnmap(GfxBuffer buffer) const
 {
     return m_resourceComponent.bufferUnmap(buffer);
@@ -310,6 +360,11 @@ GfxResult Backend::deviceCreateRenderPipeline(GfxDevice device, const GfxRenderP
     return m_renderComponent.deviceCreateRenderPipeline(device, descriptor, outPipeline);
 }
 
+GfxResult Backend::deviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback, void* userData) const
+{
+    return m_renderComponent.deviceCreateRenderPipelineAsync(device, descriptor, callback, userData);
+}
+
 GfxResult Backend::renderPipelineDestroy(GfxRenderPipeline renderPipeline) const
 {
     return m_renderComponent.renderPipelineDestroy(renderPipeline);
@@ -321,6 +376,11 @@ GfxResult Backend::deviceCreateComputePipeline(GfxDevice device, const GfxComput
     return m_computeComponent.deviceCreateComputePipeline(device, descriptor, outPipeline);
 }
 
+GfxResult Backend::deviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData) const
+{
+    return m_computeComponent.deviceCreateComputePipelineAsync(device, descriptor, callback, userData);
+}
+
 GfxResult Backend::computePipelineDestroy(GfxComputePipeline computePipeline) const
 {
     return m_computeComponent.computePipelineDestroy(computePipeline);
@@ -440,6 +500,11 @@ GfxResult Backend::commandEncoderBegin(GfxCommandEncoder commandEncoder) const
     return m_commandComponent.commandEncoderBegin(commandEncoder);
 }
 
+GfxResult Backend::commandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats) const
+{
+    return m_commandComponent.commandEncoderGetStats(commandEncoder, outStats);
+}
+
 // RenderPassEncoder functions
 GfxResult Backend::renderPassEncoderSetPipeline(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline) const
 {
@@ -471,6 +536,11 @@ GfxResult Backend::renderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPa
     return m_commandComponent.renderPassEncoderSetScissorRect(renderPassEncoder, scissor);
 }
 
+GfxResult Backend::renderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size) const
+{
+    return m_commandComponent.renderPassEncoderSetImmediateData(renderPassEncoder, offset, data, size);
+}
+
 GfxResult Backend::renderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
 {
     return m_commandComponent.renderPassEncoderDraw(renderPassEncoder, vertexCount, instanceCount, firstVertex, firstInstance);
@@ -491,6 +561,31 @@ GfxResult Backend::renderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder ren
     return m_commandComponent.renderPassEncoderDrawIndexedIndirect(renderPassEncoder, indirectBuffer, indirectOffset);
 }
 
+GfxResult Backend::renderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const
+{
+    return m_commandComponent.renderPassEncoderMultiDrawIndirect(renderPassEncoder, indirectBuffer, indirectOffset, drawCount, stride);
+}
+
+GfxResult Backend::renderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const
+{
+    return m_commandComponent.renderPassEncoderMultiDrawIndexedIndirect(renderPassEncoder, indirectBuffer, indirectOffset, drawCount, stride);
+}
+
+GfxResult Backend::renderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+    return m_commandComponent.renderPassEncoderMultiDrawIndirectCount(renderPassEncoder, indirectBuffer, indirectOffset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+GfxResult Backend::renderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+    return m_commandComponent.renderPassEncoderMultiDrawIndexedIndirectCount(renderPassEncoder, indirectBuffer, indirectOffset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+GfxResult Backend::renderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount) const
+{
+    return m_commandComponent.renderPassEncoderExecuteCommandStream(renderPassEncoder, commands, commandCount);
+}
+
 GfxResult Backend::renderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex) const
 {
     return m_commandComponent.renderPassEncoderBeginOcclusionQuery(renderPassEncoder, querySet, queryIndex);
@@ -501,6 +596,11 @@ GfxResult Backend::renderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder rende
     return m_commandComponent.renderPassEncoderEndOcclusionQuery(renderPassEncoder);
 }
 
+GfxResult Backend::renderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount) const
+{
+    return m_commandComponent.renderPassEncoderExecuteBundles(renderPassEncoder, bundles, bundleCount);
+}
+
 GfxResult Backend::renderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder) const
 {
     return m_commandComponent.renderPassEncoderEnd(renderPassEncoder);
@@ -517,6 +617,11 @@ GfxResult Backend::computePassEncoderSetBindGroup(GfxComputePassEncoder computeP
     return m_commandComponent.computePassEncoderSetBindGroup(computePassEncoder, index, bindGroup, dynamicOffsets, dynamicOffsetCount);
 }
 
+GfxResult Backend::computePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size) const
+{
+    return m_commandComponent.computePassEncoderSetImmediateData(computePassEncoder, offset, data, size);
+}
+
 GfxResult Backend::computePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ) const
 {
     return m_commandComponent.computePassEncoderDispatch(computePassEncoder, workgroupCountX, workgroupCountY, workgroupCountZ);
@@ -532,6 +637,68 @@ GfxResult Backend::computePassEncoderEnd(GfxComputePassEncoder computePassEncode
     return m_commandComponent.computePassEncoderEnd(computePassEncoder);
 }
 
+// RenderBundleEncoder functions
+GfxResult Backend::deviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder) const
+{
+    return m_commandComponent.deviceCreateRenderBundleEncoder(device, descriptor, outEncoder);
+}
+
+GfxResult Backend::renderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder) const
+{
+    return m_commandComponent.renderBundleEncoderDestroy(renderBundleEncoder);
+}
+
+GfxResult Backend::renderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline) const
+{
+    return m_commandComponent.renderBundleEncoderSetPipeline(renderBundleEncoder, pipeline);
+}
+
+GfxResult Backend::renderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const
+{
+    return m_commandComponent.renderBundleEncoderSetBindGroup(renderBundleEncoder, index, bindGroup, dynamicOffsets, dynamicOffsetCount);
+}
+
+GfxResult Backend::renderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size) const
+{
+    return m_commandComponent.renderBundleEncoderSetVertexBuffer(renderBundleEncoder, slot, buffer, offset, size);
+}
+
+GfxResult Backend::renderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const
+{
+    return m_commandComponent.renderBundleEncoderSetIndexBuffer(renderBundleEncoder, buffer, format, offset, size);
+}
+
+GfxResult Backend::renderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport) const
+{
+    return m_commandComponent.renderBundleEncoderSetViewport(renderBundleEncoder, viewport);
+}
+
+GfxResult Backend::renderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor) const
+{
+    return m_commandComponent.renderBundleEncoderSetScissorRect(renderBundleEncoder, scissor);
+}
+
+GfxResult Backend::renderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+{
+    return m_commandComponent.renderBundleEncoderDraw(renderBundleEncoder, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+GfxResult Backend::renderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const
+{
+    return m_commandComponent.renderBundleEncoderDrawIndexed(renderBundleEncoder, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+}
+
+GfxResult Backend::renderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle) const
+{
+    return m_commandComponent.renderBundleEncoderFinish(renderBundleEncoder, outBundle);
+}
+
+// RenderBundle functions
+GfxResult Backend::renderBundleDestroy(GfxRenderBundle renderBundle) const
+{
+    return m_commandComponent.renderBundleDestroy(renderBundle);
+}
+
 // Fence functions
 GfxResult Backend::deviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence) const
 {
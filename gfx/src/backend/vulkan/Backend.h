@@ -16,7 +16,7 @@
 namespace gfx::backend::vulkan {
 
 // Vulkan backend implementation
-class Backend : public IBackend {
+class Backend final : public IBackend {
 public:
     // Instance functions
     GfxResult createInstance(const GfxInstanceDescriptor* descriptor, GfxInstance* outInstance) const override;
@@ -38,11 +38,20 @@ public:
     GfxResult deviceGetQueue(GfxDevice device, GfxQueue* outQueue) const override;
     GfxResult deviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, GfxQueue* outQueue) const override;
     GfxResult deviceWaitIdle(GfxDevice device) const override;
+    GfxResult devicePoll(GfxDevice device) const override;
     GfxResult deviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits) const override;
+    GfxResult deviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats) const override;
+    GfxResult deviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data) const override;
+    GfxResult deviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore) const override;
+    GfxResult deviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue) const override;
+    GfxResult deviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue) const override;
     GfxResult deviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported) const override;
+    GfxResult deviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable) const override;
 
     // Queue functions
     GfxResult queueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor) const override;
+    GfxResult queueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount) const override;
+    GfxResult queueFlush(GfxQueue queue) const override;
     GfxResult queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const override;
     GfxResult queueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout) const override;
     GfxResult queueWaitIdle(GfxQueue queue) const override;
@@ -70,6 +79,7 @@ public:
     GfxResult bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo) const override;
     GfxResult bufferGetNativeHandle(GfxBuffer buffer, void** outHandle) const override;
     GfxResult bufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void** outMappedPointer) const override;
+    GfxResult bufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer) const override;
     GfxResult bufferUnmap(GfxBuffer buffer) const override;
     GfxResult bufferFlushMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const override;
     GfxResult bufferInvalidateMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const override;
@@ -104,10 +114,12 @@ public:
 
     // RenderPipeline functions
     GfxResult deviceCreateRenderPipeline(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxRenderPipeline* outPipeline) const override;
+    GfxResult deviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback, void* userData) const override;
     GfxResult renderPipelineDestroy(GfxRenderPipeline renderPipeline) const override;
 
     // ComputePipeline functions
     GfxResult deviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline) const override;
+    GfxResult deviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData) const override;
     GfxResult computePipelineDestroy(GfxComputePipeline computePipeline) const override;
 
     // RenderPass functions
@@ -135,6 +147,7 @@ public:
     GfxResult commandEncoderResolveQuerySet(GfxCommandEncoder commandEncoder, GfxQuerySet querySet, uint32_t firstQuery, uint32_t queryCount, GfxBuffer destinationBuffer, uint64_t destinationOffset) const override;
     GfxResult commandEncoderEnd(GfxCommandEncoder commandEncoder) const override;
     GfxResult commandEncoderBegin(GfxCommandEncoder commandEncoder) const override;
+    GfxResult commandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats) const override;
 
     // RenderPassEncoder functions
     GfxResult renderPassEncoderSetPipeline(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline) const override;
@@ -143,21 +156,45 @@ public:
     GfxResult renderPassEncoderSetIndexBuffer(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const override;
     GfxResult renderPassEncoderSetViewport(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport) const override;
     GfxResult renderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor) const override;
+    GfxResult renderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size) const override;
     GfxResult renderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const override;
     GfxResult renderPassEncoderDrawIndexed(GfxRenderPassEncoder renderPassEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const override;
     GfxResult renderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const override;
     GfxResult renderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const override;
+    GfxResult renderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const override;
+    GfxResult renderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const override;
+    GfxResult renderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const override;
+    GfxResult renderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const override;
+    GfxResult renderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount) const override;
     GfxResult renderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex) const override;
     GfxResult renderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder renderPassEncoder) const override;
+    GfxResult renderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount) const override;
     GfxResult renderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder) const override;
 
     // ComputePassEncoder functions
     GfxResult computePassEncoderSetPipeline(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline) const override;
     GfxResult computePassEncoderSetBindGroup(GfxComputePassEncoder computePassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const override;
+    GfxResult computePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size) const override;
     GfxResult computePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ) const override;
     GfxResult computePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const override;
     GfxResult computePassEncoderEnd(GfxComputePassEncoder computePassEncoder) const override;
 
+    // RenderBundleEncoder functions
+    GfxResult deviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder) const override;
+    GfxResult renderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder) const override;
+    GfxResult renderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline) const override;
+    GfxResult renderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const override;
+    GfxResult renderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size) const override;
+    GfxResult renderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const override;
+    GfxResult renderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport) const override;
+    GfxResult renderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor) const override;
+    GfxResult renderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const override;
+    GfxResult renderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const override;
+    GfxResult renderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle) const override;
+
+    // RenderBundle functions
+    GfxResult renderBundleDestroy(GfxRenderBundle renderBundle) const override;
+
     // Fence functions
     GfxResult deviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence) const override;
     GfxResult fenceDestroy(GfxFence fence) const override;
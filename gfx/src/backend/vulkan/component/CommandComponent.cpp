@@ -1,4 +1,5 @@
 #include "CommandComponent.h"
+#include "SystemComponent.h"
 
 #include "common/Logger.h"
 
@@ -8,6 +9,8 @@
 
 #include "backend/vulkan/core/command/CommandEncoder.h"
 #include "backend/vulkan/core/command/ComputePassEncoder.h"
+#include "backend/vulkan/core/command/RenderBundle.h"
+#include "backend/vulkan/core/command/RenderBundleEncoder.h"
 #include "backend/vulkan/core/command/RenderPassEncoder.h"
 #include "backend/vulkan/core/compute/ComputePipeline.h"
 #include "backend/vulkan/core/query/QuerySet.h"
@@ -20,16 +23,160 @@
 #include "backend/vulkan/core/system/Device.h"
 
 #include <stdexcept>
+#include <vector>
 
 namespace gfx::backend::vulkan::component {
 
+namespace {
+    // Components are stateless, so proc table entries share one instance of each
+    const CommandComponent s_commandComponent{};
+    const SystemComponent s_systemComponent{};
+
+    GfxResult procQueueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor)
+    {
+        return s_systemComponent.queueSubmit(queue, submitDescriptor);
+    }
+
+    GfxResult procQueueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size)
+    {
+        return s_systemComponent.queueWriteBuffer(queue, buffer, offset, data, size);
+    }
+
+    GfxResult procCommandEncoderBegin(GfxCommandEncoder commandEncoder)
+    {
+        return s_commandComponent.commandEncoderBegin(commandEncoder);
+    }
+
+    GfxResult procCommandEncoderEnd(GfxCommandEncoder commandEncoder)
+    {
+        return s_commandComponent.commandEncoderEnd(commandEncoder);
+    }
+
+    GfxResult procCommandEncoderCopyBufferToBuffer(GfxCommandEncoder commandEncoder, const GfxCopyBufferToBufferDescriptor* descriptor)
+    {
+        return s_commandComponent.commandEncoderCopyBufferToBuffer(commandEncoder, descriptor);
+    }
+
+    GfxResult procCommandEncoderPipelineBarrier(GfxCommandEncoder commandEncoder, const GfxPipelineBarrierDescriptor* descriptor)
+    {
+        return s_commandComponent.commandEncoderPipelineBarrier(commandEncoder, descriptor);
+    }
+
+    GfxResult procRenderPassEncoderSetPipeline(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline)
+    {
+        return s_commandComponent.renderPassEncoderSetPipeline(renderPassEncoder, pipeline);
+    }
+
+    GfxResult procRenderPassEncoderSetBindGroup(GfxRenderPassEncoder renderPassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+    {
+        return s_commandComponent.renderPassEncoderSetBindGroup(renderPassEncoder, index, bindGroup, dynamicOffsets, dynamicOffsetCount);
+    }
+
+    GfxResult procRenderPassEncoderSetVertexBuffer(GfxRenderPassEncoder renderPassEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size)
+    {
+        return s_commandComponent.renderPassEncoderSetVertexBuffer(renderPassEncoder, slot, buffer, offset, size);
+    }
+
+    GfxResult procRenderPassEncoderSetIndexBuffer(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size)
+    {
+        return s_commandComponent.renderPassEncoderSetIndexBuffer(renderPassEncoder, buffer, format, offset, size);
+    }
+
+    GfxResult procRenderPassEncoderSetViewport(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport)
+    {
+        return s_commandComponent.renderPassEncoderSetViewport(renderPassEncoder, viewport);
+    }
+
+    GfxResult procRenderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor)
+    {
+        return s_commandComponent.renderPassEncoderSetScissorRect(renderPassEncoder, scissor);
+    }
+
+    GfxResult procRenderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+    {
+        return s_commandComponent.renderPassEncoderDraw(renderPassEncoder, vertexCount, instanceCount, firstVertex, firstInstance);
+    }
+
+    GfxResult procRenderPassEncoderDrawIndexed(GfxRenderPassEncoder renderPassEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance)
+    {
+        return s_commandComponent.renderPassEncoderDrawIndexed(renderPassEncoder, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+    }
+
+    GfxResult procRenderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset)
+    {
+        return s_commandComponent.renderPassEncoderDrawIndirect(renderPassEncoder, indirectBuffer, indirectOffset);
+    }
+
+    GfxResult procRenderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset)
+    {
+        return s_commandComponent.renderPassEncoderDrawIndexedIndirect(renderPassEncoder, indirectBuffer, indirectOffset);
+    }
+
+    GfxResult procRenderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder)
+    {
+        return s_commandComponent.renderPassEncoderEnd(renderPassEncoder);
+    }
+
+    GfxResult procComputePassEncoderSetPipeline(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline)
+    {
+        return s_commandComponent.computePassEncoderSetPipeline(computePassEncoder, pipeline);
+    }
+
+    GfxResult procComputePassEncoderSetBindGroup(GfxComputePassEncoder computePassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+    {
+        return s_commandComponent.computePassEncoderSetBindGroup(computePassEncoder, index, bindGroup, dynamicOffsets, dynamicOffsetCount);
+    }
+
+    GfxResult procComputePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ)
+    {
+        return s_commandComponent.computePassEncoderDispatch(computePassEncoder, workgroupCountX, workgroupCountY, workgroupCountZ);
+    }
+
+    GfxResult procComputePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset)
+    {
+        return s_commandComponent.computePassEncoderDispatchIndirect(computePassEncoder, indirectBuffer, indirectOffset);
+    }
+
+    GfxResult procComputePassEncoderEnd(GfxComputePassEncoder computePassEncoder)
+    {
+        return s_commandComponent.computePassEncoderEnd(computePassEncoder);
+    }
+} // anonymous namespace
+
+// Proc table
+GfxResult CommandComponent::deviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable) const
+{
+    GFX_VALIDATE(validator::validateDeviceGetProcTable(device, outProcTable));
+
+    outProcTable->queueSubmit = procQueueSubmit;
+    outProcTable->queueWriteBuffer = procQueueWriteBuffer;
+    outProcTable->commandEncoderBegin = procCommandEncoderBegin;
+    outProcTable->commandEncoderEnd = procCommandEncoderEnd;
+    outProcTable->commandEncoderCopyBufferToBuffer = procCommandEncoderCopyBufferToBuffer;
+    outProcTable->commandEncoderPipelineBarrier = procCommandEncoderPipelineBarrier;
+    outProcTable->renderPassEncoderSetPipeline = procRenderPassEncoderSetPipeline;
+    outProcTable->renderPassEncoderSetBindGroup = procRenderPassEncoderSetBindGroup;
+    outProcTable->renderPassEncoderSetVertexBuffer = procRenderPassEncoderSetVertexBuffer;
+    outProcTable->renderPassEncoderSetIndexBuffer = procRenderPassEncoderSetIndexBuffer;
+    outProcTable->renderPassEncoderSetViewport = procRenderPassEncoderSetViewport;
+    outProcTable->renderPassEncoderSetScissorRect = procRenderPassEncoderSetScissorRect;
+    outProcTable->renderPassEncoderDraw = procRenderPassEncoderDraw;
+    outProcTable->renderPassEncoderDrawIndexed = procRenderPassEncoderDrawIndexed;
+    outProcTable->renderPassEncoderDrawIndirect = procRenderPassEncoderDrawIndirect;
+    outProcTable->renderPassEncoderDrawIndexedIndirect = procRenderPassEncoderDrawIndexedIndirect;
+    outProcTable->renderPassEncoderEnd = procRenderPassEncoderEnd;
+    outProcTable->computePassEncoderSetPipeline = procComputePassEncoderSetPipeline;
+    outProcTable->computePassEncoderSetBindGroup = procComputePassEncoderSetBindGroup;
+    outProcTable->computePassEncoderDispatch = procComputePassEncoderDispatch;
+    outProcTable->computePassEncoderDispatchIndirect = procComputePassEncoderDispatchIndirect;
+    outProcTable->computePassEncoderEnd = procComputePassEncoderEnd;
+    return GFX_RESULT_SUCCESS;
+}
+
 // CommandEncoder functions
 GfxResult CommandComponent::deviceCreateCommandEncoder(GfxDevice device, const GfxCommandEncoderDescriptor* descriptor, GfxCommandEncoder* outEncoder) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateCommandEncoder(device, descriptor, outEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateCommandEncoder(device, descriptor, outEncoder));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -44,10 +191,7 @@ GfxResult CommandComponent::deviceCreateCommandEncoder(GfxDevice device, const G
 
 GfxResult CommandComponent::commandEncoderDestroy(GfxCommandEncoder commandEncoder) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderDestroy(commandEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderDestroy(commandEncoder));
 
     delete converter::toNative<core::CommandEncoder>(commandEncoder);
     return GFX_RESULT_SUCCESS;
@@ -55,10 +199,7 @@ GfxResult CommandComponent::commandEncoderDestroy(GfxCommandEncoder commandEncod
 
 GfxResult CommandComponent::commandEncoderBeginRenderPass(GfxCommandEncoder commandEncoder, const GfxRenderPassBeginDescriptor* beginDescriptor, GfxRenderPassEncoder* outRenderPass) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderBeginRenderPass(commandEncoder, beginDescriptor, outRenderPass);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderBeginRenderPass(commandEncoder, beginDescriptor, outRenderPass));
 
     auto* encoderPtr = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* renderPass = converter::toNative<core::RenderPass>(beginDescriptor->renderPass);
@@ -71,10 +212,7 @@ GfxResult CommandComponent::commandEncoderBeginRenderPass(GfxCommandEncoder comm
 
 GfxResult CommandComponent::commandEncoderBeginComputePass(GfxCommandEncoder commandEncoder, const GfxComputePassBeginDescriptor* beginDescriptor, GfxComputePassEncoder* outComputePass) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderBeginComputePass(commandEncoder, beginDescriptor, outComputePass);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderBeginComputePass(commandEncoder, beginDescriptor, outComputePass));
 
     auto* encoderPtr = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto createInfo = converter::gfxComputePassBeginDescriptorToCreateInfo(beginDescriptor);
@@ -85,10 +223,7 @@ GfxResult CommandComponent::commandEncoderBeginComputePass(GfxCommandEncoder com
 
 GfxResult CommandComponent::commandEncoderCopyBufferToBuffer(GfxCommandEncoder commandEncoder, const GfxCopyBufferToBufferDescriptor* descriptor) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderCopyBufferToBuffer(commandEncoder, descriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderCopyBufferToBuffer(commandEncoder, descriptor));
 
     auto* enc = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* srcBuf = converter::toNative<core::Buffer>(descriptor->source);
@@ -100,10 +235,7 @@ GfxResult CommandComponent::commandEncoderCopyBufferToBuffer(GfxCommandEncoder c
 
 GfxResult CommandComponent::commandEncoderCopyBufferToTexture(GfxCommandEncoder commandEncoder, const GfxCopyBufferToTextureDescriptor* descriptor) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderCopyBufferToTexture(commandEncoder, descriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderCopyBufferToTexture(commandEncoder, descriptor));
 
     auto* enc = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* srcBuf = converter::toNative<core::Buffer>(descriptor->source);
@@ -120,10 +252,7 @@ GfxResult CommandComponent::commandEncoderCopyBufferToTexture(GfxCommandEncoder
 
 GfxResult CommandComponent::commandEncoderCopyTextureToBuffer(GfxCommandEncoder commandEncoder, const GfxCopyTextureToBufferDescriptor* descriptor) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderCopyTextureToBuffer(commandEncoder, descriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderCopyTextureToBuffer(commandEncoder, descriptor));
 
     auto* enc = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* srcTex = converter::toNative<core::Texture>(descriptor->source);
@@ -140,10 +269,7 @@ GfxResult CommandComponent::commandEncoderCopyTextureToBuffer(GfxCommandEncoder
 
 GfxResult CommandComponent::commandEncoderCopyTextureToTexture(GfxCommandEncoder commandEncoder, const GfxCopyTextureToTextureDescriptor* descriptor) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderCopyTextureToTexture(commandEncoder, descriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderCopyTextureToTexture(commandEncoder, descriptor));
 
     auto* enc = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* srcTex = converter::toNative<core::Texture>(descriptor->source);
@@ -163,10 +289,7 @@ GfxResult CommandComponent::commandEncoderCopyTextureToTexture(GfxCommandEncoder
 
 GfxResult CommandComponent::commandEncoderBlitTextureToTexture(GfxCommandEncoder commandEncoder, const GfxBlitTextureToTextureDescriptor* descriptor) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderBlitTextureToTexture(commandEncoder, descriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderBlitTextureToTexture(commandEncoder, descriptor));
 
     auto* enc = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* srcTex = converter::toNative<core::Texture>(descriptor->source);
@@ -188,10 +311,7 @@ GfxResult CommandComponent::commandEncoderBlitTextureToTexture(GfxCommandEncoder
 
 GfxResult CommandComponent::commandEncoderPipelineBarrier(GfxCommandEncoder commandEncoder, const GfxPipelineBarrierDescriptor* descriptor) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderPipelineBarrier(commandEncoder, descriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderPipelineBarrier(commandEncoder, descriptor));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
 
@@ -223,10 +343,7 @@ GfxResult CommandComponent::commandEncoderPipelineBarrier(GfxCommandEncoder comm
 
 GfxResult CommandComponent::commandEncoderGenerateMipmaps(GfxCommandEncoder commandEncoder, GfxTexture texture) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderGenerateMipmaps(commandEncoder, texture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderGenerateMipmaps(commandEncoder, texture));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* tex = converter::toNative<core::Texture>(texture);
@@ -237,10 +354,7 @@ GfxResult CommandComponent::commandEncoderGenerateMipmaps(GfxCommandEncoder comm
 GfxResult CommandComponent::commandEncoderGenerateMipmapsRange(GfxCommandEncoder commandEncoder, GfxTexture texture,
     uint32_t baseMipLevel, uint32_t levelCount) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderGenerateMipmapsRange(commandEncoder, texture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderGenerateMipmapsRange(commandEncoder, texture));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* tex = converter::toNative<core::Texture>(texture);
@@ -250,10 +364,7 @@ GfxResult CommandComponent::commandEncoderGenerateMipmapsRange(GfxCommandEncoder
 
 GfxResult CommandComponent::commandEncoderWriteTimestamp(GfxCommandEncoder commandEncoder, GfxQuerySet querySet, uint32_t queryIndex) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderWriteTimestamp(commandEncoder, querySet);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderWriteTimestamp(commandEncoder, querySet));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* query = converter::toNative<core::QuerySet>(querySet);
@@ -263,10 +374,7 @@ GfxResult CommandComponent::commandEncoderWriteTimestamp(GfxCommandEncoder comma
 
 GfxResult CommandComponent::commandEncoderResolveQuerySet(GfxCommandEncoder commandEncoder, GfxQuerySet querySet, uint32_t firstQuery, uint32_t queryCount, GfxBuffer destinationBuffer, uint64_t destinationOffset) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderResolveQuerySet(commandEncoder, querySet, destinationBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderResolveQuerySet(commandEncoder, querySet, destinationBuffer));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
     auto* query = converter::toNative<core::QuerySet>(querySet);
@@ -277,10 +385,7 @@ GfxResult CommandComponent::commandEncoderResolveQuerySet(GfxCommandEncoder comm
 
 GfxResult CommandComponent::commandEncoderEnd(GfxCommandEncoder commandEncoder) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderEnd(commandEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderEnd(commandEncoder));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
     encoder->end();
@@ -289,25 +394,32 @@ GfxResult CommandComponent::commandEncoderEnd(GfxCommandEncoder commandEncoder)
 
 GfxResult CommandComponent::commandEncoderBegin(GfxCommandEncoder commandEncoder) const
 {
-    GfxResult validationResult = validator::validateCommandEncoderBegin(commandEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCommandEncoderBegin(commandEncoder));
 
     auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
     encoder->reset();
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult CommandComponent::commandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats) const
+{
+    GFX_VALIDATE(validator::validateCommandEncoderGetStats(commandEncoder, outStats));
+
+    auto* encoder = converter::toNative<core::CommandEncoder>(commandEncoder);
+    *outStats = {};
+    outStats->filteredCommandCount = encoder->filteredCommandCount();
+    return GFX_RESULT_SUCCESS;
+}
+
 // RenderPassEncoder functions
 GfxResult CommandComponent::renderPassEncoderSetPipeline(GfxRenderPassEncoder renderPassEncoder, GfxRenderPipeline pipeline) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderSetPipeline(renderPassEncoder, pipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetPipeline(renderPassEncoder, pipeline));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* pipe = converter::toNative<core::RenderPipeline>(pipeline);
     rpe->setPipeline(pipe);
     return GFX_RESULT_SUCCESS;
@@ -315,12 +427,12 @@ GfxResult CommandComponent::renderPassEncoderSetPipeline(GfxRenderPassEncoder re
 
 GfxResult CommandComponent::renderPassEncoderSetBindGroup(GfxRenderPassEncoder renderPassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderSetBindGroup(renderPassEncoder, bindGroup);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetBindGroup(renderPassEncoder, bindGroup));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* bg = converter::toNative<core::BindGroup>(bindGroup);
     rpe->setBindGroup(index, bg, dynamicOffsets, dynamicOffsetCount);
     return GFX_RESULT_SUCCESS;
@@ -328,12 +440,12 @@ GfxResult CommandComponent::renderPassEncoderSetBindGroup(GfxRenderPassEncoder r
 
 GfxResult CommandComponent::renderPassEncoderSetVertexBuffer(GfxRenderPassEncoder renderPassEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderSetVertexBuffer(renderPassEncoder, buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetVertexBuffer(renderPassEncoder, buffer));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* buf = converter::toNative<core::Buffer>(buffer);
     rpe->setVertexBuffer(slot, buf, offset);
 
@@ -343,12 +455,12 @@ GfxResult CommandComponent::renderPassEncoderSetVertexBuffer(GfxRenderPassEncode
 
 GfxResult CommandComponent::renderPassEncoderSetIndexBuffer(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderSetIndexBuffer(renderPassEncoder, buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetIndexBuffer(renderPassEncoder, buffer));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* buf = converter::toNative<core::Buffer>(buffer);
     VkIndexType indexType = converter::gfxIndexFormatToVkIndexType(format);
     rpe->setIndexBuffer(buf, indexType, offset);
@@ -359,10 +471,7 @@ GfxResult CommandComponent::renderPassEncoderSetIndexBuffer(GfxRenderPassEncoder
 
 GfxResult CommandComponent::renderPassEncoderSetViewport(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderSetViewport(renderPassEncoder, viewport);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetViewport(renderPassEncoder, viewport));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
     core::Viewport vkViewport = converter::gfxViewportToViewport(viewport);
@@ -372,10 +481,7 @@ GfxResult CommandComponent::renderPassEncoderSetViewport(GfxRenderPassEncoder re
 
 GfxResult CommandComponent::renderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderSetScissorRect(renderPassEncoder, scissor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetScissorRect(renderPassEncoder, scissor));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
     core::ScissorRect vkScissor = converter::gfxScissorRectToScissorRect(scissor);
@@ -383,38 +489,52 @@ GfxResult CommandComponent::renderPassEncoderSetScissorRect(GfxRenderPassEncoder
     return GFX_RESULT_SUCCESS;
 }
 
-GfxResult CommandComponent::renderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+GfxResult CommandComponent::renderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderDraw(renderPassEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateRenderPassEncoderSetImmediateData(renderPassEncoder, offset, data, size));
+
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    if (!rpe->setImmediateData(offset, data, size)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderDraw(renderPassEncoder));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     rpe->draw(vertexCount, instanceCount, firstVertex, firstInstance);
     return GFX_RESULT_SUCCESS;
 }
 
 GfxResult CommandComponent::renderPassEncoderDrawIndexed(GfxRenderPassEncoder renderPassEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderDrawIndexed(renderPassEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderDrawIndexed(renderPassEncoder));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     rpe->drawIndexed(indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
     return GFX_RESULT_SUCCESS;
 }
 
 GfxResult CommandComponent::renderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderDrawIndirect(renderPassEncoder, indirectBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderDrawIndirect(renderPassEncoder, indirectBuffer));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
     rpe->drawIndirect(buffer, indirectOffset);
     return GFX_RESULT_SUCCESS;
@@ -422,25 +542,125 @@ GfxResult CommandComponent::renderPassEncoderDrawIndirect(GfxRenderPassEncoder r
 
 GfxResult CommandComponent::renderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderDrawIndexedIndirect(renderPassEncoder, indirectBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderDrawIndexedIndirect(renderPassEncoder, indirectBuffer));
 
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
     rpe->drawIndexedIndirect(buffer, indirectOffset);
     return GFX_RESULT_SUCCESS;
 }
 
-GfxResult CommandComponent::renderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex) const
+GfxResult CommandComponent::renderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderMultiDrawIndirect(renderPassEncoder, indirectBuffer, stride));
+
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
+    rpe->multiDrawIndirect(buffer, indirectOffset, drawCount, stride);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderBeginOcclusionQuery(renderPassEncoder, querySet);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateRenderPassEncoderMultiDrawIndexedIndirect(renderPassEncoder, indirectBuffer, stride));
+
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
     }
+    auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
+    rpe->multiDrawIndexedIndirect(buffer, indirectOffset, drawCount, stride);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderMultiDrawIndirectCount(renderPassEncoder, indirectBuffer, countBuffer, stride));
+
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands() || !rpe->device()->getCmdDrawIndirectCount()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
+    auto* count = converter::toNative<core::Buffer>(countBuffer);
+    rpe->multiDrawIndirectCount(buffer, indirectOffset, count, countBufferOffset, maxDrawCount, stride);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset, GfxBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderMultiDrawIndexedIndirectCount(renderPassEncoder, indirectBuffer, countBuffer, stride));
+
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands() || !rpe->device()->getCmdDrawIndexedIndirectCount()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
+    auto* count = converter::toNative<core::Buffer>(countBuffer);
+    rpe->multiDrawIndexedIndirectCount(buffer, indirectOffset, count, countBufferOffset, maxDrawCount, stride);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderExecuteCommandStream(renderPassEncoder, commands, commandCount));
+
+    // Records are already validated, decode straight into the core encoder
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    for (uint32_t i = 0; i < commandCount; ++i) {
+        const GfxCommand& command = commands[i];
+        switch (command.type) {
+        case GFX_COMMAND_TYPE_SET_PIPELINE:
+            rpe->setPipeline(converter::toNative<core::RenderPipeline>(command.setPipeline.pipeline));
+            break;
+        case GFX_COMMAND_TYPE_SET_BIND_GROUP:
+            rpe->setBindGroup(command.setBindGroup.index, converter::toNative<core::BindGroup>(command.setBindGroup.bindGroup),
+                command.setBindGroup.dynamicOffsets, command.setBindGroup.dynamicOffsetCount);
+            break;
+        case GFX_COMMAND_TYPE_SET_VERTEX_BUFFER:
+            rpe->setVertexBuffer(command.setVertexBuffer.slot, converter::toNative<core::Buffer>(command.setVertexBuffer.buffer), command.setVertexBuffer.offset);
+            break;
+        case GFX_COMMAND_TYPE_SET_INDEX_BUFFER:
+            rpe->setIndexBuffer(converter::toNative<core::Buffer>(command.setIndexBuffer.buffer),
+                converter::gfxIndexFormatToVkIndexType(command.setIndexBuffer.format), command.setIndexBuffer.offset);
+            break;
+        case GFX_COMMAND_TYPE_SET_VIEWPORT:
+            rpe->setViewport(converter::gfxViewportToViewport(&command.setViewport));
+            break;
+        case GFX_COMMAND_TYPE_SET_SCISSOR_RECT:
+            rpe->setScissorRect(converter::gfxScissorRectToScissorRect(&command.setScissorRect));
+            break;
+        case GFX_COMMAND_TYPE_DRAW:
+            rpe->draw(command.draw.vertexCount, command.draw.instanceCount, command.draw.firstVertex, command.draw.firstInstance);
+            break;
+        case GFX_COMMAND_TYPE_DRAW_INDEXED:
+            rpe->drawIndexed(command.drawIndexed.indexCount, command.drawIndexed.instanceCount, command.drawIndexed.firstIndex,
+                command.drawIndexed.baseVertex, command.drawIndexed.firstInstance);
+            break;
+        default:
+            break;
+        }
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet, uint32_t queryIndex) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderBeginOcclusionQuery(renderPassEncoder, querySet));
 
     auto* encoder = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!encoder->acceptsInlineCommands()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
     auto* query = converter::toNative<core::QuerySet>(querySet);
     encoder->beginOcclusionQuery(query->handle(), queryIndex);
     return GFX_RESULT_SUCCESS;
@@ -448,23 +668,34 @@ GfxResult CommandComponent::renderPassEncoderBeginOcclusionQuery(GfxRenderPassEn
 
 GfxResult CommandComponent::renderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder renderPassEncoder) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderEndOcclusionQuery(renderPassEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassEncoderEndOcclusionQuery(renderPassEncoder));
 
     auto* encoder = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
     encoder->endOcclusionQuery();
     return GFX_RESULT_SUCCESS;
 }
 
-GfxResult CommandComponent::renderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder) const
+GfxResult CommandComponent::renderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount) const
 {
-    GfxResult validationResult = validator::validateRenderPassEncoderEnd(renderPassEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateRenderPassEncoderExecuteBundles(renderPassEncoder, bundles, bundleCount));
+
+    auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
+    if (!rpe->acceptsBundles()) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
     }
 
+    std::vector<core::RenderBundle*> renderBundles(bundleCount);
+    for (uint32_t i = 0; i < bundleCount; ++i) {
+        renderBundles[i] = converter::toNative<core::RenderBundle>(bundles[i]);
+    }
+    rpe->executeBundles(renderBundles.data(), bundleCount);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder) const
+{
+    GFX_VALIDATE(validator::validateRenderPassEncoderEnd(renderPassEncoder));
+
     auto* rpe = converter::toNative<core::RenderPassEncoder>(renderPassEncoder);
     delete rpe;
     return GFX_RESULT_SUCCESS;
@@ -473,10 +704,7 @@ GfxResult CommandComponent::renderPassEncoderEnd(GfxRenderPassEncoder renderPass
 // ComputePassEncoder functions
 GfxResult CommandComponent::computePassEncoderSetPipeline(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline) const
 {
-    GfxResult validationResult = validator::validateComputePassEncoderSetPipeline(computePassEncoder, pipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateComputePassEncoderSetPipeline(computePassEncoder, pipeline));
 
     auto* cpe = converter::toNative<core::ComputePassEncoder>(computePassEncoder);
     auto* pipe = converter::toNative<core::ComputePipeline>(pipeline);
@@ -486,10 +714,7 @@ GfxResult CommandComponent::computePassEncoderSetPipeline(GfxComputePassEncoder
 
 GfxResult CommandComponent::computePassEncoderSetBindGroup(GfxComputePassEncoder computePassEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const
 {
-    GfxResult validationResult = validator::validateComputePassEncoderSetBindGroup(computePassEncoder, bindGroup);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateComputePassEncoderSetBindGroup(computePassEncoder, bindGroup));
 
     auto* cpe = converter::toNative<core::ComputePassEncoder>(computePassEncoder);
     auto* bg = converter::toNative<core::BindGroup>(bindGroup);
@@ -497,12 +722,20 @@ GfxResult CommandComponent::computePassEncoderSetBindGroup(GfxComputePassEncoder
     return GFX_RESULT_SUCCESS;
 }
 
-GfxResult CommandComponent::computePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ) const
+GfxResult CommandComponent::computePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size) const
 {
-    GfxResult validationResult = validator::validateComputePassEncoderDispatch(computePassEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateComputePassEncoderSetImmediateData(computePassEncoder, offset, data, size));
+
+    auto* cpe = converter::toNative<core::ComputePassEncoder>(computePassEncoder);
+    if (!cpe->setImmediateData(offset, data, size)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::computePassEncoderDispatch(GfxComputePassEncoder computePassEncoder, uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ) const
+{
+    GFX_VALIDATE(validator::validateComputePassEncoderDispatch(computePassEncoder));
 
     auto* cpe = converter::toNative<core::ComputePassEncoder>(computePassEncoder);
     cpe->dispatchWorkgroups(workgroupCountX, workgroupCountY, workgroupCountZ);
@@ -511,10 +744,7 @@ GfxResult CommandComponent::computePassEncoderDispatch(GfxComputePassEncoder com
 
 GfxResult CommandComponent::computePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer, uint64_t indirectOffset) const
 {
-    GfxResult validationResult = validator::validateComputePassEncoderDispatchIndirect(computePassEncoder, indirectBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateComputePassEncoderDispatchIndirect(computePassEncoder, indirectBuffer));
 
     auto* cpe = converter::toNative<core::ComputePassEncoder>(computePassEncoder);
     auto* buffer = converter::toNative<core::Buffer>(indirectBuffer);
@@ -524,14 +754,144 @@ GfxResult CommandComponent::computePassEncoderDispatchIndirect(GfxComputePassEnc
 
 GfxResult CommandComponent::computePassEncoderEnd(GfxComputePassEncoder computePassEncoder) const
 {
-    GfxResult validationResult = validator::validateComputePassEncoderEnd(computePassEncoder);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateComputePassEncoderEnd(computePassEncoder));
 
     auto* cpe = converter::toNative<core::ComputePassEncoder>(computePassEncoder);
     delete cpe;
     return GFX_RESULT_SUCCESS;
 }
 
+// RenderBundleEncoder functions
+GfxResult CommandComponent::deviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder) const
+{
+    GFX_VALIDATE(validator::validateDeviceCreateRenderBundleEncoder(device, descriptor, outEncoder));
+
+    try {
+        auto* dev = converter::toNative<core::Device>(device);
+        auto* renderPass = converter::toNative<core::RenderPass>(descriptor->renderPass);
+        auto* encoder = new core::RenderBundleEncoder(dev, renderPass);
+        *outEncoder = converter::toGfx<GfxRenderBundleEncoder>(encoder);
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to create render bundle encoder: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+GfxResult CommandComponent::renderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderDestroy(renderBundleEncoder));
+
+    delete converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderSetPipeline(renderBundleEncoder, pipeline));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    auto* pipe = converter::toNative<core::RenderPipeline>(pipeline);
+    rbe->setPipeline(pipe);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, uint32_t index, GfxBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderSetBindGroup(renderBundleEncoder, bindGroup));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    auto* bg = converter::toNative<core::BindGroup>(bindGroup);
+    rbe->setBindGroup(index, bg, dynamicOffsets, dynamicOffsetCount);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, uint32_t slot, GfxBuffer buffer, uint64_t offset, uint64_t size) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderSetVertexBuffer(renderBundleEncoder, buffer));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    auto* buf = converter::toNative<core::Buffer>(buffer);
+    rbe->setVertexBuffer(slot, buf, offset);
+
+    (void)size;
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer, GfxIndexFormat format, uint64_t offset, uint64_t size) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderSetIndexBuffer(renderBundleEncoder, buffer));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    auto* buf = converter::toNative<core::Buffer>(buffer);
+    rbe->setIndexBuffer(buf, converter::gfxIndexFormatToVkIndexType(format), offset);
+
+    (void)size;
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderSetViewport(renderBundleEncoder, viewport));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    rbe->setViewport(converter::gfxViewportToViewport(viewport));
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderSetScissorRect(renderBundleEncoder, scissor));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    rbe->setScissorRect(converter::gfxScissorRectToScissorRect(scissor));
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderDraw(renderBundleEncoder));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    rbe->draw(vertexCount, instanceCount, firstVertex, firstInstance);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderDrawIndexed(renderBundleEncoder));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    rbe->drawIndexed(indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult CommandComponent::renderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleEncoderFinish(renderBundleEncoder, outBundle));
+
+    auto* rbe = converter::toNative<core::RenderBundleEncoder>(renderBundleEncoder);
+    if (rbe->isFinished()) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto bundle = rbe->finish();
+        *outBundle = converter::toGfx<GfxRenderBundle>(bundle.release());
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to finish render bundle: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+// RenderBundle functions
+GfxResult CommandComponent::renderBundleDestroy(GfxRenderBundle renderBundle) const
+{
+    GFX_VALIDATE(validator::validateRenderBundleDestroy(renderBundle));
+
+    delete converter::toNative<core::RenderBundle>(renderBundle);
+    return GFX_RESULT_SUCCESS;
+}
+
 } // namespace gfx::backend::vulkan::component
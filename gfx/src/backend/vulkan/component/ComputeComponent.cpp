@@ -8,6 +8,7 @@
 
 #include "backend/vulkan/core/compute/ComputePipeline.h"
 #include "backend/vulkan/core/system/Device.h"
+#include "backend/vulkan/core/system/PipelineCompilePool.h"
 
 #include <stdexcept>
 
@@ -16,10 +17,7 @@ namespace gfx::backend::vulkan::component {
 // ComputePipeline functions
 GfxResult ComputeComponent::deviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateComputePipeline(device, descriptor, outPipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateComputePipeline(device, descriptor, outPipeline));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -33,12 +31,32 @@ GfxResult ComputeComponent::deviceCreateComputePipeline(GfxDevice device, const
     }
 }
 
-GfxResult ComputeComponent::computePipelineDestroy(GfxComputePipeline computePipeline) const
+GfxResult ComputeComponent::deviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData) const
 {
-    GfxResult validationResult = validator::validateComputePipelineDestroy(computePipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateDeviceCreateComputePipelineAsync(device, descriptor, callback));
+
+    try {
+        auto* dev = converter::toNative<core::Device>(device);
+        auto createInfo = converter::gfxDescriptorToComputePipelineCreateInfo(descriptor);
+        dev->getPipelineCompilePool()->submit([dev, createInfo = std::move(createInfo), callback, userData]() {
+            core::ComputePipeline* pipeline = nullptr;
+            try {
+                pipeline = new core::ComputePipeline(dev, createInfo);
+            } catch (const std::exception& e) {
+                gfx::common::Logger::instance().logError("Failed to create compute pipeline: {}", e.what());
+            }
+            callback(pipeline ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN, converter::toGfx<GfxComputePipeline>(pipeline), userData);
+        });
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to queue compute pipeline creation: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
     }
+}
+
+GfxResult ComputeComponent::computePipelineDestroy(GfxComputePipeline computePipeline) const
+{
+    GFX_VALIDATE(validator::validateComputePipelineDestroy(computePipeline));
 
     delete converter::toNative<core::ComputePipeline>(computePipeline);
     return GFX_RESULT_SUCCESS;
@@ -20,10 +20,7 @@ namespace gfx::backend::vulkan::component {
 // Surface functions
 GfxResult PresentationComponent::deviceCreateSurface(GfxDevice device, const GfxSurfaceDescriptor* descriptor, GfxSurface* outSurface) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSurface(device, descriptor, outSurface);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSurface(device, descriptor, outSurface));
 
 #ifdef GFX_HEADLESS_BUILD
     (void)device;
@@ -47,10 +44,7 @@ GfxResult PresentationComponent::deviceCreateSurface(GfxDevice device, const Gfx
 
 GfxResult PresentationComponent::surfaceDestroy(GfxSurface surface) const
 {
-    GfxResult validationResult = validator::validateSurfaceDestroy(surface);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceDestroy(surface));
 
     delete converter::toNative<core::Surface>(surface);
     return GFX_RESULT_SUCCESS;
@@ -58,10 +52,7 @@ GfxResult PresentationComponent::surfaceDestroy(GfxSurface surface) const
 
 GfxResult PresentationComponent::surfaceGetInfo(GfxSurface surface, GfxSurfaceInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateSurfaceGetInfo(surface, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceGetInfo(surface, outInfo));
 
     auto* surf = converter::toNative<core::Surface>(surface);
     *outInfo = converter::vkSurfaceCapabilitiesToGfxSurfaceInfo(surf->getCapabilities());
@@ -70,10 +61,7 @@ GfxResult PresentationComponent::surfaceGetInfo(GfxSurface surface, GfxSurfaceIn
 
 GfxResult PresentationComponent::surfaceEnumerateSupportedFormats(GfxSurface surface, uint32_t* formatCount, GfxFormat* formats) const
 {
-    GfxResult validationResult = validator::validateSurfaceEnumerateSupportedFormats(surface, formatCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceEnumerateSupportedFormats(surface, formatCount));
 
     auto* surf = converter::toNative<core::Surface>(surface);
     auto surfaceFormats = surf->getSupportedFormats();
@@ -93,10 +81,7 @@ GfxResult PresentationComponent::surfaceEnumerateSupportedFormats(GfxSurface sur
 
 GfxResult PresentationComponent::surfaceEnumerateSupportedPresentModes(GfxSurface surface, uint32_t* presentModeCount, GfxPresentMode* presentModes) const
 {
-    GfxResult validationResult = validator::validateSurfaceEnumerateSupportedPresentModes(surface, presentModeCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceEnumerateSupportedPresentModes(surface, presentModeCount));
 
     auto* surf = converter::toNative<core::Surface>(surface);
     auto vkPresentModes = surf->getSupportedPresentModes();
@@ -117,10 +102,7 @@ GfxResult PresentationComponent::surfaceEnumerateSupportedPresentModes(GfxSurfac
 // Swapchain functions
 GfxResult PresentationComponent::deviceCreateSwapchain(GfxDevice device, const GfxSwapchainDescriptor* descriptor, GfxSwapchain* outSwapchain) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSwapchain(device, descriptor, outSwapchain);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSwapchain(device, descriptor, outSwapchain));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -137,10 +119,7 @@ GfxResult PresentationComponent::deviceCreateSwapchain(GfxDevice device, const G
 
 GfxResult PresentationComponent::swapchainDestroy(GfxSwapchain swapchain) const
 {
-    GfxResult validationResult = validator::validateSwapchainDestroy(swapchain);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainDestroy(swapchain));
 
     delete converter::toNative<core::Swapchain>(swapchain);
     return GFX_RESULT_SUCCESS;
@@ -148,10 +127,7 @@ GfxResult PresentationComponent::swapchainDestroy(GfxSwapchain swapchain) const
 
 GfxResult PresentationComponent::swapchainGetInfo(GfxSwapchain swapchain, GfxSwapchainInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateSwapchainGetInfo(swapchain, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainGetInfo(swapchain, outInfo));
 
     auto* sc = converter::toNative<core::Swapchain>(swapchain);
     *outInfo = converter::vkSwapchainInfoToGfxSwapchainInfo(sc->getInfo());
@@ -160,10 +136,7 @@ GfxResult PresentationComponent::swapchainGetInfo(GfxSwapchain swapchain, GfxSwa
 
 GfxResult PresentationComponent::swapchainAcquireNextImage(GfxSwapchain swapchain, uint64_t timeoutNs, GfxSemaphore imageAvailableSemaphore, GfxFence fence, uint32_t* outImageIndex) const
 {
-    GfxResult validationResult = validator::validateSwapchainAcquireNextImage(swapchain, outImageIndex);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainAcquireNextImage(swapchain, outImageIndex));
 
     auto* sc = converter::toNative<core::Swapchain>(swapchain);
 
@@ -202,10 +175,7 @@ GfxResult PresentationComponent::swapchainAcquireNextImage(GfxSwapchain swapchai
 
 GfxResult PresentationComponent::swapchainGetTextureView(GfxSwapchain swapchain, uint32_t imageIndex, GfxTextureView* outView) const
 {
-    GfxResult validationResult = validator::validateSwapchainGetTextureView(swapchain, outView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainGetTextureView(swapchain, outView));
 
     auto* sc = converter::toNative<core::Swapchain>(swapchain);
     if (imageIndex >= sc->getImageCount()) {
@@ -218,10 +188,7 @@ GfxResult PresentationComponent::swapchainGetTextureView(GfxSwapchain swapchain,
 
 GfxResult PresentationComponent::swapchainGetCurrentTextureView(GfxSwapchain swapchain, GfxTextureView* outView) const
 {
-    GfxResult validationResult = validator::validateSwapchainGetCurrentTextureView(swapchain, outView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainGetCurrentTextureView(swapchain, outView));
 
     auto* sc = converter::toNative<core::Swapchain>(swapchain);
     *outView = converter::toGfx<GfxTextureView>(sc->getCurrentTextureView());
@@ -230,10 +197,7 @@ GfxResult PresentationComponent::swapchainGetCurrentTextureView(GfxSwapchain swa
 
 GfxResult PresentationComponent::swapchainPresent(GfxSwapchain swapchain, const GfxPresentDescriptor* presentDescriptor) const
 {
-    GfxResult validationResult = validator::validateSwapchainPresent(swapchain, presentDescriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainPresent(swapchain, presentDescriptor));
 
     auto* sc = converter::toNative<core::Swapchain>(swapchain);
 
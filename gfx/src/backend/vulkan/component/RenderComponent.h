@@ -17,6 +17,7 @@ public:
 
     // RenderPipeline functions
     GfxResult deviceCreateRenderPipeline(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxRenderPipeline* outPipeline) const;
+    GfxResult deviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback, void* userData) const;
     GfxResult renderPipelineDestroy(GfxRenderPipeline pipeline) const;
 };
 
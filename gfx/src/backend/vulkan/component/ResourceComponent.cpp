@@ -22,10 +22,7 @@ namespace gfx::backend::vulkan::component {
 // Buffer functions
 GfxResult ResourceComponent::deviceCreateBuffer(GfxDevice device, const GfxBufferDescriptor* descriptor, GfxBuffer* outBuffer) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateBuffer(device, descriptor, outBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateBuffer(device, descriptor, outBuffer));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -41,10 +38,7 @@ GfxResult ResourceComponent::deviceCreateBuffer(GfxDevice device, const GfxBuffe
 
 GfxResult ResourceComponent::deviceImportBuffer(GfxDevice device, const GfxBufferImportDescriptor* descriptor, GfxBuffer* outBuffer) const
 {
-    GfxResult validationResult = validator::validateDeviceImportBuffer(device, descriptor, outBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceImportBuffer(device, descriptor, outBuffer));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -61,21 +55,17 @@ GfxResult ResourceComponent::deviceImportBuffer(GfxDevice device, const GfxBuffe
 
 GfxResult ResourceComponent::bufferDestroy(GfxBuffer buffer) const
 {
-    GfxResult validationResult = validator::validateBufferDestroy(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferDestroy(buffer));
 
-    delete converter::toNative<core::Buffer>(buffer);
+    auto* buf = converter::toNative<core::Buffer>(buffer);
+    // Submitted work may still use it, the device destroys it once that work completed
+    buf->getDevice()->deferDestroy([buf]() { delete buf; });
     return GFX_RESULT_SUCCESS;
 }
 
 GfxResult ResourceComponent::bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateBufferGetInfo(buffer, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferGetInfo(buffer, outInfo));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     *outInfo = converter::vkBufferToGfxBufferInfo(buf->getInfo());
@@ -84,10 +74,7 @@ GfxResult ResourceComponent::bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outI
 
 GfxResult ResourceComponent::bufferGetNativeHandle(GfxBuffer buffer, void** outHandle) const
 {
-    GfxResult validationResult = validator::validateBufferGetNativeHandle(buffer, outHandle);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferGetNativeHandle(buffer, outHandle));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     *outHandle = reinterpret_cast<void*>(buf->handle());
@@ -96,10 +83,7 @@ GfxResult ResourceComponent::bufferGetNativeHandle(GfxBuffer buffer, void** outH
 
 GfxResult ResourceComponent::bufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void** outMappedPointer) const
 {
-    GfxResult validationResult = validator::validateBufferMap(buffer, outMappedPointer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferMap(buffer, outMappedPointer));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     void* mapped = buf->map(offset, size);
@@ -110,12 +94,26 @@ GfxResult ResourceComponent::bufferMap(GfxBuffer buffer, uint64_t offset, uint64
     return GFX_RESULT_SUCCESS;
 }
 
-GfxResult ResourceComponent::bufferUnmap(GfxBuffer buffer) const
+GfxResult ResourceComponent::bufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer) const
 {
-    GfxResult validationResult = validator::validateBufferUnmap(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateBufferGetMappedPointer(buffer, outMappedPointer));
+
+    auto* buf = converter::toNative<core::Buffer>(buffer);
+    if ((buf->getInfo().originalUsage & GFX_BUFFER_USAGE_MAP_PERSISTENT) == 0) {
+        gfx::common::Logger::instance().logError("Buffer was not created with GFX_BUFFER_USAGE_MAP_PERSISTENT");
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    void* mapped = buf->getMappedPointer();
+    if (!mapped) {
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
+    *outMappedPointer = mapped;
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult ResourceComponent::bufferUnmap(GfxBuffer buffer) const
+{
+    GFX_VALIDATE(validator::validateBufferUnmap(buffer));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     buf->unmap();
@@ -124,10 +122,7 @@ GfxResult ResourceComponent::bufferUnmap(GfxBuffer buffer) const
 
 GfxResult ResourceComponent::bufferFlushMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateBufferFlushMappedRange(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferFlushMappedRange(buffer));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     buf->flushMappedRange(offset, size);
@@ -136,10 +131,7 @@ GfxResult ResourceComponent::bufferFlushMappedRange(GfxBuffer buffer, uint64_t o
 
 GfxResult ResourceComponent::bufferInvalidateMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateBufferInvalidateMappedRange(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferInvalidateMappedRange(buffer));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     buf->invalidateMappedRange(offset, size);
@@ -149,10 +141,7 @@ GfxResult ResourceComponent::bufferInvalidateMappedRange(GfxBuffer buffer, uint6
 // Texture functions
 GfxResult ResourceComponent::deviceCreateTexture(GfxDevice device, const GfxTextureDescriptor* descriptor, GfxTexture* outTexture) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateTexture(device, descriptor, outTexture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateTexture(device, descriptor, outTexture));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -168,10 +157,7 @@ GfxResult ResourceComponent::deviceCreateTexture(GfxDevice device, const GfxText
 
 GfxResult ResourceComponent::deviceImportTexture(GfxDevice device, const GfxTextureImportDescriptor* descriptor, GfxTexture* outTexture) const
 {
-    GfxResult validationResult = validator::validateDeviceImportTexture(device, descriptor, outTexture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceImportTexture(device, descriptor, outTexture));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -189,21 +175,16 @@ GfxResult ResourceComponent::deviceImportTexture(GfxDevice device, const GfxText
 
 GfxResult ResourceComponent::textureDestroy(GfxTexture texture) const
 {
-    GfxResult validationResult = validator::validateTextureDestroy(texture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureDestroy(texture));
 
-    delete converter::toNative<core::Texture>(texture);
+    auto* tex = converter::toNative<core::Texture>(texture);
+    tex->getDevice()->deferDestroy([tex]() { delete tex; });
     return GFX_RESULT_SUCCESS;
 }
 
 GfxResult ResourceComponent::textureGetInfo(GfxTexture texture, GfxTextureInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateTextureGetInfo(texture, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureGetInfo(texture, outInfo));
 
     auto* tex = converter::toNative<core::Texture>(texture);
     *outInfo = converter::vkTextureInfoToGfxTextureInfo(tex->getInfo());
@@ -212,10 +193,7 @@ GfxResult ResourceComponent::textureGetInfo(GfxTexture texture, GfxTextureInfo*
 
 GfxResult ResourceComponent::textureGetNativeHandle(GfxTexture texture, void** outHandle) const
 {
-    GfxResult validationResult = validator::validateTextureGetNativeHandle(texture, outHandle);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureGetNativeHandle(texture, outHandle));
 
     auto* tex = converter::toNative<core::Texture>(texture);
     *outHandle = reinterpret_cast<void*>(tex->handle());
@@ -224,10 +202,7 @@ GfxResult ResourceComponent::textureGetNativeHandle(GfxTexture texture, void** o
 
 GfxResult ResourceComponent::textureGetLayout(GfxTexture texture, GfxTextureLayout* outLayout) const
 {
-    GfxResult validationResult = validator::validateTextureGetLayout(texture, outLayout);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureGetLayout(texture, outLayout));
 
     auto* tex = converter::toNative<core::Texture>(texture);
     *outLayout = converter::vkImageLayoutToGfxLayout(tex->getLayout());
@@ -236,10 +211,7 @@ GfxResult ResourceComponent::textureGetLayout(GfxTexture texture, GfxTextureLayo
 
 GfxResult ResourceComponent::textureCreateView(GfxTexture texture, const GfxTextureViewDescriptor* descriptor, GfxTextureView* outView) const
 {
-    GfxResult validationResult = validator::validateTextureCreateView(texture, descriptor, outView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureCreateView(texture, descriptor, outView));
 
     try {
         auto* tex = converter::toNative<core::Texture>(texture);
@@ -256,10 +228,7 @@ GfxResult ResourceComponent::textureCreateView(GfxTexture texture, const GfxText
 // TextureView functions
 GfxResult ResourceComponent::textureViewDestroy(GfxTextureView textureView) const
 {
-    GfxResult validationResult = validator::validateTextureViewDestroy(textureView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureViewDestroy(textureView));
 
     delete converter::toNative<core::TextureView>(textureView);
     return GFX_RESULT_SUCCESS;
@@ -268,10 +237,7 @@ GfxResult ResourceComponent::textureViewDestroy(GfxTextureView textureView) cons
 // Sampler functions
 GfxResult ResourceComponent::deviceCreateSampler(GfxDevice device, const GfxSamplerDescriptor* descriptor, GfxSampler* outSampler) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSampler(device, descriptor, outSampler);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSampler(device, descriptor, outSampler));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -287,10 +253,7 @@ GfxResult ResourceComponent::deviceCreateSampler(GfxDevice device, const GfxSamp
 
 GfxResult ResourceComponent::samplerDestroy(GfxSampler sampler) const
 {
-    GfxResult validationResult = validator::validateSamplerDestroy(sampler);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSamplerDestroy(sampler));
 
     delete converter::toNative<core::Sampler>(sampler);
     return GFX_RESULT_SUCCESS;
@@ -300,10 +263,7 @@ GfxResult ResourceComponent::samplerDestroy(GfxSampler sampler) const
 // Shader functions
 GfxResult ResourceComponent::deviceCreateShader(GfxDevice device, const GfxShaderDescriptor* descriptor, GfxShader* outShader) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateShader(device, descriptor, outShader);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateShader(device, descriptor, outShader));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -319,10 +279,7 @@ GfxResult ResourceComponent::deviceCreateShader(GfxDevice device, const GfxShade
 
 GfxResult ResourceComponent::shaderDestroy(GfxShader shader) const
 {
-    GfxResult validationResult = validator::validateShaderDestroy(shader);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateShaderDestroy(shader));
 
     delete converter::toNative<core::Shader>(shader);
     return GFX_RESULT_SUCCESS;
@@ -331,10 +288,7 @@ GfxResult ResourceComponent::shaderDestroy(GfxShader shader) const
 // BindGroupLayout functions
 GfxResult ResourceComponent::deviceCreateBindGroupLayout(GfxDevice device, const GfxBindGroupLayoutDescriptor* descriptor, GfxBindGroupLayout* outLayout) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateBindGroupLayout(device, descriptor, outLayout);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateBindGroupLayout(device, descriptor, outLayout));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -350,10 +304,7 @@ GfxResult ResourceComponent::deviceCreateBindGroupLayout(GfxDevice device, const
 
 GfxResult ResourceComponent::bindGroupLayoutDestroy(GfxBindGroupLayout bindGroupLayout) const
 {
-    GfxResult validationResult = validator::validateBindGroupLayoutDestroy(bindGroupLayout);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBindGroupLayoutDestroy(bindGroupLayout));
 
     delete converter::toNative<core::BindGroupLayout>(bindGroupLayout);
     return GFX_RESULT_SUCCESS;
@@ -362,10 +313,7 @@ GfxResult ResourceComponent::bindGroupLayoutDestroy(GfxBindGroupLayout bindGroup
 // BindGroup functions
 GfxResult ResourceComponent::deviceCreateBindGroup(GfxDevice device, const GfxBindGroupDescriptor* descriptor, GfxBindGroup* outBindGroup) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateBindGroup(device, descriptor, outBindGroup);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateBindGroup(device, descriptor, outBindGroup));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -381,12 +329,10 @@ GfxResult ResourceComponent::deviceCreateBindGroup(GfxDevice device, const GfxBi
 
 GfxResult ResourceComponent::bindGroupDestroy(GfxBindGroup bindGroup) const
 {
-    GfxResult validationResult = validator::validateBindGroupDestroy(bindGroup);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBindGroupDestroy(bindGroup));
 
-    delete converter::toNative<core::BindGroup>(bindGroup);
+    auto* group = converter::toNative<core::BindGroup>(bindGroup);
+    group->getDevice()->deferDestroy([group]() { delete group; });
     return GFX_RESULT_SUCCESS;
 }
 
@@ -21,6 +21,7 @@ public:
     GfxResult bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo) const;
     GfxResult bufferGetNativeHandle(GfxBuffer buffer, void** outHandle) const;
     GfxResult bufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void** outMappedPointer) const;
+    GfxResult bufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer) const;
     GfxResult bufferUnmap(GfxBuffer buffer) const;
     GfxResult bufferFlushMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const;
     GfxResult bufferInvalidateMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const;
@@ -17,10 +17,7 @@ namespace gfx::backend::vulkan::component {
 // Fence functions
 GfxResult SyncComponent::deviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateFence(device, descriptor, outFence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateFence(device, descriptor, outFence));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -36,10 +33,7 @@ GfxResult SyncComponent::deviceCreateFence(GfxDevice device, const GfxFenceDescr
 
 GfxResult SyncComponent::fenceDestroy(GfxFence fence) const
 {
-    GfxResult validationResult = validator::validateFenceDestroy(fence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceDestroy(fence));
 
     delete converter::toNative<core::Fence>(fence);
     return GFX_RESULT_SUCCESS;
@@ -47,10 +41,7 @@ GfxResult SyncComponent::fenceDestroy(GfxFence fence) const
 
 GfxResult SyncComponent::fenceGetStatus(GfxFence fence, bool* isSignaled) const
 {
-    GfxResult validationResult = validator::validateFenceGetStatus(fence, isSignaled);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceGetStatus(fence, isSignaled));
 
     auto* f = converter::toNative<core::Fence>(fence);
     VkResult result = f->getStatus(isSignaled);
@@ -67,10 +58,7 @@ GfxResult SyncComponent::fenceGetStatus(GfxFence fence, bool* isSignaled) const
 
 GfxResult SyncComponent::fenceWait(GfxFence fence, uint64_t timeoutNs) const
 {
-    GfxResult validationResult = validator::validateFenceWait(fence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceWait(fence));
 
     auto* f = converter::toNative<core::Fence>(fence);
     VkResult result = f->wait(timeoutNs);
@@ -89,10 +77,7 @@ GfxResult SyncComponent::fenceWait(GfxFence fence, uint64_t timeoutNs) const
 
 GfxResult SyncComponent::fenceReset(GfxFence fence) const
 {
-    GfxResult validationResult = validator::validateFenceReset(fence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceReset(fence));
 
     auto* f = converter::toNative<core::Fence>(fence);
     f->reset();
@@ -102,10 +87,7 @@ GfxResult SyncComponent::fenceReset(GfxFence fence) const
 // Semaphore functions
 GfxResult SyncComponent::deviceCreateSemaphore(GfxDevice device, const GfxSemaphoreDescriptor* descriptor, GfxSemaphore* outSemaphore) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSemaphore(device, descriptor, outSemaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSemaphore(device, descriptor, outSemaphore));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -121,10 +103,7 @@ GfxResult SyncComponent::deviceCreateSemaphore(GfxDevice device, const GfxSemaph
 
 GfxResult SyncComponent::semaphoreDestroy(GfxSemaphore semaphore) const
 {
-    GfxResult validationResult = validator::validateSemaphoreDestroy(semaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreDestroy(semaphore));
 
     delete converter::toNative<core::Semaphore>(semaphore);
     return GFX_RESULT_SUCCESS;
@@ -132,10 +111,7 @@ GfxResult SyncComponent::semaphoreDestroy(GfxSemaphore semaphore) const
 
 GfxResult SyncComponent::semaphoreGetType(GfxSemaphore semaphore, GfxSemaphoreType* outType) const
 {
-    GfxResult validationResult = validator::validateSemaphoreGetType(semaphore, outType);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreGetType(semaphore, outType));
 
     auto* s = converter::toNative<core::Semaphore>(semaphore);
     *outType = converter::vulkanSemaphoreTypeToGfxSemaphoreType(s->getType());
@@ -144,10 +120,7 @@ GfxResult SyncComponent::semaphoreGetType(GfxSemaphore semaphore, GfxSemaphoreTy
 
 GfxResult SyncComponent::semaphoreSignal(GfxSemaphore semaphore, uint64_t value) const
 {
-    GfxResult validationResult = validator::validateSemaphoreSignal(semaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreSignal(semaphore));
 
     auto* s = converter::toNative<core::Semaphore>(semaphore);
     VkResult result = s->signal(value);
@@ -156,10 +129,7 @@ GfxResult SyncComponent::semaphoreSignal(GfxSemaphore semaphore, uint64_t value)
 
 GfxResult SyncComponent::semaphoreWait(GfxSemaphore semaphore, uint64_t value, uint64_t timeoutNs) const
 {
-    GfxResult validationResult = validator::validateSemaphoreWait(semaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreWait(semaphore));
 
     auto* s = converter::toNative<core::Semaphore>(semaphore);
     VkResult result = s->wait(value, timeoutNs);
@@ -168,10 +138,7 @@ GfxResult SyncComponent::semaphoreWait(GfxSemaphore semaphore, uint64_t value, u
 
 GfxResult SyncComponent::semaphoreGetValue(GfxSemaphore semaphore, uint64_t* outValue) const
 {
-    GfxResult validationResult = validator::validateSemaphoreGetValue(semaphore, outValue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreGetValue(semaphore, outValue));
 
     auto* s = converter::toNative<core::Semaphore>(semaphore);
     *outValue = s->getValue();
@@ -6,11 +6,14 @@
 #include "backend/vulkan/converter/Conversions.h"
 #include "backend/vulkan/validator/Validations.h"
 
+#include "backend/vulkan/core/memory/MemoryAllocator.h"
 #include "backend/vulkan/core/presentation/Surface.h"
 #include "backend/vulkan/core/system/Adapter.h"
 #include "backend/vulkan/core/system/Device.h"
 #include "backend/vulkan/core/system/Instance.h"
+#include "backend/vulkan/core/system/PipelineCache.h"
 #include "backend/vulkan/core/system/Queue.h"
+#include "backend/vulkan/core/system/UploadEngine.h"
 
 #include <algorithm>
 #include <stdexcept>
@@ -21,15 +24,17 @@ namespace gfx::backend::vulkan::component {
 // Instance functions
 GfxResult SystemComponent::createInstance(const GfxInstanceDescriptor* descriptor, GfxInstance* outInstance) const
 {
-    GfxResult validationResult = validator::validateCreateInstance(descriptor, outInstance);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCreateInstance(descriptor, outInstance));
 
     try {
         auto createInfo = converter::gfxDescriptorToInstanceCreateInfo(descriptor);
         auto* instance = new core::Instance(createInfo);
         *outInstance = converter::toGfx<GfxInstance>(instance);
+        GfxValidationLevel level = validator::getInstanceValidationLevel(descriptor);
+        if (!validator::retainValidationLevel(level)) {
+            gfx::common::Logger::instance().logWarning("Validation level {} ignored, level {} of a live instance stays in effect",
+                static_cast<int>(level), static_cast<int>(validator::getValidationLevel()));
+        }
         return GFX_RESULT_SUCCESS;
     } catch (const std::exception& e) {
         gfx::common::Logger::instance().logError("Failed to create instance: {}", e.what());
@@ -39,21 +44,16 @@ GfxResult SystemComponent::createInstance(const GfxInstanceDescriptor* descripto
 
 GfxResult SystemComponent::instanceDestroy(GfxInstance instance) const
 {
-    GfxResult validationResult = validator::validateInstanceDestroy(instance);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateInstanceDestroy(instance));
 
     delete converter::toNative<core::Instance>(instance);
+    validator::releaseValidationLevel();
     return GFX_RESULT_SUCCESS;
 }
 
 GfxResult SystemComponent::instanceRequestAdapter(GfxInstance instance, const GfxAdapterDescriptor* descriptor, GfxAdapter* outAdapter) const
 {
-    GfxResult validationResult = validator::validateInstanceRequestAdapter(instance, descriptor, outAdapter);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateInstanceRequestAdapter(instance, descriptor, outAdapter));
 
     auto* inst = converter::toNative<core::Instance>(instance);
     auto createInfo = converter::gfxDescriptorToAdapterCreateInfo(descriptor);
@@ -64,10 +64,7 @@ GfxResult SystemComponent::instanceRequestAdapter(GfxInstance instance, const Gf
 
 GfxResult SystemComponent::instanceEnumerateAdapters(GfxInstance instance, uint32_t* adapterCount, GfxAdapter* adapters) const
 {
-    GfxResult validationResult = validator::validateInstanceEnumerateAdapters(instance, adapterCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateInstanceEnumerateAdapters(instance, adapterCount));
 
     auto* inst = converter::toNative<core::Instance>(instance);
     const auto& cachedAdapters = inst->getAdapters();
@@ -110,10 +107,7 @@ GfxResult SystemComponent::enumerateInstanceExtensions(uint32_t* extensionCount,
 // Adapter functions
 GfxResult SystemComponent::adapterCreateDevice(GfxAdapter adapter, const GfxDeviceDescriptor* descriptor, GfxDevice* outDevice) const
 {
-    GfxResult validationResult = validator::validateAdapterCreateDevice(adapter, descriptor, outDevice);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterCreateDevice(adapter, descriptor, outDevice));
 
     try {
         auto* adapterPtr = converter::toNative<core::Adapter>(adapter);
@@ -129,10 +123,7 @@ GfxResult SystemComponent::adapterCreateDevice(GfxAdapter adapter, const GfxDevi
 
 GfxResult SystemComponent::adapterGetInfo(GfxAdapter adapter, GfxAdapterInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateAdapterGetInfo(adapter, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterGetInfo(adapter, outInfo));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     *outInfo = converter::vkPropertiesToGfxAdapterInfo(adap->getProperties());
@@ -141,10 +132,7 @@ GfxResult SystemComponent::adapterGetInfo(GfxAdapter adapter, GfxAdapterInfo* ou
 
 GfxResult SystemComponent::adapterGetLimits(GfxAdapter adapter, GfxDeviceLimits* outLimits) const
 {
-    GfxResult validationResult = validator::validateAdapterGetLimits(adapter, outLimits);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterGetLimits(adapter, outLimits));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     *outLimits = converter::vkPropertiesToGfxDeviceLimits(adap->getProperties());
@@ -153,10 +141,7 @@ GfxResult SystemComponent::adapterGetLimits(GfxAdapter adapter, GfxDeviceLimits*
 
 GfxResult SystemComponent::adapterEnumerateQueueFamilies(GfxAdapter adapter, uint32_t* queueFamilyCount, GfxQueueFamilyProperties* queueFamilies) const
 {
-    GfxResult validationResult = validator::validateAdapterEnumerateQueueFamilies(adapter, queueFamilyCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterEnumerateQueueFamilies(adapter, queueFamilyCount));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     auto vkProps = adap->getQueueFamilyProperties();
@@ -180,10 +165,7 @@ GfxResult SystemComponent::adapterEnumerateQueueFamilies(GfxAdapter adapter, uin
 
 GfxResult SystemComponent::adapterGetQueueFamilySurfaceSupport(GfxAdapter adapter, uint32_t queueFamilyIndex, GfxSurface surface, bool* outSupported) const
 {
-    GfxResult validationResult = validator::validateAdapterGetQueueFamilySurfaceSupport(adapter, surface, outSupported);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterGetQueueFamilySurfaceSupport(adapter, surface, outSupported));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     auto* surf = converter::toNative<core::Surface>(surface);
@@ -194,10 +176,7 @@ GfxResult SystemComponent::adapterGetQueueFamilySurfaceSupport(GfxAdapter adapte
 
 GfxResult SystemComponent::adapterEnumerateExtensions(GfxAdapter adapter, uint32_t* extensionCount, const char** extensionNames) const
 {
-    GfxResult validationResult = validator::validateAdapterEnumerateExtensions(adapter, extensionCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterEnumerateExtensions(adapter, extensionCount));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     const auto internalExtensions = adap->enumerateSupportedExtensions();
@@ -220,10 +199,7 @@ GfxResult SystemComponent::adapterEnumerateExtensions(GfxAdapter adapter, uint32
 // Device functions
 GfxResult SystemComponent::deviceDestroy(GfxDevice device) const
 {
-    GfxResult validationResult = validator::validateDeviceDestroy(device);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceDestroy(device));
 
     delete converter::toNative<core::Device>(device);
     return GFX_RESULT_SUCCESS;
@@ -231,10 +207,7 @@ GfxResult SystemComponent::deviceDestroy(GfxDevice device) const
 
 GfxResult SystemComponent::deviceGetQueue(GfxDevice device, GfxQueue* outQueue) const
 {
-    GfxResult validationResult = validator::validateDeviceGetQueue(device, outQueue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceGetQueue(device, outQueue));
 
     auto* dev = converter::toNative<core::Device>(device);
     *outQueue = converter::toGfx<GfxQueue>(dev->getQueue());
@@ -243,10 +216,7 @@ GfxResult SystemComponent::deviceGetQueue(GfxDevice device, GfxQueue* outQueue)
 
 GfxResult SystemComponent::deviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, GfxQueue* outQueue) const
 {
-    GfxResult validationResult = validator::validateDeviceGetQueueByIndex(device, outQueue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceGetQueueByIndex(device, outQueue));
 
     auto* dev = converter::toNative<core::Device>(device);
     auto* queue = dev->getQueueByIndex(queueFamilyIndex, queueIndex);
@@ -261,28 +231,115 @@ GfxResult SystemComponent::deviceGetQueueByIndex(GfxDevice device, uint32_t queu
 
 GfxResult SystemComponent::deviceWaitIdle(GfxDevice device) const
 {
-    GfxResult validationResult = validator::validateDeviceWaitIdle(device);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceWaitIdle(device));
 
     auto* dev = converter::toNative<core::Device>(device);
     dev->waitIdle();
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult SystemComponent::devicePoll(GfxDevice device) const
+{
+    GFX_VALIDATE(validator::validateDevicePoll(device));
+
+    auto* dev = converter::toNative<core::Device>(device);
+    dev->poll();
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult SystemComponent::deviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits) const
 {
-    GfxResult validationResult = validator::validateDeviceGetLimits(device, outLimits);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceGetLimits(device, outLimits));
 
     auto* dev = converter::toNative<core::Device>(device);
     *outLimits = converter::vkPropertiesToGfxDeviceLimits(dev->getProperties());
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult SystemComponent::deviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats) const
+{
+    GFX_VALIDATE(validator::validateDeviceGetMemoryStats(device, outStats));
+
+    auto* dev = converter::toNative<core::Device>(device);
+    *outStats = converter::vkMemoryStatsToGfxDeviceMemoryStats(dev->getMemoryAllocator()->getStats());
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult SystemComponent::deviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data) const
+{
+    GFX_VALIDATE(validator::validateDeviceGetPipelineCacheData(device, dataSize));
+
+    auto* dev = converter::toNative<core::Device>(device);
+    VkResult result = dev->getPipelineCache()->getData(dataSize, data);
+    switch (result) {
+    case VK_SUCCESS:
+        return GFX_RESULT_SUCCESS;
+    case VK_INCOMPLETE:
+        // data was too small, dataSize holds the number of bytes written
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    default:
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+GfxResult SystemComponent::deviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore) const
+{
+    GFX_VALIDATE(validator::validateDeviceGetUploadSemaphore(device, outSemaphore));
+
+    auto* dev = converter::toNative<core::Device>(device);
+    auto* uploadEngine = dev->getUploadEngine();
+    if (!uploadEngine) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    *outSemaphore = converter::toGfx<GfxSemaphore>(uploadEngine->getSemaphore());
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult SystemComponent::deviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue) const
+{
+    GFX_VALIDATE(validator::validateDeviceUploadBuffer(device, buffer, data, outSignalValue));
+
+    auto* dev = converter::toNative<core::Device>(device);
+    auto* uploadEngine = dev->getUploadEngine();
+    if (!uploadEngine) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    try {
+        auto* buf = converter::toNative<core::Buffer>(buffer);
+        *outSignalValue = uploadEngine->uploadBuffer(buf, offset, data, size);
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to upload buffer: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+GfxResult SystemComponent::deviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue) const
+{
+    GFX_VALIDATE(validator::validateDeviceUploadTexture(device, texture, origin, extent, data, outSignalValue));
+
+    auto* dev = converter::toNative<core::Device>(device);
+    auto* uploadEngine = dev->getUploadEngine();
+    if (!uploadEngine) {
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    auto* tex = converter::toNative<core::Texture>(texture);
+    VkOffset3D vkOrigin = converter::gfxOrigin3DToVkOffset3D(origin);
+    VkExtent3D vkExtent = converter::gfxExtent3DToVkExtent3D(extent);
+    VkImageLayout vkLayout = converter::gfxLayoutToVkImageLayout(finalLayout);
+
+    try {
+        *outSignalValue = uploadEngine->uploadTexture(tex, vkOrigin, mipLevel, data, dataSize, vkExtent, vkLayout);
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to upload texture: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
+}
+
 GfxResult SystemComponent::deviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported) const
 {
     if (!device || !outSupported) {
@@ -297,10 +354,7 @@ GfxResult SystemComponent::deviceSupportsShaderFormat(GfxDevice device, GfxShade
 // Queue functions
 GfxResult SystemComponent::queueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor) const
 {
-    GfxResult validationResult = validator::validateQueueSubmit(queue, submitDescriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateQueueSubmit(queue, submitDescriptor));
 
     auto* q = converter::toNative<core::Queue>(queue);
     auto internalSubmitInfo = converter::gfxDescriptorToSubmitInfo(submitDescriptor);
@@ -308,25 +362,47 @@ GfxResult SystemComponent::queueSubmit(GfxQueue queue, const GfxSubmitDescriptor
     return (result == VK_SUCCESS) ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN;
 }
 
-GfxResult SystemComponent::queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const
+GfxResult SystemComponent::queueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount) const
 {
-    GfxResult validationResult = validator::validateQueueWriteBuffer(queue, buffer, data);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateQueueSubmitBatch(queue, submitDescriptors, submitCount));
+
+    auto* q = converter::toNative<core::Queue>(queue);
+    std::vector<core::SubmitInfo> internalSubmitInfos;
+    internalSubmitInfos.reserve(submitCount);
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        internalSubmitInfos.push_back(converter::gfxDescriptorToSubmitInfo(&submitDescriptors[i]));
     }
+    VkResult result = q->submit(internalSubmitInfos.data(), submitCount);
+    return (result == VK_SUCCESS) ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN;
+}
+
+GfxResult SystemComponent::queueFlush(GfxQueue queue) const
+{
+    GFX_VALIDATE(validator::validateQueueFlush(queue));
 
     auto* q = converter::toNative<core::Queue>(queue);
-    auto* buf = converter::toNative<core::Buffer>(buffer);
-    q->writeBuffer(buf, offset, data, size);
-    return GFX_RESULT_SUCCESS;
+    VkResult result = q->flush();
+    return (result == VK_SUCCESS) ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN;
 }
 
-GfxResult SystemComponent::queueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout) const
+GfxResult SystemComponent::queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateQueueWriteTexture(queue, texture, origin, extent, data);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateQueueWriteBuffer(queue, buffer, data));
+
+    try {
+        auto* q = converter::toNative<core::Queue>(queue);
+        auto* buf = converter::toNative<core::Buffer>(buffer);
+        q->writeBuffer(buf, offset, data, size);
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to write buffer: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
     }
+}
+
+GfxResult SystemComponent::queueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout) const
+{
+    GFX_VALIDATE(validator::validateQueueWriteTexture(queue, texture, origin, extent, data));
 
     auto* q = converter::toNative<core::Queue>(queue);
     auto* tex = converter::toNative<core::Texture>(texture);
@@ -335,17 +411,18 @@ GfxResult SystemComponent::queueWriteTexture(GfxQueue queue, GfxTexture texture,
     VkExtent3D vkExtent = converter::gfxExtent3DToVkExtent3D(extent);
     VkImageLayout vkLayout = converter::gfxLayoutToVkImageLayout(finalLayout);
 
-    q->writeTexture(tex, vkOrigin, mipLevel, data, dataSize, vkExtent, vkLayout);
-
-    return GFX_RESULT_SUCCESS;
+    try {
+        q->writeTexture(tex, vkOrigin, mipLevel, data, dataSize, vkExtent, vkLayout);
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to write texture: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
+    }
 }
 
 GfxResult SystemComponent::queueWaitIdle(GfxQueue queue) const
 {
-    GfxResult validationResult = validator::validateQueueWaitIdle(queue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateQueueWaitIdle(queue));
 
     auto* q = converter::toNative<core::Queue>(queue);
     q->waitIdle();
@@ -46,6 +46,12 @@ const char* deviceExtensionNameToGfx(const char* internalName)
     if (std::strcmp(internalName, core::extensions::ANISOTROPIC_FILTERING) == 0) {
         return GFX_DEVICE_EXTENSION_ANISOTROPIC_FILTERING;
     }
+    if (std::strcmp(internalName, core::extensions::UPLOAD_QUEUE) == 0) {
+        return GFX_DEVICE_EXTENSION_UPLOAD_QUEUE;
+    }
+    if (std::strcmp(internalName, core::extensions::DRAW_INDIRECT_COUNT) == 0) {
+        return GFX_DEVICE_EXTENSION_DRAW_INDIRECT_COUNT;
+    }
     // Unknown extension - return as-is
     return internalName;
 }
@@ -69,6 +75,23 @@ GfxDeviceLimits vkPropertiesToGfxDeviceLimits(const VkPhysicalDeviceProperties&
     return limits;
 }
 
+// ============================================================================
+// Memory Stats Conversion
+// ============================================================================
+
+GfxDeviceMemoryStats vkMemoryStatsToGfxDeviceMemoryStats(const core::MemoryStats& stats)
+{
+    GfxDeviceMemoryStats gfxStats{};
+    gfxStats.blockCount = stats.blockCount;
+    gfxStats.dedicatedAllocationCount = stats.dedicatedAllocationCount;
+    gfxStats.allocationCount = stats.allocationCount;
+    gfxStats.reservedBytes = stats.reservedBytes;
+    gfxStats.usedBytes = stats.usedBytes;
+    gfxStats.largestFreeRange = stats.largestFreeRange;
+    gfxStats.fragmentation = stats.fragmentation;
+    return gfxStats;
+}
+
 // ============================================================================
 // Queue Family Conversion
 // ============================================================================
@@ -1116,6 +1139,31 @@ VkIndexType gfxIndexFormatToVkIndexType(GfxIndexFormat format)
     }
 }
 
+VkShaderStageFlags gfxShaderStageFlagsToVkShaderStageFlags(GfxShaderStageFlags gfxStages)
+{
+    VkShaderStageFlags vkStages = 0;
+    if (gfxStages & GFX_SHADER_STAGE_VERTEX) {
+        vkStages |= VK_SHADER_STAGE_VERTEX_BIT;
+    }
+    if (gfxStages & GFX_SHADER_STAGE_FRAGMENT) {
+        vkStages |= VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    if (gfxStages & GFX_SHADER_STAGE_COMPUTE) {
+        vkStages |= VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    return vkStages;
+}
+
+std::vector<VkPushConstantRange> gfxImmediateDataRangesToVkPushConstantRanges(const GfxImmediateDataRange* ranges, uint32_t rangeCount)
+{
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    pushConstantRanges.reserve(rangeCount);
+    for (uint32_t i = 0; i < rangeCount; ++i) {
+        pushConstantRanges.push_back({ gfxShaderStageFlagsToVkShaderStageFlags(ranges[i].visibility), ranges[i].offset, ranges[i].size });
+    }
+    return pushConstantRanges;
+}
+
 core::Viewport gfxViewportToViewport(const GfxViewport* viewport)
 {
     return { viewport->x, viewport->y, viewport->width, viewport->height, viewport->minDepth, viewport->maxDepth };
@@ -1360,6 +1408,25 @@ core::DeviceCreateInfo gfxDescriptorToDeviceCreateInfo(const GfxDeviceDescriptor
                 createInfo.enabledExtensions.push_back(descriptor->enabledExtensions[i]);
             }
         }
+
+        const GfxChainHeader* chainNode = static_cast<const GfxChainHeader*>(descriptor->pNext);
+        while (chainNode) {
+            if (chainNode->sType == GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR) {
+                const auto* pipelineCache = static_cast<const GfxDevicePipelineCacheDescriptor*>(static_cast<const void*>(chainNode));
+                createInfo.pipelineCacheData = pipelineCache->initialData;
+                createInfo.pipelineCacheDataSize = pipelineCache->initialDataSize;
+                createInfo.pipelineCacheDataAccepted = pipelineCache->initialDataAccepted;
+            }
+            if (chainNode->sType == GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_COMPILE_DESCRIPTOR) {
+                const auto* pipelineCompile = static_cast<const GfxDevicePipelineCompileDescriptor*>(static_cast<const void*>(chainNode));
+                createInfo.pipelineCompileThreadCount = pipelineCompile->threadCount;
+            }
+            if (chainNode->sType == GFX_STRUCTURE_TYPE_DEVICE_SUBMIT_DESCRIPTOR) {
+                const auto* submit = static_cast<const GfxDeviceSubmitDescriptor*>(static_cast<const void*>(chainNode));
+                createInfo.deferSubmits = submit->deferSubmits;
+            }
+            chainNode = static_cast<const GfxChainHeader*>(chainNode->pNext);
+        }
     }
 
     return createInfo;
@@ -1460,17 +1527,7 @@ core::BindGroupLayoutCreateInfo gfxDescriptorToBindGroupLayoutCreateInfo(const G
             break;
         }
 
-        // Convert GfxShaderStage to VkShaderStageFlags
-        layoutEntry.stageFlags = 0;
-        if (entry.visibility & GFX_SHADER_STAGE_VERTEX) {
-            layoutEntry.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
-        }
-        if (entry.visibility & GFX_SHADER_STAGE_FRAGMENT) {
-            layoutEntry.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
-        }
-        if (entry.visibility & GFX_SHADER_STAGE_COMPUTE) {
-            layoutEntry.stageFlags |= VK_SHADER_STAGE_COMPUTE_BIT;
-        }
+        layoutEntry.stageFlags = gfxShaderStageFlagsToVkShaderStageFlags(entry.visibility);
 
         createInfo.entries.push_back(layoutEntry);
     }
@@ -1538,6 +1595,7 @@ core::RenderPipelineCreateInfo gfxDescriptorToRenderPipelineCreateInfo(const Gfx
         auto* layout = converter::toNative<core::BindGroupLayout>(descriptor->bindGroupLayouts[i]);
         createInfo.bindGroupLayouts.push_back(layout->handle());
     }
+    createInfo.pushConstantRanges = gfxImmediateDataRangesToVkPushConstantRanges(descriptor->immediateDataRanges, descriptor->immediateDataRangeCount);
 
     // Vertex state
     auto* vertShader = converter::toNative<core::Shader>(descriptor->vertex->module);
@@ -1643,6 +1701,7 @@ core::ComputePipelineCreateInfo gfxDescriptorToComputePipelineCreateInfo(const G
         auto* layout = converter::toNative<core::BindGroupLayout>(descriptor->bindGroupLayouts[i]);
         createInfo.bindGroupLayouts.push_back(layout->handle());
     }
+    createInfo.pushConstantRanges = gfxImmediateDataRangesToVkPushConstantRanges(descriptor->immediateDataRanges, descriptor->immediateDataRangeCount);
 
     // Compute shader
     auto* computeShader = converter::toNative<core::Shader>(descriptor->compute);
@@ -1661,6 +1720,12 @@ core::SubmitInfo gfxDescriptorToSubmitInfo(const GfxSubmitDescriptor* descriptor
     submitInfo.signalFence = converter::toNative<core::Fence>(descriptor->signalFence);
     submitInfo.waitSemaphores = reinterpret_cast<core::Semaphore**>(descriptor->waitSemaphores);
     submitInfo.waitValues = descriptor->waitValues;
+    if (descriptor->waitStageMasks) {
+        submitInfo.waitStageMasks.reserve(descriptor->waitSemaphoreCount);
+        for (uint32_t i = 0; i < descriptor->waitSemaphoreCount; ++i) {
+            submitInfo.waitStageMasks.push_back(gfxPipelineStageFlagsToVkPipelineStageFlags(descriptor->waitStageMasks[i]));
+        }
+    }
     submitInfo.waitSemaphoreCount = descriptor->waitSemaphoreCount;
     submitInfo.signalSemaphores = reinterpret_cast<core::Semaphore**>(descriptor->signalSemaphores);
     submitInfo.signalValues = descriptor->signalValues;
@@ -1759,6 +1824,7 @@ core::FramebufferCreateInfo gfxFramebufferDescriptorToFramebufferCreateInfo(cons
     if (descriptor->renderPass) {
         auto* renderPass = toNative<core::RenderPass>(descriptor->renderPass);
         createInfo.renderPass = renderPass->handle();
+        createInfo.renderPassKey = renderPass->compatibilityKey();
     }
 
     createInfo.colorAttachmentCount = descriptor->colorAttachmentCount;
@@ -1770,11 +1836,13 @@ core::FramebufferCreateInfo gfxFramebufferDescriptorToFramebufferCreateInfo(cons
 
         auto* view = toNative<core::TextureView>(colorAtt.view);
         createInfo.attachments.push_back(view->handle());
+        createInfo.attachmentInfos.push_back(view->getFramebufferAttachmentInfo());
 
         // Add resolve target if provided
         if (colorAtt.resolveTarget) {
             auto* resolveView = toNative<core::TextureView>(colorAtt.resolveTarget);
             createInfo.attachments.push_back(resolveView->handle());
+            createInfo.attachmentInfos.push_back(resolveView->getFramebufferAttachmentInfo());
         }
     }
 
@@ -1782,11 +1850,13 @@ core::FramebufferCreateInfo gfxFramebufferDescriptorToFramebufferCreateInfo(cons
     if (descriptor->depthStencilAttachment.view) {
         auto* view = toNative<core::TextureView>(descriptor->depthStencilAttachment.view);
         createInfo.attachments.push_back(view->handle());
+        createInfo.attachmentInfos.push_back(view->getFramebufferAttachmentInfo());
 
         // Add depth resolve target if provided
         if (descriptor->depthStencilAttachment.resolveTarget) {
             auto* resolveView = toNative<core::TextureView>(descriptor->depthStencilAttachment.resolveTarget);
             createInfo.attachments.push_back(resolveView->handle());
+            createInfo.attachmentInfos.push_back(resolveView->getFramebufferAttachmentInfo());
             createInfo.hasDepthResolve = true;
         }
     }
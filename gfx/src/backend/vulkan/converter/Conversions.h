@@ -57,6 +57,8 @@ GfxTextureUsageFlags vkImageUsageToGfxTextureUsage(VkImageUsageFlags vkUsage);
 VkPipelineStageFlags gfxPipelineStageFlagsToVkPipelineStageFlags(GfxPipelineStageFlags gfxStage);
 VkAccessFlags gfxAccessFlagsToVkAccessFlags(GfxAccessFlags gfxAccessFlags);
 VkIndexType gfxIndexFormatToVkIndexType(GfxIndexFormat format);
+VkShaderStageFlags gfxShaderStageFlagsToVkShaderStageFlags(GfxShaderStageFlags gfxStages);
+std::vector<VkPushConstantRange> gfxImmediateDataRangesToVkPushConstantRanges(const GfxImmediateDataRange* ranges, uint32_t rangeCount);
 core::Viewport gfxViewportToViewport(const GfxViewport* viewport);
 core::ScissorRect gfxScissorRectToScissorRect(const GfxScissorRect* scissor);
 
@@ -74,6 +76,12 @@ core::TextureBarrier gfxTextureBarrierToTextureBarrier(const GfxTextureBarrier&
 
 GfxDeviceLimits vkPropertiesToGfxDeviceLimits(const VkPhysicalDeviceProperties& properties);
 
+// ============================================================================
+// Memory Stats Conversion
+// ============================================================================
+
+GfxDeviceMemoryStats vkMemoryStatsToGfxDeviceMemoryStats(const core::MemoryStats& stats);
+
 // ============================================================================
 // Queue Family Conversion
 // ============================================================================
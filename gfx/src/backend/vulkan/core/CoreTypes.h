@@ -32,6 +32,8 @@ namespace extensions {
     constexpr const char* TIMELINE_SEMAPHORE = "gfx_timeline_semaphore";
     constexpr const char* MULTIVIEW = "gfx_multiview";
     constexpr const char* ANISOTROPIC_FILTERING = "gfx_anisotropic_filtering";
+    constexpr const char* UPLOAD_QUEUE = "gfx_upload_queue";
+    constexpr const char* DRAW_INDIRECT_COUNT = "gfx_draw_indirect_count";
 } // namespace extensions
 
 // ============================================================================
@@ -78,6 +80,16 @@ struct BufferInfo {
     VkMemoryPropertyFlags memoryProperties;
 };
 
+struct MemoryStats {
+    uint64_t blockCount = 0;
+    uint64_t dedicatedAllocationCount = 0;
+    uint64_t allocationCount = 0; // Sub-allocations and dedicated allocations
+    uint64_t reservedBytes = 0; // Device memory held in blocks and dedicated allocations
+    uint64_t usedBytes = 0;
+    uint64_t largestFreeRange = 0;
+    float fragmentation = 0.0f; // 1 - largestFreeRange / free bytes in blocks
+};
+
 struct TextureCreateInfo {
     VkFormat format;
     VkExtent3D size;
@@ -108,6 +120,7 @@ struct TextureInfo {
     uint32_t mipLevelCount;
     VkSampleCountFlagBits sampleCount;
     VkImageUsageFlags usage;
+    VkImageCreateFlags flags;
 };
 
 struct SwapchainInfo {
@@ -256,6 +269,11 @@ struct DeviceCreateInfo {
 
     std::vector<std::string> enabledExtensions;
     std::vector<QueueRequest> queueRequests;
+    const void* pipelineCacheData = nullptr; // Only read during device creation
+    size_t pipelineCacheDataSize = 0;
+    bool* pipelineCacheDataAccepted = nullptr; // Optional, written during device creation
+    uint32_t pipelineCompileThreadCount = 0; // 0 = PipelineCompilePool::defaultThreadCount()
+    bool deferSubmits = false; // Queue::submit holds back submits without a fence until a flush point
 };
 
 struct PlatformWindowHandle {
@@ -354,6 +372,7 @@ struct DepthStencilState {
 struct RenderPipelineCreateInfo {
     VkRenderPass renderPass = VK_NULL_HANDLE; // Render pass this pipeline will be used with
     std::vector<VkDescriptorSetLayout> bindGroupLayouts;
+    std::vector<VkPushConstantRange> pushConstantRanges;
     VertexState vertex;
     FragmentState fragment;
     PrimitiveState primitive;
@@ -363,6 +382,7 @@ struct RenderPipelineCreateInfo {
 
 struct ComputePipelineCreateInfo {
     std::vector<VkDescriptorSetLayout> bindGroupLayouts;
+    std::vector<VkPushConstantRange> pushConstantRanges;
     VkShaderModule module;
     const char* entryPoint;
 };
@@ -408,9 +428,24 @@ struct RenderPassCreateInfo {
     std::vector<uint32_t> correlationMasks;
 };
 
+// What an imageless framebuffer is created with in place of an attachment view
+struct FramebufferAttachmentInfo {
+    VkImageCreateFlags flags;
+    VkImageUsageFlags usage;
+    uint32_t width; // Of the view's base mip level
+    uint32_t height;
+    uint32_t layerCount;
+    VkFormat format; // View format
+};
+
 struct FramebufferCreateInfo {
     VkRenderPass renderPass = VK_NULL_HANDLE;
+    // RenderPass::compatibilityKey() of renderPass. Lets compatible render passes share the
+    // framebuffer; if empty the framebuffer is destroyed as soon as it is released.
+    std::string renderPassKey;
     std::vector<VkImageView> attachments; // Interleaved: [color0, resolve0, color1, resolve1, ..., depth, depthResolve]
+    // Parallel to attachments. If set the framebuffer is imageless on devices that support it.
+    std::vector<FramebufferAttachmentInfo> attachmentInfos;
     uint32_t width = 0;
     uint32_t height = 0;
     uint32_t colorAttachmentCount = 0; // Number of color attachments (not including resolves)
@@ -433,6 +468,7 @@ struct SubmitInfo {
     Fence* signalFence;
     Semaphore** waitSemaphores;
     uint64_t* waitValues;
+    std::vector<VkPipelineStageFlags> waitStageMasks; // Empty, or one per wait semaphore (0 for the default)
     uint32_t waitSemaphoreCount;
     Semaphore** signalSemaphores;
     uint64_t* signalValues;
@@ -0,0 +1,217 @@
+#include "BarrierBatch.h"
+
+#include <algorithm>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    bool rangesOverlap(uint64_t offsetA, uint64_t sizeA, uint64_t offsetB, uint64_t sizeB)
+    {
+        const uint64_t endA = sizeA == VK_WHOLE_SIZE ? UINT64_MAX : offsetA + sizeA;
+        const uint64_t endB = sizeB == VK_WHOLE_SIZE ? UINT64_MAX : offsetB + sizeB;
+        return offsetA < endB && offsetB < endA;
+    }
+
+    bool subresourcesOverlap(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b)
+    {
+        return rangesOverlap(a.baseMipLevel, a.levelCount, b.baseMipLevel, b.levelCount)
+            && rangesOverlap(a.baseArrayLayer, a.layerCount, b.baseArrayLayer, b.layerCount);
+    }
+
+    // The first 32 bits of the synchronization2 stage and access flags are the original ones
+    VkPipelineStageFlags toStageFlags(VkPipelineStageFlags2KHR stages)
+    {
+        return static_cast<VkPipelineStageFlags>(stages);
+    }
+
+    VkAccessFlags toAccessFlags(VkAccessFlags2KHR access)
+    {
+        return static_cast<VkAccessFlags>(access);
+    }
+} // anonymous namespace
+
+BarrierBatch::BarrierBatch(VkCommandBuffer commandBuffer, PFN_vkCmdPipelineBarrier2KHR pipelineBarrier2)
+    : m_commandBuffer(commandBuffer)
+    , m_pipelineBarrier2(pipelineBarrier2)
+{
+}
+
+void BarrierBatch::addMemoryBarrier(const VkMemoryBarrier& barrier, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+{
+    VkMemoryBarrier2KHR barrier2{};
+    barrier2.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+    barrier2.srcStageMask = srcStage;
+    barrier2.srcAccessMask = barrier.srcAccessMask;
+    barrier2.dstStageMask = dstStage;
+    barrier2.dstAccessMask = barrier.dstAccessMask;
+    m_memoryBarriers.push_back(barrier2);
+}
+
+void BarrierBatch::addBufferBarrier(const VkBufferMemoryBarrier& barrier, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+{
+    bool overlaps = std::any_of(m_bufferBarriers.begin(), m_bufferBarriers.end(), [&barrier](const VkBufferMemoryBarrier2KHR& pending) {
+        return pending.buffer == barrier.buffer && rangesOverlap(pending.offset, pending.size, barrier.offset, barrier.size);
+    });
+    if (overlaps) {
+        flush();
+    }
+
+    VkBufferMemoryBarrier2KHR barrier2{};
+    barrier2.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+    barrier2.srcStageMask = srcStage;
+    barrier2.srcAccessMask = barrier.srcAccessMask;
+    barrier2.dstStageMask = dstStage;
+    barrier2.dstAccessMask = barrier.dstAccessMask;
+    barrier2.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+    barrier2.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+    barrier2.buffer = barrier.buffer;
+    barrier2.offset = barrier.offset;
+    barrier2.size = barrier.size;
+    m_bufferBarriers.push_back(barrier2);
+}
+
+void BarrierBatch::addImageBarrier(const VkImageMemoryBarrier& barrier, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+{
+    bool overlaps = std::any_of(m_imageBarriers.begin(), m_imageBarriers.end(), [&barrier](const VkImageMemoryBarrier2KHR& pending) {
+        return pending.image == barrier.image && subresourcesOverlap(pending.subresourceRange, barrier.subresourceRange);
+    });
+    if (overlaps) {
+        flush();
+    }
+
+    VkImageMemoryBarrier2KHR barrier2{};
+    barrier2.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+    barrier2.srcStageMask = srcStage;
+    barrier2.srcAccessMask = barrier.srcAccessMask;
+    barrier2.dstStageMask = dstStage;
+    barrier2.dstAccessMask = barrier.dstAccessMask;
+    barrier2.oldLayout = barrier.oldLayout;
+    barrier2.newLayout = barrier.newLayout;
+    barrier2.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+    barrier2.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+    barrier2.image = barrier.image;
+    barrier2.subresourceRange = barrier.subresourceRange;
+    m_imageBarriers.push_back(barrier2);
+}
+
+void BarrierBatch::addElided(uint64_t count)
+{
+    m_stats.elidedBarrierCount += count;
+}
+
+bool BarrierBatch::empty() const
+{
+    return m_memoryBarriers.empty() && m_bufferBarriers.empty() && m_imageBarriers.empty();
+}
+
+void BarrierBatch::flush()
+{
+    if (empty()) {
+        return;
+    }
+
+    recordPipelineBarrier();
+
+    m_stats.barrierCount += m_memoryBarriers.size() + m_bufferBarriers.size() + m_imageBarriers.size();
+    ++m_stats.pipelineBarrierCount;
+    clear();
+}
+
+void BarrierBatch::clear()
+{
+    m_memoryBarriers.clear();
+    m_bufferBarriers.clear();
+    m_imageBarriers.clear();
+}
+
+const BarrierStats& BarrierBatch::getStats() const
+{
+    return m_stats;
+}
+
+void BarrierBatch::resetStats()
+{
+    m_stats = {};
+}
+
+void BarrierBatch::recordPipelineBarrier()
+{
+    if (m_pipelineBarrier2) {
+        VkDependencyInfoKHR dependencyInfo{};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.memoryBarrierCount = static_cast<uint32_t>(m_memoryBarriers.size());
+        dependencyInfo.pMemoryBarriers = m_memoryBarriers.empty() ? nullptr : m_memoryBarriers.data();
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(m_bufferBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers = m_bufferBarriers.empty() ? nullptr : m_bufferBarriers.data();
+        dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(m_imageBarriers.size());
+        dependencyInfo.pImageMemoryBarriers = m_imageBarriers.empty() ? nullptr : m_imageBarriers.data();
+        m_pipelineBarrier2(m_commandBuffer, &dependencyInfo);
+        return;
+    }
+
+    // One source and destination stage mask for all barriers
+    VkPipelineStageFlags srcStage = 0;
+    VkPipelineStageFlags dstStage = 0;
+
+    std::vector<VkMemoryBarrier> memoryBarriers;
+    memoryBarriers.reserve(m_memoryBarriers.size());
+    for (const auto& barrier2 : m_memoryBarriers) {
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = toAccessFlags(barrier2.srcAccessMask);
+        barrier.dstAccessMask = toAccessFlags(barrier2.dstAccessMask);
+        memoryBarriers.push_back(barrier);
+        srcStage |= toStageFlags(barrier2.srcStageMask);
+        dstStage |= toStageFlags(barrier2.dstStageMask);
+    }
+
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    bufferBarriers.reserve(m_bufferBarriers.size());
+    for (const auto& barrier2 : m_bufferBarriers) {
+        VkBufferMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = toAccessFlags(barrier2.srcAccessMask);
+        barrier.dstAccessMask = toAccessFlags(barrier2.dstAccessMask);
+        barrier.srcQueueFamilyIndex = barrier2.srcQueueFamilyIndex;
+        barrier.dstQueueFamilyIndex = barrier2.dstQueueFamilyIndex;
+        barrier.buffer = barrier2.buffer;
+        barrier.offset = barrier2.offset;
+        barrier.size = barrier2.size;
+        bufferBarriers.push_back(barrier);
+        srcStage |= toStageFlags(barrier2.srcStageMask);
+        dstStage |= toStageFlags(barrier2.dstStageMask);
+    }
+
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+    imageBarriers.reserve(m_imageBarriers.size());
+    for (const auto& barrier2 : m_imageBarriers) {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = toAccessFlags(barrier2.srcAccessMask);
+        barrier.dstAccessMask = toAccessFlags(barrier2.dstAccessMask);
+        barrier.oldLayout = barrier2.oldLayout;
+        barrier.newLayout = barrier2.newLayout;
+        barrier.srcQueueFamilyIndex = barrier2.srcQueueFamilyIndex;
+        barrier.dstQueueFamilyIndex = barrier2.dstQueueFamilyIndex;
+        barrier.image = barrier2.image;
+        barrier.subresourceRange = barrier2.subresourceRange;
+        imageBarriers.push_back(barrier);
+        srcStage |= toStageFlags(barrier2.srcStageMask);
+        dstStage |= toStageFlags(barrier2.dstStageMask);
+    }
+
+    // Stage masks must not be empty here, unlike with synchronization2
+    if (srcStage == 0) {
+        srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    }
+    if (dstStage == 0) {
+        dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    }
+
+    vkCmdPipelineBarrier(m_commandBuffer, srcStage, dstStage, 0,
+        static_cast<uint32_t>(memoryBarriers.size()), memoryBarriers.empty() ? nullptr : memoryBarriers.data(),
+        static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.empty() ? nullptr : bufferBarriers.data(),
+        static_cast<uint32_t>(imageBarriers.size()), imageBarriers.empty() ? nullptr : imageBarriers.data());
+}
+
+} // namespace gfx::backend::vulkan::core
@@ -0,0 +1,55 @@
+#ifndef GFX_VULKAN_BARRIER_BATCH_H
+#define GFX_VULKAN_BARRIER_BATCH_H
+
+#include "../CoreTypes.h"
+
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+struct BarrierStats {
+    uint64_t barrierCount = 0; // Memory, buffer and image barriers recorded
+    uint64_t pipelineBarrierCount = 0; // vkCmdPipelineBarrier calls they were recorded with
+    uint64_t elidedBarrierCount = 0; // Transitions that needed no barrier at all
+};
+
+// Collects the barriers inferred for one command buffer and records them together in a single
+// vkCmdPipelineBarrier2 when flushed, each barrier keeping its own stage masks. Without
+// synchronization2 they are recorded with vkCmdPipelineBarrier and the union of the stage masks.
+// Barriers for the same subresource or buffer range are not ordered within one call, so adding
+// one that overlaps a pending barrier flushes the pending ones first.
+class BarrierBatch {
+public:
+    BarrierBatch(const BarrierBatch&) = delete;
+    BarrierBatch& operator=(const BarrierBatch&) = delete;
+
+    // pipelineBarrier2 is Device::getCmdPipelineBarrier2(), nullptr without synchronization2
+    BarrierBatch(VkCommandBuffer commandBuffer, PFN_vkCmdPipelineBarrier2KHR pipelineBarrier2);
+
+    void addMemoryBarrier(const VkMemoryBarrier& barrier, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage);
+    void addBufferBarrier(const VkBufferMemoryBarrier& barrier, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage);
+    void addImageBarrier(const VkImageMemoryBarrier& barrier, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage);
+    void addElided(uint64_t count = 1);
+
+    bool empty() const;
+    void flush();
+    // Drops pending barriers without recording them, for a command buffer that is being reset
+    void clear();
+
+    const BarrierStats& getStats() const;
+    void resetStats();
+
+private:
+    void recordPipelineBarrier();
+
+    VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
+    PFN_vkCmdPipelineBarrier2KHR m_pipelineBarrier2 = nullptr;
+    std::vector<VkMemoryBarrier2KHR> m_memoryBarriers;
+    std::vector<VkBufferMemoryBarrier2KHR> m_bufferBarriers;
+    std::vector<VkImageMemoryBarrier2KHR> m_imageBarriers;
+    BarrierStats m_stats{};
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_BARRIER_BATCH_H
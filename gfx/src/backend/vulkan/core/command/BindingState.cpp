@@ -0,0 +1,101 @@
+#include "BindingState.h"
+
+#include <algorithm>
+
+namespace gfx::backend::vulkan::core {
+
+bool BindingState::setPipeline(VkPipeline pipeline)
+{
+    bool redundant = m_pipeline == pipeline;
+    m_pipeline = pipeline;
+    return record(redundant);
+}
+
+bool BindingState::setDescriptorSet(uint32_t index, VkPipelineLayout layout, VkDescriptorSet set, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+{
+    if (index >= m_descriptorSets.size()) {
+        m_descriptorSets.resize(index + 1);
+    }
+
+    DescriptorSetBinding& binding = m_descriptorSets[index];
+    bool redundant = binding.layout == layout && binding.set == set
+        && std::equal(binding.dynamicOffsets.begin(), binding.dynamicOffsets.end(), dynamicOffsets, dynamicOffsets + dynamicOffsetCount);
+    if (!redundant) {
+        if (binding.layout != layout) {
+            // Vulkan disturbs every set above and any lower set bound with an incompatible layout
+            m_descriptorSets.resize(index + 1);
+            for (uint32_t lower = 0; lower < index; ++lower) {
+                if (m_descriptorSets[lower].layout != layout) {
+                    m_descriptorSets[lower] = {};
+                }
+            }
+        }
+        binding.layout = layout;
+        binding.set = set;
+        binding.dynamicOffsets.assign(dynamicOffsets, dynamicOffsets + dynamicOffsetCount);
+    }
+    return record(redundant);
+}
+
+bool BindingState::setVertexBuffer(uint32_t slot, VkBuffer buffer, VkDeviceSize offset)
+{
+    if (slot >= m_vertexBuffers.size()) {
+        m_vertexBuffers.resize(slot + 1);
+    }
+
+    VertexBufferBinding& binding = m_vertexBuffers[slot];
+    bool redundant = binding.buffer == buffer && binding.offset == offset;
+    binding.buffer = buffer;
+    binding.offset = offset;
+    return record(redundant);
+}
+
+bool BindingState::setIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+    bool redundant = m_indexBuffer.has_value() && m_indexBuffer->buffer == buffer
+        && m_indexBuffer->offset == offset && m_indexBuffer->indexType == indexType;
+    m_indexBuffer = IndexBufferBinding{ buffer, offset, indexType };
+    return record(redundant);
+}
+
+bool BindingState::setViewport(const VkViewport& viewport)
+{
+    bool redundant = m_viewport.has_value() && m_viewport->x == viewport.x && m_viewport->y == viewport.y
+        && m_viewport->width == viewport.width && m_viewport->height == viewport.height
+        && m_viewport->minDepth == viewport.minDepth && m_viewport->maxDepth == viewport.maxDepth;
+    m_viewport = viewport;
+    return record(redundant);
+}
+
+bool BindingState::setScissor(const VkRect2D& scissor)
+{
+    bool redundant = m_scissor.has_value() && m_scissor->offset.x == scissor.offset.x && m_scissor->offset.y == scissor.offset.y
+        && m_scissor->extent.width == scissor.extent.width && m_scissor->extent.height == scissor.extent.height;
+    m_scissor = scissor;
+    return record(redundant);
+}
+
+void BindingState::invalidate()
+{
+    m_pipeline = VK_NULL_HANDLE;
+    m_descriptorSets.clear();
+    m_vertexBuffers.clear();
+    m_indexBuffer.reset();
+    m_viewport.reset();
+    m_scissor.reset();
+}
+
+uint64_t BindingState::filteredCount() const
+{
+    return m_filteredCount;
+}
+
+bool BindingState::record(bool redundant)
+{
+    if (redundant) {
+        ++m_filteredCount;
+    }
+    return !redundant;
+}
+
+} // namespace gfx::backend::vulkan::core
@@ -0,0 +1,62 @@
+#ifndef GFX_VULKAN_BINDING_STATE_H
+#define GFX_VULKAN_BINDING_STATE_H
+
+#include "../CoreTypes.h"
+
+#include <optional>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+// Shadow copy of the state a pass encoder has bound on its command buffer. Each set*() returns
+// false if the value is already bound, in which case the caller drops the vkCmd* and the call
+// is counted as filtered.
+class BindingState {
+public:
+    bool setPipeline(VkPipeline pipeline);
+    // Sets are keyed by pipeline layout too, so switching to a different layout rebinds them;
+    // a bind under another layout forgets the sets it disturbs (all above, and lower ones of other layouts)
+    bool setDescriptorSet(uint32_t index, VkPipelineLayout layout, VkDescriptorSet set, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+    bool setVertexBuffer(uint32_t slot, VkBuffer buffer, VkDeviceSize offset);
+    bool setIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
+    bool setViewport(const VkViewport& viewport);
+    bool setScissor(const VkRect2D& scissor);
+
+    // Forgets all bound state, e.g. after executing secondary command buffers
+    void invalidate();
+
+    uint64_t filteredCount() const;
+
+private:
+    struct DescriptorSetBinding {
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        VkDescriptorSet set = VK_NULL_HANDLE;
+        std::vector<uint32_t> dynamicOffsets;
+    };
+
+    struct VertexBufferBinding {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+    };
+
+    struct IndexBufferBinding {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkIndexType indexType = VK_INDEX_TYPE_UINT16;
+    };
+
+    // Counts the call as filtered if redundant, returns whether it must be recorded
+    bool record(bool redundant);
+
+    VkPipeline m_pipeline = VK_NULL_HANDLE;
+    std::vector<DescriptorSetBinding> m_descriptorSets; // Indexed by set index
+    std::vector<VertexBufferBinding> m_vertexBuffers; // Indexed by slot
+    std::optional<IndexBufferBinding> m_indexBuffer;
+    std::optional<VkViewport> m_viewport;
+    std::optional<VkRect2D> m_scissor;
+    uint64_t m_filteredCount = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_BINDING_STATE_H
@@ -3,49 +3,27 @@
 #include "../resource/Buffer.h"
 #include "../resource/Texture.h"
 #include "../system/Device.h"
-#include "../system/Queue.h"
 #include "../util/Utils.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace gfx::backend::vulkan::core {
 
+// Pools are recycled through the device instead of being created per encoder
 CommandEncoder::CommandEncoder(Device* device)
-    : m_device(device)
+    : m_lease(device->getCommandPoolArena()->acquire())
+    , m_commandBuffer(m_lease.commandBuffer)
+    , m_barriers(m_commandBuffer, device->getCmdPipelineBarrier2())
+    , m_device(device)
 {
-    // Create command pool
-    VkCommandPoolCreateInfo poolInfo{};
-    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    poolInfo.queueFamilyIndex = device->getQueue()->family();
-
-    VkResult result = vkCreateCommandPool(m_device->handle(), &poolInfo, nullptr, &m_commandPool);
-    if (result != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create command pool");
-    }
-
-    // Allocate command buffer
-    VkCommandBufferAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.commandPool = m_commandPool;
-    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandBufferCount = 1;
-
-    result = vkAllocateCommandBuffers(m_device->handle(), &allocInfo, &m_commandBuffer);
-    if (result != VK_SUCCESS) {
-        vkDestroyCommandPool(m_device->handle(), m_commandPool, nullptr);
-        throw std::runtime_error("Failed to allocate command buffer");
-    }
-
     // Begin recording
     begin();
 }
 
 CommandEncoder::~CommandEncoder()
 {
-    if (m_commandPool != VK_NULL_HANDLE) {
-        vkDestroyCommandPool(m_device->handle(), m_commandPool, nullptr);
-    }
+    m_device->getCommandPoolArena()->release(m_lease);
 }
 
 VkCommandBuffer CommandEncoder::handle() const
@@ -73,6 +51,52 @@ void CommandEncoder::setCurrentPipelineLayout(VkPipelineLayout layout)
     m_currentPipelineLayout = layout;
 }
 
+uint64_t CommandEncoder::filteredCommandCount() const
+{
+    return m_filteredCommandCount;
+}
+
+void CommandEncoder::addFilteredCommandCount(uint64_t count)
+{
+    m_filteredCommandCount += count;
+}
+
+BarrierBatch& CommandEncoder::barriers()
+{
+    return m_barriers;
+}
+
+void CommandEncoder::flushBarriers()
+{
+    m_barriers.flush();
+}
+
+const BarrierStats& CommandEncoder::barrierStats() const
+{
+    return m_barriers.getStats();
+}
+
+void CommandEncoder::trackTransferAccess(VkBuffer buffer, uint64_t offset, uint64_t size, bool write)
+{
+    const uint64_t end = size == VK_WHOLE_SIZE ? UINT64_MAX : offset + size;
+    bool hazard = std::any_of(m_transferAccesses.begin(), m_transferAccesses.end(), [&](const TransferBufferAccess& access) {
+        const uint64_t accessEnd = access.size == VK_WHOLE_SIZE ? UINT64_MAX : access.offset + access.size;
+        return access.buffer == buffer && (access.write || write) && access.offset < end && offset < accessEnd;
+    });
+
+    if (hazard) {
+        // One memory barrier orders every transfer recorded so far, so start tracking anew
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        m_barriers.addMemoryBarrier(barrier, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        m_transferAccesses.clear();
+    }
+
+    m_transferAccesses.push_back({ buffer, offset, size, write });
+}
+
 void CommandEncoder::begin()
 {
     if (!m_isRecording) {
@@ -88,6 +112,7 @@ void CommandEncoder::begin()
 void CommandEncoder::end()
 {
     if (m_isRecording) {
+        flushBarriers();
         vkEndCommandBuffer(m_commandBuffer);
         m_isRecording = false;
     }
@@ -96,9 +121,13 @@ void CommandEncoder::end()
 void CommandEncoder::reset()
 {
     m_currentPipelineLayout = VK_NULL_HANDLE;
+    m_filteredCommandCount = 0;
+    m_barriers.clear();
+    m_barriers.resetStats();
+    m_transferAccesses.clear();
 
     // Reset the command pool (this implicitly resets all command buffers)
-    vkResetCommandPool(m_device->handle(), m_commandPool, 0);
+    vkResetCommandPool(m_device->handle(), m_lease.pool, 0);
 
     // Mark as not recording since the command buffer was reset
     m_isRecording = false;
@@ -109,18 +138,8 @@ void CommandEncoder::reset()
 
 void CommandEncoder::pipelineBarrier(const MemoryBarrier* memoryBarriers, uint32_t memoryBarrierCount, const BufferBarrier* bufferBarriers, uint32_t bufferBarrierCount, const TextureBarrier* textureBarriers, uint32_t textureBarrierCount)
 {
-    std::vector<VkMemoryBarrier> memBarriers;
-    memBarriers.reserve(memoryBarrierCount);
-
-    std::vector<VkBufferMemoryBarrier> bufferMemoryBarriers;
-    bufferMemoryBarriers.reserve(bufferBarrierCount);
-
-    std::vector<VkImageMemoryBarrier> imageBarriers;
-    imageBarriers.reserve(textureBarrierCount);
-
-    // Combine pipeline stages from all barriers
-    VkPipelineStageFlags srcStage = 0;
-    VkPipelineStageFlags dstStage = 0;
+    // Explicit barriers are kept as given, even read to read ones may extend a dependency chain.
+    // They are recorded together with the transitions still pending from earlier copies.
 
     // Process memory barriers
     for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
@@ -131,10 +150,7 @@ void CommandEncoder::pipelineBarrier(const MemoryBarrier* memoryBarriers, uint32
         vkBarrier.srcAccessMask = barrier.srcAccessMask;
         vkBarrier.dstAccessMask = barrier.dstAccessMask;
 
-        memBarriers.push_back(vkBarrier);
-
-        srcStage |= barrier.srcStageMask;
-        dstStage |= barrier.dstStageMask;
+        m_barriers.addMemoryBarrier(vkBarrier, barrier.srcStageMask, barrier.dstStageMask);
     }
 
     // Process buffer barriers
@@ -151,10 +167,7 @@ void CommandEncoder::pipelineBarrier(const MemoryBarrier* memoryBarriers, uint32
         vkBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         vkBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
 
-        bufferMemoryBarriers.push_back(vkBarrier);
-
-        srcStage |= barrier.srcStageMask;
-        dstStage |= barrier.dstStageMask;
+        m_barriers.addBufferBarrier(vkBarrier, barrier.srcStageMask, barrier.dstStageMask);
     }
 
     // Process texture barriers
@@ -178,16 +191,17 @@ void CommandEncoder::pipelineBarrier(const MemoryBarrier* memoryBarriers, uint32
         vkBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         vkBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
 
-        imageBarriers.push_back(vkBarrier);
-
-        srcStage |= barrier.srcStageMask;
-        dstStage |= barrier.dstStageMask;
+        m_barriers.addImageBarrier(vkBarrier, barrier.srcStageMask, barrier.dstStageMask);
 
-        // Update tracked layout
-        barrier.texture->setLayout(barrier.newLayout);
+        // Update tracked state of the covered subresources
+        TextureSubresourceState state{};
+        state.layout = barrier.newLayout;
+        state.accessMask = barrier.dstAccessMask;
+        state.stageMask = barrier.dstStageMask;
+        barrier.texture->setSubresourceState(state, barrier.baseMipLevel, barrier.mipLevelCount, barrier.baseArrayLayer, barrier.arrayLayerCount);
     }
 
-    vkCmdPipelineBarrier(m_commandBuffer, srcStage, dstStage, 0, static_cast<uint32_t>(memBarriers.size()), memBarriers.empty() ? nullptr : memBarriers.data(), static_cast<uint32_t>(bufferMemoryBarriers.size()), bufferMemoryBarriers.empty() ? nullptr : bufferMemoryBarriers.data(), static_cast<uint32_t>(imageBarriers.size()), imageBarriers.empty() ? nullptr : imageBarriers.data());
+    flushBarriers();
 }
 
 void CommandEncoder::copyBufferToBuffer(Buffer* source, uint64_t sourceOffset,
@@ -199,13 +213,20 @@ void CommandEncoder::copyBufferToBuffer(Buffer* source, uint64_t sourceOffset,
     copyRegion.dstOffset = destinationOffset;
     copyRegion.size = size;
 
+    trackTransferAccess(source->handle(), sourceOffset, size, false);
+    trackTransferAccess(destination->handle(), destinationOffset, size, true);
+    flushBarriers();
+
     vkCmdCopyBuffer(m_commandBuffer, source->handle(), destination->handle(), 1, &copyRegion);
 }
 
 void CommandEncoder::copyBufferToTexture(Buffer* source, uint64_t sourceOffset, Texture* destination, VkOffset3D origin, VkExtent3D extent, uint32_t mipLevel, VkImageLayout finalLayout)
 {
-    // Transition image layout to transfer dst optimal
+    // Transition image layout to transfer dst optimal, together with any pending barriers.
+    // The bytes read depend on the format, so the rest of the buffer is assumed to be read
     destination->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevel, 1, 0, 1);
+    trackTransferAccess(source->handle(), sourceOffset, VK_WHOLE_SIZE, false);
+    flushBarriers();
 
     // Copy buffer to image
     VkBufferImageCopy region{};
@@ -221,14 +242,17 @@ void CommandEncoder::copyBufferToTexture(Buffer* source, uint64_t sourceOffset,
 
     vkCmdCopyBufferToImage(m_commandBuffer, source->handle(), destination->handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 
-    // Transition image layout to final layout
+    // Transition image layout to final layout, recorded with the next barriers
     destination->transitionLayout(this, finalLayout, mipLevel, 1, 0, 1);
 }
 
 void CommandEncoder::copyTextureToBuffer(Texture* source, VkOffset3D origin, uint32_t mipLevel, Buffer* destination, uint64_t destinationOffset, VkExtent3D extent, VkImageLayout finalLayout)
 {
-    // Transition image layout to transfer src optimal
+    // Transition image layout to transfer src optimal, together with any pending barriers.
+    // The bytes written depend on the format, so the rest of the buffer is assumed to be written
     source->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, mipLevel, 1, 0, 1);
+    trackTransferAccess(destination->handle(), destinationOffset, VK_WHOLE_SIZE, true);
+    flushBarriers();
 
     // Copy image to buffer
     VkBufferImageCopy region{};
@@ -245,7 +269,7 @@ void CommandEncoder::copyTextureToBuffer(Texture* source, VkOffset3D origin, uin
     vkCmdCopyImageToBuffer(m_commandBuffer, source->handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
         destination->handle(), 1, &region);
 
-    // Transition image layout to final layout
+    // Transition image layout to final layout, recorded with the next barriers
     source->transitionLayout(this, finalLayout, mipLevel, 1, 0, 1);
 }
 
@@ -265,9 +289,10 @@ void CommandEncoder::copyTextureToTexture(Texture* source, VkOffset3D sourceOrig
         layerCount = 1;
     }
 
-    // Transition images to transfer layouts
-    source->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, sourceMipLevel, 1, sourceOrigin.z, layerCount);
-    destination->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, destinationMipLevel, 1, destinationOrigin.z, layerCount);
+    // Transition images to transfer layouts in one barrier
+    source->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, sourceMipLevel, 1, is3DTexture ? 0 : sourceOrigin.z, layerCount);
+    destination->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, destinationMipLevel, 1, is3DTexture ? 0 : destinationOrigin.z, layerCount);
+    flushBarriers();
 
     // Copy image to image
     VkImageCopy region{};
@@ -285,9 +310,9 @@ void CommandEncoder::copyTextureToTexture(Texture* source, VkOffset3D sourceOrig
 
     vkCmdCopyImage(m_commandBuffer, source->handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, destination->handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 
-    // Transition images to final layouts
-    source->transitionLayout(this, srcFinalLayout, sourceMipLevel, 1, sourceOrigin.z, layerCount);
-    destination->transitionLayout(this, dstFinalLayout, destinationMipLevel, 1, destinationOrigin.z, layerCount);
+    // Transition images to final layouts, recorded with the next barriers
+    source->transitionLayout(this, srcFinalLayout, sourceMipLevel, 1, is3DTexture ? 0 : sourceOrigin.z, layerCount);
+    destination->transitionLayout(this, dstFinalLayout, destinationMipLevel, 1, is3DTexture ? 0 : destinationOrigin.z, layerCount);
 }
 
 void CommandEncoder::blitTextureToTexture(Texture* source, VkOffset3D sourceOrigin, VkExtent3D sourceExtent, uint32_t sourceMipLevel, VkImageLayout srcFinalLayout, Texture* destination, VkOffset3D destinationOrigin, VkExtent3D destinationExtent, uint32_t destinationMipLevel, VkImageLayout dstFinalLayout, VkFilter filter)
@@ -308,9 +333,10 @@ void CommandEncoder::blitTextureToTexture(Texture* source, VkOffset3D sourceOrig
         layerCount = 1;
     }
 
-    // Transition images to transfer layouts
-    source->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, sourceMipLevel, 1, sourceOrigin.z, layerCount);
-    destination->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, destinationMipLevel, 1, destinationOrigin.z, layerCount);
+    // Transition images to transfer layouts in one barrier
+    source->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, sourceMipLevel, 1, is3DTexture ? 0 : sourceOrigin.z, layerCount);
+    destination->transitionLayout(this, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, destinationMipLevel, 1, is3DTexture ? 0 : destinationOrigin.z, layerCount);
+    flushBarriers();
 
     // Blit image to image with scaling and filtering
     VkImageBlit region{};
@@ -333,9 +359,9 @@ void CommandEncoder::blitTextureToTexture(Texture* source, VkOffset3D sourceOrig
 
     vkCmdBlitImage(m_commandBuffer, source->handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, destination->handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region, filter);
 
-    // Transition images to final layouts
-    source->transitionLayout(this, srcFinalLayout, sourceMipLevel, 1, sourceOrigin.z, layerCount);
-    destination->transitionLayout(this, dstFinalLayout, destinationMipLevel, 1, destinationOrigin.z, layerCount);
+    // Transition images to final layouts, recorded with the next barriers
+    source->transitionLayout(this, srcFinalLayout, sourceMipLevel, 1, is3DTexture ? 0 : sourceOrigin.z, layerCount);
+    destination->transitionLayout(this, dstFinalLayout, destinationMipLevel, 1, is3DTexture ? 0 : destinationOrigin.z, layerCount);
 }
 
 void CommandEncoder::writeTimestamp(VkQueryPool queryPool, uint32_t queryIndex)
@@ -345,6 +371,9 @@ void CommandEncoder::writeTimestamp(VkQueryPool queryPool, uint32_t queryIndex)
 
 void CommandEncoder::resolveQuerySet(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer buffer, uint64_t destinationOffset)
 {
+    trackTransferAccess(buffer, destinationOffset, static_cast<uint64_t>(queryCount) * sizeof(uint64_t), true);
+    flushBarriers();
+
     vkCmdCopyQueryPoolResults(m_commandBuffer, queryPool, firstQuery, queryCount, buffer, destinationOffset, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
 }
 
@@ -2,6 +2,10 @@
 #define GFX_VULKAN_COMMANDENCODER_H
 
 #include "../CoreTypes.h"
+#include "BarrierBatch.h"
+#include "CommandPoolArena.h"
+
+#include <vector>
 
 namespace gfx::backend::vulkan::core {
 
@@ -21,6 +25,16 @@ public:
     VkPipelineLayout currentPipelineLayout() const;
     void setCurrentPipelineLayout(VkPipelineLayout layout);
 
+    // Redundant binds dropped by the pass encoders of this encoder, for profiling
+    uint64_t filteredCommandCount() const;
+    void addFilteredCommandCount(uint64_t count);
+
+    // Layout transitions inferred by this encoder wait here until the next command that may
+    // depend on them (copies, pass begin, explicit barriers, end) records them as one barrier
+    BarrierBatch& barriers();
+    void flushBarriers();
+    const BarrierStats& barrierStats() const;
+
     void begin();
     void end();
     void reset();
@@ -37,11 +51,24 @@ public:
     void resolveQuerySet(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer buffer, uint64_t destinationOffset);
 
 private:
+    struct TransferBufferAccess {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        uint64_t offset = 0;
+        uint64_t size = 0; // VK_WHOLE_SIZE for the rest of the buffer
+        bool write = false;
+    };
+
+    // Copies into or out of overlapping buffer ranges need a barrier between them if either writes
+    void trackTransferAccess(VkBuffer buffer, uint64_t offset, uint64_t size, bool write);
+
+    CommandPoolLease m_lease;
     VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
-    VkCommandPool m_commandPool = VK_NULL_HANDLE;
+    BarrierBatch m_barriers;
+    std::vector<TransferBufferAccess> m_transferAccesses; // Since the last transfer barrier
     Device* m_device = nullptr;
     bool m_isRecording = false;
     VkPipelineLayout m_currentPipelineLayout = VK_NULL_HANDLE;
+    uint64_t m_filteredCommandCount = 0;
 };
 
 } // namespace gfx::backend::vulkan::core
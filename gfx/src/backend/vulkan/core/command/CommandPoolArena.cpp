@@ -0,0 +1,99 @@
+#include "CommandPoolArena.h"
+
+#include <stdexcept>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    // Idle pools (per command buffer level) beyond this are destroyed, e.g. after a burst of encoders
+    constexpr size_t MAX_IDLE_POOLS = 64;
+} // anonymous namespace
+
+CommandPoolArena::CommandPoolArena(VkDevice device, uint32_t queueFamilyIndex)
+    : m_device(device)
+    , m_queueFamilyIndex(queueFamilyIndex)
+{
+}
+
+CommandPoolArena::~CommandPoolArena()
+{
+    // Destroying a pool frees its command buffer
+    for (const auto& idle : m_idle) {
+        for (const auto& lease : idle) {
+            vkDestroyCommandPool(m_device, lease.pool, nullptr);
+        }
+    }
+}
+
+CommandPoolLease CommandPoolArena::acquire(VkCommandBufferLevel level)
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        auto& idle = m_idle[level];
+        if (!idle.empty()) {
+            CommandPoolLease lease = idle.back();
+            idle.pop_back();
+            ++m_reuseCount;
+            return lease;
+        }
+    }
+
+    CommandPoolLease lease{};
+    lease.level = level;
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = m_queueFamilyIndex;
+
+    if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &lease.pool) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create command pool");
+    }
+
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = lease.pool;
+    allocInfo.level = level;
+    allocInfo.commandBufferCount = 1;
+
+    if (vkAllocateCommandBuffers(m_device, &allocInfo, &lease.commandBuffer) != VK_SUCCESS) {
+        vkDestroyCommandPool(m_device, lease.pool, nullptr);
+        throw std::runtime_error("Failed to allocate command buffer");
+    }
+
+    std::scoped_lock lock(m_mutex);
+    ++m_poolCount;
+    return lease;
+}
+
+void CommandPoolArena::release(const CommandPoolLease& lease)
+{
+    if (lease.pool == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // Reset outside the lock, the pool is exclusively ours until it is back on the idle list
+    vkResetCommandPool(m_device, lease.pool, 0);
+
+    std::scoped_lock lock(m_mutex);
+    auto& idle = m_idle[lease.level];
+    if (idle.size() < MAX_IDLE_POOLS) {
+        idle.push_back(lease);
+        return;
+    }
+    vkDestroyCommandPool(m_device, lease.pool, nullptr);
+    --m_poolCount;
+}
+
+CommandPoolArenaStats CommandPoolArena::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    CommandPoolArenaStats stats{};
+    stats.poolCount = m_poolCount;
+    stats.idlePoolCount = static_cast<uint32_t>(m_idle[VK_COMMAND_BUFFER_LEVEL_PRIMARY].size() + m_idle[VK_COMMAND_BUFFER_LEVEL_SECONDARY].size());
+    stats.reuseCount = m_reuseCount;
+    return stats;
+}
+
+} // namespace gfx::backend::vulkan::core
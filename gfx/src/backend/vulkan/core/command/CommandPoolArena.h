@@ -0,0 +1,54 @@
+#ifndef GFX_VULKAN_COMMAND_POOL_ARENA_H
+#define GFX_VULKAN_COMMAND_POOL_ARENA_H
+
+#include "../CoreTypes.h"
+
+#include <mutex>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+struct CommandPoolLease {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+};
+
+struct CommandPoolArenaStats {
+    uint32_t poolCount = 0; // Leased and idle
+    uint32_t idlePoolCount = 0;
+    uint64_t reuseCount = 0;
+};
+
+// Per-device recycler of command pools for command and render bundle encoders. Each encoder
+// leases a pool with one primary (or secondary) command buffer, so encoders can still be
+// recorded on any thread without sharing a pool. Returned pools are reset (keeping their
+// memory) and handed to the next encoder instead of being destroyed.
+class CommandPoolArena {
+public:
+    CommandPoolArena(const CommandPoolArena&) = delete;
+    CommandPoolArena& operator=(const CommandPoolArena&) = delete;
+
+    CommandPoolArena(VkDevice device, uint32_t queueFamilyIndex);
+    ~CommandPoolArena();
+
+    // Throws std::runtime_error if a new pool or command buffer cannot be created
+    CommandPoolLease acquire(VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    // The command buffer must not be pending execution anymore
+    void release(const CommandPoolLease& lease);
+
+    CommandPoolArenaStats getStats() const;
+
+private:
+    VkDevice m_device = VK_NULL_HANDLE;
+    uint32_t m_queueFamilyIndex = 0;
+
+    mutable std::mutex m_mutex;
+    std::vector<CommandPoolLease> m_idle[2]; // Indexed by VkCommandBufferLevel
+    uint32_t m_poolCount = 0;
+    uint64_t m_reuseCount = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_COMMAND_POOL_ARENA_H
@@ -15,6 +15,14 @@ ComputePassEncoder::ComputePassEncoder(CommandEncoder* commandEncoder, const Com
     , m_commandEncoder(commandEncoder)
 {
     (void)createInfo; // Label unused for now
+
+    // Dispatches may read what pending transitions and copies wrote
+    m_commandEncoder->flushBarriers();
+}
+
+ComputePassEncoder::~ComputePassEncoder()
+{
+    m_commandEncoder->addFilteredCommandCount(m_state.filteredCount());
 }
 
 VkCommandBuffer ComputePassEncoder::handle() const
@@ -34,8 +42,21 @@ CommandEncoder* ComputePassEncoder::commandEncoder() const
 
 void ComputePassEncoder::setPipeline(ComputePipeline* pipeline)
 {
-    vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline->handle());
+    if (m_state.setPipeline(pipeline->handle())) {
+        vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline->handle());
+    }
     m_commandEncoder->setCurrentPipelineLayout(pipeline->layout());
+    m_pipeline = pipeline;
+}
+
+bool ComputePassEncoder::setImmediateData(uint32_t offset, const void* data, uint32_t size)
+{
+    VkShaderStageFlags stages = m_pipeline ? m_pipeline->pushConstantStages(offset, size) : 0;
+    if (stages == 0) {
+        return false;
+    }
+    vkCmdPushConstants(m_commandBuffer, m_pipeline->layout(), stages, offset, size, data);
+    return true;
 }
 
 void ComputePassEncoder::setBindGroup(uint32_t index, BindGroup* bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
@@ -43,7 +64,9 @@ void ComputePassEncoder::setBindGroup(uint32_t index, BindGroup* bindGroup, cons
     VkPipelineLayout layout = m_commandEncoder->currentPipelineLayout();
     if (layout != VK_NULL_HANDLE) {
         VkDescriptorSet set = bindGroup->handle();
-        vkCmdBindDescriptorSets(m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, layout, index, 1, &set, dynamicOffsetCount, dynamicOffsets);
+        if (m_state.setDescriptorSet(index, layout, set, dynamicOffsets, dynamicOffsetCount)) {
+            vkCmdBindDescriptorSets(m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, layout, index, 1, &set, dynamicOffsetCount, dynamicOffsets);
+        }
     }
 }
 
@@ -57,4 +80,9 @@ void ComputePassEncoder::dispatchIndirect(Buffer* buffer, uint64_t offset)
     vkCmdDispatchIndirect(m_commandBuffer, buffer->handle(), offset);
 }
 
+uint64_t ComputePassEncoder::filteredCommandCount() const
+{
+    return m_state.filteredCount();
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define GFX_VULKAN_COMPUTEPASSSENCODER_H
 
 #include "../CoreTypes.h"
+#include "BindingState.h"
 
 namespace gfx::backend::vulkan::core {
 
@@ -16,7 +17,7 @@ public:
     ComputePassEncoder& operator=(const ComputePassEncoder&) = delete;
 
     ComputePassEncoder(CommandEncoder* commandEncoder, const ComputePassEncoderCreateInfo& createInfo);
-    ~ComputePassEncoder() = default;
+    ~ComputePassEncoder();
 
     VkCommandBuffer handle() const;
     Device* device() const;
@@ -24,14 +25,21 @@ public:
 
     void setPipeline(ComputePipeline* pipeline);
     void setBindGroup(uint32_t index, BindGroup* bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+    // False if the current pipeline declares no push constant range for some of the bytes
+    bool setImmediateData(uint32_t offset, const void* data, uint32_t size);
 
     void dispatchWorkgroups(uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ);
     void dispatchIndirect(Buffer* buffer, uint64_t offset);
 
+    // Binds dropped because the same value was already set
+    uint64_t filteredCommandCount() const;
+
 private:
     VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
     Device* m_device = nullptr;
     CommandEncoder* m_commandEncoder = nullptr;
+    ComputePipeline* m_pipeline = nullptr;
+    BindingState m_state;
 };
 
 } // namespace gfx::backend::vulkan::core
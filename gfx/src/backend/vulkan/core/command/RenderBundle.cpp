@@ -0,0 +1,23 @@
+#include "RenderBundle.h"
+
+#include "../system/Device.h"
+
+namespace gfx::backend::vulkan::core {
+
+RenderBundle::RenderBundle(Device* device, const CommandPoolLease& lease)
+    : m_device(device)
+    , m_lease(lease)
+{
+}
+
+RenderBundle::~RenderBundle()
+{
+    m_device->getCommandPoolArena()->release(m_lease);
+}
+
+VkCommandBuffer RenderBundle::handle() const
+{
+    return m_lease.commandBuffer;
+}
+
+} // namespace gfx::backend::vulkan::core
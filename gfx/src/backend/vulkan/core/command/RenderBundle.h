@@ -0,0 +1,30 @@
+#ifndef GFX_VULKAN_RENDER_BUNDLE_H
+#define GFX_VULKAN_RENDER_BUNDLE_H
+
+#include "../CoreTypes.h"
+#include "CommandPoolArena.h"
+
+namespace gfx::backend::vulkan::core {
+
+class Device;
+
+// Finished secondary command buffer, executed with vkCmdExecuteCommands. Recorded with
+// simultaneous use, so it can be replayed by several passes and frames in flight.
+class RenderBundle {
+public:
+    RenderBundle(const RenderBundle&) = delete;
+    RenderBundle& operator=(const RenderBundle&) = delete;
+
+    RenderBundle(Device* device, const CommandPoolLease& lease);
+    ~RenderBundle();
+
+    VkCommandBuffer handle() const;
+
+private:
+    Device* m_device = nullptr;
+    CommandPoolLease m_lease;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_RENDER_BUNDLE_H
@@ -0,0 +1,128 @@
+#include "RenderBundleEncoder.h"
+
+#include "RenderBundle.h"
+
+#include "../render/RenderPass.h"
+#include "../render/RenderPipeline.h"
+#include "../resource/BindGroup.h"
+#include "../resource/Buffer.h"
+#include "../system/Device.h"
+
+#include <stdexcept>
+
+namespace gfx::backend::vulkan::core {
+
+RenderBundleEncoder::RenderBundleEncoder(Device* device, RenderPass* renderPass)
+    : m_device(device)
+{
+    m_lease = m_device->getCommandPoolArena()->acquire(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    m_commandBuffer = m_lease.commandBuffer;
+
+    // The framebuffer is left unspecified so the bundle runs in any compatible pass
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = renderPass->handle();
+    inheritanceInfo.subpass = 0;
+    inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    if (vkBeginCommandBuffer(m_commandBuffer, &beginInfo) != VK_SUCCESS) {
+        m_device->getCommandPoolArena()->release(m_lease);
+        throw std::runtime_error("Failed to begin render bundle command buffer");
+    }
+}
+
+RenderBundleEncoder::~RenderBundleEncoder()
+{
+    // After finish() the command buffer belongs to the bundle
+    if (!m_finished) {
+        m_device->getCommandPoolArena()->release(m_lease);
+    }
+}
+
+VkCommandBuffer RenderBundleEncoder::handle() const
+{
+    return m_commandBuffer;
+}
+
+Device* RenderBundleEncoder::device() const
+{
+    return m_device;
+}
+
+bool RenderBundleEncoder::isFinished() const
+{
+    return m_finished;
+}
+
+void RenderBundleEncoder::setPipeline(RenderPipeline* pipeline)
+{
+    vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->handle());
+    m_currentPipelineLayout = pipeline->layout();
+}
+
+void RenderBundleEncoder::setBindGroup(uint32_t index, BindGroup* bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+{
+    if (m_currentPipelineLayout != VK_NULL_HANDLE) {
+        VkDescriptorSet set = bindGroup->handle();
+        vkCmdBindDescriptorSets(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentPipelineLayout, index, 1, &set, dynamicOffsetCount, dynamicOffsets);
+    }
+}
+
+void RenderBundleEncoder::setVertexBuffer(uint32_t slot, Buffer* buffer, uint64_t offset)
+{
+    VkBuffer vkBuf = buffer->handle();
+    VkDeviceSize offsets[] = { offset };
+    vkCmdBindVertexBuffers(m_commandBuffer, slot, 1, &vkBuf, offsets);
+}
+
+void RenderBundleEncoder::setIndexBuffer(Buffer* buffer, VkIndexType indexType, uint64_t offset)
+{
+    vkCmdBindIndexBuffer(m_commandBuffer, buffer->handle(), offset, indexType);
+}
+
+void RenderBundleEncoder::setViewport(const Viewport& viewport)
+{
+    VkViewport vkViewport{};
+    vkViewport.x = viewport.x;
+    vkViewport.y = viewport.y;
+    vkViewport.width = viewport.width;
+    vkViewport.height = viewport.height;
+    vkViewport.minDepth = viewport.minDepth;
+    vkViewport.maxDepth = viewport.maxDepth;
+    vkCmdSetViewport(m_commandBuffer, 0, 1, &vkViewport);
+}
+
+void RenderBundleEncoder::setScissorRect(const ScissorRect& scissor)
+{
+    VkRect2D vkScissor{};
+    vkScissor.offset = { scissor.x, scissor.y };
+    vkScissor.extent = { scissor.width, scissor.height };
+    vkCmdSetScissor(m_commandBuffer, 0, 1, &vkScissor);
+}
+
+void RenderBundleEncoder::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+    vkCmdDraw(m_commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void RenderBundleEncoder::drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance)
+{
+    vkCmdDrawIndexed(m_commandBuffer, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+}
+
+std::unique_ptr<RenderBundle> RenderBundleEncoder::finish()
+{
+    if (vkEndCommandBuffer(m_commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to end render bundle command buffer");
+    }
+    auto bundle = std::make_unique<RenderBundle>(m_device, m_lease);
+    m_finished = true;
+    return bundle;
+}
+
+} // namespace gfx::backend::vulkan::core
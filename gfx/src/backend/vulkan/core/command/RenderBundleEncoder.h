@@ -0,0 +1,55 @@
+#ifndef GFX_VULKAN_RENDER_BUNDLE_ENCODER_H
+#define GFX_VULKAN_RENDER_BUNDLE_ENCODER_H
+
+#include "../CoreTypes.h"
+#include "CommandPoolArena.h"
+
+#include <memory>
+
+namespace gfx::backend::vulkan::core {
+
+class Device;
+class RenderPass;
+class RenderPipeline;
+class RenderBundle;
+class BindGroup;
+class Buffer;
+
+// Records draws into a secondary command buffer that continues subpass 0 of a render pass.
+// Each encoder leases its own pool, so encoders can be recorded on separate threads.
+class RenderBundleEncoder {
+public:
+    RenderBundleEncoder(const RenderBundleEncoder&) = delete;
+    RenderBundleEncoder& operator=(const RenderBundleEncoder&) = delete;
+
+    RenderBundleEncoder(Device* device, RenderPass* renderPass);
+    ~RenderBundleEncoder();
+
+    VkCommandBuffer handle() const;
+    Device* device() const;
+    bool isFinished() const;
+
+    void setPipeline(RenderPipeline* pipeline);
+    void setBindGroup(uint32_t index, BindGroup* bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+    void setVertexBuffer(uint32_t slot, Buffer* buffer, uint64_t offset);
+    void setIndexBuffer(Buffer* buffer, VkIndexType indexType, uint64_t offset);
+    void setViewport(const Viewport& viewport);
+    void setScissorRect(const ScissorRect& scissor);
+
+    void draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+    void drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
+
+    // Ends recording and hands the command buffer over to the bundle
+    std::unique_ptr<RenderBundle> finish();
+
+private:
+    VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
+    CommandPoolLease m_lease;
+    Device* m_device = nullptr;
+    VkPipelineLayout m_currentPipelineLayout = VK_NULL_HANDLE;
+    bool m_finished = false;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_RENDER_BUNDLE_ENCODER_H
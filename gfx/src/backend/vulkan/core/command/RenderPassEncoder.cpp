@@ -1,6 +1,7 @@
 #include "RenderPassEncoder.h"
 
 #include "CommandEncoder.h"
+#include "RenderBundle.h"
 
 #include "../render/Framebuffer.h"
 #include "../render/RenderPass.h"
@@ -16,23 +17,23 @@ RenderPassEncoder::RenderPassEncoder(CommandEncoder* commandEncoder, RenderPass*
     , m_device(commandEncoder->getDevice())
     , m_commandEncoder(commandEncoder)
 {
-    // Build clear values array
-    std::vector<VkClearValue> clearValues;
+    // Transitions inferred so far can't be recorded inside the render pass
+    m_commandEncoder->flushBarriers();
 
-    // Add color clear values with dummy values for resolve attachments
+    // Build clear values array, with dummy values for resolve attachments
     const auto& colorHasResolve = renderPass->colorHasResolve();
     for (size_t i = 0; i < beginInfo.colorClearValues.size(); ++i) {
         // Add the color attachment clear value
         VkClearValue clearValue{};
         clearValue.color = beginInfo.colorClearValues[i];
-        clearValues.push_back(clearValue);
+        m_clearValues.push_back(clearValue);
 
         // If this color attachment has a resolve target, add a dummy clear value for it
         // (resolve attachments use LOAD_OP_DONT_CARE so the value doesn't matter)
         if (i < colorHasResolve.size() && colorHasResolve[i]) {
             VkClearValue dummyClear{};
             dummyClear.color = { { 0.0f, 0.0f, 0.0f, 0.0f } };
-            clearValues.push_back(dummyClear);
+            m_clearValues.push_back(dummyClear);
         }
     }
 
@@ -41,26 +42,71 @@ RenderPassEncoder::RenderPassEncoder(CommandEncoder* commandEncoder, RenderPass*
         VkClearValue depthStencilClear{};
         depthStencilClear.depthStencil.depth = beginInfo.depthClearValue;
         depthStencilClear.depthStencil.stencil = beginInfo.stencilClearValue;
-        clearValues.push_back(depthStencilClear);
+        m_clearValues.push_back(depthStencilClear);
     }
 
-    // Begin render pass
-    VkRenderPassBeginInfo vkBeginInfo{};
-    vkBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    vkBeginInfo.renderPass = renderPass->handle();
-    vkBeginInfo.framebuffer = framebuffer->handle();
-    vkBeginInfo.renderArea.offset = { 0, 0 };
-    vkBeginInfo.renderArea.extent.width = framebuffer->width();
-    vkBeginInfo.renderArea.extent.height = framebuffer->height();
-    vkBeginInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
-    vkBeginInfo.pClearValues = clearValues.data();
+    // The render pass is begun once the first command tells whether it records inline or bundles
+    m_beginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    m_beginInfo.renderPass = renderPass->handle();
+    m_beginInfo.framebuffer = framebuffer->handle();
+    m_beginInfo.renderArea.offset = { 0, 0 };
+    m_beginInfo.renderArea.extent.width = framebuffer->width();
+    m_beginInfo.renderArea.extent.height = framebuffer->height();
+    m_beginInfo.clearValueCount = static_cast<uint32_t>(m_clearValues.size());
+    m_beginInfo.pClearValues = m_clearValues.data();
 
-    vkCmdBeginRenderPass(m_commandBuffer, &vkBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    m_imagelessAttachments = framebuffer->imagelessAttachments();
+    if (!m_imagelessAttachments.empty()) {
+        m_attachmentBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO_KHR;
+        m_attachmentBeginInfo.attachmentCount = static_cast<uint32_t>(m_imagelessAttachments.size());
+        m_attachmentBeginInfo.pAttachments = m_imagelessAttachments.data();
+        m_beginInfo.pNext = &m_attachmentBeginInfo;
+    }
 }
 
 RenderPassEncoder::~RenderPassEncoder()
 {
+    // An empty pass still has to run its load/store operations
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     vkCmdEndRenderPass(m_commandBuffer);
+
+    m_commandEncoder->addFilteredCommandCount(m_state.filteredCount());
+}
+
+void RenderPassEncoder::ensureBegun(VkSubpassContents contents)
+{
+    if (m_contents.has_value()) {
+        return;
+    }
+
+    vkCmdBeginRenderPass(m_commandBuffer, &m_beginInfo, contents);
+    m_contents = contents;
+
+    if (contents == VK_SUBPASS_CONTENTS_INLINE) {
+        if (m_pendingViewport.has_value() && m_state.setViewport(m_pendingViewport.value())) {
+            vkCmdSetViewport(m_commandBuffer, 0, 1, &m_pendingViewport.value());
+        }
+        if (m_pendingScissor.has_value() && m_state.setScissor(m_pendingScissor.value())) {
+            vkCmdSetScissor(m_commandBuffer, 0, 1, &m_pendingScissor.value());
+        }
+    }
+    m_pendingViewport.reset();
+    m_pendingScissor.reset();
+}
+
+bool RenderPassEncoder::acceptsInlineCommands() const
+{
+    return m_contents.value_or(VK_SUBPASS_CONTENTS_INLINE) == VK_SUBPASS_CONTENTS_INLINE;
+}
+
+bool RenderPassEncoder::acceptsBundles() const
+{
+    return m_contents.value_or(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+}
+
+uint64_t RenderPassEncoder::filteredCommandCount() const
+{
+    return m_state.filteredCount();
 }
 
 VkCommandBuffer RenderPassEncoder::handle() const
@@ -80,29 +126,54 @@ CommandEncoder* RenderPassEncoder::commandEncoder() const
 
 void RenderPassEncoder::setPipeline(RenderPipeline* pipeline)
 {
-    vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->handle());
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    if (m_state.setPipeline(pipeline->handle())) {
+        vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->handle());
+    }
     m_commandEncoder->setCurrentPipelineLayout(pipeline->layout());
+    m_pipeline = pipeline;
+}
+
+bool RenderPassEncoder::setImmediateData(uint32_t offset, const void* data, uint32_t size)
+{
+    VkShaderStageFlags stages = m_pipeline ? m_pipeline->pushConstantStages(offset, size) : 0;
+    if (stages == 0) {
+        return false;
+    }
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdPushConstants(m_commandBuffer, m_pipeline->layout(), stages, offset, size, data);
+    return true;
 }
 
 void RenderPassEncoder::setBindGroup(uint32_t index, BindGroup* bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     VkPipelineLayout layout = m_commandEncoder->currentPipelineLayout();
     if (layout != VK_NULL_HANDLE) {
         VkDescriptorSet set = bindGroup->handle();
-        vkCmdBindDescriptorSets(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, index, 1, &set, dynamicOffsetCount, dynamicOffsets);
+        if (m_state.setDescriptorSet(index, layout, set, dynamicOffsets, dynamicOffsetCount)) {
+            vkCmdBindDescriptorSets(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, index, 1, &set, dynamicOffsetCount, dynamicOffsets);
+        }
     }
 }
 
 void RenderPassEncoder::setVertexBuffer(uint32_t slot, Buffer* buffer, uint64_t offset)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     VkBuffer vkBuf = buffer->handle();
+    if (!m_state.setVertexBuffer(slot, vkBuf, offset)) {
+        return;
+    }
     VkDeviceSize offsets[] = { offset };
     vkCmdBindVertexBuffers(m_commandBuffer, slot, 1, &vkBuf, offsets);
 }
 
 void RenderPassEncoder::setIndexBuffer(Buffer* buffer, VkIndexType indexType, uint64_t offset)
 {
-    vkCmdBindIndexBuffer(m_commandBuffer, buffer->handle(), offset, indexType);
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    if (m_state.setIndexBuffer(buffer->handle(), offset, indexType)) {
+        vkCmdBindIndexBuffer(m_commandBuffer, buffer->handle(), offset, indexType);
+    }
 }
 
 void RenderPassEncoder::setViewport(const Viewport& viewport)
@@ -114,7 +185,14 @@ void RenderPassEncoder::setViewport(const Viewport& viewport)
     vkViewport.height = viewport.height;
     vkViewport.minDepth = viewport.minDepth;
     vkViewport.maxDepth = viewport.maxDepth;
-    vkCmdSetViewport(m_commandBuffer, 0, 1, &vkViewport);
+
+    // Setting dynamic state alone doesn't decide the kind of contents. Bundles set their own
+    // viewport and scissor, so in a pass that executes bundles this has no effect.
+    if (!m_contents.has_value()) {
+        m_pendingViewport = vkViewport;
+    } else if (m_contents == VK_SUBPASS_CONTENTS_INLINE && m_state.setViewport(vkViewport)) {
+        vkCmdSetViewport(m_commandBuffer, 0, 1, &vkViewport);
+    }
 }
 
 void RenderPassEncoder::setScissorRect(const ScissorRect& scissor)
@@ -122,31 +200,90 @@ void RenderPassEncoder::setScissorRect(const ScissorRect& scissor)
     VkRect2D vkScissor{};
     vkScissor.offset = { scissor.x, scissor.y };
     vkScissor.extent = { scissor.width, scissor.height };
-    vkCmdSetScissor(m_commandBuffer, 0, 1, &vkScissor);
+
+    if (!m_contents.has_value()) {
+        m_pendingScissor = vkScissor;
+    } else if (m_contents == VK_SUBPASS_CONTENTS_INLINE && m_state.setScissor(vkScissor)) {
+        vkCmdSetScissor(m_commandBuffer, 0, 1, &vkScissor);
+    }
 }
 
 void RenderPassEncoder::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     vkCmdDraw(m_commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 }
 
 void RenderPassEncoder::drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     vkCmdDrawIndexed(m_commandBuffer, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
 }
 
 void RenderPassEncoder::drawIndirect(Buffer* buffer, uint64_t offset)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     vkCmdDrawIndirect(m_commandBuffer, buffer->handle(), offset, 1, 0);
 }
 
 void RenderPassEncoder::drawIndexedIndirect(Buffer* buffer, uint64_t offset)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     vkCmdDrawIndexedIndirect(m_commandBuffer, buffer->handle(), offset, 1, 0);
 }
 
+void RenderPassEncoder::multiDrawIndirect(Buffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    if (stride == 0) {
+        stride = sizeof(VkDrawIndirectCommand);
+    }
+    if (drawCount <= 1 || m_device->supportsMultiDrawIndirect()) {
+        vkCmdDrawIndirect(m_commandBuffer, buffer->handle(), offset, drawCount, stride);
+        return;
+    }
+    // Without multiDrawIndirect the draw count must be 0 or 1
+    for (uint32_t i = 0; i < drawCount; ++i) {
+        vkCmdDrawIndirect(m_commandBuffer, buffer->handle(), offset + static_cast<uint64_t>(i) * stride, 1, stride);
+    }
+}
+
+void RenderPassEncoder::multiDrawIndexedIndirect(Buffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    if (stride == 0) {
+        stride = sizeof(VkDrawIndexedIndirectCommand);
+    }
+    if (drawCount <= 1 || m_device->supportsMultiDrawIndirect()) {
+        vkCmdDrawIndexedIndirect(m_commandBuffer, buffer->handle(), offset, drawCount, stride);
+        return;
+    }
+    for (uint32_t i = 0; i < drawCount; ++i) {
+        vkCmdDrawIndexedIndirect(m_commandBuffer, buffer->handle(), offset + static_cast<uint64_t>(i) * stride, 1, stride);
+    }
+}
+
+void RenderPassEncoder::multiDrawIndirectCount(Buffer* buffer, uint64_t offset, Buffer* countBuffer, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    if (stride == 0) {
+        stride = sizeof(VkDrawIndirectCommand);
+    }
+    m_device->getCmdDrawIndirectCount()(m_commandBuffer, buffer->handle(), offset, countBuffer->handle(), countOffset, maxDrawCount, stride);
+}
+
+void RenderPassEncoder::multiDrawIndexedIndirectCount(Buffer* buffer, uint64_t offset, Buffer* countBuffer, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
+    if (stride == 0) {
+        stride = sizeof(VkDrawIndexedIndirectCommand);
+    }
+    m_device->getCmdDrawIndexedIndirectCount()(m_commandBuffer, buffer->handle(), offset, countBuffer->handle(), countOffset, maxDrawCount, stride);
+}
+
 void RenderPassEncoder::beginOcclusionQuery(VkQueryPool queryPool, uint32_t queryIndex)
 {
+    ensureBegun(VK_SUBPASS_CONTENTS_INLINE);
     m_activeQueryPool = queryPool;
     m_activeQueryIndex = queryIndex;
     vkCmdBeginQuery(m_commandBuffer, queryPool, queryIndex, 0);
@@ -161,4 +298,22 @@ void RenderPassEncoder::endOcclusionQuery()
     }
 }
 
+void RenderPassEncoder::executeBundles(RenderBundle* const* bundles, uint32_t bundleCount)
+{
+    ensureBegun(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    if (bundleCount == 0) {
+        return;
+    }
+
+    std::vector<VkCommandBuffer> commandBuffers(bundleCount);
+    for (uint32_t i = 0; i < bundleCount; ++i) {
+        commandBuffers[i] = bundles[i]->handle();
+    }
+    vkCmdExecuteCommands(m_commandBuffer, bundleCount, commandBuffers.data());
+
+    // Bound state is undefined after executing secondary command buffers
+    m_commandEncoder->setCurrentPipelineLayout(VK_NULL_HANDLE);
+    m_state.invalidate();
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
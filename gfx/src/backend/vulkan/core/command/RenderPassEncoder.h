@@ -2,6 +2,10 @@
 #define GFX_VULKAN_RENDERPASSENCODER_H
 
 #include "../CoreTypes.h"
+#include "BindingState.h"
+
+#include <optional>
+#include <vector>
 
 namespace gfx::backend::vulkan::core {
 
@@ -12,7 +16,12 @@ class CommandEncoder;
 class RenderPipeline;
 class BindGroup;
 class Buffer;
+class RenderBundle;
 
+// The render pass instance is begun by the first recorded command: executeBundles() begins it
+// with secondary command buffer contents, anything else but the viewport and scissor with inline
+// contents. Vulkan does not allow both in one subpass, so once begun the encoder only accepts
+// commands of that kind.
 class RenderPassEncoder {
 public:
     RenderPassEncoder(const RenderPassEncoder&) = delete;
@@ -31,21 +40,53 @@ public:
     void setIndexBuffer(Buffer* buffer, VkIndexType indexType, uint64_t offset);
     void setViewport(const Viewport& viewport);
     void setScissorRect(const ScissorRect& scissor);
+    // False if the current pipeline declares no push constant range for some of the bytes
+    bool setImmediateData(uint32_t offset, const void* data, uint32_t size);
 
     void draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
     void drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
     void drawIndirect(Buffer* buffer, uint64_t offset);
     void drawIndexedIndirect(Buffer* buffer, uint64_t offset);
+    // A stride of 0 means tightly packed commands
+    void multiDrawIndirect(Buffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride);
+    void multiDrawIndexedIndirect(Buffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride);
+    // Require the draw indirect count extension, see Device::getCmdDrawIndirectCount()
+    void multiDrawIndirectCount(Buffer* buffer, uint64_t offset, Buffer* countBuffer, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride);
+    void multiDrawIndexedIndirectCount(Buffer* buffer, uint64_t offset, Buffer* countBuffer, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride);
 
     void beginOcclusionQuery(VkQueryPool queryPool, uint32_t queryIndex);
     void endOcclusionQuery();
 
+    void executeBundles(RenderBundle* const* bundles, uint32_t bundleCount);
+
+    // False once the pass has been begun for the other kind of contents
+    bool acceptsInlineCommands() const;
+    bool acceptsBundles() const;
+
+    // Binds and dynamic state dropped because the same value was already set
+    uint64_t filteredCommandCount() const;
+
 private:
+    void ensureBegun(VkSubpassContents contents);
+
     VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
     Device* m_device = nullptr;
     CommandEncoder* m_commandEncoder = nullptr;
+    RenderPipeline* m_pipeline = nullptr;
     VkQueryPool m_activeQueryPool = VK_NULL_HANDLE;
     uint32_t m_activeQueryIndex = 0;
+
+    VkRenderPassBeginInfo m_beginInfo{};
+    std::vector<VkClearValue> m_clearValues;
+    VkRenderPassAttachmentBeginInfoKHR m_attachmentBeginInfo{};
+    std::vector<VkImageView> m_imagelessAttachments;
+    std::optional<VkSubpassContents> m_contents; // Unset until the render pass has begun
+    // Secondary command buffers don't inherit dynamic state, so the pass viewport/scissor only
+    // apply to inline contents
+    std::optional<VkViewport> m_pendingViewport;
+    std::optional<VkRect2D> m_pendingScissor;
+
+    BindingState m_state;
 };
 
 } // namespace gfx::backend::vulkan::core
@@ -1,52 +1,64 @@
 #include "ComputePipeline.h"
 
 #include "../system/Device.h"
+#include "../system/PipelineCache.h"
+#include "../system/PipelineRegistry.h"
 
 #include <stdexcept>
 
 namespace gfx::backend::vulkan::core {
 
+namespace {
+    VkPipeline createComputePipeline(Device* device, const ComputePipelineCreateInfo& createInfo, VkPipelineLayout pipelineLayout)
+    {
+        // Shader stage
+        VkPipelineShaderStageCreateInfo computeShaderStageInfo{};
+        computeShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        computeShaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        computeShaderStageInfo.module = createInfo.module;
+        computeShaderStageInfo.pName = createInfo.entryPoint;
+
+        // Create compute pipeline
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage = computeShaderStageInfo;
+        pipelineInfo.layout = pipelineLayout;
+
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkResult result = vkCreateComputePipelines(device->handle(), device->getPipelineCache()->handle(), 1, &pipelineInfo, nullptr, &pipeline);
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create compute pipeline");
+        }
+        return pipeline;
+    }
+} // anonymous namespace
+
 ComputePipeline::ComputePipeline(Device* device, const ComputePipelineCreateInfo& createInfo)
-    : m_device(device)
+    : m_pushConstantRanges(createInfo.pushConstantRanges)
+    , m_device(device)
 {
-    // Create pipeline layout
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(createInfo.bindGroupLayouts.size());
-    pipelineLayoutInfo.pSetLayouts = createInfo.bindGroupLayouts.data();
-
-    VkResult result = vkCreatePipelineLayout(m_device->handle(), &pipelineLayoutInfo, nullptr, &m_pipelineLayout);
-    if (result != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create compute pipeline layout");
-    }
+    // Identical layouts and pipelines are shared through the device registry
+    PipelineRegistry* registry = m_device->getPipelineRegistry();
+    m_pipelineLayout = registry->acquirePipelineLayout(createInfo.bindGroupLayouts, createInfo.pushConstantRanges);
 
-    // Shader stage
-    VkPipelineShaderStageCreateInfo computeShaderStageInfo{};
-    computeShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    computeShaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    computeShaderStageInfo.module = createInfo.module;
-    computeShaderStageInfo.pName = createInfo.entryPoint;
-
-    // Create compute pipeline
-    VkComputePipelineCreateInfo pipelineInfo{};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-    pipelineInfo.stage = computeShaderStageInfo;
-    pipelineInfo.layout = m_pipelineLayout;
-
-    result = vkCreateComputePipelines(m_device->handle(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline);
-    if (result != VK_SUCCESS) {
-        vkDestroyPipelineLayout(m_device->handle(), m_pipelineLayout, nullptr);
-        throw std::runtime_error("Failed to create compute pipeline");
+    try {
+        m_pipeline = registry->acquirePipeline(PipelineRegistry::makeKey(createInfo, m_pipelineLayout), [&]() {
+            return createComputePipeline(m_device, createInfo, m_pipelineLayout);
+        });
+    } catch (...) {
+        registry->releasePipelineLayout(m_pipelineLayout);
+        throw;
     }
 }
 
 ComputePipeline::~ComputePipeline()
 {
+    PipelineRegistry* registry = m_device->getPipelineRegistry();
     if (m_pipeline != VK_NULL_HANDLE) {
-        vkDestroyPipeline(m_device->handle(), m_pipeline, nullptr);
+        registry->releasePipeline(m_pipeline);
     }
     if (m_pipelineLayout != VK_NULL_HANDLE) {
-        vkDestroyPipelineLayout(m_device->handle(), m_pipelineLayout, nullptr);
+        registry->releasePipelineLayout(m_pipelineLayout);
     }
 }
 
@@ -60,4 +72,9 @@ VkPipelineLayout ComputePipeline::layout() const
     return m_pipelineLayout;
 }
 
+VkShaderStageFlags ComputePipeline::pushConstantStages(uint32_t offset, uint32_t size) const
+{
+    return PipelineRegistry::pushConstantStages(m_pushConstantRanges, offset, size);
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
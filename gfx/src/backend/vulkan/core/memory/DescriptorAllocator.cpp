@@ -0,0 +1,178 @@
+#include "DescriptorAllocator.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    constexpr uint32_t INITIAL_POOL_SET_COUNT = 64;
+    constexpr uint32_t MAX_POOL_SET_COUNT = 1024;
+    constexpr uint32_t DESCRIPTORS_PER_TYPE_PER_SET = 4;
+    constexpr size_t MAX_RECYCLED_SETS_PER_LAYOUT = 256;
+
+    constexpr VkDescriptorType POOL_DESCRIPTOR_TYPES[] = {
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        VK_DESCRIPTOR_TYPE_SAMPLER,
+        VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+        VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+    };
+} // anonymous namespace
+
+DescriptorAllocator::DescriptorAllocator(VkDevice device)
+    : m_device(device)
+    , m_nextPoolSetCount(INITIAL_POOL_SET_COUNT)
+{
+}
+
+DescriptorAllocator::~DescriptorAllocator()
+{
+    // Destroying a pool frees every set allocated from it
+    for (const Pool& pool : m_pools) {
+        vkDestroyDescriptorPool(m_device, pool.handle, nullptr);
+    }
+}
+
+DescriptorSetAllocation DescriptorAllocator::allocate(VkDescriptorSetLayout layout, const std::vector<VkDescriptorPoolSize>& requirements)
+{
+    std::scoped_lock lock(m_mutex);
+
+    LayoutEntry& entry = m_layouts[layout];
+    if (entry.generation == 0) {
+        entry.generation = m_nextGeneration++;
+    }
+    if (!entry.recycled.empty()) {
+        DescriptorSetAllocation allocation = entry.recycled.back();
+        entry.recycled.pop_back();
+        --m_recycledSetCount;
+        return allocation;
+    }
+
+    DescriptorSetAllocation allocation{};
+    allocation.layoutGeneration = entry.generation;
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &layout;
+
+    for (auto it = m_pools.rbegin(); it != m_pools.rend(); ++it) {
+        if (it->full) {
+            continue;
+        }
+        allocInfo.descriptorPool = it->handle;
+        VkResult result = vkAllocateDescriptorSets(m_device, &allocInfo, &allocation.set);
+        if (result == VK_SUCCESS) {
+            allocation.pool = it->handle;
+            ++m_allocatedSetCount;
+            return allocation;
+        }
+        if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+            throw std::runtime_error("Failed to allocate descriptor set");
+        }
+        it->full = true;
+    }
+
+    // Every pool is exhausted, start a new (larger) one
+    VkDescriptorPool pool = createPool(requirements);
+    allocInfo.descriptorPool = pool;
+    if (vkAllocateDescriptorSets(m_device, &allocInfo, &allocation.set) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate descriptor set");
+    }
+    allocation.pool = pool;
+    ++m_allocatedSetCount;
+    return allocation;
+}
+
+void DescriptorAllocator::recycle(VkDescriptorSetLayout layout, const DescriptorSetAllocation& allocation)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_layouts.find(layout);
+    if (it == m_layouts.end() || it->second.generation != allocation.layoutGeneration || it->second.recycled.size() >= MAX_RECYCLED_SETS_PER_LAYOUT) {
+        // The layout is gone (or enough sets are kept already), hand the set back to its pool
+        freeSet(allocation);
+        return;
+    }
+    it->second.recycled.push_back(allocation);
+    ++m_recycledSetCount;
+}
+
+void DescriptorAllocator::releaseLayout(VkDescriptorSetLayout layout)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_layouts.find(layout);
+    if (it == m_layouts.end()) {
+        return;
+    }
+    for (const auto& allocation : it->second.recycled) {
+        freeSet(allocation);
+    }
+    m_recycledSetCount -= static_cast<uint32_t>(it->second.recycled.size());
+    m_layouts.erase(it);
+}
+
+DescriptorAllocatorStats DescriptorAllocator::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    DescriptorAllocatorStats stats{};
+    stats.poolCount = static_cast<uint32_t>(m_pools.size());
+    stats.allocatedSetCount = m_allocatedSetCount;
+    stats.recycledSetCount = m_recycledSetCount;
+    return stats;
+}
+
+VkDescriptorPool DescriptorAllocator::createPool(const std::vector<VkDescriptorPoolSize>& requirements)
+{
+    uint32_t setCount = m_nextPoolSetCount;
+    m_nextPoolSetCount = std::min(m_nextPoolSetCount * 2, MAX_POOL_SET_COUNT);
+
+    std::vector<VkDescriptorPoolSize> poolSizes;
+    for (VkDescriptorType type : POOL_DESCRIPTOR_TYPES) {
+        poolSizes.push_back({ type, setCount * DESCRIPTORS_PER_TYPE_PER_SET });
+    }
+    // Make sure at least one set of the requesting layout fits
+    for (const auto& requirement : requirements) {
+        auto it = std::find_if(poolSizes.begin(), poolSizes.end(), [&](const VkDescriptorPoolSize& size) {
+            return size.type == requirement.type;
+        });
+        if (it == poolSizes.end()) {
+            poolSizes.push_back(requirement);
+        } else {
+            it->descriptorCount = std::max(it->descriptorCount, requirement.descriptorCount);
+        }
+    }
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    poolInfo.maxSets = setCount;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create descriptor pool");
+    }
+    m_pools.push_back({ pool, false });
+    return pool;
+}
+
+void DescriptorAllocator::freeSet(const DescriptorSetAllocation& allocation)
+{
+    vkFreeDescriptorSets(m_device, allocation.pool, 1, &allocation.set);
+    --m_allocatedSetCount;
+
+    // The pool has room again
+    auto it = std::find_if(m_pools.begin(), m_pools.end(), [&](const Pool& pool) {
+        return pool.handle == allocation.pool;
+    });
+    if (it != m_pools.end()) {
+        it->full = false;
+    }
+}
+
+} // namespace gfx::backend::vulkan::core
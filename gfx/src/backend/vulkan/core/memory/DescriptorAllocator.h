@@ -0,0 +1,73 @@
+#ifndef GFX_VULKAN_DESCRIPTOR_ALLOCATOR_H
+#define GFX_VULKAN_DESCRIPTOR_ALLOCATOR_H
+
+#include "../CoreTypes.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+struct DescriptorSetAllocation {
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    uint64_t layoutGeneration = 0; // Guards against reuse after the layout handle is recycled
+};
+
+struct DescriptorAllocatorStats {
+    uint32_t poolCount = 0;
+    uint32_t allocatedSetCount = 0; // Including recycled sets
+    uint32_t recycledSetCount = 0;
+};
+
+// Per-device descriptor set allocator. Sets come from shared pools that grow as needed,
+// newest pool first, falling back to older pools that got sets freed back. Sets returned
+// by destroyed bind groups are kept per layout for the next bind group with the same
+// layout instead of going back to the pool.
+class DescriptorAllocator {
+public:
+    DescriptorAllocator(const DescriptorAllocator&) = delete;
+    DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+    explicit DescriptorAllocator(VkDevice device);
+    ~DescriptorAllocator();
+
+    // requirements lists the descriptor counts per type of one set of the layout.
+    // Throws std::runtime_error if no pool can hold the set.
+    DescriptorSetAllocation allocate(VkDescriptorSetLayout layout, const std::vector<VkDescriptorPoolSize>& requirements);
+    void recycle(VkDescriptorSetLayout layout, const DescriptorSetAllocation& allocation);
+
+    // Frees the recycled sets of a layout that is about to be destroyed
+    void releaseLayout(VkDescriptorSetLayout layout);
+
+    DescriptorAllocatorStats getStats() const;
+
+private:
+    struct Pool {
+        VkDescriptorPool handle = VK_NULL_HANDLE;
+        bool full = false; // Set when an allocation failed, cleared when a set is freed back
+    };
+
+    struct LayoutEntry {
+        uint64_t generation = 0;
+        std::vector<DescriptorSetAllocation> recycled;
+    };
+
+    VkDescriptorPool createPool(const std::vector<VkDescriptorPoolSize>& requirements);
+    void freeSet(const DescriptorSetAllocation& allocation);
+
+    VkDevice m_device = VK_NULL_HANDLE;
+
+    mutable std::mutex m_mutex;
+    std::vector<Pool> m_pools; // Newest last
+    uint32_t m_nextPoolSetCount = 0;
+    std::unordered_map<VkDescriptorSetLayout, LayoutEntry> m_layouts;
+    uint64_t m_nextGeneration = 1;
+    uint32_t m_allocatedSetCount = 0;
+    uint32_t m_recycledSetCount = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_DESCRIPTOR_ALLOCATOR_H
@@ -0,0 +1,405 @@
+#include "MemoryAllocator.h"
+
+#include "../util/Utils.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = 64ull * 1024 * 1024;
+    constexpr VkDeviceSize SMALL_HEAP_SIZE = 1024ull * 1024 * 1024;
+
+    // Vulkan alignments are always powers of two
+    inline VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    inline VkDeviceSize alignDown(VkDeviceSize value, VkDeviceSize alignment)
+    {
+        return value & ~(alignment - 1);
+    }
+} // anonymous namespace
+
+// ============================================================================
+// MemoryBlock
+// ============================================================================
+
+MemoryBlock::MemoryBlock(VkDevice device, uint32_t memoryTypeIndex, VkDeviceSize size, bool hostVisible)
+    : m_device(device)
+    , m_size(size)
+{
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    VkResult result = vkAllocateMemory(m_device, &allocInfo, nullptr, &m_memory);
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate device memory block");
+    }
+
+    if (hostVisible) {
+        result = vkMapMemory(m_device, m_memory, 0, VK_WHOLE_SIZE, 0, &m_mappedData);
+        if (result != VK_SUCCESS) {
+            vkFreeMemory(m_device, m_memory, nullptr);
+            throw std::runtime_error("Failed to map device memory block");
+        }
+    }
+
+    insertFreeRange(0, size);
+}
+
+MemoryBlock::~MemoryBlock()
+{
+    if (m_memory != VK_NULL_HANDLE) {
+        // Freeing implicitly unmaps
+        vkFreeMemory(m_device, m_memory, nullptr);
+    }
+}
+
+bool MemoryBlock::allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset)
+{
+    // Best fit: walk free ranges from the smallest one that could hold the request
+    for (auto it = m_freeBySize.lower_bound(size); it != m_freeBySize.end(); ++it) {
+        VkDeviceSize rangeSize = it->first;
+        VkDeviceSize rangeOffset = it->second;
+        VkDeviceSize alignedOffset = alignUp(rangeOffset, alignment);
+        VkDeviceSize padding = alignedOffset - rangeOffset;
+        if (padding + size > rangeSize) {
+            continue;
+        }
+
+        eraseFreeRange(m_freeByOffset.find(rangeOffset));
+        if (padding > 0) {
+            insertFreeRange(rangeOffset, padding);
+        }
+        VkDeviceSize tail = rangeSize - padding - size;
+        if (tail > 0) {
+            insertFreeRange(alignedOffset + size, tail);
+        }
+
+        m_used += size;
+        ++m_allocationCount;
+        *outOffset = alignedOffset;
+        return true;
+    }
+    return false;
+}
+
+void MemoryBlock::free(VkDeviceSize offset, VkDeviceSize size)
+{
+    m_used -= size;
+    --m_allocationCount;
+
+    VkDeviceSize start = offset;
+    VkDeviceSize end = offset + size;
+
+    // Coalesce with the following free range
+    auto next = m_freeByOffset.lower_bound(offset);
+    if (next != m_freeByOffset.end() && next->first == end) {
+        end += next->second;
+        next = eraseFreeRange(next);
+    }
+
+    // Coalesce with the preceding free range
+    if (next != m_freeByOffset.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == start) {
+            start = prev->first;
+            eraseFreeRange(prev);
+        }
+    }
+
+    insertFreeRange(start, end - start);
+}
+
+VkDeviceMemory MemoryBlock::handle() const
+{
+    return m_memory;
+}
+
+VkDeviceSize MemoryBlock::size() const
+{
+    return m_size;
+}
+
+VkDeviceSize MemoryBlock::usedBytes() const
+{
+    return m_used;
+}
+
+VkDeviceSize MemoryBlock::largestFreeRange() const
+{
+    return m_freeBySize.empty() ? 0 : m_freeBySize.rbegin()->first;
+}
+
+uint32_t MemoryBlock::allocationCount() const
+{
+    return m_allocationCount;
+}
+
+void* MemoryBlock::mappedData() const
+{
+    return m_mappedData;
+}
+
+bool MemoryBlock::empty() const
+{
+    return m_allocationCount == 0;
+}
+
+void MemoryBlock::insertFreeRange(VkDeviceSize offset, VkDeviceSize size)
+{
+    m_freeByOffset.emplace(offset, size);
+    m_freeBySize.emplace(size, offset);
+}
+
+std::map<VkDeviceSize, VkDeviceSize>::iterator MemoryBlock::eraseFreeRange(std::map<VkDeviceSize, VkDeviceSize>::iterator it)
+{
+    auto [first, last] = m_freeBySize.equal_range(it->second);
+    for (auto sizeIt = first; sizeIt != last; ++sizeIt) {
+        if (sizeIt->second == it->first) {
+            m_freeBySize.erase(sizeIt);
+            break;
+        }
+    }
+    return m_freeByOffset.erase(it);
+}
+
+// ============================================================================
+// MemoryAllocator
+// ============================================================================
+
+MemoryAllocator::MemoryAllocator(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkPhysicalDeviceLimits& limits)
+    : m_device(device)
+    , m_memoryProperties(memoryProperties)
+    , m_bufferImageGranularity(std::max<VkDeviceSize>(limits.bufferImageGranularity, 1))
+    , m_nonCoherentAtomSize(std::max<VkDeviceSize>(limits.nonCoherentAtomSize, 1))
+{
+}
+
+MemoryAllocator::~MemoryAllocator() = default;
+
+MemoryAllocation MemoryAllocator::allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, MemoryResourceKind kind)
+{
+    uint32_t memoryTypeIndex = findMemoryType(m_memoryProperties, requirements.memoryTypeBits, properties);
+    if (memoryTypeIndex == UINT32_MAX) {
+        throw std::runtime_error("Failed to find suitable memory type");
+    }
+
+    bool hostVisible = isHostVisible(memoryTypeIndex);
+    bool nonCoherent = hostVisible && !isHostCoherent(memoryTypeIndex);
+    VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+    if (nonCoherent) {
+        // Keeps flush/invalidate ranges of neighbouring allocations from overlapping
+        alignment = std::max(alignment, m_nonCoherentAtomSize);
+    }
+
+    MemoryAllocation allocation{};
+    allocation.size = requirements.size;
+    allocation.memoryTypeIndex = memoryTypeIndex;
+
+    VkDeviceSize blockSize = getBlockSize(memoryTypeIndex);
+
+    std::scoped_lock lock(m_mutex);
+
+    // Large resources get their own memory instead of pinning most of a block
+    if (requirements.size > blockSize / 2) {
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = requirements.size;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        VkResult result = vkAllocateMemory(m_device, &allocInfo, nullptr, &allocation.memory);
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate dedicated device memory");
+        }
+        if (hostVisible) {
+            result = vkMapMemory(m_device, allocation.memory, 0, VK_WHOLE_SIZE, 0, &allocation.mappedData);
+            if (result != VK_SUCCESS) {
+                vkFreeMemory(m_device, allocation.memory, nullptr);
+                throw std::runtime_error("Failed to map dedicated device memory");
+            }
+        }
+
+        ++m_dedicatedAllocationCount;
+        m_dedicatedBytes += requirements.size;
+        return allocation;
+    }
+
+    // Whole atoms, so a widened flush/invalidate range stays inside the allocation
+    if (nonCoherent) {
+        allocation.size = alignUp(requirements.size, m_nonCoherentAtomSize);
+    }
+
+    Pool& pool = getPool(memoryTypeIndex, kind);
+
+    MemoryBlock* block = nullptr;
+    VkDeviceSize offset = 0;
+    for (auto& candidate : pool.blocks) {
+        if (candidate->allocate(allocation.size, alignment, &offset)) {
+            block = candidate.get();
+            break;
+        }
+    }
+
+    if (!block) {
+        auto newBlock = std::make_unique<MemoryBlock>(m_device, memoryTypeIndex, blockSize, hostVisible);
+        if (!newBlock->allocate(allocation.size, alignment, &offset)) {
+            throw std::runtime_error("Allocation does not fit into a new memory block");
+        }
+        block = newBlock.get();
+        pool.blocks.push_back(std::move(newBlock));
+    }
+
+    allocation.memory = block->handle();
+    allocation.offset = offset;
+    allocation.block = block;
+    if (block->mappedData()) {
+        allocation.mappedData = static_cast<char*>(block->mappedData()) + offset;
+    }
+    return allocation;
+}
+
+void MemoryAllocator::free(const MemoryAllocation& allocation)
+{
+    if (allocation.memory == VK_NULL_HANDLE) {
+        return;
+    }
+
+    std::scoped_lock lock(m_mutex);
+
+    if (!allocation.block) {
+        vkFreeMemory(m_device, allocation.memory, nullptr);
+        --m_dedicatedAllocationCount;
+        m_dedicatedBytes -= allocation.size;
+        return;
+    }
+
+    allocation.block->free(allocation.offset, allocation.size);
+    if (!allocation.block->empty()) {
+        return;
+    }
+
+    // Release empty blocks, but keep the last one of a pool so create/destroy churn
+    // does not go back to vkAllocateMemory every time
+    for (auto& pool : m_pools[allocation.memoryTypeIndex]) {
+        auto it = std::find_if(pool.blocks.begin(), pool.blocks.end(), [&](const auto& block) { return block.get() == allocation.block; });
+        if (it != pool.blocks.end()) {
+            if (pool.blocks.size() > 1) {
+                pool.blocks.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+void MemoryAllocator::flush(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) const
+{
+    if (allocation.memory == VK_NULL_HANDLE || isHostCoherent(allocation.memoryTypeIndex)) {
+        return;
+    }
+    VkMappedMemoryRange range = makeMappedRange(allocation, offset, size);
+    vkFlushMappedMemoryRanges(m_device, 1, &range);
+}
+
+void MemoryAllocator::invalidate(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) const
+{
+    if (allocation.memory == VK_NULL_HANDLE || isHostCoherent(allocation.memoryTypeIndex)) {
+        return;
+    }
+    VkMappedMemoryRange range = makeMappedRange(allocation, offset, size);
+    vkInvalidateMappedMemoryRanges(m_device, 1, &range);
+}
+
+MemoryStats MemoryAllocator::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    MemoryStats stats{};
+    uint64_t freeBytes = 0;
+    for (const auto& typePools : m_pools) {
+        for (const auto& pool : typePools) {
+            for (const auto& block : pool.blocks) {
+                ++stats.blockCount;
+                stats.allocationCount += block->allocationCount();
+                stats.reservedBytes += block->size();
+                stats.usedBytes += block->usedBytes();
+                stats.largestFreeRange = std::max<uint64_t>(stats.largestFreeRange, block->largestFreeRange());
+                freeBytes += block->size() - block->usedBytes();
+            }
+        }
+    }
+
+    stats.dedicatedAllocationCount = m_dedicatedAllocationCount;
+    stats.allocationCount += m_dedicatedAllocationCount;
+    stats.reservedBytes += m_dedicatedBytes;
+    stats.usedBytes += m_dedicatedBytes;
+    if (freeBytes > 0) {
+        stats.fragmentation = 1.0f - static_cast<float>(static_cast<double>(stats.largestFreeRange) / static_cast<double>(freeBytes));
+    }
+    return stats;
+}
+
+const VkPhysicalDeviceMemoryProperties& MemoryAllocator::getMemoryProperties() const
+{
+    return m_memoryProperties;
+}
+
+MemoryAllocator::Pool& MemoryAllocator::getPool(uint32_t memoryTypeIndex, MemoryResourceKind kind)
+{
+    // Without a granularity constraint linear and optimal resources can share blocks
+    size_t kindIndex = m_bufferImageGranularity > 1 ? static_cast<size_t>(kind) : 0;
+    return m_pools[memoryTypeIndex][kindIndex];
+}
+
+VkDeviceSize MemoryAllocator::getBlockSize(uint32_t memoryTypeIndex) const
+{
+    uint32_t heapIndex = m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    VkDeviceSize heapSize = m_memoryProperties.memoryHeaps[heapIndex].size;
+    // Small heaps (e.g. the 256MB device-local host-visible BAR heap) get smaller blocks
+    if (heapSize <= SMALL_HEAP_SIZE) {
+        return alignUp(heapSize / 8, m_bufferImageGranularity);
+    }
+    return DEFAULT_BLOCK_SIZE;
+}
+
+bool MemoryAllocator::isHostVisible(uint32_t memoryTypeIndex) const
+{
+    return (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+}
+
+bool MemoryAllocator::isHostCoherent(uint32_t memoryTypeIndex) const
+{
+    return (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+}
+
+VkMappedMemoryRange MemoryAllocator::makeMappedRange(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) const
+{
+    // Clamped to the allocation first so a range never reaches into a neighbour
+    offset = std::min(offset, allocation.size);
+    if (size == VK_WHOLE_SIZE || size > allocation.size - offset) {
+        size = allocation.size - offset;
+    }
+    VkDeviceSize allocationEnd = allocation.offset + allocation.size;
+    VkDeviceSize start = allocation.offset + offset;
+    VkDeviceSize end = start + size;
+
+    // Ranges must be nonCoherentAtomSize aligned unless they reach the end of the memory object.
+    // Block allocations start and end on atoms, dedicated ones end at the end of their memory.
+    start = alignDown(start, m_nonCoherentAtomSize);
+    end = std::min(alignUp(end, m_nonCoherentAtomSize), allocationEnd);
+
+    VkMappedMemoryRange range{};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = allocation.memory;
+    range.offset = start;
+    range.size = end - start;
+    return range;
+}
+
+} // namespace gfx::backend::vulkan::core
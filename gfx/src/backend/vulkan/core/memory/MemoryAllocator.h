@@ -0,0 +1,112 @@
+#ifndef GFX_VULKAN_MEMORY_ALLOCATOR_H
+#define GFX_VULKAN_MEMORY_ALLOCATOR_H
+
+#include "../CoreTypes.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+class MemoryBlock;
+
+// Resources that may share a block only with resources of the same kind when
+// bufferImageGranularity > 1 (buffers and linear images vs. optimal-tiling images)
+enum class MemoryResourceKind {
+    Linear = 0,
+    Optimal = 1,
+};
+
+struct MemoryAllocation {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0; // Reserved bytes, whole nonCoherentAtomSize atoms for non-coherent block allocations
+    uint32_t memoryTypeIndex = UINT32_MAX;
+    void* mappedData = nullptr; // Start of this allocation, host-visible memory only
+    MemoryBlock* block = nullptr; // nullptr for dedicated allocations
+};
+
+// A single VkDeviceMemory sub-allocated with best-fit over a free-range list.
+// Host-visible blocks are mapped once for their whole lifetime.
+class MemoryBlock {
+public:
+    MemoryBlock(const MemoryBlock&) = delete;
+    MemoryBlock& operator=(const MemoryBlock&) = delete;
+
+    MemoryBlock(VkDevice device, uint32_t memoryTypeIndex, VkDeviceSize size, bool hostVisible);
+    ~MemoryBlock();
+
+    bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset);
+    void free(VkDeviceSize offset, VkDeviceSize size);
+
+    VkDeviceMemory handle() const;
+    VkDeviceSize size() const;
+    VkDeviceSize usedBytes() const;
+    VkDeviceSize largestFreeRange() const;
+    uint32_t allocationCount() const;
+    void* mappedData() const;
+    bool empty() const;
+
+private:
+    void insertFreeRange(VkDeviceSize offset, VkDeviceSize size);
+    std::map<VkDeviceSize, VkDeviceSize>::iterator eraseFreeRange(std::map<VkDeviceSize, VkDeviceSize>::iterator it);
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkDeviceMemory m_memory = VK_NULL_HANDLE;
+    VkDeviceSize m_size = 0;
+    VkDeviceSize m_used = 0;
+    uint32_t m_allocationCount = 0;
+    void* m_mappedData = nullptr;
+
+    std::map<VkDeviceSize, VkDeviceSize> m_freeByOffset; // offset -> size
+    std::multimap<VkDeviceSize, VkDeviceSize> m_freeBySize; // size -> offset
+};
+
+// Per-device allocator: one block list per memory type (and resource kind), with
+// large resources getting a dedicated VkDeviceMemory of their own
+class MemoryAllocator {
+public:
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+    MemoryAllocator(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkPhysicalDeviceLimits& limits);
+    ~MemoryAllocator();
+
+    // Throws std::runtime_error if no memory type matches or device memory is exhausted
+    MemoryAllocation allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, MemoryResourceKind kind);
+    void free(const MemoryAllocation& allocation);
+
+    // Offsets are relative to the allocation; clamped to it, then expanded to nonCoherentAtomSize
+    void flush(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) const;
+    void invalidate(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) const;
+
+    MemoryStats getStats() const;
+    const VkPhysicalDeviceMemoryProperties& getMemoryProperties() const;
+
+private:
+    struct Pool {
+        std::vector<std::unique_ptr<MemoryBlock>> blocks;
+    };
+
+    Pool& getPool(uint32_t memoryTypeIndex, MemoryResourceKind kind);
+    VkDeviceSize getBlockSize(uint32_t memoryTypeIndex) const;
+    bool isHostVisible(uint32_t memoryTypeIndex) const;
+    bool isHostCoherent(uint32_t memoryTypeIndex) const;
+    VkMappedMemoryRange makeMappedRange(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) const;
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+    VkDeviceSize m_bufferImageGranularity = 1;
+    VkDeviceSize m_nonCoherentAtomSize = 1;
+
+    mutable std::mutex m_mutex;
+    Pool m_pools[VK_MAX_MEMORY_TYPES][2];
+    uint64_t m_dedicatedAllocationCount = 0;
+    uint64_t m_dedicatedBytes = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_MEMORY_ALLOCATOR_H
@@ -0,0 +1,101 @@
+#include "StagingRing.h"
+
+#include "../resource/Buffer.h"
+
+#include <stdexcept>
+
+namespace gfx::backend::vulkan::core {
+
+StagingRing::StagingRing(Device* device, VkDeviceSize capacity)
+    : m_capacity(capacity)
+{
+    BufferCreateInfo createInfo{};
+    createInfo.size = static_cast<size_t>(capacity);
+    createInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    createInfo.originalUsage = 0;
+    createInfo.memoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    m_buffer = std::make_unique<Buffer>(device, createInfo);
+    m_mappedData = static_cast<char*>(m_buffer->getMappedPointer());
+    if (!m_mappedData) {
+        throw std::runtime_error("Staging ring memory is not host-visible");
+    }
+}
+
+StagingRing::~StagingRing() = default;
+
+bool StagingRing::allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset)
+{
+    if (size == 0 || size > m_capacity) {
+        return false;
+    }
+    if (m_used == 0) {
+        m_head = 0;
+        m_tail = 0;
+    }
+
+    VkDeviceSize offset = (m_head + alignment - 1) / alignment * alignment;
+    VkDeviceSize consumed = 0;
+    if (m_head > m_tail || m_used == 0) {
+        // Free space is [head, capacity) followed by [0, tail)
+        if (offset + size <= m_capacity) {
+            consumed = offset + size - m_head;
+        } else if (size <= m_tail) {
+            consumed = (m_capacity - m_head) + size;
+            offset = 0;
+        } else {
+            return false;
+        }
+    } else if (m_head < m_tail) {
+        if (offset + size > m_tail) {
+            return false;
+        }
+        consumed = offset + size - m_head;
+    } else {
+        return false; // head == tail with data in flight: full
+    }
+
+    m_head = offset + size;
+    if (m_head == m_capacity) {
+        m_head = 0;
+    }
+    m_used += consumed;
+    m_untaken += consumed;
+    *outOffset = offset;
+    return true;
+}
+
+StagingRegion StagingRing::takeRegion()
+{
+    StagingRegion region{ m_head, m_untaken };
+    m_untaken = 0;
+    return region;
+}
+
+void StagingRing::release(const StagingRegion& region)
+{
+    m_tail = region.end;
+    m_used -= region.size;
+}
+
+VkBuffer StagingRing::handle() const
+{
+    return m_buffer->handle();
+}
+
+void* StagingRing::mappedData(VkDeviceSize offset) const
+{
+    return m_mappedData + offset;
+}
+
+VkDeviceSize StagingRing::capacity() const
+{
+    return m_capacity;
+}
+
+VkDeviceSize StagingRing::usedBytes() const
+{
+    return m_used;
+}
+
+} // namespace gfx::backend::vulkan::core
@@ -0,0 +1,52 @@
+#ifndef GFX_VULKAN_STAGING_RING_H
+#define GFX_VULKAN_STAGING_RING_H
+
+#include "../CoreTypes.h"
+
+#include <memory>
+
+namespace gfx::backend::vulkan::core {
+
+class Buffer;
+class Device;
+
+// Bytes handed out by a StagingRing between two takeRegion() calls. Released
+// in the same order they were taken once the GPU is done reading them.
+struct StagingRegion {
+    VkDeviceSize end = 0;
+    VkDeviceSize size = 0; // Including padding and space skipped when wrapping
+};
+
+// Persistently mapped, host-visible upload buffer used as a FIFO ring
+class StagingRing {
+public:
+    StagingRing(const StagingRing&) = delete;
+    StagingRing& operator=(const StagingRing&) = delete;
+
+    StagingRing(Device* device, VkDeviceSize capacity);
+    ~StagingRing();
+
+    // Returns false if there is no contiguous free range of the requested size
+    bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset);
+
+    StagingRegion takeRegion();
+    void release(const StagingRegion& region);
+
+    VkBuffer handle() const;
+    void* mappedData(VkDeviceSize offset) const;
+    VkDeviceSize capacity() const;
+    VkDeviceSize usedBytes() const;
+
+private:
+    std::unique_ptr<Buffer> m_buffer;
+    char* m_mappedData = nullptr;
+    VkDeviceSize m_capacity = 0;
+    VkDeviceSize m_head = 0; // Next byte to hand out
+    VkDeviceSize m_tail = 0; // Oldest byte still in use
+    VkDeviceSize m_used = 0;
+    VkDeviceSize m_untaken = 0; // Allocated since the last takeRegion()
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_STAGING_RING_H
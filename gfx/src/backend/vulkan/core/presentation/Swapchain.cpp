@@ -6,6 +6,7 @@
 #include "../resource/TextureView.h"
 #include "../system/Adapter.h"
 #include "../system/Device.h"
+#include "../system/Queue.h"
 
 #include <stdexcept>
 
@@ -136,8 +137,12 @@ Swapchain::Swapchain(Device* device, Surface* surface, const SwapchainCreateInfo
         m_textureViews.push_back(std::make_unique<TextureView>(m_textures[i].get(), viewCreateInfo));
     }
 
-    // Get present queue (assume queue family 0)
-    vkGetDeviceQueue(m_device->handle(), 0, 0, &m_presentQueue);
+    // Get present queue (assume queue family 0), through its wrapper so presents are
+    // synchronized with submits from other threads
+    m_presentQueue = m_device->getQueueByIndex(0, 0);
+    if (!m_presentQueue) {
+        m_presentQueue = m_device->getQueue();
+    }
 
     // Don't pre-acquire an image - let explicit acquire handle it
     m_currentImageIndex = 0;
@@ -234,7 +239,7 @@ VkResult Swapchain::present(const std::vector<VkSemaphore>& waitSemaphores)
     presentInfo.pSwapchains = &m_swapchain;
     presentInfo.pImageIndices = &m_currentImageIndex;
 
-    return vkQueuePresentKHR(m_presentQueue, &presentInfo);
+    return m_presentQueue->present(presentInfo);
 }
 
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
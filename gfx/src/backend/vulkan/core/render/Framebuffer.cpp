@@ -1,8 +1,7 @@
 #include "Framebuffer.h"
 
 #include "../system/Device.h"
-
-#include <stdexcept>
+#include "../system/FramebufferCache.h"
 
 namespace gfx::backend::vulkan::core {
 
@@ -11,25 +10,18 @@ Framebuffer::Framebuffer(Device* device, const FramebufferCreateInfo& createInfo
     , m_width(createInfo.width)
     , m_height(createInfo.height)
 {
-    VkFramebufferCreateInfo framebufferInfo{};
-    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-    framebufferInfo.renderPass = createInfo.renderPass;
-    framebufferInfo.attachmentCount = static_cast<uint32_t>(createInfo.attachments.size());
-    framebufferInfo.pAttachments = createInfo.attachments.data();
-    framebufferInfo.width = createInfo.width;
-    framebufferInfo.height = createInfo.height;
-    framebufferInfo.layers = 1;
-
-    VkResult result = vkCreateFramebuffer(m_device->handle(), &framebufferInfo, nullptr, &m_framebuffer);
-    if (result != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create framebuffer");
+    // Recreating a framebuffer for the same views returns the cached VkFramebuffer
+    FramebufferCache* cache = m_device->getFramebufferCache();
+    m_framebuffer = cache->acquire(createInfo);
+    if (cache->isImageless(createInfo)) {
+        m_imagelessAttachments = createInfo.attachments;
     }
 }
 
 Framebuffer::~Framebuffer()
 {
     if (m_framebuffer != VK_NULL_HANDLE) {
-        vkDestroyFramebuffer(m_device->handle(), m_framebuffer, nullptr);
+        m_device->getFramebufferCache()->release(m_framebuffer);
     }
 }
 
@@ -48,4 +40,9 @@ uint32_t Framebuffer::height() const
     return m_height;
 }
 
+const std::vector<VkImageView>& Framebuffer::imagelessAttachments() const
+{
+    return m_imagelessAttachments;
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
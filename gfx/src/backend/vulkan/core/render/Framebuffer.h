@@ -3,6 +3,8 @@
 
 #include "../CoreTypes.h"
 
+#include <vector>
+
 namespace gfx::backend::vulkan::core {
 
 class Device;
@@ -18,9 +20,12 @@ public:
     VkFramebuffer handle() const;
     uint32_t width() const;
     uint32_t height() const;
+    // Views to begin the render pass with, empty unless the framebuffer is imageless
+    const std::vector<VkImageView>& imagelessAttachments() const;
 
 private:
     VkFramebuffer m_framebuffer = VK_NULL_HANDLE;
+    std::vector<VkImageView> m_imagelessAttachments;
     Device* m_device = nullptr;
     uint32_t m_width = 0;
     uint32_t m_height = 0;
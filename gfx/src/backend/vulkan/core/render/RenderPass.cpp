@@ -1,17 +1,56 @@
 #include "RenderPass.h"
 
 #include "../system/Device.h"
+#include "../system/PipelineRegistry.h"
 
 #include <stdexcept>
+#include <type_traits>
 
 namespace gfx::backend::vulkan::core {
 
+namespace {
+    template <typename T>
+    void appendKey(std::string& key, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    std::string makeCompatibilityKey(const RenderPassCreateInfo& createInfo)
+    {
+        std::string key;
+        appendKey(key, createInfo.colorAttachments.size());
+        for (const auto& colorAttachment : createInfo.colorAttachments) {
+            appendKey(key, colorAttachment.target.format);
+            appendKey(key, colorAttachment.target.sampleCount);
+            appendKey(key, colorAttachment.resolveTarget.has_value());
+            if (colorAttachment.resolveTarget.has_value()) {
+                appendKey(key, colorAttachment.resolveTarget->format);
+            }
+        }
+
+        appendKey(key, createInfo.depthStencilAttachment.has_value());
+        if (createInfo.depthStencilAttachment.has_value()) {
+            appendKey(key, createInfo.depthStencilAttachment->target.format);
+            appendKey(key, createInfo.depthStencilAttachment->target.sampleCount);
+        }
+
+        appendKey(key, createInfo.viewMask.value_or(0));
+        appendKey(key, createInfo.correlationMasks.size());
+        for (uint32_t correlationMask : createInfo.correlationMasks) {
+            appendKey(key, correlationMask);
+        }
+        return key;
+    }
+} // anonymous namespace
+
 RenderPass::RenderPass(Device* device, const RenderPassCreateInfo& createInfo)
     : m_device(device)
 {
     // Store metadata
     m_colorAttachmentCount = static_cast<uint32_t>(createInfo.colorAttachments.size());
     m_hasDepthStencil = createInfo.depthStencilAttachment.has_value();
+    m_compatibilityKey = makeCompatibilityKey(createInfo);
 
     // Build attachment descriptions and references
     std::vector<VkAttachmentDescription> attachments;
@@ -179,6 +218,7 @@ RenderPass::RenderPass(Device* device, const RenderPassCreateInfo& createInfo)
 RenderPass::~RenderPass()
 {
     if (m_renderPass != VK_NULL_HANDLE) {
+        m_device->getPipelineRegistry()->forgetRenderPass(m_renderPass);
         vkDestroyRenderPass(m_device->handle(), m_renderPass, nullptr);
     }
 }
@@ -203,4 +243,9 @@ const std::vector<bool>& RenderPass::colorHasResolve() const
     return m_colorHasResolve;
 }
 
+const std::string& RenderPass::compatibilityKey() const
+{
+    return m_compatibilityKey;
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "../CoreTypes.h"
 
+#include <string>
+
 namespace gfx::backend::vulkan::core {
 
 class Device;
@@ -19,6 +21,9 @@ public:
     uint32_t colorAttachmentCount() const;
     bool hasDepthStencil() const;
     const std::vector<bool>& colorHasResolve() const;
+    // Equal for render passes a framebuffer can be shared between: same attachment formats,
+    // sample counts and resolve targets. Load/store ops and layouts don't affect compatibility.
+    const std::string& compatibilityKey() const;
 
 private:
     VkRenderPass m_renderPass = VK_NULL_HANDLE;
@@ -26,6 +31,7 @@ private:
     uint32_t m_colorAttachmentCount = 0;
     bool m_hasDepthStencil = false;
     std::vector<bool> m_colorHasResolve; // Track which color attachments have resolve targets
+    std::string m_compatibilityKey;
 };
 
 } // namespace gfx::backend::vulkan::core
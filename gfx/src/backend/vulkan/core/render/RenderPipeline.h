@@ -17,10 +17,13 @@ public:
 
     VkPipeline handle() const;
     VkPipelineLayout layout() const;
+    // See PipelineRegistry::pushConstantStages()
+    VkShaderStageFlags pushConstantStages(uint32_t offset, uint32_t size) const;
 
 private:
     VkPipeline m_pipeline = VK_NULL_HANDLE;
     VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+    std::vector<VkPushConstantRange> m_pushConstantRanges;
     Device* m_device = nullptr;
 };
 
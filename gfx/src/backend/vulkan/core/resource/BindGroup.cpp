@@ -1,56 +1,34 @@
 #include "BindGroup.h"
 
+#include "../memory/DescriptorAllocator.h"
 #include "../system/Device.h"
 
-#include <stdexcept>
-#include <unordered_map>
+#include <algorithm>
 #include <vector>
 
 namespace gfx::backend::vulkan::core {
 
 BindGroup::BindGroup(Device* device, const BindGroupCreateInfo& createInfo)
     : m_device(device)
+    , m_layout(createInfo.layout)
 {
-    // Count actual descriptors needed by type
-    std::unordered_map<VkDescriptorType, uint32_t> descriptorCounts;
-
+    // Count descriptors needed by type, only used if a new pool has to be created.
+    // Entries are few, so a linear scan beats hashing here.
+    std::vector<VkDescriptorPoolSize> descriptorCounts;
     for (const auto& entry : createInfo.entries) {
-        ++descriptorCounts[entry.descriptorType];
-    }
-
-    // Create descriptor pool with exact sizes
-    std::vector<VkDescriptorPoolSize> poolSizes;
-    for (const auto& [type, count] : descriptorCounts) {
-        VkDescriptorPoolSize poolSize{};
-        poolSize.type = type;
-        poolSize.descriptorCount = count;
-        poolSizes.push_back(poolSize);
-    }
-
-    VkDescriptorPoolCreateInfo poolInfo{};
-    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
-    poolInfo.pPoolSizes = poolSizes.data();
-    poolInfo.maxSets = 1; // Each BindGroup only allocates one descriptor set
-
-    VkResult result = vkCreateDescriptorPool(m_device->handle(), &poolInfo, nullptr, &m_pool);
-    if (result != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create descriptor pool");
+        auto it = std::find_if(descriptorCounts.begin(), descriptorCounts.end(), [&](const VkDescriptorPoolSize& size) {
+            return size.type == entry.descriptorType;
+        });
+        if (it == descriptorCounts.end()) {
+            descriptorCounts.push_back({ entry.descriptorType, 1 });
+        } else {
+            ++it->descriptorCount;
+        }
     }
 
-    // Allocate descriptor set
-    VkDescriptorSetLayout setLayout = createInfo.layout;
-
-    VkDescriptorSetAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocInfo.descriptorPool = m_pool;
-    allocInfo.descriptorSetCount = 1;
-    allocInfo.pSetLayouts = &setLayout;
-
-    result = vkAllocateDescriptorSets(m_device->handle(), &allocInfo, &m_descriptorSet);
-    if (result != VK_SUCCESS) {
-        throw std::runtime_error("Failed to allocate descriptor set");
-    }
+    // Allocate descriptor set from the device's shared pools
+    m_allocation = m_device->getDescriptorAllocator()->allocate(m_layout, descriptorCounts);
+    m_descriptorSet = m_allocation.set;
 
     // Update descriptor set
     // Build all the descriptor info arrays first
@@ -130,8 +108,8 @@ BindGroup::BindGroup(Device* device, const BindGroupCreateInfo& createInfo)
 
 BindGroup::~BindGroup()
 {
-    if (m_pool != VK_NULL_HANDLE) {
-        vkDestroyDescriptorPool(m_device->handle(), m_pool, nullptr);
+    if (m_descriptorSet != VK_NULL_HANDLE) {
+        m_device->getDescriptorAllocator()->recycle(m_layout, m_allocation);
     }
 }
 
@@ -140,4 +118,9 @@ VkDescriptorSet BindGroup::handle() const
     return m_descriptorSet;
 }
 
+Device* BindGroup::getDevice() const
+{
+    return m_device;
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define GFX_VULKAN_BINDGROUP_H
 
 #include "../CoreTypes.h"
+#include "../memory/DescriptorAllocator.h"
 
 namespace gfx::backend::vulkan::core {
 
@@ -16,11 +17,13 @@ public:
     ~BindGroup();
 
     VkDescriptorSet handle() const;
+    Device* getDevice() const;
 
 private:
     VkDescriptorSet m_descriptorSet = VK_NULL_HANDLE;
     Device* m_device = nullptr;
-    VkDescriptorPool m_pool = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
+    DescriptorSetAllocation m_allocation{};
 };
 
 } // namespace gfx::backend::vulkan::core
@@ -1,6 +1,8 @@
 #include "BindGroupLayout.h"
 
+#include "../memory/DescriptorAllocator.h"
 #include "../system/Device.h"
+#include "../system/PipelineRegistry.h"
 
 #include <stdexcept>
 
@@ -38,6 +40,9 @@ BindGroupLayout::BindGroupLayout(Device* device, const BindGroupLayoutCreateInfo
 BindGroupLayout::~BindGroupLayout()
 {
     if (m_layout != VK_NULL_HANDLE) {
+        // Sets kept for reuse must not outlive the layout handle
+        m_device->getDescriptorAllocator()->releaseLayout(m_layout);
+        m_device->getPipelineRegistry()->forgetDescriptorSetLayout(m_layout);
         vkDestroyDescriptorSetLayout(m_device->handle(), m_layout, nullptr);
     }
 }
@@ -1,8 +1,6 @@
 #include "Buffer.h"
 
-#include "../system/Adapter.h"
 #include "../system/Device.h"
-#include "../util/Utils.h"
 
 #include <stdexcept>
 
@@ -12,7 +10,6 @@ namespace gfx::backend::vulkan::core {
 Buffer::Buffer(Device* device, const BufferCreateInfo& createInfo)
     : m_device(device)
     , m_ownsResources(true)
-    , m_memory(VK_NULL_HANDLE)
     , m_info(createBufferInfo(createInfo))
 {
     VkBufferCreateInfo bufferInfo{};
@@ -29,31 +26,15 @@ Buffer::Buffer(Device* device, const BufferCreateInfo& createInfo)
     VkMemoryRequirements memRequirements;
     vkGetBufferMemoryRequirements(m_device->handle(), m_buffer, &memRequirements);
 
-    // Find memory type
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(m_device->getAdapter()->handle(), &memProperties);
-
     // Memory properties must be explicitly provided (validated at API level)
-    VkMemoryPropertyFlags desiredProperties = createInfo.memoryProperties;
-    uint32_t memoryTypeIndex = findMemoryType(memProperties, memRequirements.memoryTypeBits, desiredProperties);
-
-    if (memoryTypeIndex == UINT32_MAX) {
-        vkDestroyBuffer(m_device->handle(), m_buffer, nullptr);
-        throw std::runtime_error("Failed to find suitable memory type");
-    }
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = memoryTypeIndex;
-
-    result = vkAllocateMemory(m_device->handle(), &allocInfo, nullptr, &m_memory);
-    if (result != VK_SUCCESS) {
+    try {
+        m_allocation = m_device->getMemoryAllocator()->allocate(memRequirements, createInfo.memoryProperties, MemoryResourceKind::Linear);
+    } catch (...) {
         vkDestroyBuffer(m_device->handle(), m_buffer, nullptr);
-        throw std::runtime_error("Failed to allocate buffer memory");
+        throw;
     }
 
-    vkBindBufferMemory(m_device->handle(), m_buffer, m_memory, 0);
+    vkBindBufferMemory(m_device->handle(), m_buffer, m_allocation.memory, m_allocation.offset);
 }
 
 // Non-owning constructor - wraps an existing VkBuffer
@@ -61,7 +42,6 @@ Buffer::Buffer(Device* device, VkBuffer buffer, const BufferImportInfo& importIn
     : m_device(device)
     , m_ownsResources(false)
     , m_buffer(buffer)
-    , m_memory(VK_NULL_HANDLE)
     , m_info(createBufferInfo(importInfo))
 {
 }
@@ -69,12 +49,10 @@ Buffer::Buffer(Device* device, VkBuffer buffer, const BufferImportInfo& importIn
 Buffer::~Buffer()
 {
     if (m_ownsResources) {
-        if (m_memory != VK_NULL_HANDLE) {
-            vkFreeMemory(m_device->handle(), m_memory, nullptr);
-        }
         if (m_buffer != VK_NULL_HANDLE) {
             vkDestroyBuffer(m_device->handle(), m_buffer, nullptr);
         }
+        m_device->getMemoryAllocator()->free(m_allocation);
     }
 }
 
@@ -97,21 +75,21 @@ void* Buffer::map(uint64_t offset, uint64_t size)
         return nullptr;
     }
 
-    void* data;
-    VkResult result = vkMapMemory(m_device->handle(), m_memory, offset, mapSize, 0, &data);
-    if (result != VK_SUCCESS) {
+    // Host-visible memory stays mapped for the lifetime of its allocation
+    if (!m_allocation.mappedData) {
         return nullptr;
     }
-    return data;
+    return static_cast<char*>(m_allocation.mappedData) + offset;
 }
 
-void Buffer::unmap()
+void* Buffer::getMappedPointer() const
 {
-    if ((m_info.memoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0) {
-        return;
-    }
+    return m_allocation.mappedData;
+}
 
-    vkUnmapMemory(m_device->handle(), m_memory);
+void Buffer::unmap()
+{
+    // Nothing to do, the allocation is persistently mapped
 }
 
 void Buffer::flushMappedRange(uint64_t offset, uint64_t size)
@@ -125,13 +103,7 @@ void Buffer::flushMappedRange(uint64_t offset, uint64_t size)
         return; // Not host-visible, cannot flush
     }
 
-    VkMappedMemoryRange range{};
-    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-    range.memory = m_memory;
-    range.offset = offset;
-    range.size = size;
-
-    vkFlushMappedMemoryRanges(m_device->handle(), 1, &range);
+    m_device->getMemoryAllocator()->flush(m_allocation, offset, size);
 }
 
 void Buffer::invalidateMappedRange(uint64_t offset, uint64_t size)
@@ -145,13 +117,7 @@ void Buffer::invalidateMappedRange(uint64_t offset, uint64_t size)
         return; // Not host-visible, cannot invalidate
     }
 
-    VkMappedMemoryRange range{};
-    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-    range.memory = m_memory;
-    range.offset = offset;
-    range.size = size;
-
-    vkInvalidateMappedMemoryRanges(m_device->handle(), 1, &range);
+    m_device->getMemoryAllocator()->invalidate(m_allocation, offset, size);
 }
 
 VkBuffer Buffer::handle() const
@@ -159,6 +125,11 @@ VkBuffer Buffer::handle() const
     return m_buffer;
 }
 
+Device* Buffer::getDevice() const
+{
+    return m_device;
+}
+
 size_t Buffer::size() const
 {
     return m_info.size;
@@ -2,6 +2,7 @@
 #define GFX_VULKAN_BUFFER_H
 
 #include "../CoreTypes.h"
+#include "../memory/MemoryAllocator.h"
 
 namespace gfx::backend::vulkan::core {
 
@@ -17,11 +18,14 @@ public:
     ~Buffer();
 
     void* map(uint64_t offset, uint64_t size);
+    // Start of the lifetime mapping; nullptr for device-local and imported buffers
+    void* getMappedPointer() const;
     void unmap();
     void flushMappedRange(uint64_t offset, uint64_t size);
     void invalidateMappedRange(uint64_t offset, uint64_t size);
 
     VkBuffer handle() const;
+    Device* getDevice() const;
     size_t size() const;
     VkBufferUsageFlags getUsage() const;
     const BufferInfo& getInfo() const;
@@ -34,7 +38,7 @@ private:
     Device* m_device = nullptr;
     bool m_ownsResources = true;
     VkBuffer m_buffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_memory = VK_NULL_HANDLE;
+    MemoryAllocation m_allocation{};
     BufferInfo m_info{};
 };
 
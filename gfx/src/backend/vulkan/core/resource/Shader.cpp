@@ -1,6 +1,7 @@
 #include "Shader.h"
 
 #include "../system/Device.h"
+#include "../system/PipelineRegistry.h"
 
 #include <stdexcept>
 
@@ -29,6 +30,8 @@ Shader::Shader(Device* device, const ShaderCreateInfo& createInfo)
 Shader::~Shader()
 {
     if (m_shaderModule != VK_NULL_HANDLE) {
+        // Pipelines keyed on this module must not be returned for a new module reusing the handle
+        m_device->getPipelineRegistry()->forgetShaderModule(m_shaderModule);
         vkDestroyShaderModule(m_device->handle(), m_shaderModule, nullptr);
     }
 }
@@ -1,19 +1,29 @@
 #include "Texture.h"
 
+#include "../command/BarrierBatch.h"
 #include "../command/CommandEncoder.h"
 #include "../system/Adapter.h"
 #include "../system/Device.h"
 #include "../util/Utils.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace gfx::backend::vulkan::core {
 
+namespace {
+    bool sameState(const TextureSubresourceState& a, const TextureSubresourceState& b)
+    {
+        return a.layout == b.layout && a.accessMask == b.accessMask && a.stageMask == b.stageMask;
+    }
+} // anonymous namespace
+
 // Owning constructor - creates and manages VkImage and memory
 Texture::Texture(Device* device, const TextureCreateInfo& createInfo)
     : m_device(device)
     , m_ownsResources(true)
     , m_info(createTextureInfo(createInfo))
+    , m_subresourceStates(std::max<size_t>(1, static_cast<size_t>(m_info.mipLevelCount) * m_info.arrayLayers))
 {
     VkImageCreateInfo imageInfo{};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -38,23 +48,15 @@ Texture::Texture(Device* device, const TextureCreateInfo& createInfo)
     VkMemoryRequirements memRequirements;
     vkGetImageMemoryRequirements(m_device->handle(), m_image, &memRequirements);
 
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(m_device->getAdapter()->handle(), &memProperties);
-
-    uint32_t memoryTypeIndex = findMemoryType(memProperties, memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = memoryTypeIndex;
-
-    result = vkAllocateMemory(m_device->handle(), &allocInfo, nullptr, &m_memory);
-    if (result != VK_SUCCESS) {
+    // Images are always created with optimal tiling
+    try {
+        m_allocation = m_device->getMemoryAllocator()->allocate(memRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, MemoryResourceKind::Optimal);
+    } catch (...) {
         vkDestroyImage(m_device->handle(), m_image, nullptr);
-        throw std::runtime_error("Failed to allocate image memory");
+        throw;
     }
 
-    vkBindImageMemory(m_device->handle(), m_image, m_memory, 0);
+    vkBindImageMemory(m_device->handle(), m_image, m_allocation.memory, m_allocation.offset);
 }
 
 // Non-owning constructor - wraps an existing VkImage (e.g., from swapchain)
@@ -63,6 +65,7 @@ Texture::Texture(Device* device, VkImage image, const TextureCreateInfo& createI
     , m_ownsResources(false)
     , m_info(createTextureInfo(createInfo))
     , m_image(image)
+    , m_subresourceStates(std::max<size_t>(1, static_cast<size_t>(m_info.mipLevelCount) * m_info.arrayLayers))
 {
 }
 
@@ -72,18 +75,17 @@ Texture::Texture(Device* device, VkImage image, const TextureImportInfo& importI
     , m_ownsResources(false)
     , m_info(createTextureInfo(importInfo))
     , m_image(image)
+    , m_subresourceStates(std::max<size_t>(1, static_cast<size_t>(m_info.mipLevelCount) * m_info.arrayLayers))
 {
 }
 
 Texture::~Texture()
 {
     if (m_ownsResources) {
-        if (m_memory != VK_NULL_HANDLE) {
-            vkFreeMemory(m_device->handle(), m_memory, nullptr);
-        }
         if (m_image != VK_NULL_HANDLE) {
             vkDestroyImage(m_device->handle(), m_image, nullptr);
         }
+        m_device->getMemoryAllocator()->free(m_allocation);
     }
 }
 
@@ -97,6 +99,11 @@ VkDevice Texture::device() const
     return m_device->handle();
 }
 
+Device* Texture::getDevice() const
+{
+    return m_device;
+}
+
 VkImageType Texture::getImageType() const
 {
     return m_info.imageType;
@@ -137,113 +144,122 @@ const TextureInfo& Texture::getInfo() const
     return m_info;
 }
 
+size_t Texture::subresourceIndex(uint32_t mipLevel, uint32_t arrayLayer) const
+{
+    return static_cast<size_t>(arrayLayer) * m_info.mipLevelCount + mipLevel;
+}
+
 VkImageLayout Texture::getLayout() const
 {
-    return m_currentLayout;
+    return m_subresourceStates[0].layout;
 }
 
-void Texture::setLayout(VkImageLayout layout)
+VkImageLayout Texture::getLayout(uint32_t mipLevel, uint32_t arrayLayer) const
 {
-    m_currentLayout = layout;
+    return getSubresourceState(mipLevel, arrayLayer).layout;
 }
 
-void Texture::transitionLayout(CommandEncoder* encoder, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
+const TextureSubresourceState& Texture::getSubresourceState(uint32_t mipLevel, uint32_t arrayLayer) const
 {
-    transitionLayout(encoder->handle(), newLayout, baseMipLevel, levelCount, baseArrayLayer, layerCount);
+    return m_subresourceStates[subresourceIndex(mipLevel, arrayLayer)];
 }
 
-void Texture::transitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
+void Texture::setLayout(VkImageLayout layout)
 {
-    // Delegate to the private overload with explicit old layout
-    transitionLayout(commandBuffer, m_currentLayout, newLayout, baseMipLevel, levelCount, baseArrayLayer, layerCount);
+    TextureSubresourceState state{};
+    state.layout = layout;
+    state.accessMask = getVkAccessFlagsForLayout(layout);
+    state.stageMask = getVkPipelineStageFlagsForLayout(layout);
+    std::fill(m_subresourceStates.begin(), m_subresourceStates.end(), state);
+}
 
-    // Update the current layout
-    m_currentLayout = newLayout;
+void Texture::setSubresourceState(const TextureSubresourceState& state, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
+{
+    for (uint32_t mip = baseMipLevel; mip < baseMipLevel + levelCount; ++mip) {
+        for (uint32_t layer = baseArrayLayer; layer < baseArrayLayer + layerCount; ++layer) {
+            m_subresourceStates[subresourceIndex(mip, layer)] = state;
+        }
+    }
 }
 
-void Texture::transitionLayout(VkCommandBuffer commandBuffer, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
+void Texture::transitionLayout(BarrierBatch& batch, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
 {
-    VkImageMemoryBarrier barrier{};
-    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    barrier.oldLayout = oldLayout;
-    barrier.newLayout = newLayout;
-    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.image = m_image;
-
-    // Determine aspect mask based on format
-    barrier.subresourceRange.aspectMask = getImageAspectMask(m_info.format);
-
-    barrier.subresourceRange.baseMipLevel = baseMipLevel;
-    barrier.subresourceRange.levelCount = levelCount;
-    barrier.subresourceRange.baseArrayLayer = baseArrayLayer;
-    barrier.subresourceRange.layerCount = layerCount;
-
-    barrier.srcAccessMask = getVkAccessFlagsForLayout(oldLayout);
-    barrier.dstAccessMask = getVkAccessFlagsForLayout(newLayout);
-
-    // Determine source stage
-    VkPipelineStageFlags srcStage;
-    switch (oldLayout) {
-    case VK_IMAGE_LAYOUT_UNDEFINED:
-        srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
-    case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-        srcStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-        srcStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-    case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
-        srcStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-        srcStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-        srcStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-        break;
-    default:
-        srcStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-        break;
+    TextureSubresourceState newState{};
+    newState.layout = newLayout;
+    newState.accessMask = getVkAccessFlagsForLayout(newLayout);
+    newState.stageMask = getVkPipelineStageFlagsForLayout(newLayout);
+
+    // Emits one barrier for a block of subresources that are all in the same state
+    auto transitionBlock = [&](uint32_t mip, uint32_t mipCount, uint32_t layer, uint32_t blockLayerCount) {
+        TextureSubresourceState& oldState = m_subresourceStates[subresourceIndex(mip, layer)];
+
+        if (oldState.layout == newLayout && !hasWriteAccess(oldState.accessMask) && !hasWriteAccess(newState.accessMask)) {
+            // Read after read in the same layout, but a later write has to wait for both reads
+            TextureSubresourceState readState = oldState;
+            readState.accessMask |= newState.accessMask;
+            readState.stageMask |= newState.stageMask;
+            setSubresourceState(readState, mip, mipCount, layer, blockLayerCount);
+            batch.addElided();
+            return;
+        }
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = oldState.layout;
+        barrier.newLayout = newLayout;
+        barrier.srcAccessMask = oldState.accessMask;
+        barrier.dstAccessMask = newState.accessMask;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_image;
+        barrier.subresourceRange.aspectMask = getImageAspectMask(m_info.format);
+        barrier.subresourceRange.baseMipLevel = mip;
+        barrier.subresourceRange.levelCount = mipCount;
+        barrier.subresourceRange.baseArrayLayer = layer;
+        barrier.subresourceRange.layerCount = blockLayerCount;
+
+        batch.addImageBarrier(barrier, oldState.stageMask, newState.stageMask);
+        setSubresourceState(newState, mip, mipCount, layer, blockLayerCount);
+    };
+
+    // Common case: the whole range was last transitioned together
+    const TextureSubresourceState& first = m_subresourceStates[subresourceIndex(baseMipLevel, baseArrayLayer)];
+    bool uniform = true;
+    for (uint32_t mip = baseMipLevel; mip < baseMipLevel + levelCount && uniform; ++mip) {
+        for (uint32_t layer = baseArrayLayer; layer < baseArrayLayer + layerCount && uniform; ++layer) {
+            uniform = sameState(m_subresourceStates[subresourceIndex(mip, layer)], first);
+        }
+    }
+    if (uniform) {
+        transitionBlock(baseMipLevel, levelCount, baseArrayLayer, layerCount);
+        return;
     }
 
-    // Determine destination stage
-    VkPipelineStageFlags dstStage;
-    switch (newLayout) {
-    case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
-    case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-        dstStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-        dstStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-    case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
-        dstStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-        dstStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-        break;
-    case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-        dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-        break;
-    default:
-        dstStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-        break;
+    // Otherwise one barrier per run of layers in the same state, per mip level
+    for (uint32_t mip = baseMipLevel; mip < baseMipLevel + levelCount; ++mip) {
+        uint32_t layer = baseArrayLayer;
+        while (layer < baseArrayLayer + layerCount) {
+            const TextureSubresourceState runState = m_subresourceStates[subresourceIndex(mip, layer)];
+            uint32_t runEnd = layer + 1;
+            while (runEnd < baseArrayLayer + layerCount && sameState(m_subresourceStates[subresourceIndex(mip, runEnd)], runState)) {
+                ++runEnd;
+            }
+            transitionBlock(mip, 1, layer, runEnd - layer);
+            layer = runEnd;
+        }
     }
+}
 
-    vkCmdPipelineBarrier(
-        commandBuffer,
-        srcStage, dstStage,
-        0,
-        0, nullptr,
-        0, nullptr,
-        1, &barrier);
+void Texture::transitionLayout(CommandEncoder* encoder, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
+{
+    transitionLayout(encoder->barriers(), newLayout, baseMipLevel, levelCount, baseArrayLayer, layerCount);
+}
 
-    // Note: Do not update m_currentLayout here since we're transitioning specific mip levels
+void Texture::transitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount)
+{
+    BarrierBatch batch(commandBuffer, m_device->getCmdPipelineBarrier2());
+    transitionLayout(batch, newLayout, baseMipLevel, levelCount, baseArrayLayer, layerCount);
+    batch.flush();
 }
 
 void Texture::generateMipmaps(CommandEncoder* encoder)
@@ -265,11 +281,12 @@ void Texture::generateMipmapsRange(CommandEncoder* encoder, uint32_t baseMipLeve
         levelCount = m_info.mipLevelCount - baseMipLevel;
     }
 
-    VkImageLayout initialLayout = m_currentLayout;
+    VkImageLayout initialLayout = getLayout(baseMipLevel, 0);
     VkCommandBuffer cmdBuffer = encoder->handle();
+    BarrierBatch& barriers = encoder->barriers();
 
     // Transition base mip level to TRANSFER_SRC_OPTIMAL (it's already been written to)
-    transitionLayout(encoder, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, baseMipLevel, 1, 0, m_info.arrayLayers);
+    transitionLayout(barriers, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, baseMipLevel, 1, 0, m_info.arrayLayers);
 
     // Blit each mip level from the previous one
     for (uint32_t i = 0; i < levelCount - 1; ++i) {
@@ -293,8 +310,10 @@ void Texture::generateMipmapsRange(CommandEncoder* encoder, uint32_t baseMipLeve
         dstHeight = std::max(1, dstHeight);
         dstDepth = std::max(1, dstDepth);
 
-        // Transition dst mip from UNDEFINED to TRANSFER_DST_OPTIMAL
-        transitionLayout(cmdBuffer, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, dstMip, 1, 0, m_info.arrayLayers);
+        // Transition dst mip to TRANSFER_DST_OPTIMAL, in the same barrier as the previous
+        // dst mip becoming the source of this blit
+        transitionLayout(barriers, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, dstMip, 1, 0, m_info.arrayLayers);
+        barriers.flush();
 
         // Blit from src to dst
         VkImageBlit blit = {};
@@ -314,15 +333,12 @@ void Texture::generateMipmapsRange(CommandEncoder* encoder, uint32_t baseMipLeve
 
         vkCmdBlitImage(cmdBuffer, m_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
 
-        // After blitting, transition dst mip from TRANSFER_DST_OPTIMAL to TRANSFER_SRC_OPTIMAL
-        transitionLayout(cmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dstMip, 1, 0, m_info.arrayLayers);
+        // After blitting, transition dst mip to TRANSFER_SRC_OPTIMAL for the next level
+        transitionLayout(barriers, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dstMip, 1, 0, m_info.arrayLayers);
     }
 
-    // Transition all mip levels from TRANSFER_SRC_OPTIMAL back to the initial layout
-    transitionLayout(cmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, initialLayout, baseMipLevel, levelCount, 0, m_info.arrayLayers);
-
-    // Update tracked layout
-    m_currentLayout = initialLayout;
+    // Transition all mip levels back to the initial layout, recorded with the encoder's next barriers
+    transitionLayout(barriers, initialLayout, baseMipLevel, levelCount, 0, m_info.arrayLayers);
 }
 
 // Static helper to create TextureInfo from TextureCreateInfo
@@ -335,7 +351,8 @@ TextureInfo Texture::createTextureInfo(const TextureCreateInfo& info)
         info.format,
         info.mipLevelCount,
         info.sampleCount,
-        info.usage
+        info.usage,
+        info.flags
     };
 }
 
@@ -349,7 +366,8 @@ TextureInfo Texture::createTextureInfo(const TextureImportInfo& info)
         info.format,
         info.mipLevelCount,
         info.sampleCount,
-        info.usage
+        info.usage,
+        info.flags
     };
 }
 
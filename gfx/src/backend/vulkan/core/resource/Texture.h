@@ -2,12 +2,23 @@
 #define GFX_VULKAN_TEXTURE_H
 
 #include "../CoreTypes.h"
+#include "../memory/MemoryAllocator.h"
+
+#include <vector>
 
 namespace gfx::backend::vulkan::core {
 
+class BarrierBatch;
 class CommandEncoder;
 class Device;
 
+// What the last barrier (or elided read) left a subresource in, i.e. what the next barrier waits on
+struct TextureSubresourceState {
+    VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkAccessFlags accessMask = 0;
+    VkPipelineStageFlags stageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+};
+
 class Texture {
 public:
     Texture(const Texture&) = delete;
@@ -20,6 +31,7 @@ public:
 
     VkImage handle() const;
     VkDevice device() const;
+    Device* getDevice() const;
     VkImageType getImageType() const;
     VkExtent3D getSize() const;
     uint32_t getArrayLayers() const;
@@ -29,17 +41,26 @@ public:
     VkImageUsageFlags getUsage() const;
     const TextureInfo& getInfo() const;
 
+    // Layout of mip level 0, array layer 0; other subresources may differ after partial transitions
     VkImageLayout getLayout() const;
+    VkImageLayout getLayout(uint32_t mipLevel, uint32_t arrayLayer) const;
+    const TextureSubresourceState& getSubresourceState(uint32_t mipLevel, uint32_t arrayLayer) const;
+    // Sets every subresource, e.g. after a transition recorded outside of the tracked paths
     void setLayout(VkImageLayout layout);
+    void setSubresourceState(const TextureSubresourceState& state, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount);
 
+    // Adds the barriers moving the range to newLayout to the batch. Subresources already in
+    // newLayout that were only read, and are only read again, need no barrier and are elided.
+    void transitionLayout(BarrierBatch& batch, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount);
+    // Batched with the encoder's other pending barriers, recorded before its next command
     void transitionLayout(CommandEncoder* encoder, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount);
+    // Recorded immediately
     void transitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount);
     void generateMipmaps(CommandEncoder* encoder);
     void generateMipmapsRange(CommandEncoder* encoder, uint32_t baseMipLevel, uint32_t levelCount);
 
 private:
-    // Internal layout transition with explicit old layout (for mipmap generation)
-    void transitionLayout(VkCommandBuffer commandBuffer, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t baseMipLevel, uint32_t levelCount, uint32_t baseArrayLayer, uint32_t layerCount);
+    size_t subresourceIndex(uint32_t mipLevel, uint32_t arrayLayer) const;
 
     static TextureInfo createTextureInfo(const TextureCreateInfo& info);
     static TextureInfo createTextureInfo(const TextureImportInfo& info);
@@ -48,8 +69,8 @@ private:
     bool m_ownsResources = true;
     TextureInfo m_info{};
     VkImage m_image = VK_NULL_HANDLE;
-    VkDeviceMemory m_memory = VK_NULL_HANDLE;
-    VkImageLayout m_currentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    MemoryAllocation m_allocation{};
+    std::vector<TextureSubresourceState> m_subresourceStates; // Indexed by subresourceIndex()
 };
 
 } // namespace gfx::backend::vulkan::core
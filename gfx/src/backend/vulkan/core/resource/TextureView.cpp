@@ -2,8 +2,11 @@
 
 #include "Texture.h"
 
+#include "../system/Device.h"
+#include "../system/FramebufferCache.h"
 #include "../util/Utils.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace gfx::backend::vulkan::core {
@@ -11,6 +14,9 @@ namespace gfx::backend::vulkan::core {
 TextureView::TextureView(Texture* texture, const TextureViewCreateInfo& createInfo)
     : m_device(texture->device())
     , m_texture(texture)
+    , m_baseMipLevel(createInfo.baseMipLevel)
+    , m_arrayLayerCount(createInfo.arrayLayerCount)
+    , m_framebufferCache(texture->getDevice()->getFramebufferCache())
 {
     VkImageViewCreateInfo viewInfo{};
     viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -40,6 +46,8 @@ TextureView::TextureView(Texture* texture, const TextureViewCreateInfo& createIn
 TextureView::~TextureView()
 {
     if (m_imageView != VK_NULL_HANDLE) {
+        // Cached framebuffers must not outlive their views
+        m_framebufferCache->forgetImageView(m_imageView);
         vkDestroyImageView(m_device, m_imageView, nullptr);
     }
 }
@@ -59,4 +67,18 @@ VkFormat TextureView::getFormat() const
     return m_format;
 }
 
+FramebufferAttachmentInfo TextureView::getFramebufferAttachmentInfo() const
+{
+    const TextureInfo& textureInfo = m_texture->getInfo();
+
+    FramebufferAttachmentInfo info{};
+    info.flags = textureInfo.flags;
+    info.usage = textureInfo.usage;
+    info.width = std::max(1u, textureInfo.size.width >> m_baseMipLevel);
+    info.height = std::max(1u, textureInfo.size.height >> m_baseMipLevel);
+    info.layerCount = m_arrayLayerCount;
+    info.format = m_format;
+    return info;
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 namespace gfx::backend::vulkan::core {
 
+class FramebufferCache;
 class Texture;
 
 class TextureView {
@@ -18,12 +19,17 @@ public:
     VkImageView handle() const;
     Texture* getTexture() const;
     VkFormat getFormat() const;
+    // Describes the view to an imageless framebuffer
+    FramebufferAttachmentInfo getFramebufferAttachmentInfo() const;
 
 private:
     VkDevice m_device = VK_NULL_HANDLE;
     Texture* m_texture = nullptr;
     VkImageView m_imageView = VK_NULL_HANDLE;
     VkFormat m_format; // View format (may differ from texture format)
+    uint32_t m_baseMipLevel = 0;
+    uint32_t m_arrayLayerCount = 0;
+    FramebufferCache* m_framebufferCache = nullptr; // Non-owning, outlives the view
 };
 
 } // namespace gfx::backend::vulkan::core
@@ -86,6 +86,9 @@ VkResult Semaphore::wait(uint64_t value, uint64_t timeoutNs)
         return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
 
+    // The signaling submit may still be held back
+    m_device->flushSubmits();
+
     VkSemaphoreWaitInfo waitInfo{};
     waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
     waitInfo.semaphoreCount = 1;
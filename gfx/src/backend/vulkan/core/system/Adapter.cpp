@@ -26,6 +26,11 @@ uint32_t Adapter::getGraphicsQueueFamily() const
     return m_graphicsQueueFamily;
 }
 
+uint32_t Adapter::getTransferQueueFamily() const
+{
+    return m_transferQueueFamily;
+}
+
 Instance* Adapter::getInstance() const
 {
     return m_instance;
@@ -95,6 +100,15 @@ void Adapter::initializeAdapterInfo()
     if (m_graphicsQueueFamily == UINT32_MAX) {
         throw std::runtime_error("Failed to find graphics queue family for adapter");
     }
+
+    // Dedicated transfer family (DMA engine), used by the upload engine
+    for (uint32_t i = 0; i < static_cast<uint32_t>(queueFamilies.size()); ++i) {
+        VkQueueFlags flags = queueFamilies[i].queueFlags;
+        if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+            m_transferQueueFamily = i;
+            break;
+        }
+    }
 }
 
 std::vector<const char*> Adapter::enumerateSupportedExtensions() const
@@ -108,7 +122,8 @@ std::vector<const char*> Adapter::enumerateSupportedExtensions() const
     static const ExtensionMapping knownExtensions[] = {
         { extensions::SWAPCHAIN, VK_KHR_SWAPCHAIN_EXTENSION_NAME },
         { extensions::TIMELINE_SEMAPHORE, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME },
-        { extensions::MULTIVIEW, VK_KHR_MULTIVIEW_EXTENSION_NAME }
+        { extensions::MULTIVIEW, VK_KHR_MULTIVIEW_EXTENSION_NAME },
+        { extensions::DRAW_INDIRECT_COUNT, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME }
     };
 
     // Query what this physical device actually supports
@@ -136,6 +151,15 @@ std::vector<const char*> Adapter::enumerateSupportedExtensions() const
         supportedExtensions.push_back(extensions::ANISOTROPIC_FILTERING);
     }
 
+    // The upload queue signals its progress through a timeline semaphore
+    bool supportsTimelineSemaphore = std::any_of(supportedExtensions.begin(), supportedExtensions.end(),
+        [](const char* name) {
+            return strcmp(name, extensions::TIMELINE_SEMAPHORE) == 0;
+        });
+    if (supportsTimelineSemaphore) {
+        supportedExtensions.push_back(extensions::UPLOAD_QUEUE);
+    }
+
     return supportedExtensions;
 }
 
@@ -17,6 +17,8 @@ public:
 
     VkPhysicalDevice handle() const;
     uint32_t getGraphicsQueueFamily() const;
+    // Family that supports transfers but neither graphics nor compute, UINT32_MAX if there is none
+    uint32_t getTransferQueueFamily() const;
     Instance* getInstance() const;
     const VkPhysicalDeviceProperties& getProperties() const;
     const VkPhysicalDeviceMemoryProperties& getMemoryProperties() const;
@@ -36,6 +38,7 @@ private:
     VkPhysicalDeviceMemoryProperties m_memoryProperties{};
     VkPhysicalDeviceFeatures m_features{};
     uint32_t m_graphicsQueueFamily = UINT32_MAX;
+    uint32_t m_transferQueueFamily = UINT32_MAX;
 };
 
 } // namespace gfx::backend::vulkan::core
@@ -0,0 +1,76 @@
+#include "DeletionQueue.h"
+
+#include "Queue.h"
+
+#include <utility>
+
+namespace gfx::backend::vulkan::core {
+
+DeletionQueue::DeletionQueue(std::vector<Queue*> queues)
+    : m_queues(std::move(queues))
+{
+}
+
+DeletionQueue::~DeletionQueue()
+{
+    for (Entry& entry : m_entries) {
+        entry.release();
+    }
+}
+
+void DeletionQueue::defer(std::function<void()> release)
+{
+    Entry entry{};
+    entry.release = std::move(release);
+    entry.serials.reserve(m_queues.size());
+
+    // Tagged under the lock so entries stay ordered by their serials
+    std::scoped_lock lock(m_mutex);
+    for (Queue* queue : m_queues) {
+        entry.serials.push_back(queue->markSerial());
+    }
+    m_entries.push_back(std::move(entry));
+}
+
+void DeletionQueue::releaseCompleted()
+{
+    std::vector<std::function<void()>> releases;
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_entries.empty()) {
+            return;
+        }
+
+        std::vector<uint64_t> completed;
+        completed.reserve(m_queues.size());
+        for (Queue* queue : m_queues) {
+            completed.push_back(queue->getCompletedSerial());
+        }
+
+        while (!m_entries.empty()) {
+            const Entry& entry = m_entries.front();
+            bool done = true;
+            for (size_t i = 0; i < m_queues.size() && done; ++i) {
+                done = entry.serials[i] <= completed[i];
+            }
+            if (!done) {
+                break;
+            }
+            releases.push_back(std::move(m_entries.front().release));
+            m_entries.pop_front();
+        }
+    }
+
+    // Outside the lock, destructors take the allocators' locks
+    for (auto& release : releases) {
+        release();
+    }
+}
+
+size_t DeletionQueue::pendingCount() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_entries.size();
+}
+
+} // namespace gfx::backend::vulkan::core
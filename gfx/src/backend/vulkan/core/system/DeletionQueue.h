@@ -0,0 +1,49 @@
+#ifndef GFX_VULKAN_DELETION_QUEUE_H
+#define GFX_VULKAN_DELETION_QUEUE_H
+
+#include "../CoreTypes.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+class Queue;
+
+// Destroys objects once the GPU is done with them instead of draining the queues first.
+// Each entry is tagged with the serial every queue signals after the work submitted (or held
+// back) so far and released once all of those serials completed. Serials only grow and entries
+// are tagged in order, so entries complete in order as well.
+class DeletionQueue {
+public:
+    DeletionQueue(const DeletionQueue&) = delete;
+    DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+    // The queues must support serials, see Queue::markSerial()
+    explicit DeletionQueue(std::vector<Queue*> queues);
+    // Releases what is left, the device must be idle by then
+    ~DeletionQueue();
+
+    void defer(std::function<void()> release);
+    // Runs the releases of entries whose serials completed, outside the lock
+    void releaseCompleted();
+
+    size_t pendingCount() const;
+
+private:
+    struct Entry {
+        std::vector<uint64_t> serials; // One per queue, in m_queues order
+        std::function<void()> release;
+    };
+
+    std::vector<Queue*> m_queues; // Non-owning pointers
+
+    mutable std::mutex m_mutex;
+    std::deque<Entry> m_entries;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_DELETION_QUEUE_H
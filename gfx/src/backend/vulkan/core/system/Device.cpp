@@ -1,8 +1,21 @@
 #include "Device.h"
 
 #include "Adapter.h"
+#include "DeletionQueue.h"
+#include "FramebufferCache.h"
+#include "PipelineCache.h"
+#include "PipelineCompilePool.h"
+#include "PipelineRegistry.h"
 #include "Queue.h"
+#include "SamplerCache.h"
 
+#include "UploadEngine.h"
+
+#include "../command/CommandPoolArena.h"
+#include "../memory/DescriptorAllocator.h"
+#include "../memory/MemoryAllocator.h"
+
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -52,8 +65,11 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
     }
 #endif // GFX_HEADLESS_BUILD
 
+    // The upload queue reports completion through a timeline semaphore
+    bool uploadQueueEnabled = isExtensionEnabled(createInfo.enabledExtensions, extensions::UPLOAD_QUEUE);
+
     // Enable timeline semaphore extension if requested
-    bool timelineSemaphoreEnabled = isExtensionEnabled(createInfo.enabledExtensions, extensions::TIMELINE_SEMAPHORE);
+    bool timelineSemaphoreEnabled = uploadQueueEnabled || isExtensionEnabled(createInfo.enabledExtensions, extensions::TIMELINE_SEMAPHORE);
     if (timelineSemaphoreEnabled) {
         requestedExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
     }
@@ -72,6 +88,18 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
         deviceFeatures.samplerAnisotropy = VK_TRUE;
     }
 
+    // Multi-draw indirect has no extension, enable it whenever available so it can't be forgotten
+    if (availableFeatures.multiDrawIndirect) {
+        deviceFeatures.multiDrawIndirect = VK_TRUE;
+        m_multiDrawIndirectSupported = true;
+    }
+
+    // Enable indirect count draws if requested
+    bool drawIndirectCountEnabled = isExtensionEnabled(createInfo.enabledExtensions, extensions::DRAW_INDIRECT_COUNT);
+    if (drawIndirectCountEnabled) {
+        requestedExtensions.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    }
+
     // Check if all requested extensions are available
     const auto availableExtensions = m_adapter->enumerateExtensionProperties();
     for (const char* requestedExt : requestedExtensions) {
@@ -82,6 +110,50 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
         }
     }
 
+    // Synchronization2 has no gfx extension, barriers and semaphore waits use its per-barrier and
+    // per-wait stage masks whenever the device supports it
+    bool synchronization2Enabled = false;
+    if (isExtensionAvailable(availableExtensions, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)) {
+        VkPhysicalDeviceSynchronization2FeaturesKHR supportedSynchronization2{};
+        supportedSynchronization2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        VkPhysicalDeviceFeatures2 supportedFeatures{};
+        supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures.pNext = &supportedSynchronization2;
+        vkGetPhysicalDeviceFeatures2(m_adapter->handle(), &supportedFeatures);
+        synchronization2Enabled = supportedSynchronization2.synchronization2 == VK_TRUE;
+    }
+    if (synchronization2Enabled) {
+        requestedExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+    }
+
+    // Imageless framebuffers have no gfx extension either, the framebuffer cache shares one
+    // framebuffer between views with the same properties whenever the device supports them
+    bool imagelessFramebufferEnabled = false;
+    if (isExtensionAvailable(availableExtensions, VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME)
+        && isExtensionAvailable(availableExtensions, VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME)) {
+        VkPhysicalDeviceImagelessFramebufferFeaturesKHR supportedImagelessFramebuffer{};
+        supportedImagelessFramebuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+        VkPhysicalDeviceFeatures2 supportedFeatures{};
+        supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures.pNext = &supportedImagelessFramebuffer;
+        vkGetPhysicalDeviceFeatures2(m_adapter->handle(), &supportedFeatures);
+        imagelessFramebufferEnabled = supportedImagelessFramebuffer.imagelessFramebuffer == VK_TRUE;
+    }
+    if (imagelessFramebufferEnabled) {
+        // Required by the imageless framebuffer extension on Vulkan 1.1
+        requestedExtensions.push_back(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME);
+        requestedExtensions.push_back(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME);
+    }
+    m_imagelessFramebufferEnabled = imagelessFramebufferEnabled;
+
+    // Deferred destruction tracks queue progress with timeline semaphores, enable them whenever
+    // available. The extension requires the timelineSemaphore feature to be supported.
+    if (!timelineSemaphoreEnabled && isExtensionAvailable(availableExtensions, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+        timelineSemaphoreEnabled = true;
+        requestedExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    }
+    m_timelineSemaphoreEnabled = timelineSemaphoreEnabled;
+
     // Timeline semaphore features (VK_KHR_timeline_semaphore extension for Vulkan 1.1)
     VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphoreFeatures{};
     if (timelineSemaphoreEnabled) {
@@ -94,10 +166,26 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
     VkPhysicalDeviceMultiviewFeatures multiviewFeatures{};
     if (multiviewEnabled) {
         multiviewFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
-        multiviewFeatures.pNext = timelineSemaphoreEnabled ? &timelineSemaphoreFeatures : nullptr;
+        multiviewFeatures.pNext = nullptr;
         multiviewFeatures.multiview = VK_TRUE;
     }
 
+    // Synchronization2 features (VK_KHR_synchronization2 extension for Vulkan 1.1)
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features{};
+    if (synchronization2Enabled) {
+        synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        synchronization2Features.pNext = nullptr;
+        synchronization2Features.synchronization2 = VK_TRUE;
+    }
+
+    // Imageless framebuffer features (VK_KHR_imageless_framebuffer extension for Vulkan 1.1)
+    VkPhysicalDeviceImagelessFramebufferFeaturesKHR imagelessFramebufferFeatures{};
+    if (imagelessFramebufferEnabled) {
+        imagelessFramebufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+        imagelessFramebufferFeatures.pNext = nullptr;
+        imagelessFramebufferFeatures.imagelessFramebuffer = VK_TRUE;
+    }
+
     // Determine which queues to create
     std::vector<DeviceCreateInfo::QueueRequest> queueRequests;
     if (createInfo.queueRequests.empty()) {
@@ -107,6 +195,18 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
         queueRequests = createInfo.queueRequests;
     }
 
+    // Uploads go to a dedicated transfer queue when the adapter has one
+    uint32_t transferQueueFamily = m_adapter->getTransferQueueFamily();
+    if (uploadQueueEnabled && transferQueueFamily != UINT32_MAX) {
+        bool requested = std::any_of(queueRequests.begin(), queueRequests.end(),
+            [transferQueueFamily](const DeviceCreateInfo::QueueRequest& req) {
+                return req.queueFamilyIndex == transferQueueFamily && req.queueIndex == 0;
+            });
+        if (!requested) {
+            queueRequests.push_back({ transferQueueFamily, 0, 1.0f });
+        }
+    }
+
     // Group queue requests by family and find max queue index per family
     std::unordered_map<uint32_t, uint32_t> maxQueueIndexPerFamily;
     for (const auto& req : queueRequests) {
@@ -137,11 +237,23 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
         priorityStorage.push_back(std::move(priorities));
     }
 
+    // Chain the enabled feature structs
     void* pNext = nullptr;
+    if (timelineSemaphoreEnabled) {
+        timelineSemaphoreFeatures.pNext = pNext;
+        pNext = &timelineSemaphoreFeatures;
+    }
     if (multiviewEnabled) {
+        multiviewFeatures.pNext = pNext;
         pNext = &multiviewFeatures;
-    } else if (timelineSemaphoreEnabled) {
-        pNext = &timelineSemaphoreFeatures;
+    }
+    if (synchronization2Enabled) {
+        synchronization2Features.pNext = pNext;
+        pNext = &synchronization2Features;
+    }
+    if (imagelessFramebufferEnabled) {
+        imagelessFramebufferFeatures.pNext = pNext;
+        pNext = &imagelessFramebufferFeatures;
     }
 
     VkDeviceCreateInfo vkCreateInfo{};
@@ -158,6 +270,15 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
         throw std::runtime_error("Failed to create Vulkan device");
     }
 
+    if (drawIndirectCountEnabled) {
+        m_cmdDrawIndirectCount = loadFunction<PFN_vkCmdDrawIndirectCountKHR>("vkCmdDrawIndirectCountKHR");
+        m_cmdDrawIndexedIndirectCount = loadFunction<PFN_vkCmdDrawIndexedIndirectCountKHR>("vkCmdDrawIndexedIndirectCountKHR");
+    }
+    if (synchronization2Enabled) {
+        m_cmdPipelineBarrier2 = loadFunction<PFN_vkCmdPipelineBarrier2KHR>("vkCmdPipelineBarrier2KHR");
+        m_queueSubmit2 = loadFunction<PFN_vkQueueSubmit2KHR>("vkQueueSubmit2KHR");
+    }
+
     // Create Queue wrappers for all requested queues
     for (const auto& req : queueRequests) {
         VkQueue vkQueue = VK_NULL_HANDLE;
@@ -173,10 +294,59 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
 
         m_queues[key] = std::move(queue);
     }
+
+    m_memoryAllocator = std::make_unique<MemoryAllocator>(m_device, m_adapter->getMemoryProperties(), m_adapter->getProperties().limits);
+    m_descriptorAllocator = std::make_unique<DescriptorAllocator>(m_device);
+    m_commandPoolArena = std::make_unique<CommandPoolArena>(m_device, m_defaultQueue->family());
+    m_pipelineCache = std::make_unique<PipelineCache>(this, createInfo.pipelineCacheData, createInfo.pipelineCacheDataSize);
+    if (createInfo.pipelineCacheDataAccepted) {
+        *createInfo.pipelineCacheDataAccepted = m_pipelineCache->initialDataAccepted();
+    }
+    m_pipelineCompileThreadCount = createInfo.pipelineCompileThreadCount;
+    m_deferSubmits = createInfo.deferSubmits;
+    m_pipelineRegistry = std::make_unique<PipelineRegistry>(m_device);
+    m_samplerCache = std::make_unique<SamplerCache>(m_device);
+    m_framebufferCache = std::make_unique<FramebufferCache>(m_device, m_imagelessFramebufferEnabled);
+
+    if (m_timelineSemaphoreEnabled) {
+        std::vector<Queue*> queues;
+        for (auto& [key, queue] : m_queues) {
+            queues.push_back(queue.get());
+        }
+        m_deletionQueue = std::make_unique<DeletionQueue>(std::move(queues));
+    }
+
+    if (uploadQueueEnabled) {
+        Queue* transferQueue = transferQueueFamily != UINT32_MAX ? getQueueByIndex(transferQueueFamily, 0) : m_defaultQueue;
+        m_uploadEngine = std::make_unique<UploadEngine>(this, transferQueue, m_defaultQueue);
+    }
 }
 
 Device::~Device()
 {
+    // Finishes queued pipeline compiles, they use the registry and cache below
+    m_pipelineCompilePool.reset();
+
+    // Waits for outstanding uploads and releases its queue resources. Goes first, the uploads
+    // may still write to resources waiting in the deletion queue.
+    m_uploadEngine.reset();
+
+    // Destroys what is still deferred, which needs the allocators below
+    m_deletionQueue.reset();
+
+    // Queues hold staging memory and upload command pools
+    m_defaultQueue = nullptr;
+    m_queues.clear();
+
+    // Releases pipelines, command and descriptor pools and memory blocks, must happen before the device goes away
+    m_pipelineRegistry.reset();
+    m_samplerCache.reset();
+    m_framebufferCache.reset();
+    m_commandPoolArena.reset();
+    m_pipelineCache.reset();
+    m_descriptorAllocator.reset();
+    m_memoryAllocator.reset();
+
     if (m_device != VK_NULL_HANDLE) {
         vkDestroyDevice(m_device, nullptr);
     }
@@ -184,7 +354,51 @@ Device::~Device()
 
 void Device::waitIdle()
 {
-    vkDeviceWaitIdle(m_device);
+    if (PipelineCompilePool* pool = getStartedPipelineCompilePool()) {
+        pool->waitIdle();
+    }
+    // Queue by queue instead of vkDeviceWaitIdle, which would need every queue to be locked
+    for (auto& [key, queue] : m_queues) {
+        queue->waitIdle();
+    }
+    releaseCompletedDestroys();
+}
+
+void Device::flushSubmits()
+{
+    if (!m_deferSubmits) {
+        return;
+    }
+    for (auto& [key, queue] : m_queues) {
+        queue->flush();
+    }
+}
+
+void Device::deferDestroy(std::function<void()> destroy)
+{
+    if (!m_deletionQueue) {
+        destroy();
+        return;
+    }
+    m_deletionQueue->defer(std::move(destroy));
+}
+
+void Device::releaseCompletedDestroys()
+{
+    if (m_deletionQueue) {
+        m_deletionQueue->releaseCompleted();
+    }
+}
+
+void Device::poll()
+{
+    if (!m_deletionQueue) {
+        return;
+    }
+    for (auto& [key, queue] : m_queues) {
+        queue->signalSerial();
+    }
+    m_deletionQueue->releaseCompleted();
 }
 
 VkDevice Device::handle() const
@@ -197,6 +411,56 @@ Queue* Device::getQueue()
     return m_defaultQueue;
 }
 
+CommandPoolArena* Device::getCommandPoolArena()
+{
+    return m_commandPoolArena.get();
+}
+
+DescriptorAllocator* Device::getDescriptorAllocator()
+{
+    return m_descriptorAllocator.get();
+}
+
+PipelineCache* Device::getPipelineCache()
+{
+    return m_pipelineCache.get();
+}
+
+PipelineRegistry* Device::getPipelineRegistry()
+{
+    return m_pipelineRegistry.get();
+}
+
+SamplerCache* Device::getSamplerCache()
+{
+    return m_samplerCache.get();
+}
+
+FramebufferCache* Device::getFramebufferCache()
+{
+    return m_framebufferCache.get();
+}
+
+PipelineCompilePool* Device::getPipelineCompilePool()
+{
+    std::scoped_lock lock(m_pipelineCompilePoolMutex);
+    if (!m_pipelineCompilePool) {
+        m_pipelineCompilePool = std::make_unique<PipelineCompilePool>(m_pipelineCompileThreadCount);
+    }
+    return m_pipelineCompilePool.get();
+}
+
+PipelineCompilePool* Device::getStartedPipelineCompilePool()
+{
+    std::scoped_lock lock(m_pipelineCompilePoolMutex);
+    return m_pipelineCompilePool.get();
+}
+
+UploadEngine* Device::getUploadEngine()
+{
+    return m_uploadEngine.get();
+}
+
 Queue* Device::getQueueByIndex(uint32_t queueFamilyIndex, uint32_t queueIndex)
 {
     uint64_t key = makeQueueKey(queueFamilyIndex, queueIndex);
@@ -209,6 +473,11 @@ Adapter* Device::getAdapter()
     return m_adapter;
 }
 
+MemoryAllocator* Device::getMemoryAllocator()
+{
+    return m_memoryAllocator.get();
+}
+
 const VkPhysicalDeviceProperties& Device::getProperties() const
 {
     return m_adapter->getProperties();
@@ -220,4 +489,44 @@ bool Device::supportsShaderFormat(ShaderSourceType format) const
     return format == ShaderSourceType::SPIRV;
 }
 
+bool Device::supportsTimelineSemaphores() const
+{
+    return m_timelineSemaphoreEnabled;
+}
+
+bool Device::supportsMultiDrawIndirect() const
+{
+    return m_multiDrawIndirectSupported;
+}
+
+bool Device::supportsImagelessFramebuffer() const
+{
+    return m_imagelessFramebufferEnabled;
+}
+
+PFN_vkCmdDrawIndirectCountKHR Device::getCmdDrawIndirectCount() const
+{
+    return m_cmdDrawIndirectCount;
+}
+
+PFN_vkCmdDrawIndexedIndirectCountKHR Device::getCmdDrawIndexedIndirectCount() const
+{
+    return m_cmdDrawIndexedIndirectCount;
+}
+
+bool Device::defersSubmits() const
+{
+    return m_deferSubmits;
+}
+
+PFN_vkCmdPipelineBarrier2KHR Device::getCmdPipelineBarrier2() const
+{
+    return m_cmdPipelineBarrier2;
+}
+
+PFN_vkQueueSubmit2KHR Device::getQueueSubmit2() const
+{
+    return m_queueSubmit2;
+}
+
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
@@ -3,13 +3,25 @@
 
 #include "../CoreTypes.h"
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace gfx::backend::vulkan::core {
 
 class Adapter;
+class CommandPoolArena;
+class DeletionQueue;
+class DescriptorAllocator;
+class FramebufferCache;
+class MemoryAllocator;
+class PipelineCache;
+class PipelineCompilePool;
+class PipelineRegistry;
 class Queue;
+class SamplerCache;
+class UploadEngine;
 
 class Device {
 public:
@@ -20,14 +32,46 @@ public:
     ~Device();
 
     void waitIdle();
+    // Submits what every queue holds back, for host waits on work that may not be submitted yet
+    void flushSubmits();
+    // Runs destroy once the GPU finished the work submitted so far, without waiting for it.
+    // Without timeline semaphores the device can't track that and destroy runs right away.
+    void deferDestroy(std::function<void()> destroy);
+    // Runs deferred destroys whose work completed
+    void releaseCompletedDestroys();
+    // Gets pending serial signals submitted, then releases what completed
+    void poll();
 
     VkDevice handle() const;
     Queue* getQueue();
     Queue* getQueueByIndex(uint32_t queueFamilyIndex, uint32_t queueIndex);
     Adapter* getAdapter();
+    MemoryAllocator* getMemoryAllocator();
+    CommandPoolArena* getCommandPoolArena();
+    DescriptorAllocator* getDescriptorAllocator();
+    PipelineCache* getPipelineCache();
+    PipelineRegistry* getPipelineRegistry();
+    // Started on first use with the thread count from the create info
+    PipelineCompilePool* getPipelineCompilePool();
+    SamplerCache* getSamplerCache();
+    FramebufferCache* getFramebufferCache();
+    // nullptr unless the upload queue extension is enabled
+    UploadEngine* getUploadEngine();
     const VkPhysicalDeviceProperties& getProperties() const;
 
     bool supportsShaderFormat(ShaderSourceType format) const;
+    bool supportsTimelineSemaphores() const;
+    bool defersSubmits() const;
+    // Whether one indirect draw call may read more than one command
+    bool supportsMultiDrawIndirect() const;
+    // Whether the framebuffer cache creates imageless framebuffers
+    bool supportsImagelessFramebuffer() const;
+    // nullptr unless the draw indirect count extension is enabled
+    PFN_vkCmdDrawIndirectCountKHR getCmdDrawIndirectCount() const;
+    PFN_vkCmdDrawIndexedIndirectCountKHR getCmdDrawIndexedIndirectCount() const;
+    // nullptr unless the device supports synchronization2, the original commands are used then
+    PFN_vkCmdPipelineBarrier2KHR getCmdPipelineBarrier2() const;
+    PFN_vkQueueSubmit2KHR getQueueSubmit2() const;
 
     // Extension function pointer loaders
     template <typename T>
@@ -37,12 +81,36 @@ public:
     }
 
 private:
+    // nullptr if no pipeline was created asynchronously yet
+    PipelineCompilePool* getStartedPipelineCompilePool();
+
     VkDevice m_device = VK_NULL_HANDLE;
     Adapter* m_adapter = nullptr; // Non-owning pointer
 
     // Map of (queueFamilyIndex << 16 | queueIndex) -> Queue
     std::unordered_map<uint64_t, std::unique_ptr<Queue>> m_queues;
     Queue* m_defaultQueue = nullptr; // Non-owning pointer to default queue
+    std::unique_ptr<MemoryAllocator> m_memoryAllocator;
+    std::unique_ptr<CommandPoolArena> m_commandPoolArena;
+    std::unique_ptr<DescriptorAllocator> m_descriptorAllocator;
+    std::unique_ptr<PipelineCache> m_pipelineCache;
+    std::unique_ptr<PipelineRegistry> m_pipelineRegistry;
+    std::mutex m_pipelineCompilePoolMutex;
+    std::unique_ptr<PipelineCompilePool> m_pipelineCompilePool;
+    uint32_t m_pipelineCompileThreadCount = 0;
+    std::unique_ptr<SamplerCache> m_samplerCache;
+    std::unique_ptr<FramebufferCache> m_framebufferCache;
+    std::unique_ptr<UploadEngine> m_uploadEngine;
+    std::unique_ptr<DeletionQueue> m_deletionQueue;
+
+    bool m_timelineSemaphoreEnabled = false;
+    bool m_deferSubmits = false;
+    bool m_multiDrawIndirectSupported = false;
+    bool m_imagelessFramebufferEnabled = false;
+    PFN_vkCmdDrawIndirectCountKHR m_cmdDrawIndirectCount = nullptr;
+    PFN_vkCmdDrawIndexedIndirectCountKHR m_cmdDrawIndexedIndirectCount = nullptr;
+    PFN_vkCmdPipelineBarrier2KHR m_cmdPipelineBarrier2 = nullptr;
+    PFN_vkQueueSubmit2KHR m_queueSubmit2 = nullptr;
 };
 
 } // namespace gfx::backend::vulkan::core
@@ -0,0 +1,211 @@
+#include "FramebufferCache.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    template <typename T>
+    void appendKey(std::string& key, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    std::string makeKey(const FramebufferCreateInfo& createInfo, bool imageless)
+    {
+        std::string key;
+        appendKey(key, imageless);
+        appendKey(key, createInfo.renderPassKey.size());
+        key.append(createInfo.renderPassKey);
+        appendKey(key, createInfo.attachments.size());
+        if (imageless) {
+            for (const FramebufferAttachmentInfo& info : createInfo.attachmentInfos) {
+                appendKey(key, info.flags);
+                appendKey(key, info.usage);
+                appendKey(key, info.width);
+                appendKey(key, info.height);
+                appendKey(key, info.layerCount);
+                appendKey(key, info.format);
+            }
+        } else {
+            for (VkImageView view : createInfo.attachments) {
+                appendKey(key, view);
+            }
+        }
+        appendKey(key, createInfo.width);
+        appendKey(key, createInfo.height);
+        return key;
+    }
+} // anonymous namespace
+
+FramebufferCache::FramebufferCache(VkDevice device, bool imagelessSupported)
+    : m_device(device)
+    , m_imagelessSupported(imagelessSupported)
+{
+}
+
+FramebufferCache::~FramebufferCache()
+{
+    for (const auto& [framebuffer, entry] : m_framebuffers) {
+        vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+    }
+}
+
+VkFramebuffer FramebufferCache::acquire(const FramebufferCreateInfo& createInfo)
+{
+    bool imageless = isImageless(createInfo);
+    // Without a compatibility key the framebuffer can't be matched against other render passes
+    std::string key = createInfo.renderPassKey.empty() ? std::string() : makeKey(createInfo, imageless);
+
+    std::scoped_lock lock(m_mutex);
+
+    if (!key.empty()) {
+        auto it = m_lookup.find(key);
+        if (it != m_lookup.end()) {
+            Entry& entry = m_framebuffers[it->second];
+            if (entry.refCount++ == 0) {
+                --m_idleCount;
+            }
+            ++m_hitCount;
+            return it->second;
+        }
+    }
+
+    VkFramebufferCreateInfo framebufferInfo{};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = createInfo.renderPass;
+    framebufferInfo.attachmentCount = static_cast<uint32_t>(createInfo.attachments.size());
+    framebufferInfo.pAttachments = createInfo.attachments.data();
+    framebufferInfo.width = createInfo.width;
+    framebufferInfo.height = createInfo.height;
+    framebufferInfo.layers = 1;
+
+    std::vector<VkFramebufferAttachmentImageInfoKHR> imageInfos;
+    VkFramebufferAttachmentsCreateInfoKHR attachmentsInfo{};
+    if (imageless) {
+        for (const FramebufferAttachmentInfo& info : createInfo.attachmentInfos) {
+            VkFramebufferAttachmentImageInfoKHR imageInfo{};
+            imageInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO_KHR;
+            imageInfo.flags = info.flags;
+            imageInfo.usage = info.usage;
+            imageInfo.width = info.width;
+            imageInfo.height = info.height;
+            imageInfo.layerCount = info.layerCount;
+            imageInfo.viewFormatCount = 1;
+            imageInfo.pViewFormats = &info.format;
+            imageInfos.push_back(imageInfo);
+        }
+        attachmentsInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO_KHR;
+        attachmentsInfo.attachmentImageInfoCount = static_cast<uint32_t>(imageInfos.size());
+        attachmentsInfo.pAttachmentImageInfos = imageInfos.data();
+        framebufferInfo.pNext = &attachmentsInfo;
+        framebufferInfo.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR;
+        framebufferInfo.pAttachments = nullptr;
+    }
+
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    if (vkCreateFramebuffer(m_device, &framebufferInfo, nullptr, &framebuffer) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create framebuffer");
+    }
+
+    if (!key.empty()) {
+        m_lookup[key] = framebuffer;
+    }
+    Entry& entry = m_framebuffers[framebuffer];
+    entry.key = std::move(key);
+    if (!imageless) {
+        entry.attachments = createInfo.attachments;
+    }
+    entry.refCount = 1;
+    return framebuffer;
+}
+
+void FramebufferCache::release(VkFramebuffer framebuffer)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_framebuffers.find(framebuffer);
+    if (it == m_framebuffers.end() || --it->second.refCount > 0) {
+        return;
+    }
+
+    auto lookupIt = m_lookup.find(it->second.key);
+    if (it->second.key.empty() || lookupIt == m_lookup.end() || lookupIt->second != framebuffer) {
+        destroy(framebuffer);
+        return;
+    }
+
+    it->second.releaseSerial = ++m_releaseSerial;
+    ++m_idleCount;
+    evictIdle();
+}
+
+bool FramebufferCache::isImageless(const FramebufferCreateInfo& createInfo) const
+{
+    return m_imagelessSupported && !createInfo.attachmentInfos.empty()
+        && createInfo.attachmentInfos.size() == createInfo.attachments.size();
+}
+
+void FramebufferCache::forgetImageView(VkImageView view)
+{
+    std::scoped_lock lock(m_mutex);
+
+    std::vector<VkFramebuffer> idle;
+    for (const auto& [framebuffer, entry] : m_framebuffers) {
+        if (std::find(entry.attachments.begin(), entry.attachments.end(), view) == entry.attachments.end()) {
+            continue;
+        }
+        auto lookupIt = m_lookup.find(entry.key);
+        if (lookupIt != m_lookup.end() && lookupIt->second == framebuffer) {
+            m_lookup.erase(lookupIt);
+        }
+        // Framebuffers still in use are destroyed when released
+        if (entry.refCount == 0) {
+            idle.push_back(framebuffer);
+        }
+    }
+
+    for (VkFramebuffer framebuffer : idle) {
+        --m_idleCount;
+        destroy(framebuffer);
+    }
+}
+
+FramebufferCacheStats FramebufferCache::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    FramebufferCacheStats stats{};
+    stats.framebufferCount = static_cast<uint32_t>(m_framebuffers.size());
+    stats.idleFramebufferCount = m_idleCount;
+    stats.hitCount = m_hitCount;
+    return stats;
+}
+
+void FramebufferCache::destroy(VkFramebuffer framebuffer)
+{
+    m_framebuffers.erase(framebuffer);
+    vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+}
+
+void FramebufferCache::evictIdle()
+{
+    while (m_idleCount > MAX_IDLE_FRAMEBUFFERS) {
+        auto oldest = m_framebuffers.end();
+        for (auto it = m_framebuffers.begin(); it != m_framebuffers.end(); ++it) {
+            if (it->second.refCount == 0 && (oldest == m_framebuffers.end() || it->second.releaseSerial < oldest->second.releaseSerial)) {
+                oldest = it;
+            }
+        }
+
+        VkFramebuffer framebuffer = oldest->first;
+        m_lookup.erase(oldest->second.key);
+        --m_idleCount;
+        destroy(framebuffer);
+    }
+}
+
+} // namespace gfx::backend::vulkan::core
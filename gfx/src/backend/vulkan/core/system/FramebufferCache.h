@@ -0,0 +1,73 @@
+#ifndef GFX_VULKAN_FRAMEBUFFER_CACHE_H
+#define GFX_VULKAN_FRAMEBUFFER_CACHE_H
+
+#include "../CoreTypes.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+struct FramebufferCacheStats {
+    uint32_t framebufferCount = 0; // In use and idle
+    uint32_t idleFramebufferCount = 0;
+    uint64_t hitCount = 0;
+};
+
+// Device-wide store of VkFramebuffers keyed by render pass compatibility class, attachment
+// views and extent. Framebuffers are reference counted; released ones stay idle so that apps
+// recreating a GfxFramebuffer for the same views every frame (or per swapchain image) get the
+// existing VkFramebuffer back. Idle framebuffers are destroyed once one of their views is
+// destroyed, or, oldest first, when more than MAX_IDLE_FRAMEBUFFERS are idle.
+// With VK_KHR_imageless_framebuffer, create infos that carry attachmentInfos get an imageless
+// framebuffer keyed by those instead of the views, so views with the same format, usage, size
+// and layers (e.g. all swapchain images) share one. It references no view and is only evicted.
+class FramebufferCache {
+public:
+    static constexpr uint32_t MAX_IDLE_FRAMEBUFFERS = 64;
+
+    FramebufferCache(const FramebufferCache&) = delete;
+    FramebufferCache& operator=(const FramebufferCache&) = delete;
+
+    FramebufferCache(VkDevice device, bool imagelessSupported);
+    ~FramebufferCache();
+
+    // Throws std::runtime_error if a new framebuffer cannot be created
+    VkFramebuffer acquire(const FramebufferCreateInfo& createInfo);
+    // Same contract as vkDestroyFramebuffer: no pending command buffer may still use it
+    void release(VkFramebuffer framebuffer);
+    // If true the views have to be passed with VkRenderPassAttachmentBeginInfo instead
+    bool isImageless(const FramebufferCreateInfo& createInfo) const;
+
+    // Called before the view is destroyed, its handle value may be reused afterwards
+    void forgetImageView(VkImageView view);
+
+    FramebufferCacheStats getStats() const;
+
+private:
+    struct Entry {
+        std::string key; // Empty if the framebuffer is not shared
+        std::vector<VkImageView> attachments; // Empty for imageless framebuffers
+        uint32_t refCount = 0;
+        uint64_t releaseSerial = 0; // Orders idle framebuffers for eviction
+    };
+
+    void destroy(VkFramebuffer framebuffer);
+    void evictIdle();
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    bool m_imagelessSupported = false;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<VkFramebuffer, Entry> m_framebuffers;
+    std::unordered_map<std::string, VkFramebuffer> m_lookup;
+    uint32_t m_idleCount = 0;
+    uint64_t m_releaseSerial = 0;
+    uint64_t m_hitCount = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_FRAMEBUFFER_CACHE_H
@@ -0,0 +1,79 @@
+#include "PipelineCache.h"
+
+#include "Device.h"
+
+#include "common/Logger.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace gfx::backend::vulkan::core {
+
+PipelineCache::PipelineCache(Device* device, const void* initialData, size_t initialDataSize)
+    : m_device(device)
+{
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+    if (initialData && initialDataSize > 0) {
+        if (isCompatible(initialData, initialDataSize, device->getProperties())) {
+            createInfo.initialDataSize = initialDataSize;
+            createInfo.pInitialData = initialData;
+        } else {
+            gfx::common::Logger::instance().logWarning("Ignoring pipeline cache data written by a different driver or device");
+        }
+    }
+
+    VkResult result = vkCreatePipelineCache(device->handle(), &createInfo, nullptr, &m_pipelineCache);
+    if (result != VK_SUCCESS && createInfo.pInitialData) {
+        // Header matched but the driver still rejected the contents, start empty
+        gfx::common::Logger::instance().logWarning("Pipeline cache data was rejected by the driver, starting empty");
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        result = vkCreatePipelineCache(device->handle(), &createInfo, nullptr, &m_pipelineCache);
+    }
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create pipeline cache");
+    }
+    m_initialDataAccepted = createInfo.pInitialData != nullptr;
+}
+
+PipelineCache::~PipelineCache()
+{
+    if (m_pipelineCache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(m_device->handle(), m_pipelineCache, nullptr);
+    }
+}
+
+VkPipelineCache PipelineCache::handle() const
+{
+    return m_pipelineCache;
+}
+
+bool PipelineCache::initialDataAccepted() const
+{
+    return m_initialDataAccepted;
+}
+
+VkResult PipelineCache::getData(size_t* dataSize, void* data) const
+{
+    return vkGetPipelineCacheData(m_device->handle(), m_pipelineCache, dataSize, data);
+}
+
+bool PipelineCache::isCompatible(const void* data, size_t dataSize, const VkPhysicalDeviceProperties& properties)
+{
+    VkPipelineCacheHeaderVersionOne header{};
+    if (!data || dataSize < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    return header.headerSize >= sizeof(header)
+        && header.headerSize <= dataSize
+        && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && header.vendorID == properties.vendorID
+        && header.deviceID == properties.deviceID
+        && std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+} // namespace gfx::backend::vulkan::core
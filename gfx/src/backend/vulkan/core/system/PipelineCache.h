@@ -0,0 +1,38 @@
+#ifndef GFX_VULKAN_PIPELINE_CACHE_H
+#define GFX_VULKAN_PIPELINE_CACHE_H
+
+#include "../CoreTypes.h"
+
+namespace gfx::backend::vulkan::core {
+
+class Device;
+
+// Device-wide VkPipelineCache shared by every render and compute pipeline
+class PipelineCache {
+public:
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    // initialData is ignored (starting empty) if it was not written by this driver and device
+    PipelineCache(Device* device, const void* initialData, size_t initialDataSize);
+    ~PipelineCache();
+
+    VkPipelineCache handle() const;
+    // False if there was no initial data or it was ignored
+    bool initialDataAccepted() const;
+
+    // Vulkan-style query: data == nullptr returns the size in *dataSize
+    VkResult getData(size_t* dataSize, void* data) const;
+
+    // Checks the VkPipelineCacheHeaderVersionOne header against the device properties
+    static bool isCompatible(const void* data, size_t dataSize, const VkPhysicalDeviceProperties& properties);
+
+private:
+    Device* m_device = nullptr;
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+    bool m_initialDataAccepted = false;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_PIPELINE_CACHE_H
@@ -0,0 +1,83 @@
+#include "PipelineCompilePool.h"
+
+#include <algorithm>
+
+namespace gfx::backend::vulkan::core {
+
+PipelineCompilePool::PipelineCompilePool(uint32_t threadCount)
+{
+    if (threadCount == 0) {
+        threadCount = defaultThreadCount();
+    }
+
+    m_threads.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&PipelineCompilePool::workerLoop, this);
+    }
+}
+
+PipelineCompilePool::~PipelineCompilePool()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_stopping = true;
+    }
+    m_taskAvailable.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void PipelineCompilePool::submit(std::function<void()> task)
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_taskAvailable.notify_one();
+}
+
+void PipelineCompilePool::waitIdle()
+{
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [this] { return m_tasks.empty() && m_runningTaskCount == 0; });
+}
+
+uint32_t PipelineCompilePool::getThreadCount() const
+{
+    return static_cast<uint32_t>(m_threads.size());
+}
+
+uint32_t PipelineCompilePool::defaultThreadCount()
+{
+    // Leave most cores to the application, compiles are bursty and the driver may use threads of its own
+    const uint32_t cores = std::thread::hardware_concurrency();
+    return std::clamp(cores / 2, 1u, 4u);
+}
+
+void PipelineCompilePool::workerLoop()
+{
+    std::unique_lock lock(m_mutex);
+    while (true) {
+        m_taskAvailable.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+        if (m_tasks.empty()) {
+            return; // Stopping and drained
+        }
+
+        std::function<void()> task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        ++m_runningTaskCount;
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        --m_runningTaskCount;
+        if (m_tasks.empty() && m_runningTaskCount == 0) {
+            m_idle.notify_all();
+        }
+    }
+}
+
+} // namespace gfx::backend::vulkan::core
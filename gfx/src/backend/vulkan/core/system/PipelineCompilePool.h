@@ -0,0 +1,49 @@
+#ifndef GFX_VULKAN_PIPELINE_COMPILE_POOL_H
+#define GFX_VULKAN_PIPELINE_COMPILE_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+// Worker threads the asynchronous pipeline creation functions compile on. Pipelines share the
+// device's PipelineRegistry and PipelineCache, both of which may be used from any thread.
+class PipelineCompilePool {
+public:
+    PipelineCompilePool(const PipelineCompilePool&) = delete;
+    PipelineCompilePool& operator=(const PipelineCompilePool&) = delete;
+
+    // threadCount == 0 picks a count from the number of CPU cores
+    explicit PipelineCompilePool(uint32_t threadCount);
+    // Runs the tasks that are still queued, then joins the threads
+    ~PipelineCompilePool();
+
+    void submit(std::function<void()> task);
+    // Blocks until every submitted task has finished
+    void waitIdle();
+
+    uint32_t getThreadCount() const;
+
+    static uint32_t defaultThreadCount();
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_idle;
+    std::deque<std::function<void()>> m_tasks;
+    uint32_t m_runningTaskCount = 0;
+    bool m_stopping = false;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_PIPELINE_COMPILE_POOL_H
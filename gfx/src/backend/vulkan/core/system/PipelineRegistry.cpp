@@ -0,0 +1,316 @@
+#include "PipelineRegistry.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    // Handles are pointers or uint64_t depending on the platform
+    template <typename T>
+    uint64_t handleBits(T handle)
+    {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &handle, sizeof(handle));
+        return bits;
+    }
+
+    class KeyWriter {
+    public:
+        template <typename T>
+        void write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            m_data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void writeString(const char* value)
+        {
+            const size_t length = value ? std::strlen(value) : 0;
+            write(length);
+            m_data.append(value ? value : "", length);
+        }
+
+        std::string take()
+        {
+            return std::move(m_data);
+        }
+
+    private:
+        std::string m_data;
+    };
+
+    enum class PipelineKind : uint8_t {
+        Render,
+        Compute
+    };
+} // anonymous namespace
+
+PipelineRegistry::PipelineRegistry(VkDevice device)
+    : m_device(device)
+{
+}
+
+PipelineRegistry::~PipelineRegistry()
+{
+    // Everything should have been released by its owner, but don't leak if not
+    for (const auto& [pipeline, entry] : m_pipelines) {
+        vkDestroyPipeline(m_device, pipeline, nullptr);
+    }
+    for (const auto& [layout, entry] : m_layouts) {
+        vkDestroyPipelineLayout(m_device, layout, nullptr);
+    }
+}
+
+VkPipelineLayout PipelineRegistry::acquirePipelineLayout(const std::vector<VkDescriptorSetLayout>& setLayouts, const std::vector<VkPushConstantRange>& pushConstantRanges)
+{
+    KeyWriter writer;
+    writer.write(setLayouts.size());
+    for (VkDescriptorSetLayout setLayout : setLayouts) {
+        writer.write(setLayout);
+    }
+    writer.write(pushConstantRanges.size());
+    for (const VkPushConstantRange& range : pushConstantRanges) {
+        writer.write(range);
+    }
+    std::string key = writer.take();
+
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_layoutLookup.find(key);
+    if (it != m_layoutLookup.end()) {
+        ++m_layouts[it->second].refCount;
+        ++m_layoutHits;
+        return it->second;
+    }
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
+    pipelineLayoutInfo.pSetLayouts = setLayouts.data();
+    pipelineLayoutInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+    pipelineLayoutInfo.pPushConstantRanges = pushConstantRanges.data();
+
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &layout) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create pipeline layout");
+    }
+
+    m_layoutLookup[key] = layout;
+    LayoutEntry& entry = m_layouts[layout];
+    entry.key = std::move(key);
+    entry.setLayouts = setLayouts;
+    entry.refCount = 1;
+    return layout;
+}
+
+void PipelineRegistry::releasePipelineLayout(VkPipelineLayout layout)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_layouts.find(layout);
+    if (it == m_layouts.end() || --it->second.refCount > 0) {
+        return;
+    }
+
+    auto lookupIt = m_layoutLookup.find(it->second.key);
+    if (lookupIt != m_layoutLookup.end() && lookupIt->second == layout) {
+        m_layoutLookup.erase(lookupIt);
+    }
+    m_layouts.erase(it);
+    vkDestroyPipelineLayout(m_device, layout, nullptr);
+}
+
+VkPipeline PipelineRegistry::acquirePipeline(const PipelineKey& key, const std::function<VkPipeline()>& create)
+{
+    {
+        std::scoped_lock lock(m_mutex);
+
+        auto it = m_pipelineLookup.find(key.data);
+        if (it != m_pipelineLookup.end()) {
+            ++m_pipelines[it->second].refCount;
+            ++m_pipelineHits;
+            return it->second;
+        }
+    }
+
+    // Compile without holding the lock so pipelines with different keys build in parallel
+    VkPipeline pipeline = create();
+
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_pipelineLookup.find(key.data);
+    if (it != m_pipelineLookup.end()) {
+        // Another thread created the same pipeline in the meantime
+        vkDestroyPipeline(m_device, pipeline, nullptr);
+        ++m_pipelines[it->second].refCount;
+        ++m_pipelineHits;
+        return it->second;
+    }
+
+    m_pipelineLookup[key.data] = pipeline;
+    PipelineEntry& entry = m_pipelines[pipeline];
+    entry.key = key;
+    entry.refCount = 1;
+    return pipeline;
+}
+
+void PipelineRegistry::releasePipeline(VkPipeline pipeline)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_pipelines.find(pipeline);
+    if (it == m_pipelines.end() || --it->second.refCount > 0) {
+        return;
+    }
+
+    auto lookupIt = m_pipelineLookup.find(it->second.key.data);
+    if (lookupIt != m_pipelineLookup.end() && lookupIt->second == pipeline) {
+        m_pipelineLookup.erase(lookupIt);
+    }
+    m_pipelines.erase(it);
+    vkDestroyPipeline(m_device, pipeline, nullptr);
+}
+
+void PipelineRegistry::forgetDescriptorSetLayout(VkDescriptorSetLayout setLayout)
+{
+    std::scoped_lock lock(m_mutex);
+
+    // Pipelines don't need to be forgotten, their keys contain the pipeline layout
+    // handle, which can't be reused while those pipelines hold a reference to it
+    for (const auto& [layout, entry] : m_layouts) {
+        if (std::find(entry.setLayouts.begin(), entry.setLayouts.end(), setLayout) == entry.setLayouts.end()) {
+            continue;
+        }
+        auto lookupIt = m_layoutLookup.find(entry.key);
+        if (lookupIt != m_layoutLookup.end() && lookupIt->second == layout) {
+            m_layoutLookup.erase(lookupIt);
+        }
+    }
+}
+
+void PipelineRegistry::forgetShaderModule(VkShaderModule module)
+{
+    forgetObject(handleBits(module));
+}
+
+void PipelineRegistry::forgetRenderPass(VkRenderPass renderPass)
+{
+    forgetObject(handleBits(renderPass));
+}
+
+void PipelineRegistry::forgetObject(uint64_t handle)
+{
+    std::scoped_lock lock(m_mutex);
+
+    for (const auto& [pipeline, entry] : m_pipelines) {
+        if (std::find(entry.key.objects.begin(), entry.key.objects.end(), handle) == entry.key.objects.end()) {
+            continue;
+        }
+        auto lookupIt = m_pipelineLookup.find(entry.key.data);
+        if (lookupIt != m_pipelineLookup.end() && lookupIt->second == pipeline) {
+            m_pipelineLookup.erase(lookupIt);
+        }
+    }
+}
+
+PipelineRegistryStats PipelineRegistry::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    PipelineRegistryStats stats{};
+    stats.layoutCount = static_cast<uint32_t>(m_layouts.size());
+    stats.pipelineCount = static_cast<uint32_t>(m_pipelines.size());
+    stats.layoutHits = m_layoutHits;
+    stats.pipelineHits = m_pipelineHits;
+    return stats;
+}
+
+PipelineKey PipelineRegistry::makeKey(const RenderPipelineCreateInfo& createInfo, VkPipelineLayout layout)
+{
+    KeyWriter writer;
+    writer.write(PipelineKind::Render);
+    writer.write(layout);
+    writer.write(createInfo.renderPass);
+
+    writer.write(createInfo.vertex.module);
+    writer.writeString(createInfo.vertex.entryPoint);
+    writer.write(createInfo.vertex.buffers.size());
+    for (const auto& buffer : createInfo.vertex.buffers) {
+        writer.write(buffer.arrayStride);
+        writer.write(buffer.inputRate);
+        writer.write(buffer.attributes.size());
+        for (const auto& attribute : buffer.attributes) {
+            writer.write(attribute);
+        }
+    }
+
+    writer.write(createInfo.fragment.module);
+    writer.writeString(createInfo.fragment.module != VK_NULL_HANDLE ? createInfo.fragment.entryPoint : nullptr);
+    writer.write(createInfo.fragment.targets.size());
+    for (const auto& target : createInfo.fragment.targets) {
+        writer.write(target.format);
+        writer.write(target.writeMask);
+        writer.write(target.blendState);
+    }
+
+    writer.write(createInfo.primitive.topology);
+    writer.write(createInfo.primitive.polygonMode);
+    writer.write(createInfo.primitive.cullMode);
+    writer.write(createInfo.primitive.frontFace);
+
+    writer.write(static_cast<uint8_t>(createInfo.depthStencil.has_value()));
+    if (createInfo.depthStencil.has_value()) {
+        writer.write(createInfo.depthStencil->format);
+        writer.write(static_cast<uint8_t>(createInfo.depthStencil->depthWriteEnabled));
+        writer.write(createInfo.depthStencil->depthCompareOp);
+    }
+    writer.write(createInfo.sampleCount);
+
+    PipelineKey key{};
+    key.data = writer.take();
+    key.objects = { handleBits(createInfo.renderPass), handleBits(createInfo.vertex.module) };
+    if (createInfo.fragment.module != VK_NULL_HANDLE) {
+        key.objects.push_back(handleBits(createInfo.fragment.module));
+    }
+    return key;
+}
+
+PipelineKey PipelineRegistry::makeKey(const ComputePipelineCreateInfo& createInfo, VkPipelineLayout layout)
+{
+    KeyWriter writer;
+    writer.write(PipelineKind::Compute);
+    writer.write(layout);
+    writer.write(createInfo.module);
+    writer.writeString(createInfo.entryPoint);
+
+    PipelineKey key{};
+    key.data = writer.take();
+    key.objects = { handleBits(createInfo.module) };
+    return key;
+}
+
+VkShaderStageFlags PipelineRegistry::pushConstantStages(const std::vector<VkPushConstantRange>& ranges, uint32_t offset, uint32_t size)
+{
+    VkShaderStageFlags stages = 0;
+    for (const VkPushConstantRange& range : ranges) {
+        if (range.offset < offset + size && offset < range.offset + range.size) {
+            stages |= range.stageFlags;
+        }
+    }
+
+    // Push constants are updated in 4 byte units, every one of them must be in some range
+    for (uint32_t word = offset; word < offset + size; word += 4) {
+        bool covered = std::any_of(ranges.begin(), ranges.end(), [word](const VkPushConstantRange& range) {
+            return range.offset <= word && word + 4 <= range.offset + range.size;
+        });
+        if (!covered) {
+            return 0;
+        }
+    }
+    return stages;
+}
+
+} // namespace gfx::backend::vulkan::core
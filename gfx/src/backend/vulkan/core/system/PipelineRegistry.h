@@ -0,0 +1,91 @@
+#ifndef GFX_VULKAN_PIPELINE_REGISTRY_H
+#define GFX_VULKAN_PIPELINE_REGISTRY_H
+
+#include "../CoreTypes.h"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+// Canonical encoding of a pipeline create info
+struct PipelineKey {
+    std::string data;
+    std::vector<uint64_t> objects; // Shader module and render pass handles referenced by data
+};
+
+struct PipelineRegistryStats {
+    uint32_t layoutCount = 0;
+    uint32_t pipelineCount = 0;
+    uint64_t layoutHits = 0;
+    uint64_t pipelineHits = 0;
+};
+
+// Device-wide, content-addressed store of pipeline layouts and pipelines. Objects are keyed
+// by a canonical encoding of their converted create info and reference counted, so identical
+// create infos share one VkPipelineLayout / VkPipeline instead of creating duplicates.
+//
+// Keys contain object handles (set layouts, shader modules, render passes). When one of those
+// is destroyed its handle value may be reused for a different object, so the owner calls
+// forget*() and entries referencing it are no longer returned for new requests.
+class PipelineRegistry {
+public:
+    PipelineRegistry(const PipelineRegistry&) = delete;
+    PipelineRegistry& operator=(const PipelineRegistry&) = delete;
+
+    explicit PipelineRegistry(VkDevice device);
+    ~PipelineRegistry();
+
+    // Throws std::runtime_error if a new layout cannot be created
+    VkPipelineLayout acquirePipelineLayout(const std::vector<VkDescriptorSetLayout>& setLayouts, const std::vector<VkPushConstantRange>& pushConstantRanges = {});
+    void releasePipelineLayout(VkPipelineLayout layout);
+
+    // create is only called (outside the registry lock) if no pipeline with this key exists yet.
+    // The key includes the pipeline layout, which the caller keeps acquired until releasePipeline.
+    VkPipeline acquirePipeline(const PipelineKey& key, const std::function<VkPipeline()>& create);
+    void releasePipeline(VkPipeline pipeline);
+
+    void forgetDescriptorSetLayout(VkDescriptorSetLayout setLayout);
+    void forgetShaderModule(VkShaderModule module);
+    void forgetRenderPass(VkRenderPass renderPass);
+
+    PipelineRegistryStats getStats() const;
+
+    static PipelineKey makeKey(const RenderPipelineCreateInfo& createInfo, VkPipelineLayout layout);
+    static PipelineKey makeKey(const ComputePipelineCreateInfo& createInfo, VkPipelineLayout layout);
+
+    // Stage flags vkCmdPushConstants needs to update [offset, offset + size): the stages of every
+    // range overlapping it. 0 if some of the bytes are not covered by any range.
+    static VkShaderStageFlags pushConstantStages(const std::vector<VkPushConstantRange>& ranges, uint32_t offset, uint32_t size);
+
+private:
+    struct LayoutEntry {
+        std::string key;
+        std::vector<VkDescriptorSetLayout> setLayouts;
+        uint32_t refCount = 0;
+    };
+
+    struct PipelineEntry {
+        PipelineKey key;
+        uint32_t refCount = 0;
+    };
+
+    void forgetObject(uint64_t handle);
+
+    VkDevice m_device = VK_NULL_HANDLE;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<VkPipelineLayout, LayoutEntry> m_layouts;
+    std::unordered_map<std::string, VkPipelineLayout> m_layoutLookup;
+    std::unordered_map<VkPipeline, PipelineEntry> m_pipelines;
+    std::unordered_map<std::string, VkPipeline> m_pipelineLookup;
+    uint64_t m_layoutHits = 0;
+    uint64_t m_pipelineHits = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_PIPELINE_REGISTRY_H
@@ -2,27 +2,63 @@
 
 #include "Adapter.h"
 #include "Device.h"
+#include "UploadEngine.h"
 
 #include "../command/CommandEncoder.h"
 #include "../resource/Buffer.h"
 #include "../resource/Texture.h"
 #include "../sync/Fence.h"
 #include "../sync/Semaphore.h"
-#include "../util/CommandExecutor.h"
 #include "../util/Utils.h"
 
 #include "common/Logger.h"
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <stdexcept>
 
 namespace gfx::backend::vulkan::core {
 
+namespace {
+    constexpr VkDeviceSize INITIAL_STAGING_RING_SIZE = 4ull * 1024 * 1024;
+    constexpr VkDeviceSize MAX_STAGING_RING_SIZE = 256ull * 1024 * 1024;
+    constexpr VkDeviceSize STAGING_BUFFER_ALIGNMENT = 4;
+    constexpr VkDeviceSize STAGING_TEXTURE_ALIGNMENT = 16; // Largest texel block size
+} // anonymous namespace
+
 Queue::Queue(Device* device, VkQueue queue, uint32_t queueFamily)
     : m_queue(queue)
     , m_device(device)
     , m_queueFamily(queueFamily)
 {
+    if (m_device->supportsTimelineSemaphores()) {
+        SemaphoreCreateInfo serialInfo{};
+        serialInfo.type = SemaphoreType::Timeline;
+        serialInfo.initialValue = 0;
+        m_serialSemaphore = std::make_unique<Semaphore>(m_device, serialInfo);
+    }
+}
+
+Queue::~Queue()
+{
+    VkDevice vkDevice = device();
+
+    // Recorded but never submitted uploads are dropped along with the pool
+    std::vector<VkFence> fences;
+    for (const auto& batch : m_inFlightUploads) {
+        fences.push_back(batch.fence);
+    }
+    if (!fences.empty()) {
+        vkWaitForFences(vkDevice, static_cast<uint32_t>(fences.size()), fences.data(), VK_TRUE, UINT64_MAX);
+    }
+    fences.insert(fences.end(), m_freeUploadFences.begin(), m_freeUploadFences.end());
+    for (VkFence fence : fences) {
+        vkDestroyFence(vkDevice, fence, nullptr);
+    }
+    if (m_uploadCommandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(vkDevice, m_uploadCommandPool, nullptr);
+    }
 }
 
 VkQueue Queue::handle() const
@@ -47,227 +83,439 @@ uint32_t Queue::family() const
 
 VkResult Queue::submit(const SubmitInfo& submitInfo)
 {
+    return submit(&submitInfo, 1);
+}
+
+VkResult Queue::submit(const SubmitInfo* submitInfos, uint32_t submitCount)
+{
+    VkResult result = submitAll(submitInfos, submitCount);
+
+    // Resources destroyed a while ago are usually done by now
+    m_device->releaseCompletedDestroys();
+    return result;
+}
+
+VkResult Queue::submitAll(const SubmitInfo* submitInfos, uint32_t submitCount)
+{
+    flushUploads();
+
+    // Converted under the lock, so upload acquire values go out in the order they were handed
+    // out. Lock order is this queue, the upload engine, then its transfer queue, which is never
+    // a queue the engine records acquires for (see UploadEngine::prepareAcquire).
+    std::scoped_lock lock(m_submitMutex);
+
+    std::vector<NativeSubmit> submits;
+    try {
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            submits.push_back(toNativeSubmit(submitInfos[i]));
+
+            // A fence is a point the host waits on, so everything before it goes out now.
+            // vkQueueSubmit takes one fence, later submits start the next call.
+            if (submitInfos[i].signalFence) {
+                // On failure submitLocked cancels the acquires, later submits are not converted yet
+                VkResult result = submitLocked(submits, submitInfos[i].signalFence->handle());
+                if (result != VK_SUCCESS) {
+                    return result;
+                }
+                submits.clear();
+            }
+        }
+    } catch (...) {
+        cancelAcquires(submits);
+        throw;
+    }
+
+    if (submits.empty()) {
+        return VK_SUCCESS;
+    }
+    if (m_device->defersSubmits()) {
+        m_deferredSubmits.insert(m_deferredSubmits.end(), std::make_move_iterator(submits.begin()), std::make_move_iterator(submits.end()));
+        return VK_SUCCESS;
+    }
+    return submitLocked(submits, VK_NULL_HANDLE);
+}
+
+VkResult Queue::submit(const VkSubmitInfo& submitInfo, VkFence fence)
+{
+    std::scoped_lock lock(m_submitMutex);
+
+    VkResult result = flushLocked();
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    if (!m_serialSemaphore) {
+        return vkQueueSubmit(m_queue, 1, &submitInfo, fence);
+    }
+
+    // Always followed by a serial signal: nothing else may be submitted to this queue (e.g. the
+    // upload engine's transfer queue) to carry the serial of a destroy made in the meantime
+    if (m_markedSerial == m_submittedSerial) {
+        ++m_markedSerial;
+    }
+    uint64_t serial = m_markedSerial;
+    VkSemaphore serialSemaphore = m_serialSemaphore->handle();
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues = &serial;
+
+    VkSubmitInfo submitInfos[2] = { submitInfo, {} };
+    submitInfos[1].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfos[1].pNext = &timelineInfo;
+    submitInfos[1].signalSemaphoreCount = 1;
+    submitInfos[1].pSignalSemaphores = &serialSemaphore;
+
+    result = vkQueueSubmit(m_queue, 2, submitInfos, fence);
+    if (result == VK_SUCCESS) {
+        m_submittedSerial = serial;
+        m_unsignaledWork = false;
+    }
+    return result;
+}
+
+VkResult Queue::present(const VkPresentInfoKHR& presentInfo)
+{
+    // The submits signaling the wait semaphores have to be made before the present
+    std::scoped_lock lock(m_submitMutex);
+
+    VkResult result = flushLocked();
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    return vkQueuePresentKHR(m_queue, &presentInfo);
+}
+
+VkResult Queue::flush()
+{
+    std::scoped_lock lock(m_submitMutex);
+    return flushLocked();
+}
+
+uint64_t Queue::markSerial()
+{
+    if (!m_serialSemaphore) {
+        return 0;
+    }
+
+    // Recorded uploads may write to whatever is being destroyed
+    flushUploads();
+
+    std::scoped_lock lock(m_submitMutex);
+    if (m_markedSerial == m_submittedSerial) {
+        // Nothing went to this queue since the last serial, which then covers everything
+        if (!m_unsignaledWork && m_deferredSubmits.empty()) {
+            return m_submittedSerial;
+        }
+        ++m_markedSerial;
+    }
+    return m_markedSerial;
+}
+
+uint64_t Queue::getCompletedSerial() const
+{
+    return m_serialSemaphore ? m_serialSemaphore->getValue() : 0;
+}
+
+VkResult Queue::signalSerial()
+{
+    std::scoped_lock lock(m_submitMutex);
+    return signalSerialLocked();
+}
+
+VkResult Queue::submitSerial(uint64_t* outSerial)
+{
+    *outSerial = markSerial();
+    if (*outSerial == 0) {
+        return VK_SUCCESS;
+    }
+
+    std::scoped_lock lock(m_submitMutex);
+    VkResult result = flushLocked();
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    return signalSerialLocked();
+}
+
+Semaphore* Queue::getSerialSemaphore() const
+{
+    return m_serialSemaphore.get();
+}
+
+Queue::NativeSubmit Queue::toNativeSubmit(const SubmitInfo& submitInfo)
+{
+    NativeSubmit native{};
+
     // Convert command encoders to command buffers
-    std::vector<VkCommandBuffer> commandBuffers;
-    commandBuffers.reserve(submitInfo.commandEncoderCount);
+    native.commandBuffers.reserve(submitInfo.commandEncoderCount);
     for (uint32_t i = 0; i < submitInfo.commandEncoderCount; ++i) {
-        commandBuffers.push_back(submitInfo.commandEncoders[i]->handle());
+        native.commandBuffers.push_back(submitInfo.commandEncoders[i]->handle());
     }
 
     // Convert wait semaphores
-    std::vector<VkSemaphore> waitSemaphores;
-    std::vector<uint64_t> waitValues;
-    std::vector<VkPipelineStageFlags> waitStages;
-    waitSemaphores.reserve(submitInfo.waitSemaphoreCount);
-    waitStages.reserve(submitInfo.waitSemaphoreCount);
+    native.waitSemaphores.reserve(submitInfo.waitSemaphoreCount);
+    native.waitStages.reserve(submitInfo.waitSemaphoreCount);
+
+    UploadEngine* uploadEngine = m_device->getUploadEngine();
+    Semaphore* uploadSemaphore = uploadEngine ? uploadEngine->getSemaphore() : nullptr;
+    uint64_t uploadWaitValue = 0;
 
-    bool hasTimelineWait = false;
     for (uint32_t i = 0; i < submitInfo.waitSemaphoreCount; ++i) {
-        waitSemaphores.push_back(submitInfo.waitSemaphores[i]->handle());
-        waitStages.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+        native.waitSemaphores.push_back(submitInfo.waitSemaphores[i]->handle());
+
+        VkPipelineStageFlags waitStage = i < submitInfo.waitStageMasks.size() ? submitInfo.waitStageMasks[i] : 0;
+        if (submitInfo.waitSemaphores[i] == uploadSemaphore) {
+            // Uploaded data may be consumed by any stage
+            native.waitStages.push_back(waitStage != 0 ? waitStage : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+            uploadWaitValue = std::max(uploadWaitValue, submitInfo.waitValues ? submitInfo.waitValues[i] : 0);
+        } else {
+            // Without a stage from the caller, assume a swapchain image acquire
+            native.waitStages.push_back(waitStage != 0 ? waitStage : VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+        }
 
         if (submitInfo.waitSemaphores[i]->getType() == SemaphoreType::Timeline) {
-            hasTimelineWait = true;
+            native.hasTimeline = true;
             uint64_t value = submitInfo.waitValues ? submitInfo.waitValues[i] : 0;
-            waitValues.push_back(value);
+            native.waitValues.push_back(value);
         } else {
-            waitValues.push_back(0);
+            native.waitValues.push_back(0);
         }
     }
 
     // Convert signal semaphores
-    std::vector<VkSemaphore> signalSemaphores;
-    std::vector<uint64_t> signalValues;
-    signalSemaphores.reserve(submitInfo.signalSemaphoreCount);
+    native.signalSemaphores.reserve(submitInfo.signalSemaphoreCount);
 
-    bool hasTimelineSignal = false;
     for (uint32_t i = 0; i < submitInfo.signalSemaphoreCount; ++i) {
-        signalSemaphores.push_back(submitInfo.signalSemaphores[i]->handle());
+        native.signalSemaphores.push_back(submitInfo.signalSemaphores[i]->handle());
 
         if (submitInfo.signalSemaphores[i]->getType() == SemaphoreType::Timeline) {
-            hasTimelineSignal = true;
+            native.hasTimeline = true;
             uint64_t value = submitInfo.signalValues ? submitInfo.signalValues[i] : 0;
-            signalValues.push_back(value);
+            native.signalValues.push_back(value);
         } else {
-            signalValues.push_back(0);
+            native.signalValues.push_back(0);
         }
     }
 
-    // Timeline semaphore info (if needed)
-    VkTimelineSemaphoreSubmitInfo timelineInfo{};
-    if (hasTimelineWait || hasTimelineSignal) {
-        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
-        timelineInfo.waitSemaphoreValueCount = static_cast<uint32_t>(waitValues.size());
-        timelineInfo.pWaitSemaphoreValues = waitValues.empty() ? nullptr : waitValues.data();
-        timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
-        timelineInfo.pSignalSemaphoreValues = signalValues.empty() ? nullptr : signalValues.data();
-    }
-
-    // Build submit info
-    VkSubmitInfo vkSubmitInfo{};
-    vkSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    if (hasTimelineWait || hasTimelineSignal) {
-        vkSubmitInfo.pNext = &timelineInfo;
-    }
-    vkSubmitInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size());
-    vkSubmitInfo.pCommandBuffers = commandBuffers.empty() ? nullptr : commandBuffers.data();
-    vkSubmitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
-    vkSubmitInfo.pWaitSemaphores = waitSemaphores.empty() ? nullptr : waitSemaphores.data();
-    vkSubmitInfo.pWaitDstStageMask = waitStages.empty() ? nullptr : waitStages.data();
-    vkSubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
-    vkSubmitInfo.pSignalSemaphores = signalSemaphores.empty() ? nullptr : signalSemaphores.data();
-
-    // Get fence if provided
-    VkFence fence = VK_NULL_HANDLE;
-    if (submitInfo.signalFence) {
-        fence = submitInfo.signalFence->handle();
+    // Take ownership of resources the upload engine released from the transfer family.
+    // The acquire runs after the semaphore wait, ahead of the submitted command buffers.
+    VkCommandBuffer acquireCommandBuffer = VK_NULL_HANDLE;
+    if (uploadWaitValue > 0) {
+        acquireCommandBuffer = uploadEngine->prepareAcquire(this, uploadWaitValue, &native.acquireValue);
+    }
+    if (acquireCommandBuffer != VK_NULL_HANDLE) {
+        native.commandBuffers.insert(native.commandBuffers.begin(), acquireCommandBuffer);
+        native.signalSemaphores.push_back(uploadEngine->getAcquireSemaphore()->handle());
+        native.signalValues.push_back(native.acquireValue);
+        native.hasTimeline = true;
+    } else {
+        native.acquireValue = 0;
     }
 
-    return vkQueueSubmit(m_queue, 1, &vkSubmitInfo, fence);
+    return native;
 }
 
-void Queue::waitIdle()
+VkResult Queue::submitLocked(std::vector<NativeSubmit>& submits, VkFence fence)
 {
-    vkQueueWaitIdle(m_queue);
+    if (!m_deferredSubmits.empty()) {
+        submits.insert(submits.begin(), std::make_move_iterator(m_deferredSubmits.begin()), std::make_move_iterator(m_deferredSubmits.end()));
+        m_deferredSubmits.clear();
+    }
+    if (submits.empty()) {
+        return VK_SUCCESS;
+    }
+
+    // A signal covers everything submitted before it, so the last submit carries the serial
+    bool signalsSerial = m_markedSerial > m_submittedSerial;
+    if (signalsSerial) {
+        NativeSubmit& last = submits.back();
+        last.signalSemaphores.push_back(m_serialSemaphore->handle());
+        last.signalValues.push_back(m_markedSerial);
+        last.hasTimeline = true;
+    }
+
+    VkResult result = m_device->getQueueSubmit2() ? submit2(submits, fence) : submit1(submits, fence);
+    if (result == VK_SUCCESS) {
+        if (signalsSerial) {
+            m_submittedSerial = m_markedSerial;
+        }
+        m_unsignaledWork = !signalsSerial;
+    }
+    if (result != VK_SUCCESS) {
+        cancelAcquires(submits);
+    }
+    return result;
 }
 
-void Queue::writeBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size)
+void Queue::cancelAcquires(const std::vector<NativeSubmit>& submits)
 {
-    void* mapped = buffer->map(offset, size);
-    if (mapped) {
-        // Buffer is host-visible, can map directly
-        memcpy(mapped, data, size);
-        buffer->unmap();
-    } else {
-        // Buffer is not host-visible (device-local), use staging buffer
-        VkDevice vkDevice = device();
-
-        // Create staging buffer
-        VkBufferCreateInfo stagingInfo{};
-        stagingInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        stagingInfo.size = size;
-        stagingInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        stagingInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        VkBuffer stagingBuffer;
-        if (vkCreateBuffer(vkDevice, &stagingInfo, nullptr, &stagingBuffer) != VK_SUCCESS) {
-            throw std::runtime_error("Failed to create staging buffer for writeBuffer");
+    UploadEngine* uploadEngine = m_device->getUploadEngine();
+    if (!uploadEngine) {
+        return;
+    }
+    // Newest first, the upload engine takes the values back in the order it handed them out
+    for (auto it = submits.rbegin(); it != submits.rend(); ++it) {
+        if (it->acquireValue != 0) {
+            uploadEngine->cancelAcquire(it->acquireValue);
         }
+    }
+}
 
-        // Allocate staging buffer memory (host-visible)
-        VkMemoryRequirements memReq;
-        vkGetBufferMemoryRequirements(vkDevice, stagingBuffer, &memReq);
-
-        const VkPhysicalDeviceMemoryProperties& memProps = m_device->getAdapter()->getMemoryProperties();
+VkResult Queue::flushLocked()
+{
+    std::vector<NativeSubmit> none;
+    return submitLocked(none, VK_NULL_HANDLE);
+}
 
-        VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        uint32_t memTypeIndex = findMemoryType(memProps, memReq.memoryTypeBits, flags);
+VkResult Queue::signalSerialLocked()
+{
+    if (m_markedSerial == m_submittedSerial || !m_deferredSubmits.empty()) {
+        return VK_SUCCESS;
+    }
+    std::vector<NativeSubmit> signalOnly(1);
+    return submitLocked(signalOnly, VK_NULL_HANDLE);
+}
 
-        if (memTypeIndex == UINT32_MAX) {
-            vkDestroyBuffer(vkDevice, stagingBuffer, nullptr);
-            throw std::runtime_error("Failed to find suitable memory type for staging buffer");
+VkResult Queue::submit2(const std::vector<NativeSubmit>& submits, VkFence fence)
+{
+    // Every semaphore carries its own stage mask and value (ignored for binary semaphores).
+    // Sized up front, the submit infos point into these arrays.
+    size_t waitCount = 0;
+    size_t signalCount = 0;
+    size_t commandBufferCount = 0;
+    for (const NativeSubmit& native : submits) {
+        waitCount += native.waitSemaphores.size();
+        signalCount += native.signalSemaphores.size();
+        commandBufferCount += native.commandBuffers.size();
+    }
+    std::vector<VkSemaphoreSubmitInfoKHR> waitInfos;
+    waitInfos.reserve(waitCount);
+    std::vector<VkSemaphoreSubmitInfoKHR> signalInfos;
+    signalInfos.reserve(signalCount);
+    std::vector<VkCommandBufferSubmitInfoKHR> commandBufferInfos;
+    commandBufferInfos.reserve(commandBufferCount);
+    std::vector<VkSubmitInfo2KHR> vkSubmitInfos(submits.size());
+
+    for (size_t s = 0; s < submits.size(); ++s) {
+        const NativeSubmit& native = submits[s];
+        VkSubmitInfo2KHR& vkSubmitInfo = vkSubmitInfos[s];
+        vkSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+
+        vkSubmitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(native.waitSemaphores.size());
+        vkSubmitInfo.pWaitSemaphoreInfos = waitInfos.data() + waitInfos.size();
+        for (size_t i = 0; i < native.waitSemaphores.size(); ++i) {
+            VkSemaphoreSubmitInfoKHR& waitInfo = waitInfos.emplace_back();
+            waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+            waitInfo.semaphore = native.waitSemaphores[i];
+            waitInfo.value = native.waitValues[i];
+            waitInfo.stageMask = native.waitStages[i];
         }
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memReq.size;
-        allocInfo.memoryTypeIndex = memTypeIndex;
-
-        VkDeviceMemory stagingMemory;
-        if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &stagingMemory) != VK_SUCCESS) {
-            vkDestroyBuffer(vkDevice, stagingBuffer, nullptr);
-            throw std::runtime_error("Failed to allocate staging buffer memory");
+        vkSubmitInfo.commandBufferInfoCount = static_cast<uint32_t>(native.commandBuffers.size());
+        vkSubmitInfo.pCommandBufferInfos = commandBufferInfos.data() + commandBufferInfos.size();
+        for (VkCommandBuffer commandBuffer : native.commandBuffers) {
+            VkCommandBufferSubmitInfoKHR& commandBufferInfo = commandBufferInfos.emplace_back();
+            commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
+            commandBufferInfo.commandBuffer = commandBuffer;
         }
 
-        vkBindBufferMemory(vkDevice, stagingBuffer, stagingMemory, 0);
-
-        // Map and copy data to staging buffer
-        void* stagingMapped;
-        vkMapMemory(vkDevice, stagingMemory, 0, size, 0, &stagingMapped);
-        memcpy(stagingMapped, data, size);
-        vkUnmapMemory(vkDevice, stagingMemory);
-
-        // Execute copy command
-        CommandExecutor executor(this);
-        executor.execute([&](VkCommandBuffer cmd) {
-            VkBufferCopy copyRegion{};
-            copyRegion.srcOffset = 0;
-            copyRegion.dstOffset = offset;
-            copyRegion.size = size;
-            vkCmdCopyBuffer(cmd, stagingBuffer, buffer->handle(), 1, &copyRegion);
-        });
-
-        // Cleanup
-        vkFreeMemory(vkDevice, stagingMemory, nullptr);
-        vkDestroyBuffer(vkDevice, stagingBuffer, nullptr);
+        vkSubmitInfo.signalSemaphoreInfoCount = static_cast<uint32_t>(native.signalSemaphores.size());
+        vkSubmitInfo.pSignalSemaphoreInfos = signalInfos.data() + signalInfos.size();
+        for (size_t i = 0; i < native.signalSemaphores.size(); ++i) {
+            VkSemaphoreSubmitInfoKHR& signalInfo = signalInfos.emplace_back();
+            signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+            signalInfo.semaphore = native.signalSemaphores[i];
+            signalInfo.value = native.signalValues[i];
+            signalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+        }
     }
+
+    return m_device->getQueueSubmit2()(m_queue, static_cast<uint32_t>(vkSubmitInfos.size()), vkSubmitInfos.data(), fence);
 }
 
-void Queue::writeTexture(Texture* texture, const VkOffset3D& origin, uint32_t mipLevel,
-    const void* data, uint64_t dataSize,
-    const VkExtent3D& extent, VkImageLayout finalLayout)
+VkResult Queue::submit1(const std::vector<NativeSubmit>& submits, VkFence fence)
 {
-    VkDevice device = texture->device();
-
-    // Create staging buffer
-    VkBufferCreateInfo bufferInfo{};
-    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    bufferInfo.size = dataSize;
-    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    std::vector<VkTimelineSemaphoreSubmitInfo> timelineInfos(submits.size());
+    std::vector<VkSubmitInfo> vkSubmitInfos(submits.size());
+
+    for (size_t s = 0; s < submits.size(); ++s) {
+        const NativeSubmit& native = submits[s];
+
+        // Timeline semaphore info (if needed)
+        VkTimelineSemaphoreSubmitInfo& timelineInfo = timelineInfos[s];
+        if (native.hasTimeline) {
+            timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineInfo.waitSemaphoreValueCount = static_cast<uint32_t>(native.waitValues.size());
+            timelineInfo.pWaitSemaphoreValues = native.waitValues.empty() ? nullptr : native.waitValues.data();
+            timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(native.signalValues.size());
+            timelineInfo.pSignalSemaphoreValues = native.signalValues.empty() ? nullptr : native.signalValues.data();
+        }
 
-    VkBuffer stagingBuffer = VK_NULL_HANDLE;
-    VkResult result = vkCreateBuffer(device, &bufferInfo, nullptr, &stagingBuffer);
-    if (result != VK_SUCCESS) {
-        gfx::common::Logger::instance().logError("Failed to create staging buffer for texture upload");
-        return;
+        // Build submit info
+        VkSubmitInfo& vkSubmitInfo = vkSubmitInfos[s];
+        vkSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        if (native.hasTimeline) {
+            vkSubmitInfo.pNext = &timelineInfo;
+        }
+        vkSubmitInfo.commandBufferCount = static_cast<uint32_t>(native.commandBuffers.size());
+        vkSubmitInfo.pCommandBuffers = native.commandBuffers.empty() ? nullptr : native.commandBuffers.data();
+        vkSubmitInfo.waitSemaphoreCount = static_cast<uint32_t>(native.waitSemaphores.size());
+        vkSubmitInfo.pWaitSemaphores = native.waitSemaphores.empty() ? nullptr : native.waitSemaphores.data();
+        vkSubmitInfo.pWaitDstStageMask = native.waitStages.empty() ? nullptr : native.waitStages.data();
+        vkSubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(native.signalSemaphores.size());
+        vkSubmitInfo.pSignalSemaphores = native.signalSemaphores.empty() ? nullptr : native.signalSemaphores.data();
     }
 
-    // Get memory requirements and allocate
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(device, stagingBuffer, &memRequirements);
-
-    const VkPhysicalDeviceMemoryProperties& memProperties = m_device->getAdapter()->getMemoryProperties();
-
-    VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    uint32_t memoryTypeIndex = findMemoryType(memProperties, memRequirements.memoryTypeBits, properties);
+    return vkQueueSubmit(m_queue, static_cast<uint32_t>(vkSubmitInfos.size()), vkSubmitInfos.data(), fence);
+}
 
-    if (memoryTypeIndex == UINT32_MAX) {
-        gfx::common::Logger::instance().logError("Failed to find suitable memory type for staging buffer");
-        vkDestroyBuffer(device, stagingBuffer, nullptr);
-        return;
-    }
+void Queue::waitIdle()
+{
+    std::scoped_lock lock(m_uploadMutex);
+    submitUploadBatch();
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = memoryTypeIndex;
+    std::scoped_lock submitLock(m_submitMutex);
+    flushLocked();
+    signalSerialLocked();
+    vkQueueWaitIdle(m_queue);
+    reclaimUploadBatches(false);
+}
 
-    VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
-    result = vkAllocateMemory(device, &allocInfo, nullptr, &stagingMemory);
-    if (result != VK_SUCCESS) {
-        gfx::common::Logger::instance().logError("Failed to allocate staging buffer memory");
-        vkDestroyBuffer(device, stagingBuffer, nullptr);
+void Queue::writeBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size)
+{
+    void* mapped = buffer->map(offset, size);
+    if (mapped) {
+        // Buffer is host-visible and persistently mapped, write straight into it
+        memcpy(mapped, data, size);
+        buffer->flushMappedRange(offset, size);
         return;
     }
 
-    vkBindBufferMemory(device, stagingBuffer, stagingMemory, 0);
+    // Buffer is not host-visible (device-local), go through the staging ring
+    recordUpload(data, size, STAGING_BUFFER_ALIGNMENT, [&](VkCommandBuffer cmd, VkBuffer stagingBuffer, VkDeviceSize stagingOffset) {
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = stagingOffset;
+        copyRegion.dstOffset = offset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(cmd, stagingBuffer, buffer->handle(), 1, &copyRegion);
+    });
+}
 
-    // Copy data to staging buffer
-    void* mappedData = nullptr;
-    vkMapMemory(device, stagingMemory, 0, dataSize, 0, &mappedData);
-    memcpy(mappedData, data, dataSize);
-    vkUnmapMemory(device, stagingMemory);
+void Queue::writeTexture(Texture* texture, const VkOffset3D& origin, uint32_t mipLevel,
+    const void* data, uint64_t dataSize,
+    const VkExtent3D& extent, VkImageLayout finalLayout)
+{
+    // Buffer-to-image copies need the source offset aligned to the texel block size
+    VkDeviceSize alignment = std::max<VkDeviceSize>(STAGING_TEXTURE_ALIGNMENT, m_device->getProperties().limits.optimalBufferCopyOffsetAlignment);
 
-    // Execute copy command
-    CommandExecutor executor(this);
-    executor.execute([&](VkCommandBuffer cmd) {
+    recordUpload(data, dataSize, alignment, [&](VkCommandBuffer cmd, VkBuffer stagingBuffer, VkDeviceSize stagingOffset) {
         // Transition image to transfer dst optimal
         texture->transitionLayout(cmd, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevel, 1, 0, 1);
 
         // Copy buffer to image
         VkBufferImageCopy region{};
-        region.bufferOffset = 0;
+        region.bufferOffset = stagingOffset;
         region.bufferRowLength = 0; // Tightly packed
         region.bufferImageHeight = 0;
         region.imageSubresource.aspectMask = getImageAspectMask(texture->getFormat());
@@ -283,10 +531,182 @@ void Queue::writeTexture(Texture* texture, const VkOffset3D& origin, uint32_t mi
         // Transition image to final layout
         texture->transitionLayout(cmd, finalLayout, mipLevel, 1, 0, 1);
     });
+}
+
+void Queue::flushUploads()
+{
+    std::scoped_lock lock(m_uploadMutex);
+    submitUploadBatch();
+}
+
+void Queue::recordUpload(const void* data, uint64_t size, VkDeviceSize alignment, const UploadRecordFunc& recordFunc)
+{
+    std::scoped_lock lock(m_uploadMutex);
+
+    reclaimUploadBatches(false);
+    VkDeviceSize stagingOffset = allocateStaging(size, alignment);
+    memcpy(m_stagingRing->mappedData(stagingOffset), data, size);
+
+    VkCommandBuffer cmd = beginUploadBatch();
+    recordFunc(cmd, m_stagingRing->handle(), stagingOffset);
+}
+
+VkDeviceSize Queue::allocateStaging(uint64_t size, VkDeviceSize alignment)
+{
+    VkDeviceSize offset = 0;
+    if (m_stagingRing && m_stagingRing->allocate(size, alignment, &offset)) {
+        return offset;
+    }
+
+    // Out of room: get the recorded copies going so their space can be reclaimed
+    submitUploadBatch();
+    while (m_stagingRing && size <= m_stagingRing->capacity()) {
+        reclaimUploadBatches(false);
+        if (m_stagingRing->allocate(size, alignment, &offset)) {
+            return offset;
+        }
+        // Past the size limit, wait for in-flight uploads instead of growing further
+        if (m_stagingRing->capacity() < MAX_STAGING_RING_SIZE || m_inFlightUploads.empty()) {
+            break;
+        }
+        reclaimUploadBatches(true);
+    }
+
+    // Grow. The old ring stays alive through the batches that still reference it.
+    VkDeviceSize capacity = m_stagingRing ? m_stagingRing->capacity() * 2 : INITIAL_STAGING_RING_SIZE;
+    while (capacity < size) {
+        capacity *= 2;
+    }
+    m_stagingRing = std::make_shared<StagingRing>(m_device, capacity);
+    if (!m_stagingRing->allocate(size, alignment, &offset)) {
+        throw std::runtime_error("Failed to allocate from staging ring");
+    }
+    return offset;
+}
+
+VkCommandBuffer Queue::beginUploadBatch()
+{
+    if (m_pendingUpload.commandBuffer != VK_NULL_HANDLE) {
+        return m_pendingUpload.commandBuffer;
+    }
+
+    VkDevice vkDevice = device();
+    if (m_uploadCommandPool == VK_NULL_HANDLE) {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = m_queueFamily;
+        if (vkCreateCommandPool(vkDevice, &poolInfo, nullptr, &m_uploadCommandPool) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create upload command pool");
+        }
+    }
+
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    if (!m_freeUploadCommandBuffers.empty()) {
+        cmd = m_freeUploadCommandBuffers.back();
+        m_freeUploadCommandBuffers.pop_back();
+    } else {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_uploadCommandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(vkDevice, &allocInfo, &cmd) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate upload command buffer");
+        }
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &beginInfo);
+
+    // Copies must not overwrite data that previously submitted work is still using
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    m_pendingUpload.commandBuffer = cmd;
+    return cmd;
+}
+
+void Queue::submitUploadBatch()
+{
+    if (m_pendingUpload.commandBuffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    VkDevice vkDevice = device();
+    VkCommandBuffer cmd = m_pendingUpload.commandBuffer;
+
+    // Make the uploaded data visible to everything submitted afterwards
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    vkEndCommandBuffer(cmd);
 
-    // Cleanup
-    vkDestroyBuffer(device, stagingBuffer, nullptr);
-    vkFreeMemory(device, stagingMemory, nullptr);
+    VkFence fence = VK_NULL_HANDLE;
+    if (!m_freeUploadFences.empty()) {
+        fence = m_freeUploadFences.back();
+        m_freeUploadFences.pop_back();
+    } else {
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(vkDevice, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create upload fence");
+        }
+    }
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &cmd;
+    // Held back submits were made before these uploads were recorded, so they go first
+    VkResult result = submit(submitInfo, fence);
+    if (result != VK_SUCCESS) {
+        // The fence will never signal, so recycle everything right away
+        gfx::common::Logger::instance().logError("Failed to submit staged uploads: {}", vkResultToString(result));
+        m_stagingRing->release(m_stagingRing->takeRegion());
+        vkResetCommandBuffer(cmd, 0);
+        m_freeUploadCommandBuffers.push_back(cmd);
+        m_freeUploadFences.push_back(fence);
+        m_pendingUpload = UploadBatch{};
+        return;
+    }
+
+    m_pendingUpload.fence = fence;
+    m_pendingUpload.ring = m_stagingRing;
+    m_pendingUpload.region = m_stagingRing->takeRegion();
+    m_inFlightUploads.push_back(std::move(m_pendingUpload));
+    m_pendingUpload = UploadBatch{};
+}
+
+void Queue::reclaimUploadBatches(bool waitForOldest)
+{
+    VkDevice vkDevice = device();
+
+    if (waitForOldest && !m_inFlightUploads.empty()) {
+        vkWaitForFences(vkDevice, 1, &m_inFlightUploads.front().fence, VK_TRUE, UINT64_MAX);
+    }
+
+    // Batches complete in submission order, stop at the first one still running
+    while (!m_inFlightUploads.empty()) {
+        UploadBatch& batch = m_inFlightUploads.front();
+        if (vkGetFenceStatus(vkDevice, batch.fence) != VK_SUCCESS) {
+            break;
+        }
+        batch.ring->release(batch.region);
+
+        vkResetFences(vkDevice, 1, &batch.fence);
+        vkResetCommandBuffer(batch.commandBuffer, 0);
+        m_freeUploadFences.push_back(batch.fence);
+        m_freeUploadCommandBuffers.push_back(batch.commandBuffer);
+        m_inFlightUploads.pop_front();
+    }
 }
 
 } // namespace gfx::backend::vulkan::core
\ No newline at end of file
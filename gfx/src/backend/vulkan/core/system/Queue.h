@@ -2,11 +2,19 @@
 #define GFX_VULKAN_QUEUE_H
 
 #include "../CoreTypes.h"
+#include "../memory/StagingRing.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace gfx::backend::vulkan::core {
 
 class Device;
 class Buffer;
+class Semaphore;
 class Texture;
 
 class Queue {
@@ -15,26 +23,116 @@ public:
     Queue& operator=(const Queue&) = delete;
 
     Queue(Device* device, VkQueue queue, uint32_t queueFamily);
-    ~Queue() = default;
+    ~Queue();
 
     VkQueue handle() const;
     VkDevice device() const;
     VkPhysicalDevice physicalDevice() const;
     uint32_t family() const;
 
+    // Submits recorded uploads first, so they execute before the given command buffers.
+    // When the device defers submits, ones without a fence are held back and merged into
+    // the next vkQueueSubmit made on this queue. Their command encoders must stay alive
+    // until then, only the command buffer handles are kept.
     VkResult submit(const SubmitInfo& submitInfo);
+    // Same order and synchronization as calling submit() for each, in one vkQueueSubmit.
+    // Afterwards releases destroyed resources the GPU is done with.
+    VkResult submit(const SubmitInfo* submitInfos, uint32_t submitCount);
+    // Internal one-shot work, submitted right away after any held back submits. Always
+    // signals a new serial, so destroys are not held up by queues only used internally.
+    VkResult submit(const VkSubmitInfo& submitInfo, VkFence fence);
+    VkResult present(const VkPresentInfoKHR& presentInfo);
+    // Submits the held back submits, if any
+    VkResult flush();
     void waitIdle();
 
-    // Write data directly to a buffer by mapping it
+    // Serials order destruction after GPU work (see DeletionQueue). markSerial() returns the value
+    // the serial semaphore reaches once everything submitted or held back so far has completed;
+    // its signal rides along with the next vkQueueSubmit made on this queue. A queue that got no
+    // work since its last serial returns that one instead. All return 0 when the device has no
+    // timeline semaphores.
+    uint64_t markSerial();
+    uint64_t getCompletedSerial() const;
+    // Submits the signal of the marked serial on its own if no work is pending to carry it.
+    // Does nothing while submits are held back, their flush carries it instead.
+    VkResult signalSerial();
+    // Marks a serial and submits its signal right away, flushing held back submits with it, so
+    // other queues can wait on everything this queue was given so far. *outSerial is 0 when
+    // there is nothing to wait on or the device has no timeline semaphores.
+    VkResult submitSerial(uint64_t* outSerial);
+    // Reaches the serials above, nullptr when the device has no timeline semaphores
+    Semaphore* getSerialSemaphore() const;
+
+    // Host-visible buffers are written directly; device-local ones go through the staging ring
     void writeBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size);
 
-    // Write data directly to a texture using staging buffer
+    // Copied into the staging ring and uploaded ahead of the next submit
     void writeTexture(Texture* texture, const VkOffset3D& origin, uint32_t mipLevel, const void* data, uint64_t dataSize, const VkExtent3D& extent, VkImageLayout finalLayout);
 
+    // Submits recorded uploads without waiting for them
+    void flushUploads();
+
 private:
+    // Copies recorded into one command buffer, submitted as a single batch
+    struct UploadBatch {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        std::shared_ptr<StagingRing> ring; // Keeps a replaced ring alive until the GPU is done with it
+        StagingRegion region{};
+    };
+
+    // Native handles of one submit, one entry per semaphore in the value and stage arrays
+    struct NativeSubmit {
+        std::vector<VkCommandBuffer> commandBuffers;
+        std::vector<VkSemaphore> waitSemaphores;
+        std::vector<uint64_t> waitValues;
+        std::vector<VkPipelineStageFlags> waitStages;
+        std::vector<VkSemaphore> signalSemaphores;
+        std::vector<uint64_t> signalValues;
+        bool hasTimeline = false;
+        uint64_t acquireValue = 0; // Upload engine acquire carried by this submit, 0 if none
+    };
+
+    using UploadRecordFunc = std::function<void(VkCommandBuffer, VkBuffer, VkDeviceSize)>;
+
+    VkResult submitAll(const SubmitInfo* submitInfos, uint32_t submitCount);
+    // Requires m_submitMutex, the upload acquire it may record takes the next acquire value
+    NativeSubmit toNativeSubmit(const SubmitInfo& submitInfo);
+    void cancelAcquires(const std::vector<NativeSubmit>& submits);
+    // Submits the held back submits followed by the given ones. Requires m_submitMutex.
+    VkResult submitLocked(std::vector<NativeSubmit>& submits, VkFence fence);
+    VkResult flushLocked();
+    VkResult signalSerialLocked();
+    // vkQueueSubmit2, requires synchronization2
+    VkResult submit2(const std::vector<NativeSubmit>& submits, VkFence fence);
+    // vkQueueSubmit, timeline values are chained when any semaphore is a timeline semaphore
+    VkResult submit1(const std::vector<NativeSubmit>& submits, VkFence fence);
+
+    void recordUpload(const void* data, uint64_t size, VkDeviceSize alignment, const UploadRecordFunc& recordFunc);
+    VkDeviceSize allocateStaging(uint64_t size, VkDeviceSize alignment);
+    VkCommandBuffer beginUploadBatch();
+    void submitUploadBatch();
+    void reclaimUploadBatches(bool waitForOldest);
+
     VkQueue m_queue = VK_NULL_HANDLE;
     Device* m_device = nullptr;
     uint32_t m_queueFamily = 0;
+
+    // Guards every use of m_queue, which Vulkan requires to be externally synchronized
+    std::mutex m_submitMutex;
+    std::vector<NativeSubmit> m_deferredSubmits;
+    std::unique_ptr<Semaphore> m_serialSemaphore;
+    uint64_t m_markedSerial = 0;
+    uint64_t m_submittedSerial = 0;
+    bool m_unsignaledWork = false; // Submitted after the last serial signal
+
+    std::mutex m_uploadMutex;
+    std::shared_ptr<StagingRing> m_stagingRing;
+    VkCommandPool m_uploadCommandPool = VK_NULL_HANDLE;
+    UploadBatch m_pendingUpload{};
+    std::deque<UploadBatch> m_inFlightUploads;
+    std::vector<VkCommandBuffer> m_freeUploadCommandBuffers;
+    std::vector<VkFence> m_freeUploadFences;
 };
 
 } // namespace gfx::backend::vulkan::core
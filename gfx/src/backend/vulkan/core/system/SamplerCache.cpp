@@ -0,0 +1,135 @@
+#include "SamplerCache.h"
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    template <typename T>
+    void appendKey(std::string& key, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // Field by field so padding never ends up in the key
+    std::string makeKey(const SamplerCreateInfo& createInfo)
+    {
+        std::string key;
+        appendKey(key, createInfo.addressModeU);
+        appendKey(key, createInfo.addressModeV);
+        appendKey(key, createInfo.addressModeW);
+        appendKey(key, createInfo.magFilter);
+        appendKey(key, createInfo.minFilter);
+        appendKey(key, createInfo.mipmapMode);
+        appendKey(key, createInfo.lodMinClamp);
+        appendKey(key, createInfo.lodMaxClamp);
+        appendKey(key, createInfo.maxAnisotropy);
+        appendKey(key, createInfo.compareOp);
+        return key;
+    }
+
+    VkSamplerCreateInfo toVkSamplerCreateInfo(const SamplerCreateInfo& createInfo)
+    {
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+
+        // Address modes
+        samplerInfo.addressModeU = createInfo.addressModeU;
+        samplerInfo.addressModeV = createInfo.addressModeV;
+        samplerInfo.addressModeW = createInfo.addressModeW;
+
+        // Filter modes
+        samplerInfo.magFilter = createInfo.magFilter;
+        samplerInfo.minFilter = createInfo.minFilter;
+        samplerInfo.mipmapMode = createInfo.mipmapMode;
+
+        // LOD
+        samplerInfo.minLod = createInfo.lodMinClamp;
+        samplerInfo.maxLod = createInfo.lodMaxClamp;
+
+        // Anisotropy
+        if (createInfo.maxAnisotropy > 1) {
+            samplerInfo.anisotropyEnable = VK_TRUE;
+            samplerInfo.maxAnisotropy = static_cast<float>(createInfo.maxAnisotropy);
+        } else {
+            samplerInfo.anisotropyEnable = VK_FALSE;
+            samplerInfo.maxAnisotropy = 1.0f;
+        }
+
+        // Compare operation for depth textures
+        if (createInfo.compareOp != VK_COMPARE_OP_MAX_ENUM) {
+            samplerInfo.compareEnable = VK_TRUE;
+            samplerInfo.compareOp = createInfo.compareOp;
+        } else {
+            samplerInfo.compareEnable = VK_FALSE;
+        }
+        return samplerInfo;
+    }
+} // anonymous namespace
+
+SamplerCache::SamplerCache(VkDevice device)
+    : m_device(device)
+{
+}
+
+SamplerCache::~SamplerCache()
+{
+    // Everything should have been released by its owner, but don't leak if not
+    for (const auto& [sampler, entry] : m_samplers) {
+        vkDestroySampler(m_device, sampler, nullptr);
+    }
+}
+
+VkSampler SamplerCache::acquire(const SamplerCreateInfo& createInfo)
+{
+    std::string key = makeKey(createInfo);
+
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_lookup.find(key);
+    if (it != m_lookup.end()) {
+        ++m_samplers[it->second].refCount;
+        ++m_hitCount;
+        return it->second;
+    }
+
+    VkSamplerCreateInfo samplerInfo = toVkSamplerCreateInfo(createInfo);
+    VkSampler sampler = VK_NULL_HANDLE;
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &sampler) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create sampler");
+    }
+
+    m_lookup[key] = sampler;
+    Entry& entry = m_samplers[sampler];
+    entry.key = std::move(key);
+    entry.refCount = 1;
+    return sampler;
+}
+
+void SamplerCache::release(VkSampler sampler)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_samplers.find(sampler);
+    if (it == m_samplers.end() || --it->second.refCount > 0) {
+        return;
+    }
+
+    m_lookup.erase(it->second.key);
+    m_samplers.erase(it);
+    vkDestroySampler(m_device, sampler, nullptr);
+}
+
+SamplerCacheStats SamplerCache::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    SamplerCacheStats stats{};
+    stats.samplerCount = static_cast<uint32_t>(m_samplers.size());
+    stats.hitCount = m_hitCount;
+    return stats;
+}
+
+} // namespace gfx::backend::vulkan::core
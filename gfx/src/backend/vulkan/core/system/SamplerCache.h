@@ -0,0 +1,50 @@
+#ifndef GFX_VULKAN_SAMPLER_CACHE_H
+#define GFX_VULKAN_SAMPLER_CACHE_H
+
+#include "../CoreTypes.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace gfx::backend::vulkan::core {
+
+struct SamplerCacheStats {
+    uint32_t samplerCount = 0;
+    uint64_t hitCount = 0;
+};
+
+// Device-wide store of VkSamplers keyed by their create info and reference counted. Assets
+// usually need only a handful of distinct sampler states, so sharing them keeps the device
+// far below maxSamplerAllocationCount no matter how many GfxSamplers are created.
+class SamplerCache {
+public:
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+
+    explicit SamplerCache(VkDevice device);
+    ~SamplerCache();
+
+    // Throws std::runtime_error if a new sampler cannot be created
+    VkSampler acquire(const SamplerCreateInfo& createInfo);
+    void release(VkSampler sampler);
+
+    SamplerCacheStats getStats() const;
+
+private:
+    struct Entry {
+        std::string key;
+        uint32_t refCount = 0;
+    };
+
+    VkDevice m_device = VK_NULL_HANDLE;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<VkSampler, Entry> m_samplers;
+    std::unordered_map<std::string, VkSampler> m_lookup;
+    uint64_t m_hitCount = 0;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_SAMPLER_CACHE_H
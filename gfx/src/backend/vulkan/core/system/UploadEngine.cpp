@@ -0,0 +1,456 @@
+#include "UploadEngine.h"
+
+#include "Device.h"
+#include "Queue.h"
+
+#include "../resource/Buffer.h"
+#include "../resource/Texture.h"
+#include "../sync/Semaphore.h"
+#include "../util/Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace gfx::backend::vulkan::core {
+
+namespace {
+    constexpr VkDeviceSize INITIAL_STAGING_RING_SIZE = 16ull * 1024 * 1024;
+    constexpr VkDeviceSize MAX_STAGING_RING_SIZE = 256ull * 1024 * 1024;
+    constexpr VkDeviceSize STAGING_BUFFER_ALIGNMENT = 4;
+    constexpr VkDeviceSize STAGING_TEXTURE_ALIGNMENT = 16; // Largest texel block size
+
+    VkCommandPool createCommandPool(VkDevice device, uint32_t queueFamily)
+    {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = queueFamily;
+
+        VkCommandPool pool = VK_NULL_HANDLE;
+        if (vkCreateCommandPool(device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create upload command pool");
+        }
+        return pool;
+    }
+} // anonymous namespace
+
+UploadEngine::UploadEngine(Device* device, Queue* transferQueue, Queue* graphicsQueue)
+    : m_device(device)
+    , m_transferQueue(transferQueue)
+    , m_graphicsQueue(graphicsQueue)
+    , m_dedicated(transferQueue->family() != graphicsQueue->family())
+{
+    SemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.type = SemaphoreType::Timeline;
+    semaphoreInfo.initialValue = 0;
+    m_semaphore = std::make_unique<Semaphore>(device, semaphoreInfo);
+
+    VkDevice vkDevice = device->handle();
+    m_transferCommandPool = createCommandPool(vkDevice, transferQueue->family());
+
+    if (m_dedicated) {
+        try {
+            m_acquireSemaphore = std::make_unique<Semaphore>(device, semaphoreInfo);
+            m_acquireCommandPool = createCommandPool(vkDevice, graphicsQueue->family());
+        } catch (...) {
+            vkDestroyCommandPool(vkDevice, m_transferCommandPool, nullptr);
+            throw;
+        }
+    }
+}
+
+UploadEngine::~UploadEngine()
+{
+    VkDevice vkDevice = m_device->handle();
+
+    if (m_lastValue > 0) {
+        m_semaphore->wait(m_lastValue, UINT64_MAX);
+    }
+    if (m_acquireSemaphore && m_lastAcquireValue > 0) {
+        m_acquireSemaphore->wait(m_lastAcquireValue, UINT64_MAX);
+    }
+
+    // Destroying the pools frees every command buffer allocated from them
+    if (m_acquireCommandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(vkDevice, m_acquireCommandPool, nullptr);
+    }
+    vkDestroyCommandPool(vkDevice, m_transferCommandPool, nullptr);
+}
+
+Semaphore* UploadEngine::getSemaphore() const
+{
+    return m_semaphore.get();
+}
+
+Semaphore* UploadEngine::getAcquireSemaphore() const
+{
+    return m_acquireSemaphore.get();
+}
+
+bool UploadEngine::hasDedicatedQueue() const
+{
+    return m_dedicated;
+}
+
+uint64_t UploadEngine::uploadBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size)
+{
+    void* mapped = buffer->map(offset, size);
+    if (mapped) {
+        // Host-visible buffers need no GPU work, anything already signaled covers them
+        memcpy(mapped, data, size);
+        buffer->flushMappedRange(offset, size);
+        std::scoped_lock lock(m_mutex);
+        return m_lastValue;
+    }
+
+    uint32_t transferFamily = m_transferQueue->family();
+    uint32_t graphicsFamily = m_graphicsQueue->family();
+
+    return submitUpload(data, size, STAGING_BUFFER_ALIGNMENT, [&](VkCommandBuffer cmd, VkBuffer stagingBuffer, VkDeviceSize stagingOffset, PendingAcquire& acquire) {
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = stagingOffset;
+        copyRegion.dstOffset = offset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(cmd, stagingBuffer, buffer->handle(), 1, &copyRegion);
+
+        if (!m_dedicated) {
+            return;
+        }
+
+        // Release the written range to the graphics family
+        VkBufferMemoryBarrier release{};
+        release.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        release.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        release.dstAccessMask = 0;
+        release.srcQueueFamilyIndex = transferFamily;
+        release.dstQueueFamilyIndex = graphicsFamily;
+        release.buffer = buffer->handle();
+        release.offset = offset;
+        release.size = size;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &release, 0, nullptr);
+
+        VkBufferMemoryBarrier acquireBarrier = release;
+        acquireBarrier.srcAccessMask = 0;
+        acquireBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        acquire.bufferBarriers.push_back(acquireBarrier);
+    });
+}
+
+uint64_t UploadEngine::uploadTexture(Texture* texture, const VkOffset3D& origin, uint32_t mipLevel,
+    const void* data, uint64_t dataSize,
+    const VkExtent3D& extent, VkImageLayout finalLayout)
+{
+    VkExtent3D size = texture->getSize();
+    VkExtent3D mipExtent = {
+        std::max(1u, size.width >> mipLevel),
+        std::max(1u, size.height >> mipLevel),
+        std::max(1u, size.depth >> mipLevel)
+    };
+    bool wholeMip = origin.x == 0 && origin.y == 0 && origin.z == 0
+        && extent.width == mipExtent.width && extent.height == mipExtent.height && extent.depth == mipExtent.depth;
+    bool depthStencil = isDepthFormat(texture->getFormat()) || hasStencilComponent(texture->getFormat());
+
+    if (m_dedicated && (!wholeMip || depthStencil)) {
+        // Partial writes would need the rest of the subresource handed over to the transfer
+        // family first, so those stay on the graphics queue, ordered before its next submit
+        m_graphicsQueue->writeTexture(texture, origin, mipLevel, data, dataSize, extent, finalLayout);
+        m_graphicsQueue->flushUploads();
+        std::scoped_lock lock(m_mutex);
+        return m_lastValue;
+    }
+
+    // Buffer-to-image copies need the source offset aligned to the texel block size
+    VkDeviceSize alignment = std::max<VkDeviceSize>(STAGING_TEXTURE_ALIGNMENT, m_device->getProperties().limits.optimalBufferCopyOffsetAlignment);
+    uint32_t transferFamily = m_transferQueue->family();
+    uint32_t graphicsFamily = m_graphicsQueue->family();
+
+    return submitUpload(data, dataSize, alignment, [&](VkCommandBuffer cmd, VkBuffer stagingBuffer, VkDeviceSize stagingOffset, PendingAcquire& acquire) {
+        VkBufferImageCopy region{};
+        region.bufferOffset = stagingOffset;
+        region.bufferRowLength = 0; // Tightly packed
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = getImageAspectMask(texture->getFormat());
+        region.imageSubresource.mipLevel = mipLevel;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = origin;
+        region.imageExtent = extent;
+
+        if (!m_dedicated) {
+            texture->transitionLayout(cmd, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevel, 1, 0, 1);
+            vkCmdCopyBufferToImage(cmd, stagingBuffer, texture->handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+            texture->transitionLayout(cmd, finalLayout, mipLevel, 1, 0, 1);
+            return;
+        }
+
+        // Starts from the tracked layout; the wait on the graphics serial already covers earlier
+        // accesses, and the whole subresource is overwritten, so no ownership transfer is needed
+        VkImageMemoryBarrier toTransfer{};
+        toTransfer.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        toTransfer.srcAccessMask = 0;
+        toTransfer.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toTransfer.oldLayout = texture->getLayout(mipLevel, 0);
+        toTransfer.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        toTransfer.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toTransfer.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toTransfer.image = texture->handle();
+        toTransfer.subresourceRange.aspectMask = region.imageSubresource.aspectMask;
+        toTransfer.subresourceRange.baseMipLevel = mipLevel;
+        toTransfer.subresourceRange.levelCount = 1;
+        toTransfer.subresourceRange.baseArrayLayer = 0;
+        toTransfer.subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toTransfer);
+
+        vkCmdCopyBufferToImage(cmd, stagingBuffer, texture->handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        // Release to the graphics family, moving to the final layout as part of the transfer
+        VkImageMemoryBarrier release = toTransfer;
+        release.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        release.dstAccessMask = 0;
+        release.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        release.newLayout = finalLayout;
+        release.srcQueueFamilyIndex = transferFamily;
+        release.dstQueueFamilyIndex = graphicsFamily;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &release);
+
+        VkImageMemoryBarrier acquireBarrier = release;
+        acquireBarrier.srcAccessMask = 0;
+        acquireBarrier.dstAccessMask = getVkAccessFlagsForLayout(finalLayout);
+        acquire.imageBarriers.push_back(acquireBarrier);
+
+        // Only the written subresource changed, the other mips and layers keep their state
+        TextureSubresourceState state{};
+        state.layout = finalLayout;
+        state.accessMask = acquireBarrier.dstAccessMask;
+        state.stageMask = getVkPipelineStageFlagsForLayout(finalLayout);
+        texture->setSubresourceState(state, mipLevel, 1, 0, 1);
+    });
+}
+
+VkCommandBuffer UploadEngine::prepareAcquire(Queue* queue, uint64_t waitValue, uint64_t* outAcquireValue)
+{
+    // Checked before locking: the transfer queue submits while this lock is held
+    if (!m_dedicated || queue != m_graphicsQueue) {
+        return VK_NULL_HANDLE;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    reclaim();
+
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+    for (const PendingAcquire& pending : m_pendingAcquires) {
+        if (pending.value > waitValue) {
+            break;
+        }
+        bufferBarriers.insert(bufferBarriers.end(), pending.bufferBarriers.begin(), pending.bufferBarriers.end());
+        imageBarriers.insert(imageBarriers.end(), pending.imageBarriers.begin(), pending.imageBarriers.end());
+    }
+    if (bufferBarriers.empty() && imageBarriers.empty()) {
+        return VK_NULL_HANDLE;
+    }
+
+    VkCommandBuffer cmd = allocateCommandBuffer(m_acquireCommandPool, m_freeAcquireCommandBuffers);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &beginInfo);
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+        0, nullptr,
+        static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+        static_cast<uint32_t>(imageBarriers.size()), imageBarriers.data());
+    vkEndCommandBuffer(cmd);
+
+    // Recorded, so the acquires move out of the pending list now
+    AcquireBatch batch{};
+    while (!m_pendingAcquires.empty() && m_pendingAcquires.front().value <= waitValue) {
+        batch.acquires.push_back(std::move(m_pendingAcquires.front()));
+        m_pendingAcquires.pop_front();
+    }
+
+    batch.commandBuffer = cmd;
+    batch.value = ++m_lastAcquireValue;
+    *outAcquireValue = batch.value;
+    m_inFlightAcquires.push_back(std::move(batch));
+    return cmd;
+}
+
+void UploadEngine::cancelAcquire(uint64_t acquireValue)
+{
+    std::scoped_lock lock(m_mutex);
+
+    if (m_inFlightAcquires.empty() || m_inFlightAcquires.back().value != acquireValue || acquireValue != m_lastAcquireValue) {
+        // Not the newest value: nothing on the GPU will signal it anymore, so signal it here
+        m_acquireSemaphore->signal(acquireValue);
+        return;
+    }
+
+    // The barriers were never executed, the next acquire has to record them again
+    AcquireBatch& batch = m_inFlightAcquires.back();
+    for (auto it = batch.acquires.rbegin(); it != batch.acquires.rend(); ++it) {
+        m_pendingAcquires.push_front(std::move(*it));
+    }
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+    m_freeAcquireCommandBuffers.push_back(batch.commandBuffer);
+    m_inFlightAcquires.pop_back();
+    --m_lastAcquireValue;
+}
+
+uint64_t UploadEngine::submitUpload(const void* data, uint64_t size, VkDeviceSize alignment, const UploadRecordFunc& recordFunc)
+{
+    // Graphics work submitted so far may still read what the copy overwrites (write-after-read
+    // across queues). Taken before locking, the graphics queue locks us while it submits.
+    uint64_t graphicsSerial = 0;
+    if (m_dedicated) {
+        VkResult result = m_graphicsQueue->submitSerial(&graphicsSerial);
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error(std::string("Failed to submit graphics queue serial: ") + vkResultToString(result));
+        }
+    }
+
+    std::scoped_lock lock(m_mutex);
+
+    reclaim();
+    VkDeviceSize stagingOffset = allocateStaging(size, alignment);
+    memcpy(m_stagingRing->mappedData(stagingOffset), data, size);
+
+    VkCommandBuffer cmd = allocateCommandBuffer(m_transferCommandPool, m_freeTransferCommandBuffers);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &beginInfo);
+
+    if (!m_dedicated) {
+        // Sharing the graphics queue: copies must not overwrite data earlier work still uses
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    PendingAcquire acquire{};
+    acquire.value = m_lastValue + 1;
+    recordFunc(cmd, m_stagingRing->handle(), stagingOffset, acquire);
+    vkEndCommandBuffer(cmd);
+
+    // The semaphore signal makes the writes available to every queue that waits on it
+    uint64_t signalValue = m_lastValue + 1;
+    VkSemaphore signalSemaphore = m_semaphore->handle();
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues = &signalValue;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &cmd;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = &signalSemaphore;
+
+    VkSemaphore waitSemaphore = VK_NULL_HANDLE;
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    if (graphicsSerial > 0) {
+        waitSemaphore = m_graphicsQueue->getSerialSemaphore()->handle();
+        timelineInfo.waitSemaphoreValueCount = 1;
+        timelineInfo.pWaitSemaphoreValues = &graphicsSerial;
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &waitSemaphore;
+        submitInfo.pWaitDstStageMask = &waitStage;
+    }
+
+    VkResult result = m_transferQueue->submit(submitInfo, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS) {
+        m_stagingRing->release(m_stagingRing->takeRegion());
+        vkResetCommandBuffer(cmd, 0);
+        m_freeTransferCommandBuffers.push_back(cmd);
+        throw std::runtime_error(std::string("Failed to submit upload: ") + vkResultToString(result));
+    }
+
+    m_lastValue = signalValue;
+    m_inFlightUploads.push_back({ cmd, signalValue, m_stagingRing, m_stagingRing->takeRegion() });
+    if (!acquire.bufferBarriers.empty() || !acquire.imageBarriers.empty()) {
+        m_pendingAcquires.push_back(std::move(acquire));
+    }
+    return signalValue;
+}
+
+VkDeviceSize UploadEngine::allocateStaging(uint64_t size, VkDeviceSize alignment)
+{
+    VkDeviceSize offset = 0;
+    while (m_stagingRing && size <= m_stagingRing->capacity()) {
+        if (m_stagingRing->allocate(size, alignment, &offset)) {
+            return offset;
+        }
+        // Past the size limit, wait for in-flight uploads instead of growing further
+        if (m_stagingRing->capacity() < MAX_STAGING_RING_SIZE || m_inFlightUploads.empty()) {
+            break;
+        }
+        m_semaphore->wait(m_inFlightUploads.front().value, UINT64_MAX);
+        reclaim();
+    }
+
+    // Grow. The old ring stays alive through the batches that still reference it.
+    VkDeviceSize capacity = m_stagingRing ? m_stagingRing->capacity() * 2 : INITIAL_STAGING_RING_SIZE;
+    while (capacity < size) {
+        capacity *= 2;
+    }
+    m_stagingRing = std::make_shared<StagingRing>(m_device, capacity);
+    if (!m_stagingRing->allocate(size, alignment, &offset)) {
+        throw std::runtime_error("Failed to allocate from staging ring");
+    }
+    return offset;
+}
+
+VkCommandBuffer UploadEngine::allocateCommandBuffer(VkCommandPool pool, std::vector<VkCommandBuffer>& freeList)
+{
+    if (!freeList.empty()) {
+        VkCommandBuffer cmd = freeList.back();
+        freeList.pop_back();
+        return cmd;
+    }
+
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = pool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    if (vkAllocateCommandBuffers(m_device->handle(), &allocInfo, &cmd) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate upload command buffer");
+    }
+    return cmd;
+}
+
+void UploadEngine::reclaim()
+{
+    // Submissions complete in value order, stop at the first one still running
+    uint64_t completed = m_semaphore->getValue();
+    while (!m_inFlightUploads.empty() && m_inFlightUploads.front().value <= completed) {
+        UploadBatch& batch = m_inFlightUploads.front();
+        batch.ring->release(batch.region);
+        vkResetCommandBuffer(batch.commandBuffer, 0);
+        m_freeTransferCommandBuffers.push_back(batch.commandBuffer);
+        m_inFlightUploads.pop_front();
+    }
+
+    if (!m_acquireSemaphore) {
+        return;
+    }
+    uint64_t acquired = m_acquireSemaphore->getValue();
+    while (!m_inFlightAcquires.empty() && m_inFlightAcquires.front().value <= acquired) {
+        vkResetCommandBuffer(m_inFlightAcquires.front().commandBuffer, 0);
+        m_freeAcquireCommandBuffers.push_back(m_inFlightAcquires.front().commandBuffer);
+        m_inFlightAcquires.pop_front();
+    }
+}
+
+} // namespace gfx::backend::vulkan::core
@@ -0,0 +1,107 @@
+#ifndef GFX_VULKAN_UPLOAD_ENGINE_H
+#define GFX_VULKAN_UPLOAD_ENGINE_H
+
+#include "../CoreTypes.h"
+#include "../memory/StagingRing.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gfx::backend::vulkan::core {
+
+class Buffer;
+class Device;
+class Queue;
+class Semaphore;
+class Texture;
+
+// Streams buffer and texture data through a transfer-only queue when the adapter has
+// one, so uploads overlap with rendering instead of serializing with it. Every upload
+// is submitted right away and signals the next value of a timeline semaphore. On the
+// transfer queue it first waits for the graphics work submitted before it, which may
+// still read what the upload overwrites.
+//
+// Ownership of the written range is released to the graphics family on the transfer
+// queue; the matching acquire is recorded into the first graphics submit that waits
+// on the upload semaphore for that value (see Queue::submit). Uploaded resources must
+// therefore only be used by submits to the graphics queue that wait on the returned value.
+class UploadEngine {
+public:
+    UploadEngine(const UploadEngine&) = delete;
+    UploadEngine& operator=(const UploadEngine&) = delete;
+
+    // transferQueue may be the graphics queue, in which case no ownership transfer happens
+    UploadEngine(Device* device, Queue* transferQueue, Queue* graphicsQueue);
+    ~UploadEngine();
+
+    Semaphore* getSemaphore() const;
+    bool hasDedicatedQueue() const;
+
+    // Return the semaphore value that signals once the data is on the GPU
+    uint64_t uploadBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size);
+    uint64_t uploadTexture(Texture* texture, const VkOffset3D& origin, uint32_t mipLevel, const void* data, uint64_t dataSize, const VkExtent3D& extent, VkImageLayout finalLayout);
+
+    // Called by Queue::submit for submits that wait on the upload semaphore. Returns a
+    // command buffer acquiring everything released up to waitValue, or VK_NULL_HANDLE.
+    // The submit must also signal getAcquireSemaphore() with *outAcquireValue. Only the
+    // graphics queue acquires, under its submit lock, so the values are signaled in order.
+    VkCommandBuffer prepareAcquire(Queue* queue, uint64_t waitValue, uint64_t* outAcquireValue);
+    // The submit carrying the acquire failed. Its barriers go back to the next acquire and
+    // its value is handed out again; cancel newer values first.
+    void cancelAcquire(uint64_t acquireValue);
+    Semaphore* getAcquireSemaphore() const;
+
+private:
+    struct UploadBatch {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        uint64_t value = 0;
+        std::shared_ptr<StagingRing> ring; // Keeps a replaced ring alive until the GPU is done with it
+        StagingRegion region{};
+    };
+
+    struct PendingAcquire {
+        uint64_t value = 0;
+        std::vector<VkBufferMemoryBarrier> bufferBarriers;
+        std::vector<VkImageMemoryBarrier> imageBarriers;
+    };
+
+    struct AcquireBatch {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        uint64_t value = 0;
+        std::deque<PendingAcquire> acquires; // Recorded into commandBuffer, put back if the submit fails
+    };
+
+    using UploadRecordFunc = std::function<void(VkCommandBuffer, VkBuffer, VkDeviceSize, PendingAcquire&)>;
+
+    uint64_t submitUpload(const void* data, uint64_t size, VkDeviceSize alignment, const UploadRecordFunc& recordFunc);
+    VkDeviceSize allocateStaging(uint64_t size, VkDeviceSize alignment);
+    VkCommandBuffer allocateCommandBuffer(VkCommandPool pool, std::vector<VkCommandBuffer>& freeList);
+    void reclaim();
+
+    Device* m_device = nullptr;
+    Queue* m_transferQueue = nullptr;
+    Queue* m_graphicsQueue = nullptr;
+    bool m_dedicated = false;
+
+    std::mutex m_mutex;
+    std::unique_ptr<Semaphore> m_semaphore;
+    std::unique_ptr<Semaphore> m_acquireSemaphore;
+    uint64_t m_lastValue = 0;
+    uint64_t m_lastAcquireValue = 0;
+
+    std::shared_ptr<StagingRing> m_stagingRing;
+    VkCommandPool m_transferCommandPool = VK_NULL_HANDLE;
+    VkCommandPool m_acquireCommandPool = VK_NULL_HANDLE;
+    std::deque<UploadBatch> m_inFlightUploads;
+    std::deque<PendingAcquire> m_pendingAcquires;
+    std::deque<AcquireBatch> m_inFlightAcquires;
+    std::vector<VkCommandBuffer> m_freeTransferCommandBuffers;
+    std::vector<VkCommandBuffer> m_freeAcquireCommandBuffers;
+};
+
+} // namespace gfx::backend::vulkan::core
+
+#endif // GFX_VULKAN_UPLOAD_ENGINE_H
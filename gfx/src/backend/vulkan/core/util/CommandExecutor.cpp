@@ -71,7 +71,9 @@ void CommandExecutor::execute(const std::function<void(VkCommandBuffer)>& record
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
 
-    vkQueueSubmit(m_queue->handle(), 1, &submitInfo, fence);
+    // Staged uploads recorded earlier must execute first
+    m_queue->flushUploads();
+    m_queue->submit(submitInfo, fence);
     vkWaitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
 
     // Cleanup
@@ -15,6 +15,12 @@ VkImageAspectFlags getImageAspectMask(VkFormat format);
 // Get the appropriate access flags for a given image layout
 VkAccessFlags getVkAccessFlagsForLayout(VkImageLayout layout);
 
+// Get the pipeline stages that access an image in the given layout
+VkPipelineStageFlags getVkPipelineStageFlagsForLayout(VkImageLayout layout);
+
+// Check if access flags include any write access
+bool hasWriteAccess(VkAccessFlags access);
+
 // Check if format has depth component
 bool isDepthFormat(VkFormat format);
 
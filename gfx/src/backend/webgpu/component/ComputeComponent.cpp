@@ -17,13 +17,11 @@ namespace gfx::backend::webgpu::component {
 // ComputePipeline functions
 GfxResult ComputeComponent::deviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateComputePipeline(device, descriptor, outPipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateComputePipeline(device, descriptor, outPipeline));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
+        GFX_VALIDATE(validator::validatePipelineImmediateDataGroup(descriptor->bindGroupLayoutCount, descriptor->immediateDataRangeCount, devicePtr->getLimits().maxBindGroups));
         auto createInfo = converter::gfxDescriptorToWebGPUComputePipelineCreateInfo(descriptor);
         auto* pipeline = new core::ComputePipeline(devicePtr, createInfo);
         *outPipeline = converter::toGfx<GfxComputePipeline>(pipeline);
@@ -34,12 +32,27 @@ GfxResult ComputeComponent::deviceCreateComputePipeline(GfxDevice device, const
     }
 }
 
-GfxResult ComputeComponent::computePipelineDestroy(GfxComputePipeline computePipeline) const
+GfxResult ComputeComponent::deviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData) const
 {
-    GfxResult validationResult = validator::validateComputePipelineDestroy(computePipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateDeviceCreateComputePipelineAsync(device, descriptor, callback));
+
+    try {
+        auto* devicePtr = converter::toNative<core::Device>(device);
+        GFX_VALIDATE(validator::validatePipelineImmediateDataGroup(descriptor->bindGroupLayoutCount, descriptor->immediateDataRangeCount, devicePtr->getLimits().maxBindGroups));
+        auto createInfo = converter::gfxDescriptorToWebGPUComputePipelineCreateInfo(descriptor);
+        core::ComputePipeline::createAsync(devicePtr, createInfo, [callback, userData](core::ComputePipeline* pipeline) {
+            callback(pipeline ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN, converter::toGfx<GfxComputePipeline>(pipeline), userData);
+        });
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to queue compute pipeline creation: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
     }
+}
+
+GfxResult ComputeComponent::computePipelineDestroy(GfxComputePipeline computePipeline) const
+{
+    GFX_VALIDATE(validator::validateComputePipelineDestroy(computePipeline));
 
     delete converter::toNative<core::ComputePipeline>(computePipeline);
     return GFX_RESULT_SUCCESS;
@@ -9,6 +9,7 @@ class ComputeComponent {
 public:
     // ComputePipeline functions
     GfxResult deviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline) const;
+    GfxResult deviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback, void* userData) const;
     GfxResult computePipelineDestroy(GfxComputePipeline pipeline) const;
 };
 
@@ -29,10 +29,7 @@ GfxResult PresentationComponent::deviceCreateSurface(GfxDevice device, const Gfx
     gfx::common::Logger::instance().logError("Surface creation is not available in headless builds");
     return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
 #else
-    GfxResult validationResult = validator::validateDeviceCreateSurface(device, descriptor, outSurface);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSurface(device, descriptor, outSurface));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -49,10 +46,7 @@ GfxResult PresentationComponent::deviceCreateSurface(GfxDevice device, const Gfx
 
 GfxResult PresentationComponent::surfaceDestroy(GfxSurface surface) const
 {
-    GfxResult validationResult = validator::validateSurfaceDestroy(surface);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceDestroy(surface));
 
     delete converter::toNative<core::Surface>(surface);
     return GFX_RESULT_SUCCESS;
@@ -60,10 +54,7 @@ GfxResult PresentationComponent::surfaceDestroy(GfxSurface surface) const
 
 GfxResult PresentationComponent::surfaceGetInfo(GfxSurface surface, GfxSurfaceInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateSurfaceGetInfo(surface, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceGetInfo(surface, outInfo));
 
     auto* surf = converter::toNative<core::Surface>(surface);
     *outInfo = converter::wgpuSurfaceInfoToGfxSurfaceInfo(surf->getInfo());
@@ -72,10 +63,7 @@ GfxResult PresentationComponent::surfaceGetInfo(GfxSurface surface, GfxSurfaceIn
 
 GfxResult PresentationComponent::surfaceEnumerateSupportedFormats(GfxSurface surface, uint32_t* formatCount, GfxFormat* formats) const
 {
-    GfxResult validationResult = validator::validateSurfaceEnumerateSupportedFormats(surface, formatCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceEnumerateSupportedFormats(surface, formatCount));
 
     auto* surf = converter::toNative<core::Surface>(surface);
 
@@ -103,10 +91,7 @@ GfxResult PresentationComponent::surfaceEnumerateSupportedFormats(GfxSurface sur
 
 GfxResult PresentationComponent::surfaceEnumerateSupportedPresentModes(GfxSurface surface, uint32_t* presentModeCount, GfxPresentMode* presentModes) const
 {
-    GfxResult validationResult = validator::validateSurfaceEnumerateSupportedPresentModes(surface, presentModeCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSurfaceEnumerateSupportedPresentModes(surface, presentModeCount));
 
     auto* surf = converter::toNative<core::Surface>(surface);
 
@@ -135,10 +120,7 @@ GfxResult PresentationComponent::surfaceEnumerateSupportedPresentModes(GfxSurfac
 // Swapchain functions
 GfxResult PresentationComponent::deviceCreateSwapchain(GfxDevice device, const GfxSwapchainDescriptor* descriptor, GfxSwapchain* outSwapchain) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSwapchain(device, descriptor, outSwapchain);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSwapchain(device, descriptor, outSwapchain));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -155,10 +137,7 @@ GfxResult PresentationComponent::deviceCreateSwapchain(GfxDevice device, const G
 
 GfxResult PresentationComponent::swapchainDestroy(GfxSwapchain swapchain) const
 {
-    GfxResult validationResult = validator::validateSwapchainDestroy(swapchain);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainDestroy(swapchain));
 
     delete converter::toNative<core::Swapchain>(swapchain);
     return GFX_RESULT_SUCCESS;
@@ -166,10 +145,7 @@ GfxResult PresentationComponent::swapchainDestroy(GfxSwapchain swapchain) const
 
 GfxResult PresentationComponent::swapchainGetInfo(GfxSwapchain swapchain, GfxSwapchainInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateSwapchainGetInfo(swapchain, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainGetInfo(swapchain, outInfo));
 
     auto* swapchainPtr = converter::toNative<core::Swapchain>(swapchain);
     *outInfo = converter::wgpuSwapchainInfoToGfxSwapchainInfo(swapchainPtr->getInfo());
@@ -178,10 +154,7 @@ GfxResult PresentationComponent::swapchainGetInfo(GfxSwapchain swapchain, GfxSwa
 
 GfxResult PresentationComponent::swapchainAcquireNextImage(GfxSwapchain swapchain, uint64_t timeoutNs, GfxSemaphore imageAvailableSemaphore, GfxFence fence, uint32_t* outImageIndex) const
 {
-    GfxResult validationResult = validator::validateSwapchainAcquireNextImage(swapchain, outImageIndex);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainAcquireNextImage(swapchain, outImageIndex));
 
     // WebGPU doesn't have explicit acquire semantics with semaphores
     // The surface texture is acquired implicitly when we call wgpuSurfaceGetCurrentTexture
@@ -227,10 +200,7 @@ GfxResult PresentationComponent::swapchainAcquireNextImage(GfxSwapchain swapchai
 
 GfxResult PresentationComponent::swapchainGetTextureView(GfxSwapchain swapchain, uint32_t imageIndex, GfxTextureView* outView) const
 {
-    GfxResult validationResult = validator::validateSwapchainGetTextureView(swapchain, outView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainGetTextureView(swapchain, outView));
 
     // WebGPU doesn't expose multiple swapchain images by index
     // Always return the current texture view regardless of index
@@ -241,10 +211,7 @@ GfxResult PresentationComponent::swapchainGetTextureView(GfxSwapchain swapchain,
 
 GfxResult PresentationComponent::swapchainGetCurrentTextureView(GfxSwapchain swapchain, GfxTextureView* outView) const
 {
-    GfxResult validationResult = validator::validateSwapchainGetCurrentTextureView(swapchain, outView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainGetCurrentTextureView(swapchain, outView));
 
     auto* swapchainPtr = converter::toNative<core::Swapchain>(swapchain);
     *outView = converter::toGfx<GfxTextureView>(swapchainPtr->getCurrentTextureView());
@@ -253,10 +220,7 @@ GfxResult PresentationComponent::swapchainGetCurrentTextureView(GfxSwapchain swa
 
 GfxResult PresentationComponent::swapchainPresent(GfxSwapchain swapchain, const GfxPresentDescriptor* presentDescriptor) const
 {
-    GfxResult validationResult = validator::validateSwapchainPresent(swapchain, presentDescriptor);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSwapchainPresent(swapchain, presentDescriptor));
 
     // WebGPU doesn't support explicit wait semaphores for present
     // The queue submission already ensures ordering, so we just present
@@ -17,10 +17,7 @@ namespace gfx::backend::webgpu::component {
 // QuerySet functions
 GfxResult QueryComponent::deviceCreateQuerySet(GfxDevice device, const GfxQuerySetDescriptor* descriptor, GfxQuerySet* outQuerySet) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateQuerySet(device, descriptor, outQuerySet);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateQuerySet(device, descriptor, outQuerySet));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -36,10 +33,7 @@ GfxResult QueryComponent::deviceCreateQuerySet(GfxDevice device, const GfxQueryS
 
 GfxResult QueryComponent::querySetDestroy(GfxQuerySet querySet) const
 {
-    GfxResult validationResult = validator::validateQuerySetDestroy(querySet);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateQuerySetDestroy(querySet));
 
     delete converter::toNative<core::QuerySet>(querySet);
     return GFX_RESULT_SUCCESS;
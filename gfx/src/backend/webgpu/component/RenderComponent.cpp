@@ -18,10 +18,7 @@ namespace gfx::backend::webgpu::component {
 // RenderPass functions
 GfxResult RenderComponent::deviceCreateRenderPass(GfxDevice device, const GfxRenderPassDescriptor* descriptor, GfxRenderPass* outRenderPass) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateRenderPass(device, descriptor, outRenderPass);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateRenderPass(device, descriptor, outRenderPass));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -37,10 +34,7 @@ GfxResult RenderComponent::deviceCreateRenderPass(GfxDevice device, const GfxRen
 
 GfxResult RenderComponent::renderPassDestroy(GfxRenderPass renderPass) const
 {
-    GfxResult validationResult = validator::validateRenderPassDestroy(renderPass);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateRenderPassDestroy(renderPass));
 
     delete converter::toNative<core::RenderPass>(renderPass);
     return GFX_RESULT_SUCCESS;
@@ -49,10 +43,7 @@ GfxResult RenderComponent::renderPassDestroy(GfxRenderPass renderPass) const
 // Framebuffer functions
 GfxResult RenderComponent::deviceCreateFramebuffer(GfxDevice device, const GfxFramebufferDescriptor* descriptor, GfxFramebuffer* outFramebuffer) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateFramebuffer(device, descriptor, outFramebuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateFramebuffer(device, descriptor, outFramebuffer));
 
     try {
         auto* dev = converter::toNative<core::Device>(device);
@@ -68,10 +59,7 @@ GfxResult RenderComponent::deviceCreateFramebuffer(GfxDevice device, const GfxFr
 
 GfxResult RenderComponent::framebufferDestroy(GfxFramebuffer framebuffer) const
 {
-    GfxResult validationResult = validator::validateFramebufferDestroy(framebuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFramebufferDestroy(framebuffer));
 
     delete converter::toNative<core::Framebuffer>(framebuffer);
     return GFX_RESULT_SUCCESS;
@@ -80,13 +68,11 @@ GfxResult RenderComponent::framebufferDestroy(GfxFramebuffer framebuffer) const
 // RenderPipeline functions
 GfxResult RenderComponent::deviceCreateRenderPipeline(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxRenderPipeline* outPipeline) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateRenderPipeline(device, descriptor, outPipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateRenderPipeline(device, descriptor, outPipeline));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
+        GFX_VALIDATE(validator::validatePipelineImmediateDataGroup(descriptor->bindGroupLayoutCount, descriptor->immediateDataRangeCount, devicePtr->getLimits().maxBindGroups));
         auto createInfo = converter::gfxDescriptorToWebGPURenderPipelineCreateInfo(descriptor);
         auto* pipeline = new core::RenderPipeline(devicePtr, createInfo);
         *outPipeline = converter::toGfx<GfxRenderPipeline>(pipeline);
@@ -97,12 +83,27 @@ GfxResult RenderComponent::deviceCreateRenderPipeline(GfxDevice device, const Gf
     }
 }
 
-GfxResult RenderComponent::renderPipelineDestroy(GfxRenderPipeline renderPipeline) const
+GfxResult RenderComponent::deviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback, void* userData) const
 {
-    GfxResult validationResult = validator::validateRenderPipelineDestroy(renderPipeline);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateDeviceCreateRenderPipelineAsync(device, descriptor, callback));
+
+    try {
+        auto* devicePtr = converter::toNative<core::Device>(device);
+        GFX_VALIDATE(validator::validatePipelineImmediateDataGroup(descriptor->bindGroupLayoutCount, descriptor->immediateDataRangeCount, devicePtr->getLimits().maxBindGroups));
+        auto createInfo = converter::gfxDescriptorToWebGPURenderPipelineCreateInfo(descriptor);
+        core::RenderPipeline::createAsync(devicePtr, createInfo, [callback, userData](core::RenderPipeline* pipeline) {
+            callback(pipeline ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN, converter::toGfx<GfxRenderPipeline>(pipeline), userData);
+        });
+        return GFX_RESULT_SUCCESS;
+    } catch (const std::exception& e) {
+        gfx::common::Logger::instance().logError("Failed to queue render pipeline creation: {}", e.what());
+        return GFX_RESULT_ERROR_UNKNOWN;
     }
+}
+
+GfxResult RenderComponent::renderPipelineDestroy(GfxRenderPipeline renderPipeline) const
+{
+    GFX_VALIDATE(validator::validateRenderPipelineDestroy(renderPipeline));
 
     delete converter::toNative<core::RenderPipeline>(renderPipeline);
     return GFX_RESULT_SUCCESS;
@@ -22,9 +22,11 @@ namespace gfx::backend::webgpu::component {
 // Buffer functions
 GfxResult ResourceComponent::deviceCreateBuffer(GfxDevice device, const GfxBufferDescriptor* descriptor, GfxBuffer* outBuffer) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateBuffer(device, descriptor, outBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateDeviceCreateBuffer(device, descriptor, outBuffer));
+
+    if (descriptor->usage & GFX_BUFFER_USAGE_MAP_PERSISTENT) {
+        gfx::common::Logger::instance().logError("Persistently mapped buffers are not supported by the WebGPU backend");
+        return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
     }
 
     try {
@@ -41,10 +43,7 @@ GfxResult ResourceComponent::deviceCreateBuffer(GfxDevice device, const GfxBuffe
 
 GfxResult ResourceComponent::deviceImportBuffer(GfxDevice device, const GfxBufferImportDescriptor* descriptor, GfxBuffer* outBuffer) const
 {
-    GfxResult validationResult = validator::validateDeviceImportBuffer(device, descriptor, outBuffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceImportBuffer(device, descriptor, outBuffer));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -61,10 +60,7 @@ GfxResult ResourceComponent::deviceImportBuffer(GfxDevice device, const GfxBuffe
 
 GfxResult ResourceComponent::bufferDestroy(GfxBuffer buffer) const
 {
-    GfxResult validationResult = validator::validateBufferDestroy(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferDestroy(buffer));
 
     delete converter::toNative<core::Buffer>(buffer);
     return GFX_RESULT_SUCCESS;
@@ -72,10 +68,7 @@ GfxResult ResourceComponent::bufferDestroy(GfxBuffer buffer) const
 
 GfxResult ResourceComponent::bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateBufferGetInfo(buffer, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferGetInfo(buffer, outInfo));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     *outInfo = converter::wgpuBufferToGfxBufferInfo(buf->getInfo());
@@ -84,10 +77,7 @@ GfxResult ResourceComponent::bufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outI
 
 GfxResult ResourceComponent::bufferGetNativeHandle(GfxBuffer buffer, void** outHandle) const
 {
-    GfxResult validationResult = validator::validateBufferGetNativeHandle(buffer, outHandle);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferGetNativeHandle(buffer, outHandle));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     *outHandle = reinterpret_cast<void*>(buf->handle());
@@ -96,10 +86,7 @@ GfxResult ResourceComponent::bufferGetNativeHandle(GfxBuffer buffer, void** outH
 
 GfxResult ResourceComponent::bufferMap(GfxBuffer buffer, uint64_t offset, uint64_t size, void** outMappedPointer) const
 {
-    GfxResult validationResult = validator::validateBufferMap(buffer, outMappedPointer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferMap(buffer, outMappedPointer));
 
     auto* bufferPtr = converter::toNative<core::Buffer>(buffer);
     void* mappedData = bufferPtr->map(offset, size);
@@ -112,12 +99,17 @@ GfxResult ResourceComponent::bufferMap(GfxBuffer buffer, uint64_t offset, uint64
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult ResourceComponent::bufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer) const
+{
+    GFX_VALIDATE(validator::validateBufferGetMappedPointer(buffer, outMappedPointer));
+
+    // WebGPU buffers cannot be used by the GPU while mapped
+    return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
 GfxResult ResourceComponent::bufferUnmap(GfxBuffer buffer) const
 {
-    GfxResult validationResult = validator::validateBufferUnmap(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferUnmap(buffer));
 
     auto* bufferPtr = converter::toNative<core::Buffer>(buffer);
     bufferPtr->unmap();
@@ -126,10 +118,7 @@ GfxResult ResourceComponent::bufferUnmap(GfxBuffer buffer) const
 
 GfxResult ResourceComponent::bufferFlushMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateBufferFlushMappedRange(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferFlushMappedRange(buffer));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     buf->flushMappedRange(offset, size);
@@ -138,10 +127,7 @@ GfxResult ResourceComponent::bufferFlushMappedRange(GfxBuffer buffer, uint64_t o
 
 GfxResult ResourceComponent::bufferInvalidateMappedRange(GfxBuffer buffer, uint64_t offset, uint64_t size) const
 {
-    GfxResult validationResult = validator::validateBufferInvalidateMappedRange(buffer);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBufferInvalidateMappedRange(buffer));
 
     auto* buf = converter::toNative<core::Buffer>(buffer);
     buf->invalidateMappedRange(offset, size);
@@ -151,10 +137,7 @@ GfxResult ResourceComponent::bufferInvalidateMappedRange(GfxBuffer buffer, uint6
 // Texture functions
 GfxResult ResourceComponent::deviceCreateTexture(GfxDevice device, const GfxTextureDescriptor* descriptor, GfxTexture* outTexture) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateTexture(device, descriptor, outTexture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateTexture(device, descriptor, outTexture));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -170,10 +153,7 @@ GfxResult ResourceComponent::deviceCreateTexture(GfxDevice device, const GfxText
 
 GfxResult ResourceComponent::deviceImportTexture(GfxDevice device, const GfxTextureImportDescriptor* descriptor, GfxTexture* outTexture) const
 {
-    GfxResult validationResult = validator::validateDeviceImportTexture(device, descriptor, outTexture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceImportTexture(device, descriptor, outTexture));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -190,10 +170,7 @@ GfxResult ResourceComponent::deviceImportTexture(GfxDevice device, const GfxText
 
 GfxResult ResourceComponent::textureDestroy(GfxTexture texture) const
 {
-    GfxResult validationResult = validator::validateTextureDestroy(texture);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureDestroy(texture));
 
     delete converter::toNative<core::Texture>(texture);
     return GFX_RESULT_SUCCESS;
@@ -201,10 +178,7 @@ GfxResult ResourceComponent::textureDestroy(GfxTexture texture) const
 
 GfxResult ResourceComponent::textureGetInfo(GfxTexture texture, GfxTextureInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateTextureGetInfo(texture, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureGetInfo(texture, outInfo));
 
     auto* texturePtr = converter::toNative<core::Texture>(texture);
     *outInfo = converter::wgpuTextureInfoToGfxTextureInfo(texturePtr->getInfo());
@@ -213,10 +187,7 @@ GfxResult ResourceComponent::textureGetInfo(GfxTexture texture, GfxTextureInfo*
 
 GfxResult ResourceComponent::textureGetNativeHandle(GfxTexture texture, void** outHandle) const
 {
-    GfxResult validationResult = validator::validateTextureGetNativeHandle(texture, outHandle);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureGetNativeHandle(texture, outHandle));
 
     auto* texturePtr = converter::toNative<core::Texture>(texture);
     *outHandle = reinterpret_cast<void*>(texturePtr->handle());
@@ -226,10 +197,7 @@ GfxResult ResourceComponent::textureGetNativeHandle(GfxTexture texture, void** o
 GfxResult ResourceComponent::textureGetLayout(GfxTexture texture, GfxTextureLayout* outLayout) const
 {
     // WebGPU doesn't have explicit layouts, return GENERAL as a reasonable default
-    GfxResult validationResult = validator::validateTextureGetLayout(texture, outLayout);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureGetLayout(texture, outLayout));
 
     *outLayout = GFX_TEXTURE_LAYOUT_GENERAL;
     return GFX_RESULT_SUCCESS;
@@ -237,10 +205,7 @@ GfxResult ResourceComponent::textureGetLayout(GfxTexture texture, GfxTextureLayo
 
 GfxResult ResourceComponent::textureCreateView(GfxTexture texture, const GfxTextureViewDescriptor* descriptor, GfxTextureView* outView) const
 {
-    GfxResult validationResult = validator::validateTextureCreateView(texture, descriptor, outView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureCreateView(texture, descriptor, outView));
 
     try {
         auto* texturePtr = converter::toNative<core::Texture>(texture);
@@ -257,10 +222,7 @@ GfxResult ResourceComponent::textureCreateView(GfxTexture texture, const GfxText
 // TextureView functions
 GfxResult ResourceComponent::textureViewDestroy(GfxTextureView textureView) const
 {
-    GfxResult validationResult = validator::validateTextureViewDestroy(textureView);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateTextureViewDestroy(textureView));
 
     delete converter::toNative<core::TextureView>(textureView);
     return GFX_RESULT_SUCCESS;
@@ -269,10 +231,7 @@ GfxResult ResourceComponent::textureViewDestroy(GfxTextureView textureView) cons
 // Sampler functions
 GfxResult ResourceComponent::deviceCreateSampler(GfxDevice device, const GfxSamplerDescriptor* descriptor, GfxSampler* outSampler) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSampler(device, descriptor, outSampler);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSampler(device, descriptor, outSampler));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -288,10 +247,7 @@ GfxResult ResourceComponent::deviceCreateSampler(GfxDevice device, const GfxSamp
 
 GfxResult ResourceComponent::samplerDestroy(GfxSampler sampler) const
 {
-    GfxResult validationResult = validator::validateSamplerDestroy(sampler);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSamplerDestroy(sampler));
 
     delete converter::toNative<core::Sampler>(sampler);
     return GFX_RESULT_SUCCESS;
@@ -300,10 +256,7 @@ GfxResult ResourceComponent::samplerDestroy(GfxSampler sampler) const
 // Shader functions
 GfxResult ResourceComponent::deviceCreateShader(GfxDevice device, const GfxShaderDescriptor* descriptor, GfxShader* outShader) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateShader(device, descriptor, outShader);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateShader(device, descriptor, outShader));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -319,10 +272,7 @@ GfxResult ResourceComponent::deviceCreateShader(GfxDevice device, const GfxShade
 
 GfxResult ResourceComponent::shaderDestroy(GfxShader shader) const
 {
-    GfxResult validationResult = validator::validateShaderDestroy(shader);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateShaderDestroy(shader));
 
     delete converter::toNative<core::Shader>(shader);
     return GFX_RESULT_SUCCESS;
@@ -331,10 +281,7 @@ GfxResult ResourceComponent::shaderDestroy(GfxShader shader) const
 // BindGroupLayout functions
 GfxResult ResourceComponent::deviceCreateBindGroupLayout(GfxDevice device, const GfxBindGroupLayoutDescriptor* descriptor, GfxBindGroupLayout* outLayout) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateBindGroupLayout(device, descriptor, outLayout);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateBindGroupLayout(device, descriptor, outLayout));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -350,10 +297,7 @@ GfxResult ResourceComponent::deviceCreateBindGroupLayout(GfxDevice device, const
 
 GfxResult ResourceComponent::bindGroupLayoutDestroy(GfxBindGroupLayout bindGroupLayout) const
 {
-    GfxResult validationResult = validator::validateBindGroupLayoutDestroy(bindGroupLayout);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBindGroupLayoutDestroy(bindGroupLayout));
 
     delete converter::toNative<core::BindGroupLayout>(bindGroupLayout);
     return GFX_RESULT_SUCCESS;
@@ -362,10 +306,7 @@ GfxResult ResourceComponent::bindGroupLayoutDestroy(GfxBindGroupLayout bindGroup
 // BindGroup functions
 GfxResult ResourceComponent::deviceCreateBindGroup(GfxDevice device, const GfxBindGroupDescriptor* descriptor, GfxBindGroup* outBindGroup) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateBindGroup(device, descriptor, outBindGroup);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateBindGroup(device, descriptor, outBindGroup));
 
     try {
         auto* devicePtr = converter::toNative<core::Device>(device);
@@ -382,10 +323,7 @@ GfxResult ResourceComponent::deviceCreateBindGroup(GfxDevice device, const GfxBi
 
 GfxResult ResourceComponent::bindGroupDestroy(GfxBindGroup bindGroup) const
 {
-    GfxResult validationResult = validator::validateBindGroupDestroy(bindGroup);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateBindGroupDestroy(bindGroup));
 
     delete converter::toNative<core::BindGroup>(bindGroup);
     return GFX_RESULT_SUCCESS;
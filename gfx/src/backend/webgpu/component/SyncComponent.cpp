@@ -18,10 +18,7 @@ namespace gfx::backend::webgpu::component {
 // Fence functions
 GfxResult SyncComponent::deviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateFence(device, descriptor, outFence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateFence(device, descriptor, outFence));
 
     try {
         auto* fence = new core::Fence(descriptor->signaled);
@@ -35,10 +32,7 @@ GfxResult SyncComponent::deviceCreateFence(GfxDevice device, const GfxFenceDescr
 
 GfxResult SyncComponent::fenceDestroy(GfxFence fence) const
 {
-    GfxResult validationResult = validator::validateFenceDestroy(fence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceDestroy(fence));
 
     delete converter::toNative<core::Fence>(fence);
     return GFX_RESULT_SUCCESS;
@@ -46,10 +40,7 @@ GfxResult SyncComponent::fenceDestroy(GfxFence fence) const
 
 GfxResult SyncComponent::fenceGetStatus(GfxFence fence, bool* isSignaled) const
 {
-    GfxResult validationResult = validator::validateFenceGetStatus(fence, isSignaled);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceGetStatus(fence, isSignaled));
 
     auto* fencePtr = converter::toNative<core::Fence>(fence);
     *isSignaled = fencePtr->isSignaled();
@@ -58,25 +49,18 @@ GfxResult SyncComponent::fenceGetStatus(GfxFence fence, bool* isSignaled) const
 
 GfxResult SyncComponent::fenceWait(GfxFence fence, uint64_t timeoutNs) const
 {
-    GfxResult validationResult = validator::validateFenceWait(fence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceWait(fence));
 
     auto* fencePtr = converter::toNative<core::Fence>(fence);
 
-    // Fence is already properly signaled by queueSubmit after GPU work completes
-    // Just check the status
+    // Waits on the work-done future of the submit that signals it
     bool signaled = fencePtr->wait(timeoutNs);
     return signaled ? GFX_RESULT_SUCCESS : GFX_RESULT_TIMEOUT;
 }
 
 GfxResult SyncComponent::fenceReset(GfxFence fence) const
 {
-    GfxResult validationResult = validator::validateFenceReset(fence);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateFenceReset(fence));
 
     auto* fencePtr = converter::toNative<core::Fence>(fence);
     fencePtr->reset();
@@ -86,10 +70,7 @@ GfxResult SyncComponent::fenceReset(GfxFence fence) const
 // Semaphore functions
 GfxResult SyncComponent::deviceCreateSemaphore(GfxDevice device, const GfxSemaphoreDescriptor* descriptor, GfxSemaphore* outSemaphore) const
 {
-    GfxResult validationResult = validator::validateDeviceCreateSemaphore(device, descriptor, outSemaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceCreateSemaphore(device, descriptor, outSemaphore));
 
     try {
         auto semaphoreType = converter::gfxSemaphoreTypeToWebGPUSemaphoreType(descriptor->type);
@@ -104,10 +85,7 @@ GfxResult SyncComponent::deviceCreateSemaphore(GfxDevice device, const GfxSemaph
 
 GfxResult SyncComponent::semaphoreDestroy(GfxSemaphore semaphore) const
 {
-    GfxResult validationResult = validator::validateSemaphoreDestroy(semaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreDestroy(semaphore));
 
     delete converter::toNative<core::Semaphore>(semaphore);
     return GFX_RESULT_SUCCESS;
@@ -115,10 +93,7 @@ GfxResult SyncComponent::semaphoreDestroy(GfxSemaphore semaphore) const
 
 GfxResult SyncComponent::semaphoreGetType(GfxSemaphore semaphore, GfxSemaphoreType* outType) const
 {
-    GfxResult validationResult = validator::validateSemaphoreGetType(semaphore, outType);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreGetType(semaphore, outType));
 
     auto type = converter::toNative<core::Semaphore>(semaphore)->getType();
     *outType = converter::webgpuSemaphoreTypeToGfxSemaphoreType(type);
@@ -127,10 +102,7 @@ GfxResult SyncComponent::semaphoreGetType(GfxSemaphore semaphore, GfxSemaphoreTy
 
 GfxResult SyncComponent::semaphoreSignal(GfxSemaphore semaphore, uint64_t value) const
 {
-    GfxResult validationResult = validator::validateSemaphoreSignal(semaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreSignal(semaphore));
 
     auto* semaphorePtr = converter::toNative<core::Semaphore>(semaphore);
     semaphorePtr->signal(value);
@@ -139,10 +111,7 @@ GfxResult SyncComponent::semaphoreSignal(GfxSemaphore semaphore, uint64_t value)
 
 GfxResult SyncComponent::semaphoreWait(GfxSemaphore semaphore, uint64_t value, uint64_t timeoutNs) const
 {
-    GfxResult validationResult = validator::validateSemaphoreWait(semaphore);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreWait(semaphore));
 
     auto* semaphorePtr = converter::toNative<core::Semaphore>(semaphore);
     bool satisfied = semaphorePtr->wait(value, timeoutNs);
@@ -151,10 +120,7 @@ GfxResult SyncComponent::semaphoreWait(GfxSemaphore semaphore, uint64_t value, u
 
 GfxResult SyncComponent::semaphoreGetValue(GfxSemaphore semaphore, uint64_t* outValue) const
 {
-    GfxResult validationResult = validator::validateSemaphoreGetValue(semaphore, outValue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateSemaphoreGetValue(semaphore, outValue));
 
     *outValue = converter::toNative<core::Semaphore>(semaphore)->getValue();
     return GFX_RESULT_SUCCESS;
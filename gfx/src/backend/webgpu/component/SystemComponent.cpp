@@ -12,21 +12,24 @@
 #include "../core/system/Queue.h"
 
 #include <stdexcept>
+#include <vector>
 
 namespace gfx::backend::webgpu::component {
 
 // Instance functions
 GfxResult SystemComponent::createInstance(const GfxInstanceDescriptor* descriptor, GfxInstance* outInstance) const
 {
-    GfxResult validationResult = validator::validateCreateInstance(descriptor, outInstance);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateCreateInstance(descriptor, outInstance));
 
     try {
         auto createInfo = converter::gfxDescriptorToWebGPUInstanceCreateInfo(descriptor);
         auto* instance = new core::Instance(createInfo);
         *outInstance = converter::toGfx<GfxInstance>(instance);
+        GfxValidationLevel level = validator::getInstanceValidationLevel(descriptor);
+        if (!validator::retainValidationLevel(level)) {
+            gfx::common::Logger::instance().logWarning("Validation level {} ignored, level {} of a live instance stays in effect",
+                static_cast<int>(level), static_cast<int>(validator::getValidationLevel()));
+        }
         return GFX_RESULT_SUCCESS;
     } catch (const std::exception& e) {
         gfx::common::Logger::instance().logError("Failed to create instance: {}", e.what());
@@ -36,10 +39,7 @@ GfxResult SystemComponent::createInstance(const GfxInstanceDescriptor* descripto
 
 GfxResult SystemComponent::instanceDestroy(GfxInstance instance) const
 {
-    GfxResult validationResult = validator::validateInstanceDestroy(instance);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateInstanceDestroy(instance));
 
     // Process any remaining events before destroying the instance
     // This ensures all pending callbacks are completed
@@ -49,15 +49,13 @@ GfxResult SystemComponent::instanceDestroy(GfxInstance instance) const
     }
 
     delete inst;
+    validator::releaseValidationLevel();
     return GFX_RESULT_SUCCESS;
 }
 
 GfxResult SystemComponent::instanceRequestAdapter(GfxInstance instance, const GfxAdapterDescriptor* descriptor, GfxAdapter* outAdapter) const
 {
-    GfxResult validationResult = validator::validateInstanceRequestAdapter(instance, descriptor, outAdapter);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateInstanceRequestAdapter(instance, descriptor, outAdapter));
 
     auto* inst = converter::toNative<core::Instance>(instance);
     auto createInfo = converter::gfxDescriptorToWebGPUAdapterCreateInfo(descriptor);
@@ -69,10 +67,7 @@ GfxResult SystemComponent::instanceRequestAdapter(GfxInstance instance, const Gf
 
 GfxResult SystemComponent::instanceEnumerateAdapters(GfxInstance instance, uint32_t* adapterCount, GfxAdapter* adapters) const
 {
-    GfxResult validationResult = validator::validateInstanceEnumerateAdapters(instance, adapterCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateInstanceEnumerateAdapters(instance, adapterCount));
 
     auto* inst = converter::toNative<core::Instance>(instance);
     const auto& cachedAdapters = inst->getAdapters();
@@ -117,10 +112,7 @@ GfxResult SystemComponent::enumerateInstanceExtensions(uint32_t* extensionCount,
 // Adapter functions
 GfxResult SystemComponent::adapterCreateDevice(GfxAdapter adapter, const GfxDeviceDescriptor* descriptor, GfxDevice* outDevice) const
 {
-    GfxResult validationResult = validator::validateAdapterCreateDevice(adapter, descriptor, outDevice);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterCreateDevice(adapter, descriptor, outDevice));
 
     try {
         auto* adapterPtr = converter::toNative<core::Adapter>(adapter);
@@ -136,10 +128,7 @@ GfxResult SystemComponent::adapterCreateDevice(GfxAdapter adapter, const GfxDevi
 
 GfxResult SystemComponent::adapterGetInfo(GfxAdapter adapter, GfxAdapterInfo* outInfo) const
 {
-    GfxResult validationResult = validator::validateAdapterGetInfo(adapter, outInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterGetInfo(adapter, outInfo));
 
     auto* adapterPtr = converter::toNative<core::Adapter>(adapter);
     *outInfo = converter::wgpuAdapterToGfxAdapterInfo(adapterPtr->getInfo());
@@ -148,10 +137,7 @@ GfxResult SystemComponent::adapterGetInfo(GfxAdapter adapter, GfxAdapterInfo* ou
 
 GfxResult SystemComponent::adapterGetLimits(GfxAdapter adapter, GfxDeviceLimits* outLimits) const
 {
-    GfxResult validationResult = validator::validateAdapterGetLimits(adapter, outLimits);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterGetLimits(adapter, outLimits));
 
     auto* adapterPtr = converter::toNative<core::Adapter>(adapter);
     *outLimits = converter::wgpuLimitsToGfxDeviceLimits(adapterPtr->getLimits());
@@ -160,10 +146,7 @@ GfxResult SystemComponent::adapterGetLimits(GfxAdapter adapter, GfxDeviceLimits*
 
 GfxResult SystemComponent::adapterEnumerateQueueFamilies(GfxAdapter adapter, uint32_t* queueFamilyCount, GfxQueueFamilyProperties* queueFamilies) const
 {
-    GfxResult validationResult = validator::validateAdapterEnumerateQueueFamilies(adapter, queueFamilyCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterEnumerateQueueFamilies(adapter, queueFamilyCount));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     auto families = adap->getQueueFamilyProperties();
@@ -185,10 +168,7 @@ GfxResult SystemComponent::adapterEnumerateQueueFamilies(GfxAdapter adapter, uin
 
 GfxResult SystemComponent::adapterGetQueueFamilySurfaceSupport(GfxAdapter adapter, uint32_t queueFamilyIndex, GfxSurface surface, bool* outSupported) const
 {
-    GfxResult validationResult = validator::validateAdapterGetQueueFamilySurfaceSupport(adapter, surface, outSupported);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterGetQueueFamilySurfaceSupport(adapter, surface, outSupported));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     *outSupported = adap->supportsPresentation(queueFamilyIndex);
@@ -197,10 +177,7 @@ GfxResult SystemComponent::adapterGetQueueFamilySurfaceSupport(GfxAdapter adapte
 
 GfxResult SystemComponent::adapterEnumerateExtensions(GfxAdapter adapter, uint32_t* extensionCount, const char** extensionNames) const
 {
-    GfxResult validationResult = validator::validateAdapterEnumerateExtensions(adapter, extensionCount);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateAdapterEnumerateExtensions(adapter, extensionCount));
 
     auto* adap = converter::toNative<core::Adapter>(adapter);
     const auto internalExtensions = adap->enumerateSupportedExtensions();
@@ -222,10 +199,7 @@ GfxResult SystemComponent::adapterEnumerateExtensions(GfxAdapter adapter, uint32
 // Device functions
 GfxResult SystemComponent::deviceDestroy(GfxDevice device) const
 {
-    GfxResult validationResult = validator::validateDeviceDestroy(device);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceDestroy(device));
 
     delete converter::toNative<core::Device>(device);
     return GFX_RESULT_SUCCESS;
@@ -233,10 +207,7 @@ GfxResult SystemComponent::deviceDestroy(GfxDevice device) const
 
 GfxResult SystemComponent::deviceGetQueue(GfxDevice device, GfxQueue* outQueue) const
 {
-    GfxResult validationResult = validator::validateDeviceGetQueue(device, outQueue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceGetQueue(device, outQueue));
 
     auto* dev = converter::toNative<core::Device>(device);
     *outQueue = converter::toGfx<GfxQueue>(dev->getQueue());
@@ -245,10 +216,7 @@ GfxResult SystemComponent::deviceGetQueue(GfxDevice device, GfxQueue* outQueue)
 
 GfxResult SystemComponent::deviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, GfxQueue* outQueue) const
 {
-    GfxResult validationResult = validator::validateDeviceGetQueueByIndex(device, outQueue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceGetQueueByIndex(device, outQueue));
 
     // WebGPU only has one queue family (index 0) with one queue (index 0)
     if (queueFamilyIndex != 0 || queueIndex != 0) {
@@ -262,28 +230,75 @@ GfxResult SystemComponent::deviceGetQueueByIndex(GfxDevice device, uint32_t queu
 
 GfxResult SystemComponent::deviceWaitIdle(GfxDevice device) const
 {
-    GfxResult validationResult = validator::validateDeviceWaitIdle(device);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceWaitIdle(device));
 
     auto* devicePtr = converter::toNative<core::Device>(device);
     devicePtr->waitIdle();
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult SystemComponent::devicePoll(GfxDevice device) const
+{
+    GFX_VALIDATE(validator::validateDevicePoll(device));
+
+    auto* devicePtr = converter::toNative<core::Device>(device);
+    devicePtr->poll();
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult SystemComponent::deviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits) const
 {
-    GfxResult validationResult = validator::validateDeviceGetLimits(device, outLimits);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateDeviceGetLimits(device, outLimits));
 
     auto* devicePtr = converter::toNative<core::Device>(device);
     *outLimits = converter::wgpuLimitsToGfxDeviceLimits(devicePtr->getLimits());
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult SystemComponent::deviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats) const
+{
+    GFX_VALIDATE(validator::validateDeviceGetMemoryStats(device, outStats));
+
+    // Device memory is owned and sub-allocated by the WebGPU implementation
+    return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
+GfxResult SystemComponent::deviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data) const
+{
+    (void)data;
+    GFX_VALIDATE(validator::validateDeviceGetPipelineCacheData(device, dataSize));
+
+    // Pipeline caching is handled internally by the WebGPU implementation
+    return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
+GfxResult SystemComponent::deviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore) const
+{
+    GFX_VALIDATE(validator::validateDeviceGetUploadSemaphore(device, outSemaphore));
+
+    // WebGPU exposes a single queue, use gfxQueueWriteBuffer/gfxQueueWriteTexture instead
+    return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
+GfxResult SystemComponent::deviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue) const
+{
+    (void)offset;
+    (void)size;
+    GFX_VALIDATE(validator::validateDeviceUploadBuffer(device, buffer, data, outSignalValue));
+
+    return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
+GfxResult SystemComponent::deviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue) const
+{
+    (void)mipLevel;
+    (void)dataSize;
+    (void)finalLayout;
+    GFX_VALIDATE(validator::validateDeviceUploadTexture(device, texture, origin, extent, data, outSignalValue));
+
+    return GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
 GfxResult SystemComponent::deviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported) const
 {
     if (!device || !outSupported) {
@@ -298,10 +313,7 @@ GfxResult SystemComponent::deviceSupportsShaderFormat(GfxDevice device, GfxShade
 // Queue functions
 GfxResult SystemComponent::queueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitInfo) const
 {
-    GfxResult validationResult = validator::validateQueueSubmit(queue, submitInfo);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateQueueSubmit(queue, submitInfo));
 
     auto* queuePtr = converter::toNative<core::Queue>(queue);
     auto submit = converter::gfxDescriptorToWebGPUSubmitInfo(submitInfo);
@@ -309,13 +321,32 @@ GfxResult SystemComponent::queueSubmit(GfxQueue queue, const GfxSubmitDescriptor
     return queuePtr->submit(submit) ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN;
 }
 
-GfxResult SystemComponent::queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const
+GfxResult SystemComponent::queueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitInfos, uint32_t submitCount) const
 {
-    GfxResult validationResult = validator::validateQueueWriteBuffer(queue, buffer, data);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
+    GFX_VALIDATE(validator::validateQueueSubmitBatch(queue, submitInfos, submitCount));
+
+    auto* queuePtr = converter::toNative<core::Queue>(queue);
+    std::vector<core::SubmitInfo> submits;
+    submits.reserve(submitCount);
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        submits.push_back(converter::gfxDescriptorToWebGPUSubmitInfo(&submitInfos[i]));
     }
 
+    return queuePtr->submit(submits.data(), submitCount) ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN;
+}
+
+GfxResult SystemComponent::queueFlush(GfxQueue queue) const
+{
+    GFX_VALIDATE(validator::validateQueueFlush(queue));
+
+    // Submits are never deferred
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult SystemComponent::queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const
+{
+    GFX_VALIDATE(validator::validateQueueWriteBuffer(queue, buffer, data));
+
     auto* queuePtr = converter::toNative<core::Queue>(queue);
     auto* bufferPtr = converter::toNative<core::Buffer>(buffer);
 
@@ -325,10 +356,7 @@ GfxResult SystemComponent::queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, ui
 
 GfxResult SystemComponent::queueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout) const
 {
-    GfxResult validationResult = validator::validateQueueWriteTexture(queue, texture, origin, extent, data);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateQueueWriteTexture(queue, texture, origin, extent, data));
 
     auto* queuePtr = converter::toNative<core::Queue>(queue);
     auto* texturePtr = converter::toNative<core::Texture>(texture);
@@ -344,10 +372,7 @@ GfxResult SystemComponent::queueWriteTexture(GfxQueue queue, GfxTexture texture,
 
 GfxResult SystemComponent::queueWaitIdle(GfxQueue queue) const
 {
-    GfxResult validationResult = validator::validateQueueWaitIdle(queue);
-    if (validationResult != GFX_RESULT_SUCCESS) {
-        return validationResult;
-    }
+    GFX_VALIDATE(validator::validateQueueWaitIdle(queue));
 
     auto* queuePtr = converter::toNative<core::Queue>(queue);
     return queuePtr->waitIdle() ? GFX_RESULT_SUCCESS : GFX_RESULT_ERROR_UNKNOWN;
@@ -27,11 +27,19 @@ public:
     GfxResult deviceGetQueue(GfxDevice device, GfxQueue* outQueue) const;
     GfxResult deviceGetQueueByIndex(GfxDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, GfxQueue* outQueue) const;
     GfxResult deviceWaitIdle(GfxDevice device) const;
+    GfxResult devicePoll(GfxDevice device) const;
     GfxResult deviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits) const;
+    GfxResult deviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats) const;
+    GfxResult deviceGetPipelineCacheData(GfxDevice device, size_t* dataSize, void* data) const;
+    GfxResult deviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore) const;
+    GfxResult deviceUploadBuffer(GfxDevice device, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size, uint64_t* outSignalValue) const;
+    GfxResult deviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout, uint64_t* outSignalValue) const;
     GfxResult deviceSupportsShaderFormat(GfxDevice device, GfxShaderSourceType format, bool* outSupported) const;
 
     // Queue functions
     GfxResult queueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptor) const;
+    GfxResult queueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount) const;
+    GfxResult queueFlush(GfxQueue queue) const;
     GfxResult queueWriteBuffer(GfxQueue queue, GfxBuffer buffer, uint64_t offset, const void* data, uint64_t size) const;
     GfxResult queueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, uint32_t mipLevel, const void* data, uint64_t dataSize, GfxTextureLayout finalLayout) const;
     GfxResult queueWaitIdle(GfxQueue queue) const;
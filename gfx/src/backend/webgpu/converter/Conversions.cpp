@@ -24,6 +24,7 @@
 #include "../core/system/Instance.h"
 #include "../core/system/Queue.h"
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -256,6 +257,15 @@ core::DeviceCreateInfo gfxDescriptorToWebGPUDeviceCreateInfo(const GfxDeviceDesc
                 createInfo.enabledExtensions.push_back(descriptor->enabledExtensions[i]);
             }
         }
+
+        const GfxChainHeader* chainNode = static_cast<const GfxChainHeader*>(descriptor->pNext);
+        while (chainNode) {
+            if (chainNode->sType == GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR) {
+                const auto* pipelineCache = static_cast<const GfxDevicePipelineCacheDescriptor*>(static_cast<const void*>(chainNode));
+                createInfo.pipelineCacheDataAccepted = pipelineCache->initialDataAccepted;
+            }
+            chainNode = static_cast<const GfxChainHeader*>(chainNode->pNext);
+        }
     }
 
     return createInfo;
@@ -587,6 +597,12 @@ core::RenderPipelineCreateInfo gfxDescriptorToWebGPURenderPipelineCreateInfo(con
         }
     }
 
+    // Immediate data ranges all live in one emulated uniform block
+    for (uint32_t i = 0; i < descriptor->immediateDataRangeCount; ++i) {
+        const auto& range = descriptor->immediateDataRanges[i];
+        createInfo.immediateDataSize = std::max(createInfo.immediateDataSize, range.offset + range.size);
+    }
+
     // Vertex state
     auto* vertexShader = toNative<Shader>(descriptor->vertex->module);
     createInfo.vertex.module = vertexShader->handle();
@@ -713,6 +729,12 @@ core::ComputePipelineCreateInfo gfxDescriptorToWebGPUComputePipelineCreateInfo(c
         }
     }
 
+    // Immediate data ranges all live in one emulated uniform block
+    for (uint32_t i = 0; i < descriptor->immediateDataRangeCount; ++i) {
+        const auto& range = descriptor->immediateDataRanges[i];
+        createInfo.immediateDataSize = std::max(createInfo.immediateDataSize, range.offset + range.size);
+    }
+
     // Extract shader module
     auto* shader = toNative<Shader>(descriptor->compute);
     createInfo.module = shader->handle();
@@ -1434,6 +1456,7 @@ core::RenderPassCreateInfo gfxRenderPassDescriptorToRenderPassCreateInfo(const G
         attachment.storeOp = gfxStoreOpToWGPUStoreOp(target.ops.storeOp);
 
         createInfo.colorAttachments.push_back(attachment);
+        createInfo.sampleCount = target.sampleCount;
     }
 
     // Convert depth/stencil attachment ops if present
@@ -1449,6 +1472,7 @@ core::RenderPassCreateInfo gfxRenderPassDescriptorToRenderPassCreateInfo(const G
         depthStencilAttachment.stencilStoreOp = gfxStoreOpToWGPUStoreOp(target.stencilOps.storeOp);
 
         createInfo.depthStencilAttachment = depthStencilAttachment;
+        createInfo.sampleCount = target.sampleCount;
     }
 
     return createInfo;
@@ -1515,4 +1539,11 @@ core::ComputePassEncoderCreateInfo gfxComputePassBeginDescriptorToCreateInfo(con
     return createInfo;
 }
 
+core::RenderBundleEncoderCreateInfo gfxRenderBundleEncoderDescriptorToCreateInfo(const GfxRenderBundleEncoderDescriptor* descriptor)
+{
+    core::RenderBundleEncoderCreateInfo createInfo{};
+    createInfo.label = descriptor->label;
+    return createInfo;
+}
+
 } // namespace gfx::backend::webgpu::converter
@@ -38,6 +38,7 @@ namespace core {
     struct FramebufferCreateInfo;
     struct RenderPassEncoderBeginInfo;
     struct ComputePassEncoderCreateInfo;
+    struct RenderBundleEncoderCreateInfo;
 
     struct SubmitInfo;
     struct PlatformWindowHandle;
@@ -237,6 +238,9 @@ core::RenderPassEncoderBeginInfo gfxRenderPassBeginDescriptorToBeginInfo(
 core::ComputePassEncoderCreateInfo gfxComputePassBeginDescriptorToCreateInfo(
     const GfxComputePassBeginDescriptor* descriptor);
 
+core::RenderBundleEncoderCreateInfo gfxRenderBundleEncoderDescriptorToCreateInfo(
+    const GfxRenderBundleEncoderDescriptor* descriptor);
+
 } // namespace gfx::backend::webgpu::converter
 
 #endif // GFX_WEBGPU_CONVERTER_H
\ No newline at end of file
@@ -52,6 +52,9 @@ struct QueueFamilyProperties {
     bool supportsTransfer; // Always true
 };
 
+// Immediate data is emulated with a uniform buffer binding of this size
+constexpr uint32_t MAX_IMMEDIATE_DATA_SIZE = 128;
+
 // ============================================================================
 // Internal CreateInfo structs - pure WebGPU types, no GFX dependencies
 // ============================================================================
@@ -205,6 +208,7 @@ struct InstanceCreateInfo {
 
 struct DeviceCreateInfo {
     std::vector<std::string> enabledExtensions;
+    bool* pipelineCacheDataAccepted = nullptr; // Caching is left to the implementation, always set to false
 };
 
 // Platform-specific window handles (WebGPU native)
@@ -375,6 +379,7 @@ struct DepthStencilState {
 
 struct RenderPipelineCreateInfo {
     std::vector<WGPUBindGroupLayout> bindGroupLayouts;
+    uint32_t immediateDataSize = 0; // End of the last immediate data range, 0 if unused
     VertexState vertex;
     std::optional<FragmentState> fragment;
     PrimitiveState primitive;
@@ -384,6 +389,7 @@ struct RenderPipelineCreateInfo {
 
 struct ComputePipelineCreateInfo {
     std::vector<WGPUBindGroupLayout> bindGroupLayouts;
+    uint32_t immediateDataSize = 0; // End of the last immediate data range, 0 if unused
     WGPUShaderModule module;
     const char* entryPoint;
 };
@@ -407,6 +413,7 @@ struct RenderPassDepthStencilAttachment {
 struct RenderPassCreateInfo {
     std::vector<RenderPassColorAttachment> colorAttachments;
     std::optional<RenderPassDepthStencilAttachment> depthStencilAttachment;
+    uint32_t sampleCount = 1; // Needed by render bundle encoders, which only see the pass
 };
 
 struct FramebufferCreateInfo {
@@ -428,6 +435,10 @@ struct ComputePassEncoderCreateInfo {
     const char* label;
 };
 
+struct RenderBundleEncoderCreateInfo {
+    const char* label;
+};
+
 } // namespace gfx::backend::webgpu::core
 
 #endif // GFX_WEBGPU_CREATEINFO_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "../command/CommandEncoder.h"
 
+#include "../command/ImmediateDataRing.h"
 #include "../resource/Buffer.h"
 #include "../resource/Texture.h"
 #include "../system/Device.h"
@@ -73,9 +74,20 @@ bool CommandEncoder::recreateIfNeeded()
     }
 
     m_finished = false;
+    if (m_immediateDataRing) {
+        m_immediateDataRing->reset();
+    }
     return true;
 }
 
+ImmediateDataRing* CommandEncoder::getImmediateDataRing()
+{
+    if (!m_immediateDataRing) {
+        m_immediateDataRing = std::make_unique<ImmediateDataRing>(m_device);
+    }
+    return m_immediateDataRing.get();
+}
+
 // Copy operations
 void CommandEncoder::copyBufferToBuffer(Buffer* source, uint64_t sourceOffset, Buffer* destination, uint64_t destinationOffset, uint64_t size)
 {
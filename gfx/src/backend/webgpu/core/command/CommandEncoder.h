@@ -3,11 +3,14 @@
 
 #include "../CoreTypes.h"
 
+#include <memory>
+
 namespace gfx::backend::webgpu::core {
 
 class Device;
 class Buffer;
 class Texture;
+class ImmediateDataRing;
 
 class CommandEncoder {
 public:
@@ -26,6 +29,9 @@ public:
     // Recreate the encoder if it has been finished
     bool recreateIfNeeded();
 
+    // Created on first use, rewound whenever the encoder is recreated
+    ImmediateDataRing* getImmediateDataRing();
+
     // Copy operations
     void copyBufferToBuffer(Buffer* source, uint64_t sourceOffset, Buffer* destination, uint64_t destinationOffset, uint64_t size);
     void copyBufferToTexture(Buffer* source, uint64_t sourceOffset, Texture* destination, const WGPUOrigin3D& origin, const WGPUExtent3D& extent, uint32_t mipLevel);
@@ -41,6 +47,7 @@ private:
     Device* m_device = nullptr; // Non-owning pointer
     WGPUCommandEncoder m_encoder = nullptr;
     bool m_finished = false;
+    std::unique_ptr<ImmediateDataRing> m_immediateDataRing;
 };
 
 } // namespace gfx::backend::webgpu::core
@@ -1,13 +1,16 @@
 #include "ComputePassEncoder.h"
 
 #include "../command/CommandEncoder.h"
+#include "../compute/ComputePipeline.h"
 #include "../util/Utils.h"
 
+#include <cstring>
 #include <stdexcept>
 
 namespace gfx::backend::webgpu::core {
 
 ComputePassEncoder::ComputePassEncoder(CommandEncoder* commandEncoder, const ComputePassEncoderCreateInfo& createInfo)
+    : m_commandEncoder(commandEncoder)
 {
     WGPUComputePassDescriptor wgpuDesc = WGPU_COMPUTE_PASS_DESCRIPTOR_INIT;
     if (createInfo.label) {
@@ -30,9 +33,17 @@ ComputePassEncoder::~ComputePassEncoder()
     }
 }
 
-void ComputePassEncoder::setPipeline(WGPUComputePipeline pipeline)
+void ComputePassEncoder::setPipeline(ComputePipeline* pipeline)
 {
-    wgpuComputePassEncoderSetPipeline(m_encoder, pipeline);
+    wgpuComputePassEncoderSetPipeline(m_encoder, pipeline->handle());
+
+    // The data persists across pipelines, it only needs binding again if the group moved
+    std::optional<uint32_t> group = pipeline->immediateDataGroup();
+    m_immediateDataSize = pipeline->immediateDataSize();
+    if (group.has_value() && group != m_immediateDataGroup) {
+        m_immediateDataGroup = group;
+        bindImmediateData();
+    }
 }
 
 void ComputePassEncoder::setBindGroup(uint32_t index, WGPUBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
@@ -40,6 +51,28 @@ void ComputePassEncoder::setBindGroup(uint32_t index, WGPUBindGroup bindGroup, c
     wgpuComputePassEncoderSetBindGroup(m_encoder, index, bindGroup, dynamicOffsetCount, dynamicOffsets);
 }
 
+bool ComputePassEncoder::setImmediateData(uint32_t offset, const void* data, uint32_t size)
+{
+    if (!m_immediateDataGroup.has_value() || offset + size > m_immediateDataSize) {
+        return false;
+    }
+
+    // Every update gets its own slot, earlier dispatches keep reading the slot they were recorded with
+    std::memcpy(m_immediateData.data() + offset, data, size);
+    m_immediateDataSlot = m_commandEncoder->getImmediateDataRing()->push(m_immediateData.data(), MAX_IMMEDIATE_DATA_SIZE);
+    bindImmediateData();
+    return true;
+}
+
+void ComputePassEncoder::bindImmediateData()
+{
+    if (!m_immediateDataSlot.has_value()) {
+        // Nothing set yet, bind zeros so the pipeline's group is never left empty
+        m_immediateDataSlot = m_commandEncoder->getImmediateDataRing()->push(m_immediateData.data(), MAX_IMMEDIATE_DATA_SIZE);
+    }
+    wgpuComputePassEncoderSetBindGroup(m_encoder, *m_immediateDataGroup, m_immediateDataSlot->bindGroup, 1, &m_immediateDataSlot->offset);
+}
+
 void ComputePassEncoder::dispatchWorkgroups(uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ)
 {
     wgpuComputePassEncoderDispatchWorkgroups(m_encoder, workgroupCountX, workgroupCountY, workgroupCountZ);
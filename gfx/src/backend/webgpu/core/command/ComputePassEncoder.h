@@ -2,9 +2,15 @@
 #define GFX_WEBGPU_COMPUTE_PASS_ENCODER_H
 
 #include "../CoreTypes.h"
+#include "ImmediateDataRing.h"
+
+#include <array>
+#include <optional>
 
 namespace gfx::backend::webgpu::core {
 
+class ComputePipeline;
+
 class ComputePassEncoder {
 public:
     // Prevent copying
@@ -14,8 +20,12 @@ public:
     ComputePassEncoder(CommandEncoder* commandEncoder, const ComputePassEncoderCreateInfo& createInfo);
     ~ComputePassEncoder();
 
-    void setPipeline(WGPUComputePipeline pipeline);
+    // Throws std::runtime_error if immediate data cannot be rebound for the pipeline
+    void setPipeline(ComputePipeline* pipeline);
     void setBindGroup(uint32_t index, WGPUBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+    // Returns false if the bytes are outside the current pipeline's immediate data.
+    // Throws std::runtime_error if no immediate data slot can be allocated.
+    bool setImmediateData(uint32_t offset, const void* data, uint32_t size);
 
     void dispatchWorkgroups(uint32_t workgroupCountX, uint32_t workgroupCountY, uint32_t workgroupCountZ);
     void dispatchIndirect(WGPUBuffer buffer, uint64_t offset);
@@ -23,8 +33,16 @@ public:
     WGPUComputePassEncoder handle() const;
 
 private:
+    void bindImmediateData();
+
     WGPUComputePassEncoder m_encoder = nullptr;
     bool m_ended = false;
+
+    CommandEncoder* m_commandEncoder = nullptr; // Non-owning pointer
+    std::array<uint8_t, MAX_IMMEDIATE_DATA_SIZE> m_immediateData{};
+    std::optional<ImmediateDataSlot> m_immediateDataSlot; // Holds a copy of m_immediateData
+    std::optional<uint32_t> m_immediateDataGroup; // Where m_immediateDataSlot is bound
+    uint32_t m_immediateDataSize = 0;
 };
 
 } // namespace gfx::backend::webgpu::core
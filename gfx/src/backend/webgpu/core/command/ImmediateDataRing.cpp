@@ -0,0 +1,91 @@
+#include "ImmediateDataRing.h"
+
+#include "../system/Device.h"
+#include "../system/Queue.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace gfx::backend::webgpu::core {
+
+namespace {
+    constexpr uint64_t SLOTS_PER_CHUNK = 256;
+} // anonymous namespace
+
+ImmediateDataRing::ImmediateDataRing(Device* device)
+    : m_device(device)
+{
+    // Dynamic offsets must be multiples of minUniformBufferOffsetAlignment
+    m_slotSize = std::max(MAX_IMMEDIATE_DATA_SIZE, device->getLimits().minUniformBufferOffsetAlignment);
+}
+
+ImmediateDataRing::~ImmediateDataRing()
+{
+    for (const Chunk& chunk : m_chunks) {
+        wgpuBindGroupRelease(chunk.bindGroup);
+        wgpuBufferRelease(chunk.buffer);
+    }
+}
+
+ImmediateDataSlot ImmediateDataRing::push(const void* data, uint32_t size)
+{
+    if (m_chunkIndex < m_chunks.size() && m_chunkOffset == SLOTS_PER_CHUNK * m_slotSize) {
+        ++m_chunkIndex;
+        m_chunkOffset = 0;
+    }
+    if (m_chunkIndex == m_chunks.size()) {
+        createChunk();
+    }
+
+    const Chunk& chunk = m_chunks[m_chunkIndex];
+    wgpuQueueWriteBuffer(m_device->getQueue()->handle(), chunk.buffer, m_chunkOffset, data, size);
+
+    ImmediateDataSlot slot{};
+    slot.bindGroup = chunk.bindGroup;
+    slot.offset = static_cast<uint32_t>(m_chunkOffset);
+    m_chunkOffset += m_slotSize;
+    return slot;
+}
+
+void ImmediateDataRing::reset()
+{
+    m_chunkIndex = 0;
+    m_chunkOffset = 0;
+}
+
+size_t ImmediateDataRing::chunkCount() const
+{
+    return m_chunks.size();
+}
+
+void ImmediateDataRing::createChunk()
+{
+    WGPUBufferDescriptor bufferDesc = WGPU_BUFFER_DESCRIPTOR_INIT;
+    bufferDesc.size = SLOTS_PER_CHUNK * m_slotSize;
+    bufferDesc.usage = WGPUBufferUsage_Uniform | WGPUBufferUsage_CopyDst;
+
+    Chunk chunk{};
+    chunk.buffer = wgpuDeviceCreateBuffer(m_device->handle(), &bufferDesc);
+    if (!chunk.buffer) {
+        throw std::runtime_error("Failed to create immediate data buffer");
+    }
+
+    WGPUBindGroupEntry entry = WGPU_BIND_GROUP_ENTRY_INIT;
+    entry.binding = 0;
+    entry.buffer = chunk.buffer;
+    entry.size = MAX_IMMEDIATE_DATA_SIZE;
+
+    WGPUBindGroupDescriptor bindGroupDesc = WGPU_BIND_GROUP_DESCRIPTOR_INIT;
+    bindGroupDesc.layout = m_device->getImmediateDataLayout();
+    bindGroupDesc.entryCount = 1;
+    bindGroupDesc.entries = &entry;
+    chunk.bindGroup = wgpuDeviceCreateBindGroup(m_device->handle(), &bindGroupDesc);
+    if (!chunk.bindGroup) {
+        wgpuBufferRelease(chunk.buffer);
+        throw std::runtime_error("Failed to create immediate data bind group");
+    }
+
+    m_chunks.push_back(chunk);
+}
+
+} // namespace gfx::backend::webgpu::core
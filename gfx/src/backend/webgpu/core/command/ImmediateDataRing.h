@@ -0,0 +1,54 @@
+#ifndef GFX_WEBGPU_IMMEDIATE_DATA_RING_H
+#define GFX_WEBGPU_IMMEDIATE_DATA_RING_H
+
+#include "../CoreTypes.h"
+
+#include <vector>
+
+namespace gfx::backend::webgpu::core {
+
+class Device;
+
+struct ImmediateDataSlot {
+    WGPUBindGroup bindGroup = nullptr; // Uses Device::getImmediateDataLayout()
+    uint32_t offset = 0; // Dynamic offset to bind the group with
+};
+
+// WebGPU has no push constants. Each immediate data update is written to its own slot of a
+// uniform buffer and bound with a dynamic offset, so draws never wait on each other's data.
+// Slots come from chunks owned by one command encoder and are rewound when it records again:
+// queue writes made after a submit are ordered after it, so the old contents are no longer read.
+class ImmediateDataRing {
+public:
+    // Prevent copying
+    ImmediateDataRing(const ImmediateDataRing&) = delete;
+    ImmediateDataRing& operator=(const ImmediateDataRing&) = delete;
+
+    explicit ImmediateDataRing(Device* device);
+    ~ImmediateDataRing();
+
+    // size must not exceed MAX_IMMEDIATE_DATA_SIZE.
+    // Throws std::runtime_error if a new chunk cannot be created.
+    ImmediateDataSlot push(const void* data, uint32_t size);
+    void reset();
+
+    size_t chunkCount() const;
+
+private:
+    struct Chunk {
+        WGPUBuffer buffer = nullptr;
+        WGPUBindGroup bindGroup = nullptr;
+    };
+
+    void createChunk();
+
+    Device* m_device = nullptr; // Non-owning pointer
+    uint32_t m_slotSize = 0;
+    std::vector<Chunk> m_chunks;
+    size_t m_chunkIndex = 0;
+    uint64_t m_chunkOffset = 0;
+};
+
+} // namespace gfx::backend::webgpu::core
+
+#endif // GFX_WEBGPU_IMMEDIATE_DATA_RING_H
@@ -0,0 +1,22 @@
+#include "RenderBundle.h"
+
+namespace gfx::backend::webgpu::core {
+
+RenderBundle::RenderBundle(WGPURenderBundle bundle)
+    : m_bundle(bundle)
+{
+}
+
+RenderBundle::~RenderBundle()
+{
+    if (m_bundle) {
+        wgpuRenderBundleRelease(m_bundle);
+    }
+}
+
+WGPURenderBundle RenderBundle::handle() const
+{
+    return m_bundle;
+}
+
+} // namespace gfx::backend::webgpu::core
@@ -0,0 +1,26 @@
+#ifndef GFX_WEBGPU_RENDER_BUNDLE_H
+#define GFX_WEBGPU_RENDER_BUNDLE_H
+
+#include "../CoreTypes.h"
+
+namespace gfx::backend::webgpu::core {
+
+class RenderBundle {
+public:
+    // Prevent copying
+    RenderBundle(const RenderBundle&) = delete;
+    RenderBundle& operator=(const RenderBundle&) = delete;
+
+    // Takes ownership of bundle
+    explicit RenderBundle(WGPURenderBundle bundle);
+    ~RenderBundle();
+
+    WGPURenderBundle handle() const;
+
+private:
+    WGPURenderBundle m_bundle = nullptr;
+};
+
+} // namespace gfx::backend::webgpu::core
+
+#endif // GFX_WEBGPU_RENDER_BUNDLE_H
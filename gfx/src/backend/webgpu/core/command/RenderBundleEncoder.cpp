@@ -0,0 +1,100 @@
+#include "RenderBundleEncoder.h"
+
+#include "../command/RenderBundle.h"
+#include "../render/RenderPass.h"
+#include "../resource/Buffer.h"
+#include "../system/Device.h"
+#include "../util/Utils.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace gfx::backend::webgpu::core {
+
+RenderBundleEncoder::RenderBundleEncoder(RenderPass* renderPass, const RenderBundleEncoderCreateInfo& createInfo)
+{
+    const RenderPassCreateInfo& passInfo = renderPass->getCreateInfo();
+
+    std::vector<WGPUTextureFormat> colorFormats;
+    for (const auto& colorAttachment : passInfo.colorAttachments) {
+        colorFormats.push_back(colorAttachment.format);
+    }
+
+    WGPURenderBundleEncoderDescriptor wgpuDesc = WGPU_RENDER_BUNDLE_ENCODER_DESCRIPTOR_INIT;
+    if (createInfo.label) {
+        wgpuDesc.label = toStringView(createInfo.label);
+    }
+    wgpuDesc.colorFormatCount = colorFormats.size();
+    wgpuDesc.colorFormats = colorFormats.data();
+    if (passInfo.depthStencilAttachment.has_value()) {
+        wgpuDesc.depthStencilFormat = passInfo.depthStencilAttachment->format;
+    }
+    wgpuDesc.sampleCount = passInfo.sampleCount;
+
+    m_encoder = wgpuDeviceCreateRenderBundleEncoder(renderPass->getDevice()->handle(), &wgpuDesc);
+    if (!m_encoder) {
+        throw std::runtime_error("Failed to create render bundle encoder");
+    }
+}
+
+RenderBundleEncoder::~RenderBundleEncoder()
+{
+    if (m_encoder) {
+        wgpuRenderBundleEncoderRelease(m_encoder);
+    }
+}
+
+void RenderBundleEncoder::setPipeline(WGPURenderPipeline pipeline)
+{
+    wgpuRenderBundleEncoderSetPipeline(m_encoder, pipeline);
+}
+
+void RenderBundleEncoder::setBindGroup(uint32_t index, WGPUBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+{
+    wgpuRenderBundleEncoderSetBindGroup(m_encoder, index, bindGroup, dynamicOffsetCount, dynamicOffsets);
+}
+
+void RenderBundleEncoder::setVertexBuffer(uint32_t slot, Buffer* buffer, uint64_t offset, uint64_t size)
+{
+    uint64_t actualSize = (size == 0) ? (buffer->getInfo().size - offset) : size;
+    wgpuRenderBundleEncoderSetVertexBuffer(m_encoder, slot, buffer->handle(), offset, actualSize);
+}
+
+void RenderBundleEncoder::setIndexBuffer(Buffer* buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size)
+{
+    uint64_t actualSize = (size == 0) ? (buffer->getInfo().size - offset) : size;
+    wgpuRenderBundleEncoderSetIndexBuffer(m_encoder, buffer->handle(), format, offset, actualSize);
+}
+
+void RenderBundleEncoder::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+    wgpuRenderBundleEncoderDraw(m_encoder, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void RenderBundleEncoder::drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance)
+{
+    wgpuRenderBundleEncoderDrawIndexed(m_encoder, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+}
+
+bool RenderBundleEncoder::isFinished() const
+{
+    return m_finished;
+}
+
+std::unique_ptr<RenderBundle> RenderBundleEncoder::finish()
+{
+    WGPURenderBundleDescriptor wgpuDesc = WGPU_RENDER_BUNDLE_DESCRIPTOR_INIT;
+    WGPURenderBundle bundle = wgpuRenderBundleEncoderFinish(m_encoder, &wgpuDesc);
+    if (!bundle) {
+        throw std::runtime_error("Failed to finish render bundle");
+    }
+    m_finished = true;
+    return std::make_unique<RenderBundle>(bundle);
+}
+
+WGPURenderBundleEncoder RenderBundleEncoder::handle() const
+{
+    return m_encoder;
+}
+
+} // namespace gfx::backend::webgpu::core
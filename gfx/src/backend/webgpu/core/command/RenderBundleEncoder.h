@@ -0,0 +1,44 @@
+#ifndef GFX_WEBGPU_RENDER_BUNDLE_ENCODER_H
+#define GFX_WEBGPU_RENDER_BUNDLE_ENCODER_H
+
+#include "../CoreTypes.h"
+
+#include <memory>
+
+namespace gfx::backend::webgpu::core {
+
+class Buffer;
+class RenderBundle;
+class RenderPass;
+
+class RenderBundleEncoder {
+public:
+    // Prevent copying
+    RenderBundleEncoder(const RenderBundleEncoder&) = delete;
+    RenderBundleEncoder& operator=(const RenderBundleEncoder&) = delete;
+
+    // Attachment formats and sample count are taken from renderPass
+    RenderBundleEncoder(RenderPass* renderPass, const RenderBundleEncoderCreateInfo& createInfo);
+    ~RenderBundleEncoder();
+
+    void setPipeline(WGPURenderPipeline pipeline);
+    void setBindGroup(uint32_t index, WGPUBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+    void setVertexBuffer(uint32_t slot, Buffer* buffer, uint64_t offset, uint64_t size);
+    void setIndexBuffer(Buffer* buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
+
+    void draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+    void drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
+
+    bool isFinished() const;
+    std::unique_ptr<RenderBundle> finish();
+
+    WGPURenderBundleEncoder handle() const;
+
+private:
+    WGPURenderBundleEncoder m_encoder = nullptr;
+    bool m_finished = false;
+};
+
+} // namespace gfx::backend::webgpu::core
+
+#endif // GFX_WEBGPU_RENDER_BUNDLE_ENCODER_H
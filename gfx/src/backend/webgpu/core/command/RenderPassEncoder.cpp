@@ -1,8 +1,10 @@
 #include "RenderPassEncoder.h"
 
 #include "../command/CommandEncoder.h"
+#include "../command/RenderBundle.h"
 #include "../render/Framebuffer.h"
 #include "../render/RenderPass.h"
+#include "../render/RenderPipeline.h"
 #include "../resource/Buffer.h"
 #include "../resource/Texture.h"
 #include "../resource/TextureView.h"
@@ -10,11 +12,14 @@
 
 #include "../../../../common/Logger.h"
 
+#include <cstring>
 #include <stdexcept>
+#include <vector>
 
 namespace gfx::backend::webgpu::core {
 
 RenderPassEncoder::RenderPassEncoder(CommandEncoder* commandEncoder, RenderPass* renderPass, Framebuffer* framebuffer, const RenderPassEncoderBeginInfo& beginInfo)
+    : m_commandEncoder(commandEncoder)
 {
     // Combine render pass ops with framebuffer views
     const RenderPassCreateInfo& passInfo = renderPass->getCreateInfo();
@@ -91,9 +96,17 @@ RenderPassEncoder::~RenderPassEncoder()
     }
 }
 
-void RenderPassEncoder::setPipeline(WGPURenderPipeline pipeline)
+void RenderPassEncoder::setPipeline(RenderPipeline* pipeline)
 {
-    wgpuRenderPassEncoderSetPipeline(m_encoder, pipeline);
+    wgpuRenderPassEncoderSetPipeline(m_encoder, pipeline->handle());
+
+    // The data persists across pipelines, it only needs binding again if the group moved
+    std::optional<uint32_t> group = pipeline->immediateDataGroup();
+    m_immediateDataSize = pipeline->immediateDataSize();
+    if (group.has_value() && group != m_immediateDataGroup) {
+        m_immediateDataGroup = group;
+        bindImmediateData();
+    }
 }
 
 void RenderPassEncoder::setBindGroup(uint32_t index, WGPUBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
@@ -123,6 +136,28 @@ void RenderPassEncoder::setScissorRect(uint32_t x, uint32_t y, uint32_t width, u
     wgpuRenderPassEncoderSetScissorRect(m_encoder, x, y, width, height);
 }
 
+bool RenderPassEncoder::setImmediateData(uint32_t offset, const void* data, uint32_t size)
+{
+    if (!m_immediateDataGroup.has_value() || offset + size > m_immediateDataSize) {
+        return false;
+    }
+
+    // Every update gets its own slot, earlier draws keep reading the slot they were recorded with
+    std::memcpy(m_immediateData.data() + offset, data, size);
+    m_immediateDataSlot = m_commandEncoder->getImmediateDataRing()->push(m_immediateData.data(), MAX_IMMEDIATE_DATA_SIZE);
+    bindImmediateData();
+    return true;
+}
+
+void RenderPassEncoder::bindImmediateData()
+{
+    if (!m_immediateDataSlot.has_value()) {
+        // Nothing set yet, bind zeros so the pipeline's group is never left empty
+        m_immediateDataSlot = m_commandEncoder->getImmediateDataRing()->push(m_immediateData.data(), MAX_IMMEDIATE_DATA_SIZE);
+    }
+    wgpuRenderPassEncoderSetBindGroup(m_encoder, *m_immediateDataGroup, m_immediateDataSlot->bindGroup, 1, &m_immediateDataSlot->offset);
+}
+
 void RenderPassEncoder::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
 {
     wgpuRenderPassEncoderDraw(m_encoder, vertexCount, instanceCount, firstVertex, firstInstance);
@@ -143,6 +178,24 @@ void RenderPassEncoder::drawIndexedIndirect(WGPUBuffer buffer, uint64_t offset)
     wgpuRenderPassEncoderDrawIndexedIndirect(m_encoder, buffer, offset);
 }
 
+void RenderPassEncoder::multiDrawIndirect(WGPUBuffer buffer, uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    // vertexCount, instanceCount, firstVertex, firstInstance
+    const uint64_t step = stride != 0 ? stride : 4 * sizeof(uint32_t);
+    for (uint32_t i = 0; i < drawCount; ++i) {
+        wgpuRenderPassEncoderDrawIndirect(m_encoder, buffer, offset + i * step);
+    }
+}
+
+void RenderPassEncoder::multiDrawIndexedIndirect(WGPUBuffer buffer, uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    // indexCount, instanceCount, firstIndex, baseVertex, firstInstance
+    const uint64_t step = stride != 0 ? stride : 5 * sizeof(uint32_t);
+    for (uint32_t i = 0; i < drawCount; ++i) {
+        wgpuRenderPassEncoderDrawIndexedIndirect(m_encoder, buffer, offset + i * step);
+    }
+}
+
 void RenderPassEncoder::beginOcclusionQuery(WGPUQuerySet querySet, uint32_t queryIndex)
 {
     (void)querySet; // WebGPU doesn't use query set in begin call
@@ -154,6 +207,18 @@ void RenderPassEncoder::endOcclusionQuery()
     wgpuRenderPassEncoderEndOcclusionQuery(m_encoder);
 }
 
+void RenderPassEncoder::executeBundles(RenderBundle* const* bundles, uint32_t bundleCount)
+{
+    std::vector<WGPURenderBundle> handles(bundleCount);
+    for (uint32_t i = 0; i < bundleCount; ++i) {
+        handles[i] = bundles[i]->handle();
+    }
+    wgpuRenderPassEncoderExecuteBundles(m_encoder, bundleCount, handles.data());
+
+    // Executing bundles resets the pass state, the next pipeline has to bind the data again
+    m_immediateDataGroup.reset();
+}
+
 WGPURenderPassEncoder RenderPassEncoder::handle() const
 {
     return m_encoder;
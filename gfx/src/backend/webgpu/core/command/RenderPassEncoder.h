@@ -2,13 +2,19 @@
 #define GFX_WEBGPU_RENDER_PASS_ENCODER_H
 
 #include "../CoreTypes.h"
+#include "ImmediateDataRing.h"
+
+#include <array>
+#include <optional>
 
 namespace gfx::backend::webgpu::core {
 
 class Buffer;
 class CommandEncoder;
+class RenderBundle;
 class RenderPass;
 class Framebuffer;
+class RenderPipeline;
 
 class RenderPassEncoder {
 public:
@@ -19,27 +25,44 @@ public:
     RenderPassEncoder(CommandEncoder* commandEncoder, RenderPass* renderPass, Framebuffer* framebuffer, const RenderPassEncoderBeginInfo& beginInfo);
     ~RenderPassEncoder();
 
-    void setPipeline(WGPURenderPipeline pipeline);
+    // Throws std::runtime_error if immediate data cannot be rebound for the pipeline
+    void setPipeline(RenderPipeline* pipeline);
     void setBindGroup(uint32_t index, WGPUBindGroup bindGroup, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
     void setVertexBuffer(uint32_t slot, Buffer* buffer, uint64_t offset, uint64_t size);
     void setIndexBuffer(Buffer* buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
 
     void setViewport(float x, float y, float width, float height, float minDepth, float maxDepth);
     void setScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+    // Returns false if the bytes are outside the current pipeline's immediate data.
+    // Throws std::runtime_error if no immediate data slot can be allocated.
+    bool setImmediateData(uint32_t offset, const void* data, uint32_t size);
 
     void draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
     void drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
     void drawIndirect(WGPUBuffer buffer, uint64_t offset);
     void drawIndexedIndirect(WGPUBuffer buffer, uint64_t offset);
+    // WebGPU has no multi-draw, these issue one draw per command (stride 0 = tightly packed)
+    void multiDrawIndirect(WGPUBuffer buffer, uint64_t offset, uint32_t drawCount, uint32_t stride);
+    void multiDrawIndexedIndirect(WGPUBuffer buffer, uint64_t offset, uint32_t drawCount, uint32_t stride);
 
     void beginOcclusionQuery(WGPUQuerySet querySet, uint32_t queryIndex);
     void endOcclusionQuery();
 
+    void executeBundles(RenderBundle* const* bundles, uint32_t bundleCount);
+
     WGPURenderPassEncoder handle() const;
 
 private:
+    void bindImmediateData();
+
     WGPURenderPassEncoder m_encoder = nullptr;
     bool m_ended = false;
+
+    CommandEncoder* m_commandEncoder = nullptr; // Non-owning pointer
+    std::array<uint8_t, MAX_IMMEDIATE_DATA_SIZE> m_immediateData{};
+    std::optional<ImmediateDataSlot> m_immediateDataSlot; // Holds a copy of m_immediateData
+    std::optional<uint32_t> m_immediateDataGroup; // Where m_immediateDataSlot is bound
+    uint32_t m_immediateDataSize = 0;
 };
 
 } // namespace gfx::backend::webgpu::core
@@ -2,39 +2,125 @@
 
 #include "../system/Device.h"
 
+#include "common/Logger.h"
+
+#include <memory>
 #include <stdexcept>
+#include <string_view>
+#include <vector>
 
 namespace gfx::backend::webgpu::core {
 
-ComputePipeline::ComputePipeline(Device* device, const ComputePipelineCreateInfo& createInfo)
-{
-    WGPUComputePipelineDescriptor desc = WGPU_COMPUTE_PIPELINE_DESCRIPTOR_INIT;
-
-    // Create pipeline layout if bind group layouts are provided
-    WGPUPipelineLayout pipelineLayout = nullptr;
-    if (!createInfo.bindGroupLayouts.empty()) {
-        WGPUPipelineLayoutDescriptor layoutDesc = WGPU_PIPELINE_LAYOUT_DESCRIPTOR_INIT;
-        layoutDesc.bindGroupLayouts = createInfo.bindGroupLayouts.data();
-        layoutDesc.bindGroupLayoutCount = static_cast<uint32_t>(createInfo.bindGroupLayouts.size());
-        pipelineLayout = wgpuDeviceCreatePipelineLayout(device->handle(), &layoutDesc);
-        desc.layout = pipelineLayout;
-    }
+namespace {
+
+    // Owns everything a WGPUComputePipelineDescriptor points to
+    class ComputePipelineDescriptor {
+    public:
+        ComputePipelineDescriptor(const ComputePipelineDescriptor&) = delete;
+        ComputePipelineDescriptor& operator=(const ComputePipelineDescriptor&) = delete;
+
+        ComputePipelineDescriptor(Device* device, const ComputePipelineCreateInfo& createInfo)
+        {
+            // Immediate data is emulated with a uniform buffer in the group after the user's groups
+            std::vector<WGPUBindGroupLayout> bindGroupLayouts = createInfo.bindGroupLayouts;
+            if (createInfo.immediateDataSize > 0) {
+                bindGroupLayouts.push_back(device->getImmediateDataLayout());
+            }
+
+            // Create pipeline layout if bind group layouts are provided
+            if (!bindGroupLayouts.empty()) {
+                WGPUPipelineLayoutDescriptor layoutDesc = WGPU_PIPELINE_LAYOUT_DESCRIPTOR_INIT;
+                layoutDesc.bindGroupLayouts = bindGroupLayouts.data();
+                layoutDesc.bindGroupLayoutCount = static_cast<uint32_t>(bindGroupLayouts.size());
+                m_pipelineLayout = wgpuDeviceCreatePipelineLayout(device->handle(), &layoutDesc);
+                m_desc.layout = m_pipelineLayout;
+            }
 
-    desc.compute.module = createInfo.module;
-    desc.compute.entryPoint = { createInfo.entryPoint, WGPU_STRLEN };
+            m_desc.compute.module = createInfo.module;
+            m_desc.compute.entryPoint = { createInfo.entryPoint, WGPU_STRLEN };
+        }
 
-    m_pipeline = wgpuDeviceCreateComputePipeline(device->handle(), &desc);
+        ~ComputePipelineDescriptor()
+        {
+            // The pipeline holds its own reference
+            if (m_pipelineLayout) {
+                wgpuPipelineLayoutRelease(m_pipelineLayout);
+            }
+        }
 
-    // Release the pipeline layout if we created one (pipeline holds its own reference)
-    if (pipelineLayout) {
-        wgpuPipelineLayoutRelease(pipelineLayout);
+        const WGPUComputePipelineDescriptor* get() const
+        {
+            return &m_desc;
+        }
+
+    private:
+        WGPUComputePipelineDescriptor m_desc = WGPU_COMPUTE_PIPELINE_DESCRIPTOR_INIT;
+        WGPUPipelineLayout m_pipelineLayout = nullptr;
+    };
+
+    std::optional<uint32_t> immediateDataGroupFor(const ComputePipelineCreateInfo& createInfo)
+    {
+        if (createInfo.immediateDataSize == 0) {
+            return std::nullopt;
+        }
+        return static_cast<uint32_t>(createInfo.bindGroupLayouts.size());
     }
 
+    struct AsyncRequest {
+        ComputePipeline::CreateCallback onComplete;
+        std::optional<uint32_t> immediateDataGroup;
+        uint32_t immediateDataSize = 0;
+    };
+
+} // anonymous namespace
+
+ComputePipeline::ComputePipeline(Device* device, const ComputePipelineCreateInfo& createInfo)
+    : m_immediateDataGroup(immediateDataGroupFor(createInfo))
+    , m_immediateDataSize(createInfo.immediateDataSize)
+{
+    ComputePipelineDescriptor descriptor(device, createInfo);
+    m_pipeline = wgpuDeviceCreateComputePipeline(device->handle(), descriptor.get());
     if (!m_pipeline) {
         throw std::runtime_error("Failed to create WebGPU ComputePipeline");
     }
 }
 
+ComputePipeline::ComputePipeline(WGPUComputePipeline pipeline, std::optional<uint32_t> immediateDataGroup, uint32_t immediateDataSize)
+    : m_pipeline(pipeline)
+    , m_immediateDataGroup(immediateDataGroup)
+    , m_immediateDataSize(immediateDataSize)
+{
+}
+
+void ComputePipeline::createAsync(Device* device, const ComputePipelineCreateInfo& createInfo, CreateCallback onComplete)
+{
+    ComputePipelineDescriptor descriptor(device, createInfo);
+
+    auto request = std::make_unique<AsyncRequest>();
+    request->onComplete = std::move(onComplete);
+    request->immediateDataGroup = immediateDataGroupFor(createInfo);
+    request->immediateDataSize = createInfo.immediateDataSize;
+
+    WGPUCreateComputePipelineAsyncCallbackInfo callbackInfo = WGPU_CREATE_COMPUTE_PIPELINE_ASYNC_CALLBACK_INFO_INIT;
+    callbackInfo.mode = WGPUCallbackMode_AllowSpontaneous;
+    callbackInfo.callback = [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline pipeline, WGPUStringView message, void* userdata1, void*) {
+        std::unique_ptr<AsyncRequest> request(static_cast<AsyncRequest*>(userdata1));
+        if (status != WGPUCreatePipelineAsyncStatus_Success || !pipeline) {
+            gfx::common::Logger::instance().logError("Failed to create WebGPU ComputePipeline: {}", std::string_view(message.data, message.length));
+            if (pipeline) {
+                wgpuComputePipelineRelease(pipeline);
+            }
+            request->onComplete(nullptr);
+            return;
+        }
+        request->onComplete(new ComputePipeline(pipeline, request->immediateDataGroup, request->immediateDataSize));
+    };
+    callbackInfo.userdata1 = request.release();
+
+    WGPUFuture future = wgpuDeviceCreateComputePipelineAsync(device->handle(), descriptor.get(), callbackInfo);
+    device->addPendingFuture(future);
+}
+
 ComputePipeline::~ComputePipeline()
 {
     if (m_pipeline) {
@@ -47,4 +133,14 @@ WGPUComputePipeline ComputePipeline::handle() const
     return m_pipeline;
 }
 
+std::optional<uint32_t> ComputePipeline::immediateDataGroup() const
+{
+    return m_immediateDataGroup;
+}
+
+uint32_t ComputePipeline::immediateDataSize() const
+{
+    return m_immediateDataSize;
+}
+
 } // namespace gfx::backend::webgpu::core
\ No newline at end of file
@@ -3,12 +3,18 @@
 
 #include "../CoreTypes.h"
 
+#include <functional>
+#include <optional>
+
 namespace gfx::backend::webgpu::core {
 
 class Device;
 
 class ComputePipeline {
 public:
+    // pipeline is nullptr if creation failed
+    using CreateCallback = std::function<void(ComputePipeline* pipeline)>;
+
     // Prevent copying
     ComputePipeline(const ComputePipeline&) = delete;
     ComputePipeline& operator=(const ComputePipeline&) = delete;
@@ -16,10 +22,22 @@ public:
     ComputePipeline(Device* device, const ComputePipelineCreateInfo& createInfo);
     ~ComputePipeline();
 
+    // Compiles on the implementation's threads, onComplete may run on any thread.
+    // The device waits for it in waitIdle.
+    static void createAsync(Device* device, const ComputePipelineCreateInfo& createInfo, CreateCallback onComplete);
+
     WGPUComputePipeline handle() const;
 
+    // Bind group index of the emulated immediate data, empty if the pipeline declares none
+    std::optional<uint32_t> immediateDataGroup() const;
+    uint32_t immediateDataSize() const;
+
 private:
+    ComputePipeline(WGPUComputePipeline pipeline, std::optional<uint32_t> immediateDataGroup, uint32_t immediateDataSize);
+
     WGPUComputePipeline m_pipeline = nullptr;
+    std::optional<uint32_t> m_immediateDataGroup;
+    uint32_t m_immediateDataSize = 0;
 };
 
 } // namespace gfx::backend::webgpu::core
@@ -2,156 +2,239 @@
 
 #include "../system/Device.h"
 
+#include "common/Logger.h"
+
+#include <memory>
 #include <stdexcept>
+#include <string_view>
+#include <vector>
 
 namespace gfx::backend::webgpu::core {
 
-RenderPipeline::RenderPipeline(Device* device, const RenderPipelineCreateInfo& createInfo)
-{
-    WGPURenderPipelineDescriptor desc = WGPU_RENDER_PIPELINE_DESCRIPTOR_INIT;
-
-    // Create pipeline layout if bind group layouts are provided
-    WGPUPipelineLayout pipelineLayout = nullptr;
-    if (!createInfo.bindGroupLayouts.empty()) {
-        WGPUPipelineLayoutDescriptor layoutDesc = WGPU_PIPELINE_LAYOUT_DESCRIPTOR_INIT;
-        layoutDesc.bindGroupLayouts = createInfo.bindGroupLayouts.data();
-        layoutDesc.bindGroupLayoutCount = static_cast<uint32_t>(createInfo.bindGroupLayouts.size());
-        pipelineLayout = wgpuDeviceCreatePipelineLayout(device->handle(), &layoutDesc);
-        desc.layout = pipelineLayout;
-    }
+namespace {
+
+    // Owns everything a WGPURenderPipelineDescriptor points to
+    class RenderPipelineDescriptor {
+    public:
+        RenderPipelineDescriptor(const RenderPipelineDescriptor&) = delete;
+        RenderPipelineDescriptor& operator=(const RenderPipelineDescriptor&) = delete;
 
-    // Vertex state
-    WGPUVertexState vertexState = WGPU_VERTEX_STATE_INIT;
-    vertexState.module = createInfo.vertex.module;
-    vertexState.entryPoint = { createInfo.vertex.entryPoint, WGPU_STRLEN };
-
-    // Convert vertex buffers
-    std::vector<WGPUVertexBufferLayout> vertexBuffers;
-    std::vector<std::vector<WGPUVertexAttribute>> allAttributes;
-
-    if (!createInfo.vertex.buffers.empty()) {
-        vertexBuffers.reserve(createInfo.vertex.buffers.size());
-        allAttributes.reserve(createInfo.vertex.buffers.size());
-
-        for (const auto& buffer : createInfo.vertex.buffers) {
-            std::vector<WGPUVertexAttribute> attributes;
-            attributes.reserve(buffer.attributes.size());
-
-            for (const auto& attr : buffer.attributes) {
-                WGPUVertexAttribute wgpuAttr = WGPU_VERTEX_ATTRIBUTE_INIT;
-                wgpuAttr.format = attr.format;
-                wgpuAttr.offset = attr.offset;
-                wgpuAttr.shaderLocation = attr.shaderLocation;
-                attributes.push_back(wgpuAttr);
+        RenderPipelineDescriptor(Device* device, const RenderPipelineCreateInfo& createInfo);
+        ~RenderPipelineDescriptor()
+        {
+            // The pipeline holds its own reference
+            if (m_pipelineLayout) {
+                wgpuPipelineLayoutRelease(m_pipelineLayout);
             }
+        }
 
-            allAttributes.push_back(std::move(attributes));
+        const WGPURenderPipelineDescriptor* get() const
+        {
+            return &m_desc;
+        }
 
-            WGPUVertexBufferLayout wgpuBuffer = WGPU_VERTEX_BUFFER_LAYOUT_INIT;
-            wgpuBuffer.arrayStride = buffer.arrayStride;
-            wgpuBuffer.stepMode = buffer.stepMode;
-            wgpuBuffer.attributes = allAttributes.back().data();
-            wgpuBuffer.attributeCount = static_cast<uint32_t>(allAttributes.back().size());
-            vertexBuffers.push_back(wgpuBuffer);
+    private:
+        WGPURenderPipelineDescriptor m_desc = WGPU_RENDER_PIPELINE_DESCRIPTOR_INIT;
+        WGPUPipelineLayout m_pipelineLayout = nullptr;
+        std::vector<WGPUVertexBufferLayout> m_vertexBuffers;
+        std::vector<std::vector<WGPUVertexAttribute>> m_attributes;
+        WGPUFragmentState m_fragmentState = WGPU_FRAGMENT_STATE_INIT;
+        std::vector<WGPUColorTargetState> m_colorTargets;
+        std::vector<WGPUBlendState> m_blendStates;
+        WGPUDepthStencilState m_depthStencilState = WGPU_DEPTH_STENCIL_STATE_INIT;
+    };
+
+    RenderPipelineDescriptor::RenderPipelineDescriptor(Device* device, const RenderPipelineCreateInfo& createInfo)
+    {
+        // Immediate data is emulated with a uniform buffer in the group after the user's groups
+        std::vector<WGPUBindGroupLayout> bindGroupLayouts = createInfo.bindGroupLayouts;
+        if (createInfo.immediateDataSize > 0) {
+            bindGroupLayouts.push_back(device->getImmediateDataLayout());
         }
 
-        vertexState.buffers = vertexBuffers.data();
-        vertexState.bufferCount = static_cast<uint32_t>(vertexBuffers.size());
-    }
+        // Create pipeline layout if bind group layouts are provided
+        if (!bindGroupLayouts.empty()) {
+            WGPUPipelineLayoutDescriptor layoutDesc = WGPU_PIPELINE_LAYOUT_DESCRIPTOR_INIT;
+            layoutDesc.bindGroupLayouts = bindGroupLayouts.data();
+            layoutDesc.bindGroupLayoutCount = static_cast<uint32_t>(bindGroupLayouts.size());
+            m_pipelineLayout = wgpuDeviceCreatePipelineLayout(device->handle(), &layoutDesc);
+            m_desc.layout = m_pipelineLayout;
+        }
 
-    desc.vertex = vertexState;
-
-    // Fragment state (optional)
-    WGPUFragmentState fragmentState = WGPU_FRAGMENT_STATE_INIT;
-    std::vector<WGPUColorTargetState> colorTargets;
-    std::vector<WGPUBlendState> blendStates;
-
-    if (createInfo.fragment.has_value()) {
-        fragmentState.module = createInfo.fragment->module;
-        fragmentState.entryPoint = { createInfo.fragment->entryPoint, WGPU_STRLEN };
-
-        if (!createInfo.fragment->targets.empty()) {
-            colorTargets.reserve(createInfo.fragment->targets.size());
-
-            for (const auto& target : createInfo.fragment->targets) {
-                WGPUColorTargetState wgpuTarget = WGPU_COLOR_TARGET_STATE_INIT;
-                wgpuTarget.format = target.format;
-                wgpuTarget.writeMask = target.writeMask;
-
-                if (target.blend.has_value()) {
-                    WGPUBlendState blend = WGPU_BLEND_STATE_INIT;
-                    blend.color.operation = target.blend->color.operation;
-                    blend.color.srcFactor = target.blend->color.srcFactor;
-                    blend.color.dstFactor = target.blend->color.dstFactor;
-                    blend.alpha.operation = target.blend->alpha.operation;
-                    blend.alpha.srcFactor = target.blend->alpha.srcFactor;
-                    blend.alpha.dstFactor = target.blend->alpha.dstFactor;
-                    blendStates.push_back(blend);
-                    wgpuTarget.blend = &blendStates.back();
+        // Vertex state
+        WGPUVertexState& vertexState = m_desc.vertex;
+        vertexState.module = createInfo.vertex.module;
+        vertexState.entryPoint = { createInfo.vertex.entryPoint, WGPU_STRLEN };
+
+        // Convert vertex buffers
+        if (!createInfo.vertex.buffers.empty()) {
+            m_vertexBuffers.reserve(createInfo.vertex.buffers.size());
+            m_attributes.reserve(createInfo.vertex.buffers.size());
+
+            for (const auto& buffer : createInfo.vertex.buffers) {
+                std::vector<WGPUVertexAttribute> attributes;
+                attributes.reserve(buffer.attributes.size());
+
+                for (const auto& attr : buffer.attributes) {
+                    WGPUVertexAttribute wgpuAttr = WGPU_VERTEX_ATTRIBUTE_INIT;
+                    wgpuAttr.format = attr.format;
+                    wgpuAttr.offset = attr.offset;
+                    wgpuAttr.shaderLocation = attr.shaderLocation;
+                    attributes.push_back(wgpuAttr);
                 }
 
-                colorTargets.push_back(wgpuTarget);
+                m_attributes.push_back(std::move(attributes));
+
+                WGPUVertexBufferLayout wgpuBuffer = WGPU_VERTEX_BUFFER_LAYOUT_INIT;
+                wgpuBuffer.arrayStride = buffer.arrayStride;
+                wgpuBuffer.stepMode = buffer.stepMode;
+                wgpuBuffer.attributes = m_attributes.back().data();
+                wgpuBuffer.attributeCount = static_cast<uint32_t>(m_attributes.back().size());
+                m_vertexBuffers.push_back(wgpuBuffer);
             }
 
-            fragmentState.targets = colorTargets.data();
-            fragmentState.targetCount = static_cast<uint32_t>(colorTargets.size());
+            vertexState.buffers = m_vertexBuffers.data();
+            vertexState.bufferCount = static_cast<uint32_t>(m_vertexBuffers.size());
         }
 
-        desc.fragment = &fragmentState;
-    }
+        // Fragment state (optional)
+        if (createInfo.fragment.has_value()) {
+            m_fragmentState.module = createInfo.fragment->module;
+            m_fragmentState.entryPoint = { createInfo.fragment->entryPoint, WGPU_STRLEN };
+
+            if (!createInfo.fragment->targets.empty()) {
+                // Targets point into m_blendStates, so it must not reallocate
+                m_colorTargets.reserve(createInfo.fragment->targets.size());
+                m_blendStates.reserve(createInfo.fragment->targets.size());
+
+                for (const auto& target : createInfo.fragment->targets) {
+                    WGPUColorTargetState wgpuTarget = WGPU_COLOR_TARGET_STATE_INIT;
+                    wgpuTarget.format = target.format;
+                    wgpuTarget.writeMask = target.writeMask;
+
+                    if (target.blend.has_value()) {
+                        WGPUBlendState blend = WGPU_BLEND_STATE_INIT;
+                        blend.color.operation = target.blend->color.operation;
+                        blend.color.srcFactor = target.blend->color.srcFactor;
+                        blend.color.dstFactor = target.blend->color.dstFactor;
+                        blend.alpha.operation = target.blend->alpha.operation;
+                        blend.alpha.srcFactor = target.blend->alpha.srcFactor;
+                        blend.alpha.dstFactor = target.blend->alpha.dstFactor;
+                        m_blendStates.push_back(blend);
+                        wgpuTarget.blend = &m_blendStates.back();
+                    }
+
+                    m_colorTargets.push_back(wgpuTarget);
+                }
 
-    // Primitive state
-    WGPUPrimitiveState primitiveState = WGPU_PRIMITIVE_STATE_INIT;
-    primitiveState.topology = createInfo.primitive.topology;
-    primitiveState.frontFace = createInfo.primitive.frontFace;
-    primitiveState.cullMode = createInfo.primitive.cullMode;
-    primitiveState.stripIndexFormat = createInfo.primitive.stripIndexFormat;
-    desc.primitive = primitiveState;
-
-    // Depth/stencil state (optional)
-    WGPUDepthStencilState depthStencilState = WGPU_DEPTH_STENCIL_STATE_INIT;
-    if (createInfo.depthStencil.has_value()) {
-        depthStencilState.format = createInfo.depthStencil->format;
-        depthStencilState.depthWriteEnabled = createInfo.depthStencil->depthWriteEnabled ? WGPUOptionalBool_True : WGPUOptionalBool_False;
-        depthStencilState.depthCompare = createInfo.depthStencil->depthCompare;
-
-        depthStencilState.stencilFront.compare = createInfo.depthStencil->stencilFront.compare;
-        depthStencilState.stencilFront.failOp = createInfo.depthStencil->stencilFront.failOp;
-        depthStencilState.stencilFront.depthFailOp = createInfo.depthStencil->stencilFront.depthFailOp;
-        depthStencilState.stencilFront.passOp = createInfo.depthStencil->stencilFront.passOp;
-
-        depthStencilState.stencilBack.compare = createInfo.depthStencil->stencilBack.compare;
-        depthStencilState.stencilBack.failOp = createInfo.depthStencil->stencilBack.failOp;
-        depthStencilState.stencilBack.depthFailOp = createInfo.depthStencil->stencilBack.depthFailOp;
-        depthStencilState.stencilBack.passOp = createInfo.depthStencil->stencilBack.passOp;
-
-        depthStencilState.stencilReadMask = createInfo.depthStencil->stencilReadMask;
-        depthStencilState.stencilWriteMask = createInfo.depthStencil->stencilWriteMask;
-        depthStencilState.depthBias = createInfo.depthStencil->depthBias;
-        depthStencilState.depthBiasSlopeScale = createInfo.depthStencil->depthBiasSlopeScale;
-        depthStencilState.depthBiasClamp = createInfo.depthStencil->depthBiasClamp;
-
-        desc.depthStencil = &depthStencilState;
-    }
+                m_fragmentState.targets = m_colorTargets.data();
+                m_fragmentState.targetCount = static_cast<uint32_t>(m_colorTargets.size());
+            }
 
-    // Multisample state
-    WGPUMultisampleState multisampleState = WGPU_MULTISAMPLE_STATE_INIT;
-    // WebGPU requires sampleCount >= 1, clamp to valid range
-    multisampleState.count = std::max<uint32_t>(1, createInfo.sampleCount);
-    desc.multisample = multisampleState;
+            m_desc.fragment = &m_fragmentState;
+        }
 
-    m_pipeline = wgpuDeviceCreateRenderPipeline(device->handle(), &desc);
+        // Primitive state
+        WGPUPrimitiveState& primitiveState = m_desc.primitive;
+        primitiveState.topology = createInfo.primitive.topology;
+        primitiveState.frontFace = createInfo.primitive.frontFace;
+        primitiveState.cullMode = createInfo.primitive.cullMode;
+        primitiveState.stripIndexFormat = createInfo.primitive.stripIndexFormat;
+
+        // Depth/stencil state (optional)
+        if (createInfo.depthStencil.has_value()) {
+            m_depthStencilState.format = createInfo.depthStencil->format;
+            m_depthStencilState.depthWriteEnabled = createInfo.depthStencil->depthWriteEnabled ? WGPUOptionalBool_True : WGPUOptionalBool_False;
+            m_depthStencilState.depthCompare = createInfo.depthStencil->depthCompare;
+
+            m_depthStencilState.stencilFront.compare = createInfo.depthStencil->stencilFront.compare;
+            m_depthStencilState.stencilFront.failOp = createInfo.depthStencil->stencilFront.failOp;
+            m_depthStencilState.stencilFront.depthFailOp = createInfo.depthStencil->stencilFront.depthFailOp;
+            m_depthStencilState.stencilFront.passOp = createInfo.depthStencil->stencilFront.passOp;
+
+            m_depthStencilState.stencilBack.compare = createInfo.depthStencil->stencilBack.compare;
+            m_depthStencilState.stencilBack.failOp = createInfo.depthStencil->stencilBack.failOp;
+            m_depthStencilState.stencilBack.depthFailOp = createInfo.depthStencil->stencilBack.depthFailOp;
+            m_depthStencilState.stencilBack.passOp = createInfo.depthStencil->stencilBack.passOp;
+
+            m_depthStencilState.stencilReadMask = createInfo.depthStencil->stencilReadMask;
+            m_depthStencilState.stencilWriteMask = createInfo.depthStencil->stencilWriteMask;
+            m_depthStencilState.depthBias = createInfo.depthStencil->depthBias;
+            m_depthStencilState.depthBiasSlopeScale = createInfo.depthStencil->depthBiasSlopeScale;
+            m_depthStencilState.depthBiasClamp = createInfo.depthStencil->depthBiasClamp;
+
+            m_desc.depthStencil = &m_depthStencilState;
+        }
+
+        // Multisample state
+        WGPUMultisampleState& multisampleState = m_desc.multisample;
+        // WebGPU requires sampleCount >= 1, clamp to valid range
+        multisampleState.count = std::max<uint32_t>(1, createInfo.sampleCount);
+    }
 
-    // Release the pipeline layout if we created one (pipeline holds its own reference)
-    if (pipelineLayout) {
-        wgpuPipelineLayoutRelease(pipelineLayout);
+    std::optional<uint32_t> immediateDataGroupFor(const RenderPipelineCreateInfo& createInfo)
+    {
+        if (createInfo.immediateDataSize == 0) {
+            return std::nullopt;
+        }
+        return static_cast<uint32_t>(createInfo.bindGroupLayouts.size());
     }
 
+    struct AsyncRequest {
+        RenderPipeline::CreateCallback onComplete;
+        std::optional<uint32_t> immediateDataGroup;
+        uint32_t immediateDataSize = 0;
+    };
+
+} // anonymous namespace
+
+RenderPipeline::RenderPipeline(Device* device, const RenderPipelineCreateInfo& createInfo)
+    : m_immediateDataGroup(immediateDataGroupFor(createInfo))
+    , m_immediateDataSize(createInfo.immediateDataSize)
+{
+    RenderPipelineDescriptor descriptor(device, createInfo);
+    m_pipeline = wgpuDeviceCreateRenderPipeline(device->handle(), descriptor.get());
     if (!m_pipeline) {
         throw std::runtime_error("Failed to create WebGPU RenderPipeline");
     }
 }
 
+RenderPipeline::RenderPipeline(WGPURenderPipeline pipeline, std::optional<uint32_t> immediateDataGroup, uint32_t immediateDataSize)
+    : m_pipeline(pipeline)
+    , m_immediateDataGroup(immediateDataGroup)
+    , m_immediateDataSize(immediateDataSize)
+{
+}
+
+void RenderPipeline::createAsync(Device* device, const RenderPipelineCreateInfo& createInfo, CreateCallback onComplete)
+{
+    RenderPipelineDescriptor descriptor(device, createInfo);
+
+    auto request = std::make_unique<AsyncRequest>();
+    request->onComplete = std::move(onComplete);
+    request->immediateDataGroup = immediateDataGroupFor(createInfo);
+    request->immediateDataSize = createInfo.immediateDataSize;
+
+    WGPUCreateRenderPipelineAsyncCallbackInfo callbackInfo = WGPU_CREATE_RENDER_PIPELINE_ASYNC_CALLBACK_INFO_INIT;
+    callbackInfo.mode = WGPUCallbackMode_AllowSpontaneous;
+    callbackInfo.callback = [](WGPUCreatePipelineAsyncStatus status, WGPURenderPipeline pipeline, WGPUStringView message, void* userdata1, void*) {
+        std::unique_ptr<AsyncRequest> request(static_cast<AsyncRequest*>(userdata1));
+        if (status != WGPUCreatePipelineAsyncStatus_Success || !pipeline) {
+            gfx::common::Logger::instance().logError("Failed to create WebGPU RenderPipeline: {}", std::string_view(message.data, message.length));
+            if (pipeline) {
+                wgpuRenderPipelineRelease(pipeline);
+            }
+            request->onComplete(nullptr);
+            return;
+        }
+        request->onComplete(new RenderPipeline(pipeline, request->immediateDataGroup, request->immediateDataSize));
+    };
+    callbackInfo.userdata1 = request.release();
+
+    WGPUFuture future = wgpuDeviceCreateRenderPipelineAsync(device->handle(), descriptor.get(), callbackInfo);
+    device->addPendingFuture(future);
+}
+
 RenderPipeline::~RenderPipeline()
 {
     if (m_pipeline) {
@@ -164,4 +247,14 @@ WGPURenderPipeline RenderPipeline::handle() const
     return m_pipeline;
 }
 
+std::optional<uint32_t> RenderPipeline::immediateDataGroup() const
+{
+    return m_immediateDataGroup;
+}
+
+uint32_t RenderPipeline::immediateDataSize() const
+{
+    return m_immediateDataSize;
+}
+
 } // namespace gfx::backend::webgpu::core
\ No newline at end of file
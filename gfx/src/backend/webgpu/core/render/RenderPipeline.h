@@ -3,12 +3,18 @@
 
 #include "../CoreTypes.h"
 
+#include <functional>
+#include <optional>
+
 namespace gfx::backend::webgpu::core {
 
 class Device;
 
 class RenderPipeline {
 public:
+    // pipeline is nullptr if creation failed
+    using CreateCallback = std::function<void(RenderPipeline* pipeline)>;
+
     // Prevent copying
     RenderPipeline(const RenderPipeline&) = delete;
     RenderPipeline& operator=(const RenderPipeline&) = delete;
@@ -16,10 +22,22 @@ public:
     RenderPipeline(Device* device, const RenderPipelineCreateInfo& createInfo);
     ~RenderPipeline();
 
+    // Compiles on the implementation's threads, onComplete may run on any thread.
+    // The device waits for it in waitIdle.
+    static void createAsync(Device* device, const RenderPipelineCreateInfo& createInfo, CreateCallback onComplete);
+
     WGPURenderPipeline handle() const;
 
+    // Bind group index of the emulated immediate data, empty if the pipeline declares none
+    std::optional<uint32_t> immediateDataGroup() const;
+    uint32_t immediateDataSize() const;
+
 private:
+    RenderPipeline(WGPURenderPipeline pipeline, std::optional<uint32_t> immediateDataGroup, uint32_t immediateDataSize);
+
     WGPURenderPipeline m_pipeline = nullptr;
+    std::optional<uint32_t> m_immediateDataGroup;
+    uint32_t m_immediateDataSize = 0;
 };
 
 } // namespace gfx::backend::webgpu::core
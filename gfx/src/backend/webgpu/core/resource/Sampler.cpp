@@ -1,37 +1,21 @@
 #include "Sampler.h"
 
 #include "../system/Device.h"
-
-#include <algorithm>
-#include <stdexcept>
+#include "../system/SamplerCache.h"
 
 namespace gfx::backend::webgpu::core {
 
 Sampler::Sampler(Device* device, const SamplerCreateInfo& createInfo)
     : m_device(device)
 {
-    WGPUSamplerDescriptor desc = WGPU_SAMPLER_DESCRIPTOR_INIT;
-    desc.addressModeU = createInfo.addressModeU;
-    desc.addressModeV = createInfo.addressModeV;
-    desc.addressModeW = createInfo.addressModeW;
-    desc.magFilter = createInfo.magFilter;
-    desc.minFilter = createInfo.minFilter;
-    desc.mipmapFilter = createInfo.mipmapFilter;
-    desc.lodMinClamp = createInfo.lodMinClamp;
-    desc.lodMaxClamp = createInfo.lodMaxClamp;
-    desc.maxAnisotropy = static_cast<uint16_t>(std::max(1u, createInfo.maxAnisotropy));
-    desc.compare = createInfo.compareFunction;
-
-    m_sampler = wgpuDeviceCreateSampler(m_device->handle(), &desc);
-    if (!m_sampler) {
-        throw std::runtime_error("Failed to create WebGPU sampler");
-    }
+    // Identical create infos share one WGPUSampler
+    m_sampler = m_device->getSamplerCache()->acquire(createInfo);
 }
 
 Sampler::~Sampler()
 {
     if (m_sampler) {
-        wgpuSamplerRelease(m_sampler);
+        m_device->getSamplerCache()->release(m_sampler);
     }
 }
 
@@ -40,4 +24,4 @@ WGPUSampler Sampler::handle() const
     return m_sampler;
 }
 
-} // namespace gfx::backend::webgpu::core
\ No newline at end of file
+} // namespace gfx::backend::webgpu::core
@@ -9,29 +9,70 @@ Fence::Fence(bool signaled)
 
 bool Fence::isSignaled() const
 {
-    return m_signaled;
+    // A zero timeout only polls
+    return waitForFuture(0);
+}
+
+bool Fence::isPending() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_pending;
 }
 
 void Fence::signal()
 {
+    std::scoped_lock lock(m_mutex);
     m_signaled = true;
+    m_pending = false;
 }
 
 void Fence::reset()
 {
+    std::scoped_lock lock(m_mutex);
     m_signaled = false;
+    m_pending = false;
 }
 
 bool Fence::wait(uint64_t timeoutNs)
 {
-    // WebGPU fence is mock implementation - always immediately satisfied
-    (void)timeoutNs;
-    return m_signaled;
+    return waitForFuture(timeoutNs);
+}
+
+void Fence::signalOnCompletion(WGPUInstance instance, WGPUFuture future)
+{
+    std::scoped_lock lock(m_mutex);
+    m_signaled = false;
+    m_pending = true;
+    m_instance = instance;
+    m_future = future;
 }
 
-void Fence::setSignaled(bool signaled)
+bool Fence::waitForFuture(uint64_t timeoutNs) const
 {
-    m_signaled = signaled;
+    WGPUInstance instance = nullptr;
+    WGPUFutureWaitInfo waitInfo = WGPU_FUTURE_WAIT_INFO_INIT;
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_signaled || !m_pending) {
+            return m_signaled;
+        }
+        instance = m_instance;
+        waitInfo.future = m_future;
+    }
+
+    // Waited on without the lock so other threads can poll or wait meanwhile. The future also
+    // completes when the device is lost, which signals the fence rather than hanging waits.
+    WGPUWaitStatus status = wgpuInstanceWaitAny(instance, 1, &waitInfo, timeoutNs);
+    if (status != WGPUWaitStatus_Success || !waitInfo.completed) {
+        return false;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    if (m_pending && m_future.id == waitInfo.future.id) {
+        m_signaled = true;
+        m_pending = false;
+    }
+    return m_signaled;
 }
 
-} // namespace gfx::backend::webgpu::core
\ No newline at end of file
+} // namespace gfx::backend::webgpu::core
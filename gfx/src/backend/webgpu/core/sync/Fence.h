@@ -3,8 +3,13 @@
 
 #include "../CoreTypes.h"
 
+#include <mutex>
+
 namespace gfx::backend::webgpu::core {
 
+// WebGPU has no fences. A submit that signals one hands it the future of a
+// wgpuQueueOnSubmittedWorkDone instead of waiting, and the fence is signaled once that
+// future completed: isSignaled() polls it and wait() waits on it with the given timeout.
 class Fence {
 public:
     // Prevent copying
@@ -15,15 +20,26 @@ public:
     ~Fence() = default;
 
     bool isSignaled() const;
+    // Whether a submit handed the fence a future that nobody saw complete yet, does not poll
+    bool isPending() const;
     void signal();
     void reset();
     bool wait(uint64_t timeoutNs);
 
+    // future must come from a work-done callback in WGPUCallbackMode_WaitAnyOnly
+    void signalOnCompletion(WGPUInstance instance, WGPUFuture future);
+
 private:
-    void setSignaled(bool signaled);
-    bool m_signaled = false;
+    // Returns whether the fence is signaled after waiting up to timeoutNs for the pending future
+    bool waitForFuture(uint64_t timeoutNs) const;
+
+    mutable std::mutex m_mutex;
+    mutable bool m_signaled = false;
+    mutable bool m_pending = false;
+    WGPUInstance m_instance = nullptr;
+    WGPUFuture m_future = {};
 };
 
 } // namespace gfx::backend::webgpu::core
 
-#endif // GFX_WEBGPU_FENCE_H
\ No newline at end of file
+#endif // GFX_WEBGPU_FENCE_H
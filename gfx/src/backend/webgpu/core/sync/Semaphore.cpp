@@ -1,5 +1,9 @@
 #include "Semaphore.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 namespace gfx::backend::webgpu::core {
 
 Semaphore::Semaphore(SemaphoreType type, uint64_t value)
@@ -15,11 +19,15 @@ SemaphoreType Semaphore::getType() const
 
 uint64_t Semaphore::getValue() const
 {
+    processPendingSignals(0, 0);
+
+    std::scoped_lock lock(m_mutex);
     return m_value;
 }
 
 void Semaphore::signal(uint64_t value)
 {
+    std::scoped_lock lock(m_mutex);
     if (m_type == SemaphoreType::Binary) {
         // Binary semaphores always signal to 1
         m_value = 1;
@@ -35,10 +43,11 @@ void Semaphore::signal(uint64_t value)
 
 bool Semaphore::wait(uint64_t value, uint64_t timeoutNs)
 {
-    // WebGPU doesn't support explicit semaphore waiting
-    // For API consistency, check if the wait condition is satisfied
-    (void)timeoutNs;
+    if (m_type == SemaphoreType::Timeline) {
+        processPendingSignals(value, timeoutNs);
+    }
 
+    std::scoped_lock lock(m_mutex);
     if (m_type == SemaphoreType::Timeline) {
         return m_value >= value;
     } else {
@@ -46,9 +55,54 @@ bool Semaphore::wait(uint64_t value, uint64_t timeoutNs)
     }
 }
 
-void Semaphore::setValue(uint64_t value)
+void Semaphore::signalOnCompletion(WGPUInstance instance, WGPUFuture future, uint64_t value)
 {
-    m_value = value;
+    std::scoped_lock lock(m_mutex);
+    m_instance = instance;
+    m_pendingSignals.push_back({ future, value });
+}
+
+void Semaphore::processPendingSignals(uint64_t value, uint64_t timeoutNs) const
+{
+    WGPUInstance instance = nullptr;
+    std::vector<WGPUFutureWaitInfo> waitInfos;
+    size_t target = SIZE_MAX;
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_pendingSignals.empty() || (value > 0 && m_value >= value)) {
+            return;
+        }
+        instance = m_instance;
+        for (const PendingSignal& pending : m_pendingSignals) {
+            if (target == SIZE_MAX && pending.value >= value) {
+                target = waitInfos.size();
+            }
+            WGPUFutureWaitInfo waitInfo = WGPU_FUTURE_WAIT_INFO_INIT;
+            waitInfo.future = pending.future;
+            waitInfos.push_back(waitInfo);
+        }
+    }
+
+    // Work completes in submission order, so only the first signal reaching value is waited on
+    if (timeoutNs > 0 && target < waitInfos.size()) {
+        wgpuInstanceWaitAny(instance, 1, &waitInfos[target], timeoutNs);
+    }
+    // A zero timeout only polls, marking the futures that already completed
+    wgpuInstanceWaitAny(instance, waitInfos.size(), waitInfos.data(), 0);
+
+    std::scoped_lock lock(m_mutex);
+    for (const WGPUFutureWaitInfo& waitInfo : waitInfos) {
+        if (!waitInfo.completed) {
+            continue;
+        }
+        auto it = std::find_if(m_pendingSignals.begin(), m_pendingSignals.end(), [&](const PendingSignal& pending) {
+            return pending.future.id == waitInfo.future.id;
+        });
+        if (it != m_pendingSignals.end()) {
+            m_value = std::max(m_value, it->value);
+            m_pendingSignals.erase(it);
+        }
+    }
 }
 
-} // namespace gfx::backend::webgpu::core
\ No newline at end of file
+} // namespace gfx::backend::webgpu::core
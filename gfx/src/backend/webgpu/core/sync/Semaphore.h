@@ -3,8 +3,14 @@
 
 #include "../CoreTypes.h"
 
+#include <deque>
+#include <mutex>
+
 namespace gfx::backend::webgpu::core {
 
+// Submits run in order on WebGPU, so semaphores never make the GPU wait. Timeline values
+// signaled by a submit are reached once its work-done future completed, which getValue()
+// polls and wait() waits on with the given timeout.
 class Semaphore {
 public:
     // Prevent copying
@@ -19,14 +25,28 @@ public:
     void signal(uint64_t value = 0);
     bool wait(uint64_t value = 0, uint64_t timeoutNs = UINT64_MAX);
 
+    // Timeline semaphores only. future must come from a work-done callback in
+    // WGPUCallbackMode_WaitAnyOnly.
+    void signalOnCompletion(WGPUInstance instance, WGPUFuture future, uint64_t value);
+
 private:
-    void setValue(uint64_t value);
+    struct PendingSignal {
+        WGPUFuture future = {};
+        uint64_t value = 0;
+    };
+
+    // Waits up to timeoutNs for the first pending signal reaching value, then applies every
+    // pending signal that completed
+    void processPendingSignals(uint64_t value, uint64_t timeoutNs) const;
 
 private:
     SemaphoreType m_type = SemaphoreType::Binary;
-    uint64_t m_value = 0;
+    mutable std::mutex m_mutex;
+    mutable uint64_t m_value = 0;
+    WGPUInstance m_instance = nullptr;
+    mutable std::deque<PendingSignal> m_pendingSignals;
 };
 
 } // namespace gfx::backend::webgpu::core
 
-#endif // GFX_WEBGPU_SEMAPHORE_H
\ No newline at end of file
+#endif // GFX_WEBGPU_SEMAPHORE_H
@@ -3,12 +3,14 @@
 #include "Adapter.h"
 #include "Instance.h"
 #include "Queue.h"
+#include "SamplerCache.h"
 
 #include "../util/Blit.h"
 
 #include "common/Logger.h"
 
 #include <stdexcept>
+#include <vector>
 
 namespace gfx::backend::webgpu::core {
 
@@ -54,9 +56,6 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
     wgpuDesc.nextInChain = reinterpret_cast<WGPUChainedStruct*>(&deviceTogglesDesc);
 #endif
 
-    // DeviceCreateInfo is currently empty, but we keep it for future extensibility
-    (void)createInfo;
-
     struct DeviceRequestContext {
         WGPUDevice* outDevice;
         bool completed;
@@ -106,10 +105,35 @@ Device::Device(Adapter* adapter, const DeviceCreateInfo& createInfo)
 
     // Create blit helper
     m_blit = std::make_unique<Blit>(m_device);
+
+    m_samplerCache = std::make_unique<SamplerCache>(m_device);
+
+    // Pipelines with immediate data get this layout appended after their own bind group layouts
+    WGPUBindGroupLayoutEntry immediateDataEntry = WGPU_BIND_GROUP_LAYOUT_ENTRY_INIT;
+    immediateDataEntry.binding = 0;
+    immediateDataEntry.visibility = WGPUShaderStage_Vertex | WGPUShaderStage_Fragment | WGPUShaderStage_Compute;
+    immediateDataEntry.buffer.type = WGPUBufferBindingType_Uniform;
+    immediateDataEntry.buffer.hasDynamicOffset = WGPU_TRUE;
+
+    WGPUBindGroupLayoutDescriptor immediateDataLayoutDesc = WGPU_BIND_GROUP_LAYOUT_DESCRIPTOR_INIT;
+    immediateDataLayoutDesc.entryCount = 1;
+    immediateDataLayoutDesc.entries = &immediateDataEntry;
+    m_immediateDataLayout = wgpuDeviceCreateBindGroupLayout(m_device, &immediateDataLayoutDesc);
+    if (!m_immediateDataLayout) {
+        throw std::runtime_error("Failed to create immediate data bind group layout");
+    }
+
+    if (createInfo.pipelineCacheDataAccepted) {
+        *createInfo.pipelineCacheDataAccepted = false;
+    }
 }
 
 Device::~Device()
 {
+    m_samplerCache.reset();
+    if (m_immediateDataLayout) {
+        wgpuBindGroupLayoutRelease(m_immediateDataLayout);
+    }
     if (m_device) {
         // Release queue first
         m_queue.reset();
@@ -144,8 +168,26 @@ WGPULimits Device::getLimits() const
     return limits;
 }
 
+namespace {
+    // Prune completed futures once this many are pending
+    constexpr size_t PENDING_FUTURE_PRUNE_THRESHOLD = 64;
+} // anonymous namespace
+
 void Device::waitIdle() const
 {
+    WGPUInstance instance = m_adapter->getInstance()->handle();
+
+    std::vector<WGPUFuture> pendingFutures;
+    {
+        std::scoped_lock lock(m_pendingFuturesMutex);
+        pendingFutures.swap(m_pendingFutures);
+    }
+    for (WGPUFuture pendingFuture : pendingFutures) {
+        WGPUFutureWaitInfo pendingInfo = WGPU_FUTURE_WAIT_INFO_INIT;
+        pendingInfo.future = pendingFuture;
+        wgpuInstanceWaitAny(instance, 1, &pendingInfo, UINT64_MAX);
+    }
+
     WGPUQueueWorkDoneCallbackInfo callbackInfo = WGPU_QUEUE_WORK_DONE_CALLBACK_INFO_INIT;
     callbackInfo.mode = WGPUCallbackMode_WaitAnyOnly;
     callbackInfo.callback = [](WGPUQueueWorkDoneStatus status, WGPUStringView message, void* userdata1, void* userdata2) {
@@ -157,17 +199,56 @@ void Device::waitIdle() const
     WGPUFuture future = wgpuQueueOnSubmittedWorkDone(m_queue->handle(), callbackInfo);
 
     // Wait for the work to complete
-    WGPUInstance instance = m_adapter->getInstance()->handle();
     WGPUFutureWaitInfo waitInfo = WGPU_FUTURE_WAIT_INFO_INIT;
     waitInfo.future = future;
     wgpuInstanceWaitAny(instance, 1, &waitInfo, UINT64_MAX);
 }
 
+void Device::poll() const
+{
+    wgpuInstanceProcessEvents(m_adapter->getInstance()->handle());
+}
+
+void Device::addPendingFuture(WGPUFuture future)
+{
+    std::scoped_lock lock(m_pendingFuturesMutex);
+
+    if (m_pendingFutures.size() >= PENDING_FUTURE_PRUNE_THRESHOLD) {
+        std::vector<WGPUFutureWaitInfo> waitInfos;
+        waitInfos.reserve(m_pendingFutures.size());
+        for (WGPUFuture pendingFuture : m_pendingFutures) {
+            WGPUFutureWaitInfo waitInfo = WGPU_FUTURE_WAIT_INFO_INIT;
+            waitInfo.future = pendingFuture;
+            waitInfos.push_back(waitInfo);
+        }
+        // A zero timeout only polls, marking the futures that already completed
+        wgpuInstanceWaitAny(m_adapter->getInstance()->handle(), waitInfos.size(), waitInfos.data(), 0);
+
+        m_pendingFutures.clear();
+        for (const WGPUFutureWaitInfo& waitInfo : waitInfos) {
+            if (!waitInfo.completed) {
+                m_pendingFutures.push_back(waitInfo.future);
+            }
+        }
+    }
+    m_pendingFutures.push_back(future);
+}
+
+SamplerCache* Device::getSamplerCache()
+{
+    return m_samplerCache.get();
+}
+
 Blit* Device::getBlit()
 {
     return m_blit.get();
 }
 
+WGPUBindGroupLayout Device::getImmediateDataLayout() const
+{
+    return m_immediateDataLayout;
+}
+
 bool Device::supportsShaderFormat(ShaderSourceType format) const
 {
 #ifdef __EMSCRIPTEN__
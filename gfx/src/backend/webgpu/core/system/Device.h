@@ -4,12 +4,15 @@
 #include "../CoreTypes.h"
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace gfx::backend::webgpu::core {
 
 class Adapter;
 class Queue;
 class Blit;
+class SamplerCache;
 
 class Device {
 public:
@@ -28,16 +31,33 @@ public:
     WGPULimits getLimits() const;
 
     void waitIdle() const;
+    // Runs callbacks that are ready without waiting. Destroyed objects need nothing here,
+    // the implementation keeps them alive while submitted work uses them.
+    void poll() const;
 
     bool supportsShaderFormat(ShaderSourceType format) const;
 
     Blit* getBlit();
+    SamplerCache* getSamplerCache();
+
+    // Layout of the dynamic-offset uniform buffer that emulates immediate data
+    WGPUBindGroupLayout getImmediateDataLayout() const;
+
+    // Futures of callbacks that must run before waitIdle returns (e.g. async pipeline
+    // creation or submitted work). They must be created with WGPUCallbackMode_AllowSpontaneous,
+    // or WGPUCallbackMode_WaitAnyOnly if nothing depends on the callback running otherwise.
+    void addPendingFuture(WGPUFuture future);
 
 private:
     WGPUDevice m_device = nullptr;
     Adapter* m_adapter = nullptr; // Non-owning pointer
     std::unique_ptr<Queue> m_queue;
     std::unique_ptr<Blit> m_blit;
+    std::unique_ptr<SamplerCache> m_samplerCache;
+    WGPUBindGroupLayout m_immediateDataLayout = nullptr;
+
+    mutable std::mutex m_pendingFuturesMutex;
+    mutable std::vector<WGPUFuture> m_pendingFutures;
 };
 
 } // namespace gfx::backend::webgpu::core
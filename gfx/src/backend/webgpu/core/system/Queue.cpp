@@ -4,6 +4,7 @@
 #include "../resource/Buffer.h"
 #include "../resource/Texture.h"
 #include "../sync/Fence.h"
+#include "../sync/Semaphore.h"
 #include "../system/Adapter.h"
 #include "../system/Device.h"
 #include "../system/Instance.h"
@@ -38,49 +39,83 @@ Device* Queue::getDevice() const
 
 bool Queue::submit(const SubmitInfo& submitInfo)
 {
-    // WebGPU doesn't support semaphore-based sync - just submit command buffers
-    for (uint32_t i = 0; i < submitInfo.commandEncoderCount; ++i) {
-        if (submitInfo.commandEncoders[i]) {
-            auto* encoderPtr = submitInfo.commandEncoders[i];
-
-            WGPUCommandBufferDescriptor cmdDesc = WGPU_COMMAND_BUFFER_DESCRIPTOR_INIT;
-            WGPUCommandBuffer cmdBuffer = wgpuCommandEncoderFinish(encoderPtr->handle(), &cmdDesc);
+    return submit(&submitInfo, 1);
+}
 
-            if (cmdBuffer) {
-                wgpuQueueSubmit(m_queue, 1, &cmdBuffer);
-                wgpuCommandBufferRelease(cmdBuffer);
+bool Queue::submit(const SubmitInfo* submitInfos, uint32_t submitCount)
+{
+    // WebGPU doesn't support semaphore-based sync - command buffers run in submission order,
+    // so everything up to the next fence goes into one wgpuQueueSubmit
+    std::vector<WGPUCommandBuffer> commandBuffers;
+    for (uint32_t s = 0; s < submitCount; ++s) {
+        const SubmitInfo& submitInfo = submitInfos[s];
+        for (uint32_t i = 0; i < submitInfo.commandEncoderCount; ++i) {
+            if (submitInfo.commandEncoders[i]) {
+                auto* encoderPtr = submitInfo.commandEncoders[i];
+
+                WGPUCommandBufferDescriptor cmdDesc = WGPU_COMMAND_BUFFER_DESCRIPTOR_INIT;
+                WGPUCommandBuffer cmdBuffer = wgpuCommandEncoderFinish(encoderPtr->handle(), &cmdDesc);
+                if (!cmdBuffer) {
+                    submitCommandBuffers(commandBuffers);
+                    return false;
+                }
+                commandBuffers.push_back(cmdBuffer);
 
                 // Mark encoder as finished so it will be recreated on next Begin()
                 encoderPtr->markFinished();
-            } else {
-                return false;
             }
         }
+
+        bool signalsTimeline = false;
+        for (uint32_t i = 0; i < submitInfo.signalSemaphoreCount && submitInfo.signalValues; ++i) {
+            signalsTimeline |= submitInfo.signalSemaphores[i] && submitInfo.signalSemaphores[i]->getType() == SemaphoreType::Timeline;
+        }
+        if (submitInfo.signalFence || signalsTimeline) {
+            submitCommandBuffers(commandBuffers);
+            signalOnCompletion(submitInfo);
+        }
     }
+    submitCommandBuffers(commandBuffers);
 
-    // Signal fence if provided - use queue work done to wait for GPU completion
-    if (submitInfo.signalFence) {
-        static auto fenceSignalCallback = [](WGPUQueueWorkDoneStatus status, WGPUStringView, void* userdata1, void*) {
-            auto* fence = static_cast<Fence*>(userdata1);
-            if (status == WGPUQueueWorkDoneStatus_Success) {
-                fence->signal();
-            }
-        };
+    return true;
+}
 
-        WGPUQueueWorkDoneCallbackInfo callbackInfo = WGPU_QUEUE_WORK_DONE_CALLBACK_INFO_INIT;
-        callbackInfo.mode = WGPUCallbackMode_WaitAnyOnly;
-        callbackInfo.callback = fenceSignalCallback;
-        callbackInfo.userdata1 = submitInfo.signalFence;
+void Queue::submitCommandBuffers(std::vector<WGPUCommandBuffer>& commandBuffers)
+{
+    if (commandBuffers.empty()) {
+        return;
+    }
+    wgpuQueueSubmit(m_queue, commandBuffers.size(), commandBuffers.data());
+    for (WGPUCommandBuffer cmdBuffer : commandBuffers) {
+        wgpuCommandBufferRelease(cmdBuffer);
+    }
+    commandBuffers.clear();
+}
 
-        WGPUFuture future = wgpuQueueOnSubmittedWorkDone(m_queue, callbackInfo);
+void Queue::signalOnCompletion(const SubmitInfo& submitInfo)
+{
+    // The callback has nothing to do, the fence and semaphores wait on the future themselves.
+    // Without userdata it is safe to run after they were destroyed.
+    WGPUQueueWorkDoneCallbackInfo callbackInfo = WGPU_QUEUE_WORK_DONE_CALLBACK_INFO_INIT;
+    callbackInfo.mode = WGPUCallbackMode_WaitAnyOnly;
+    callbackInfo.callback = [](WGPUQueueWorkDoneStatus, WGPUStringView, void*, void*) {};
 
-        // Wait for the fence to be signaled (GPU work done)
-        WGPUFutureWaitInfo waitInfo = WGPU_FUTURE_WAIT_INFO_INIT;
-        waitInfo.future = future;
-        wgpuInstanceWaitAny(m_device->getAdapter()->getInstance()->handle(), 1, &waitInfo, UINT64_MAX);
+    // Returns right away, the CPU keeps going while the GPU works through the submit
+    WGPUFuture future = wgpuQueueOnSubmittedWorkDone(m_queue, callbackInfo);
+    WGPUInstance instance = m_device->getAdapter()->getInstance()->handle();
+
+    if (submitInfo.signalFence) {
+        submitInfo.signalFence->signalOnCompletion(instance, future);
+    }
+    for (uint32_t i = 0; i < submitInfo.signalSemaphoreCount && submitInfo.signalValues; ++i) {
+        Semaphore* semaphore = submitInfo.signalSemaphores[i];
+        if (semaphore && semaphore->getType() == SemaphoreType::Timeline) {
+            semaphore->signalOnCompletion(instance, future, submitInfo.signalValues[i]);
+        }
     }
 
-    return true;
+    // Futures nobody waits on are still collected, and waitIdle waits for them
+    m_device->addPendingFuture(future);
 }
 
 void Queue::writeBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size)
@@ -3,10 +3,13 @@
 
 #include "../CoreTypes.h"
 
+#include <vector>
+
 namespace gfx::backend::webgpu::core {
 
 class Device;
 class Buffer;
+class Fence;
 class Texture;
 
 class Queue {
@@ -21,8 +24,11 @@ public:
     WGPUQueue handle() const;
     Device* getDevice() const;
 
-    // Submit command encoders with optional fence signaling
+    // Submit command encoders with optional fence signaling. Returns without waiting for the
+    // work, the fence and timeline semaphores signal once it completed.
     bool submit(const SubmitInfo& submitInfo);
+    // Same as calling submit() for each, with one wgpuQueueSubmit per fence
+    bool submit(const SubmitInfo* submitInfos, uint32_t submitCount);
 
     // Write data directly to a buffer
     void writeBuffer(Buffer* buffer, uint64_t offset, const void* data, uint64_t size);
@@ -33,6 +39,11 @@ public:
     bool waitIdle();
 
 private:
+    // Submits and releases the command buffers, leaving the vector empty
+    void submitCommandBuffers(std::vector<WGPUCommandBuffer>& commandBuffers);
+    // Signals the submit's fence and timeline semaphores once the work submitted so far is done
+    void signalOnCompletion(const SubmitInfo& submitInfo);
+
     WGPUQueue m_queue = nullptr;
     Device* m_device = nullptr; // Non-owning pointer to parent device
 };
@@ -0,0 +1,110 @@
+#include "SamplerCache.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gfx::backend::webgpu::core {
+
+namespace {
+    template <typename T>
+    void appendKey(std::string& key, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // Field by field so padding never ends up in the key
+    std::string makeKey(const SamplerCreateInfo& createInfo)
+    {
+        std::string key;
+        appendKey(key, createInfo.addressModeU);
+        appendKey(key, createInfo.addressModeV);
+        appendKey(key, createInfo.addressModeW);
+        appendKey(key, createInfo.magFilter);
+        appendKey(key, createInfo.minFilter);
+        appendKey(key, createInfo.mipmapFilter);
+        appendKey(key, createInfo.lodMinClamp);
+        appendKey(key, createInfo.lodMaxClamp);
+        appendKey(key, std::max(1u, createInfo.maxAnisotropy));
+        appendKey(key, createInfo.compareFunction);
+        return key;
+    }
+} // anonymous namespace
+
+SamplerCache::SamplerCache(WGPUDevice device)
+    : m_device(device)
+{
+}
+
+SamplerCache::~SamplerCache()
+{
+    // Everything should have been released by its owner, but don't leak if not
+    for (const auto& [sampler, entry] : m_samplers) {
+        wgpuSamplerRelease(sampler);
+    }
+}
+
+WGPUSampler SamplerCache::acquire(const SamplerCreateInfo& createInfo)
+{
+    std::string key = makeKey(createInfo);
+
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_lookup.find(key);
+    if (it != m_lookup.end()) {
+        ++m_samplers[it->second].refCount;
+        ++m_hitCount;
+        return it->second;
+    }
+
+    WGPUSamplerDescriptor desc = WGPU_SAMPLER_DESCRIPTOR_INIT;
+    desc.addressModeU = createInfo.addressModeU;
+    desc.addressModeV = createInfo.addressModeV;
+    desc.addressModeW = createInfo.addressModeW;
+    desc.magFilter = createInfo.magFilter;
+    desc.minFilter = createInfo.minFilter;
+    desc.mipmapFilter = createInfo.mipmapFilter;
+    desc.lodMinClamp = createInfo.lodMinClamp;
+    desc.lodMaxClamp = createInfo.lodMaxClamp;
+    desc.maxAnisotropy = static_cast<uint16_t>(std::max(1u, createInfo.maxAnisotropy));
+    desc.compare = createInfo.compareFunction;
+
+    WGPUSampler sampler = wgpuDeviceCreateSampler(m_device, &desc);
+    if (!sampler) {
+        throw std::runtime_error("Failed to create WebGPU sampler");
+    }
+
+    m_lookup[key] = sampler;
+    Entry& entry = m_samplers[sampler];
+    entry.key = std::move(key);
+    entry.refCount = 1;
+    return sampler;
+}
+
+void SamplerCache::release(WGPUSampler sampler)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto it = m_samplers.find(sampler);
+    if (it == m_samplers.end() || --it->second.refCount > 0) {
+        return;
+    }
+
+    // Bind groups using the sampler hold their own reference
+    m_lookup.erase(it->second.key);
+    m_samplers.erase(it);
+    wgpuSamplerRelease(sampler);
+}
+
+SamplerCacheStats SamplerCache::getStats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    SamplerCacheStats stats{};
+    stats.samplerCount = static_cast<uint32_t>(m_samplers.size());
+    stats.hitCount = m_hitCount;
+    return stats;
+}
+
+} // namespace gfx::backend::webgpu::core
@@ -0,0 +1,50 @@
+#ifndef GFX_WEBGPU_SAMPLER_CACHE_H
+#define GFX_WEBGPU_SAMPLER_CACHE_H
+
+#include "../CoreTypes.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace gfx::backend::webgpu::core {
+
+struct SamplerCacheStats {
+    uint32_t samplerCount = 0;
+    uint64_t hitCount = 0;
+};
+
+// Device-wide store of WGPUSamplers keyed by their create info and reference counted, so
+// GfxSamplers with the same state share one native sampler
+class SamplerCache {
+public:
+    // Prevent copying
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+
+    explicit SamplerCache(WGPUDevice device);
+    ~SamplerCache();
+
+    // Throws std::runtime_error if a new sampler cannot be created
+    WGPUSampler acquire(const SamplerCreateInfo& createInfo);
+    void release(WGPUSampler sampler);
+
+    SamplerCacheStats getStats() const;
+
+private:
+    struct Entry {
+        std::string key;
+        uint32_t refCount = 0;
+    };
+
+    WGPUDevice m_device = nullptr; // Non-owning
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<WGPUSampler, Entry> m_samplers;
+    std::unordered_map<std::string, WGPUSampler> m_lookup;
+    uint64_t m_hitCount = 0;
+};
+
+} // namespace gfx::backend::webgpu::core
+
+#endif // GFX_WEBGPU_SAMPLER_CACHE_H
@@ -1,11 +1,26 @@
 #include "Validations.h"
 
+#include <atomic>
 #include <cstdint>
+#include <mutex>
 
 namespace gfx::backend::webgpu::validator {
 
 namespace {
 
+#ifndef GFX_DISABLE_VALIDATION
+    std::atomic<GfxValidationLevel> s_validationLevel{ GFX_VALIDATION_LEVEL_FULL };
+    std::mutex s_instanceCountMutex;
+    uint32_t s_instanceCount = 0;
+#endif
+
+    // Descriptor contents are only inspected at GFX_VALIDATION_LEVEL_FULL; the null checks
+    // in front of each call below still run at GFX_VALIDATION_LEVEL_HANDLES_ONLY
+    bool descriptorValidationEnabled()
+    {
+        return getValidationLevel() == GFX_VALIDATION_LEVEL_FULL;
+    }
+
     // ============================================================================
     // Internal descriptor validation functions
     // ============================================================================
@@ -16,6 +31,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_SUCCESS;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // All fields are optional - no specific validation needed
         // applicationName, applicationVersion, enabledExtensions are all optional
@@ -28,6 +46,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_SUCCESS;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // All fields are optional - no specific validation needed
         // adapterIndex and preference are both valid selection criteria
@@ -45,6 +66,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate dimensions
         if (descriptor->extent.width == 0 || descriptor->extent.height == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -79,6 +104,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_SUCCESS;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // Validate queueRequests and queueRequestCount consistency
         if (descriptor->queueRequests != nullptr && descriptor->queueRequestCount == 0) {
@@ -108,6 +136,17 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        const GfxChainHeader* chainNode = static_cast<const GfxChainHeader*>(descriptor->pNext);
+        while (chainNode) {
+            if (chainNode->sType == GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR) {
+                const auto* pipelineCache = static_cast<const GfxDevicePipelineCacheDescriptor*>(static_cast<const void*>(chainNode));
+                if (pipelineCache->initialData == nullptr && pipelineCache->initialDataSize != 0) {
+                    return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+                }
+            }
+            chainNode = static_cast<const GfxChainHeader*>(chainNode->pNext);
+        }
+
         return GFX_RESULT_SUCCESS;
     }
 
@@ -116,6 +155,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // Validate size
         if (descriptor->size == 0) {
@@ -154,10 +196,10 @@ namespace {
 
         // Validate consistency between map usage and memory properties
         {
-            const bool hasMapUsage = (descriptor->usage & (GFX_BUFFER_USAGE_MAP_READ | GFX_BUFFER_USAGE_MAP_WRITE)) != 0;
+            const bool hasMapUsage = (descriptor->usage & (GFX_BUFFER_USAGE_MAP_READ | GFX_BUFFER_USAGE_MAP_WRITE | GFX_BUFFER_USAGE_MAP_PERSISTENT)) != 0;
             const bool hasHostVisible = (descriptor->memoryProperties & GFX_MEMORY_PROPERTY_HOST_VISIBLE) != 0;
 
-            // MapRead or MapWrite requires HostVisible for consistent API behavior
+            // MapRead, MapWrite or MapPersistent requires HostVisible for consistent API behavior
             if (hasMapUsage && !hasHostVisible) {
                 return GFX_RESULT_ERROR_INVALID_ARGUMENT;
             }
@@ -171,6 +213,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // Validate dimensions based on texture type
         switch (descriptor->type) {
@@ -228,6 +273,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate size
         if (descriptor->size == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -252,6 +301,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate dimensions based on texture type
         switch (descriptor->type) {
         case GFX_TEXTURE_TYPE_1D:
@@ -297,6 +350,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // Validate filter modes
         if (descriptor->magFilter < GFX_FILTER_MODE_NEAREST || descriptor->magFilter > GFX_FILTER_MODE_LINEAR) {
@@ -332,14 +388,22 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
+        // Validate code pointer
+        if (!descriptor->code) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // WebGPU supports WGSL and SPIR-V (via Dawn extension)
         if (descriptor->sourceType != GFX_SHADER_SOURCE_WGSL && descriptor->sourceType != GFX_SHADER_SOURCE_SPIRV) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
-        // Validate code pointer and size
-        if (!descriptor->code || descriptor->codeSize == 0) {
+        // Validate code size
+        if (descriptor->codeSize == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
@@ -357,6 +421,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // Validate format
         if (descriptor->format == GFX_FORMAT_UNDEFINED) {
@@ -409,6 +476,23 @@ namespace {
         return GFX_RESULT_SUCCESS;
     }
 
+    GfxResult validateImmediateDataRanges(const GfxImmediateDataRange* ranges, uint32_t rangeCount)
+    {
+        if (rangeCount > 0 && !ranges) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        for (uint32_t i = 0; i < rangeCount; ++i) {
+            const GfxImmediateDataRange& range = ranges[i];
+            if (range.visibility == GFX_SHADER_STAGE_NONE || range.size == 0 || range.offset % 4 != 0 || range.size % 4 != 0) {
+                return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            if (range.offset + static_cast<uint64_t>(range.size) > GFX_MAX_IMMEDIATE_DATA_SIZE) {
+                return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        return GFX_RESULT_SUCCESS;
+    }
+
     GfxResult validateRenderPipelineDescriptor(const GfxRenderPipelineDescriptor* descriptor)
     {
         if (!descriptor) {
@@ -425,7 +509,16 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
-        return GFX_RESULT_SUCCESS;
+        // Validate immediate data ranges if provided
+        if (descriptor->immediateDataRangeCount > 0 && !descriptor->immediateDataRanges) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
+        return validateImmediateDataRanges(descriptor->immediateDataRanges, descriptor->immediateDataRangeCount);
     }
 
     GfxResult validateComputePipelineDescriptor(const GfxComputePipelineDescriptor* descriptor)
@@ -439,7 +532,16 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
-        return GFX_RESULT_SUCCESS;
+        // Validate immediate data ranges if provided
+        if (descriptor->immediateDataRangeCount > 0 && !descriptor->immediateDataRanges) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
+        return validateImmediateDataRanges(descriptor->immediateDataRanges, descriptor->immediateDataRangeCount);
     }
 
     GfxResult validateRenderPassDescriptor(const GfxRenderPassDescriptor* descriptor)
@@ -467,13 +569,17 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
-        // Validate dimensions
-        if (descriptor->extent.width == 0 || descriptor->extent.height == 0) {
+        // Validate color attachments if provided
+        if (descriptor->colorAttachmentCount > 0 && !descriptor->colorAttachments) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
-        // Validate color attachments if provided
-        if (descriptor->colorAttachmentCount > 0 && !descriptor->colorAttachments) {
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
+        // Validate dimensions
+        if (descriptor->extent.width == 0 || descriptor->extent.height == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
@@ -486,6 +592,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_SUCCESS;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // No specific validation needed - signaled flag is any bool value
         return GFX_RESULT_SUCCESS;
@@ -497,6 +606,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_SUCCESS;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // No specific validation needed - type and initialValue are both valid
         return GFX_RESULT_SUCCESS;
@@ -526,6 +638,9 @@ namespace {
         if (!descriptor) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
 
         // No specific validation needed - label is optional
         return GFX_RESULT_SUCCESS;
@@ -542,6 +657,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate size
         if (descriptor->size == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -561,6 +680,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate extent
         if (descriptor->extent.width == 0 || descriptor->extent.height == 0 || descriptor->extent.depth == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -580,6 +703,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate extent
         if (descriptor->extent.width == 0 || descriptor->extent.height == 0 || descriptor->extent.depth == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -599,6 +726,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate extent
         if (descriptor->extent.width == 0 || descriptor->extent.height == 0 || descriptor->extent.depth == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -618,6 +749,10 @@ namespace {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if (!descriptorValidationEnabled()) {
+            return GFX_RESULT_SUCCESS;
+        }
+
         // Validate extents
         if (descriptor->sourceExtent.width == 0 || descriptor->sourceExtent.height == 0 || descriptor->sourceExtent.depth == 0) {
             return GFX_RESULT_ERROR_INVALID_ARGUMENT;
@@ -654,8 +789,94 @@ namespace {
         return GFX_RESULT_SUCCESS;
     }
 
+    GfxResult validateImmediateData(uint32_t offset, const void* data, uint32_t size)
+    {
+        if (!data || size == 0 || offset % 4 != 0 || size % 4 != 0) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        if (offset + static_cast<uint64_t>(size) > GFX_MAX_IMMEDIATE_DATA_SIZE) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return GFX_RESULT_SUCCESS;
+    }
+
+    // Indirect draw commands are 16 (non-indexed) or 20 (indexed) bytes, 0 means tightly packed
+    GfxResult validateIndirectStride(uint32_t stride, uint32_t commandSize)
+    {
+        if (stride != 0 && (stride % 4 != 0 || stride < commandSize)) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return GFX_RESULT_SUCCESS;
+    }
+
 } // anonymous namespace
 
+// ============================================================================
+// Validation level
+// ============================================================================
+
+GfxValidationLevel getValidationLevel()
+{
+#ifdef GFX_DISABLE_VALIDATION
+    return GFX_VALIDATION_LEVEL_DISABLED;
+#else
+    return s_validationLevel.load(std::memory_order_relaxed);
+#endif
+}
+
+void setValidationLevel(GfxValidationLevel level)
+{
+#ifdef GFX_DISABLE_VALIDATION
+    (void)level;
+#else
+    s_validationLevel.store(level, std::memory_order_relaxed);
+#endif
+}
+
+GfxValidationLevel getInstanceValidationLevel(const GfxInstanceDescriptor* descriptor)
+{
+    if (!descriptor) {
+        return GFX_VALIDATION_LEVEL_FULL;
+    }
+
+    const GfxChainHeader* chainNode = static_cast<const GfxChainHeader*>(descriptor->pNext);
+    while (chainNode) {
+        if (chainNode->sType == GFX_STRUCTURE_TYPE_INSTANCE_VALIDATION_DESCRIPTOR) {
+            const auto* validation = static_cast<const GfxInstanceValidationDescriptor*>(static_cast<const void*>(chainNode));
+            if (validation->level >= GFX_VALIDATION_LEVEL_FULL && validation->level <= GFX_VALIDATION_LEVEL_DISABLED) {
+                return validation->level;
+            }
+            return GFX_VALIDATION_LEVEL_FULL;
+        }
+        chainNode = static_cast<const GfxChainHeader*>(chainNode->pNext);
+    }
+    return GFX_VALIDATION_LEVEL_FULL;
+}
+
+bool retainValidationLevel(GfxValidationLevel level)
+{
+#ifdef GFX_DISABLE_VALIDATION
+    (void)level;
+    return true;
+#else
+    std::scoped_lock lock(s_instanceCountMutex);
+    if (s_instanceCount++ == 0) {
+        setValidationLevel(level);
+    }
+    return getValidationLevel() == level;
+#endif
+}
+
+void releaseValidationLevel()
+{
+#ifndef GFX_DISABLE_VALIDATION
+    std::scoped_lock lock(s_instanceCountMutex);
+    if (s_instanceCount > 0 && --s_instanceCount == 0) {
+        setValidationLevel(GFX_VALIDATION_LEVEL_FULL);
+    }
+#endif
+}
+
 // ============================================================================
 // Combined validation functions (parameters + descriptors)
 // ============================================================================
@@ -836,6 +1057,14 @@ GfxResult validateDeviceCreateRenderPipeline(GfxDevice device, const GfxRenderPi
     return validateRenderPipelineDescriptor(descriptor);
 }
 
+GfxResult validateDeviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback)
+{
+    if (!device || !descriptor || !callback) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateRenderPipelineDescriptor(descriptor);
+}
+
 GfxResult validateDeviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline)
 {
     if (!device || !descriptor || !outPipeline) {
@@ -844,6 +1073,22 @@ GfxResult validateDeviceCreateComputePipeline(GfxDevice device, const GfxCompute
     return validateComputePipelineDescriptor(descriptor);
 }
 
+GfxResult validateDeviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback)
+{
+    if (!device || !descriptor || !callback) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateComputePipelineDescriptor(descriptor);
+}
+
+GfxResult validatePipelineImmediateDataGroup(uint32_t bindGroupLayoutCount, uint32_t immediateDataRangeCount, uint32_t maxBindGroups)
+{
+    if (immediateDataRangeCount > 0 && bindGroupLayoutCount >= maxBindGroups) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateDeviceCreateRenderPass(GfxDevice device, const GfxRenderPassDescriptor* descriptor, GfxRenderPass* outRenderPass)
 {
     if (!device || !descriptor || !outRenderPass) {
@@ -868,6 +1113,14 @@ GfxResult validateDeviceCreateCommandEncoder(GfxDevice device, const GfxCommandE
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateDeviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder)
+{
+    if (!device || !descriptor || !outEncoder || !descriptor->renderPass) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateDeviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence)
 {
     if (!device || !outFence) {
@@ -903,6 +1156,54 @@ GfxResult validateDeviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits)
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateDeviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats)
+{
+    if (!device || !outStats) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateDeviceGetPipelineCacheData(GfxDevice device, size_t* dataSize)
+{
+    if (!device || !dataSize) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateDeviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore)
+{
+    if (!device || !outSemaphore) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateDeviceUploadBuffer(GfxDevice device, GfxBuffer buffer, const void* data, uint64_t* outSignalValue)
+{
+    if (!device || !buffer || !data || !outSignalValue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateDeviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, const void* data, uint64_t* outSignalValue)
+{
+    if (!device || !texture || !origin || !extent || !data || !outSignalValue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateDeviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable)
+{
+    if (!device || !outProcTable) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateSurfaceGetInfo(GfxSurface surface, GfxSurfaceInfo* outInfo)
 {
     if (!surface || !outInfo) {
@@ -995,6 +1296,14 @@ GfxResult validateBufferMap(GfxBuffer buffer, void** outMappedPointer)
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateBufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer)
+{
+    if (!buffer || !outMappedPointer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateTextureGetInfo(GfxTexture texture, GfxTextureInfo* outInfo)
 {
     if (!texture || !outInfo) {
@@ -1035,6 +1344,22 @@ GfxResult validateQueueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitD
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateQueueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitDescriptors, uint32_t submitCount)
+{
+    if (!queue || (submitCount > 0 && !submitDescriptors)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateQueueFlush(GfxQueue queue)
+{
+    if (!queue) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateQueueWriteBuffer(GfxQueue queue, GfxBuffer buffer, const void* data)
 {
     if (!queue || !buffer || !data) {
@@ -1195,6 +1520,14 @@ GfxResult validateRenderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPas
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateRenderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size)
+{
+    if (!renderPassEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateImmediateData(offset, data, size);
+}
+
 GfxResult validateRenderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer)
 {
     if (!renderPassEncoder || !indirectBuffer) {
@@ -1211,6 +1544,93 @@ GfxResult validateRenderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder rend
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateRenderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint32_t stride)
+{
+    if (!renderPassEncoder || !indirectBuffer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateIndirectStride(stride, 16);
+}
+
+GfxResult validateRenderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint32_t stride)
+{
+    if (!renderPassEncoder || !indirectBuffer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateIndirectStride(stride, 20);
+}
+
+GfxResult validateRenderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, GfxBuffer countBuffer, uint32_t stride)
+{
+    if (!renderPassEncoder || !indirectBuffer || !countBuffer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateIndirectStride(stride, 16);
+}
+
+GfxResult validateRenderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, GfxBuffer countBuffer, uint32_t stride)
+{
+    if (!renderPassEncoder || !indirectBuffer || !countBuffer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateIndirectStride(stride, 20);
+}
+
+// Validates the whole stream before anything is recorded, so the decode loop can run unchecked
+GfxResult validateRenderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount)
+{
+    if (!renderPassEncoder || (commandCount > 0 && !commands)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (uint32_t i = 0; i < commandCount; ++i) {
+        const GfxCommand& command = commands[i];
+        switch (command.type) {
+        case GFX_COMMAND_TYPE_SET_PIPELINE:
+            if (!command.setPipeline.pipeline) {
+                return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            break;
+        case GFX_COMMAND_TYPE_SET_BIND_GROUP:
+            if (!command.setBindGroup.bindGroup || (command.setBindGroup.dynamicOffsetCount > 0 && !command.setBindGroup.dynamicOffsets)) {
+                return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            break;
+        case GFX_COMMAND_TYPE_SET_VERTEX_BUFFER:
+            if (!command.setVertexBuffer.buffer) {
+                return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            break;
+        case GFX_COMMAND_TYPE_SET_INDEX_BUFFER:
+            if (!command.setIndexBuffer.buffer) {
+                return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            break;
+        case GFX_COMMAND_TYPE_SET_VIEWPORT:
+        case GFX_COMMAND_TYPE_SET_SCISSOR_RECT:
+        case GFX_COMMAND_TYPE_DRAW:
+        case GFX_COMMAND_TYPE_DRAW_INDEXED:
+            break;
+        default:
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount)
+{
+    if (!renderPassEncoder || (bundleCount > 0 && !bundles)) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < bundleCount; ++i) {
+        if (!bundles[i]) {
+            return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateRenderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet)
 {
     if (!renderPassEncoder || !querySet) {
@@ -1243,6 +1663,14 @@ GfxResult validateComputePassEncoderSetBindGroup(GfxComputePassEncoder computePa
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateComputePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size)
+{
+    if (!computePassEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return validateImmediateData(offset, data, size);
+}
+
 GfxResult validateComputePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer)
 {
     if (!computePassEncoder || !indirectBuffer) {
@@ -1251,6 +1679,62 @@ GfxResult validateComputePassEncoderDispatchIndirect(GfxComputePassEncoder compu
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateRenderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline)
+{
+    if (!renderBundleEncoder || !pipeline) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, GfxBindGroup bindGroup)
+{
+    if (!renderBundleEncoder || !bindGroup) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer)
+{
+    if (!renderBundleEncoder || !buffer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer)
+{
+    if (!renderBundleEncoder || !buffer) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport)
+{
+    if (!renderBundleEncoder || !viewport) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor)
+{
+    if (!renderBundleEncoder || !scissor) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle)
+{
+    if (!renderBundleEncoder || !outBundle) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateFenceGetStatus(GfxFence fence, bool* isSignaled)
 {
     if (!fence || !isSignaled) {
@@ -1311,6 +1795,14 @@ GfxResult validateDeviceWaitIdle(GfxDevice device)
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateDevicePoll(GfxDevice device)
+{
+    if (!device) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateSurfaceDestroy(GfxSurface surface)
 {
     if (!surface) {
@@ -1479,6 +1971,14 @@ GfxResult validateCommandEncoderBegin(GfxCommandEncoder commandEncoder)
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateCommandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats)
+{
+    if (!commandEncoder || !outStats) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateRenderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder)
 {
     if (!renderPassEncoder) {
@@ -1519,6 +2019,38 @@ GfxResult validateComputePassEncoderEnd(GfxComputePassEncoder computePassEncoder
     return GFX_RESULT_SUCCESS;
 }
 
+GfxResult validateRenderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder)
+{
+    if (!renderBundleEncoder) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
+GfxResult validateRenderBundleDestroy(GfxRenderBundle renderBundle)
+{
+    if (!renderBundle) {
+        return GFX_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return GFX_RESULT_SUCCESS;
+}
+
 GfxResult validateFenceDestroy(GfxFence fence)
 {
     if (!fence) {
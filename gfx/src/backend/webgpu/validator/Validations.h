@@ -3,8 +3,38 @@
 
 #include "gfx/gfx.h"
 
+// Runs a validator and returns its error from the calling function. Validation is skipped at
+// GFX_VALIDATION_LEVEL_DISABLED and compiled out entirely with GFX_DISABLE_VALIDATION.
+#ifdef GFX_DISABLE_VALIDATION
+#define GFX_VALIDATE(expression) static_cast<void>(0)
+#else
+#define GFX_VALIDATE(expression)                                                  \
+    do {                                                                          \
+        if (validator::getValidationLevel() != GFX_VALIDATION_LEVEL_DISABLED) {   \
+            GfxResult validationResult = (expression);                            \
+            if (validationResult != GFX_RESULT_SUCCESS) {                         \
+                return validationResult;                                          \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
+#endif
+
 namespace gfx::backend::webgpu::validator {
 
+// ============================================================================
+// Validation level
+// ============================================================================
+
+// Backend-wide; the first instance created while none is alive picks it from its
+// GfxInstanceValidationDescriptor, later instances leave it alone until all are destroyed
+GfxValidationLevel getValidationLevel();
+void setValidationLevel(GfxValidationLevel level);
+GfxValidationLevel getInstanceValidationLevel(const GfxInstanceDescriptor* descriptor);
+// False when another live instance's different level stays in effect
+bool retainValidationLevel(GfxValidationLevel level);
+// Goes back to GFX_VALIDATION_LEVEL_FULL once the last instance is destroyed
+void releaseValidationLevel();
+
 // ============================================================================
 // Public validation interface (called by Backend)
 // ============================================================================
@@ -31,16 +61,27 @@ GfxResult validateDeviceCreateShader(GfxDevice device, const GfxShaderDescriptor
 GfxResult validateDeviceCreateBindGroupLayout(GfxDevice device, const GfxBindGroupLayoutDescriptor* descriptor, GfxBindGroupLayout* outLayout);
 GfxResult validateDeviceCreateBindGroup(GfxDevice device, const GfxBindGroupDescriptor* descriptor, GfxBindGroup* outBindGroup);
 GfxResult validateDeviceCreateRenderPipeline(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxRenderPipeline* outPipeline);
+GfxResult validateDeviceCreateRenderPipelineAsync(GfxDevice device, const GfxRenderPipelineDescriptor* descriptor, GfxCreateRenderPipelineCallback callback);
 GfxResult validateDeviceCreateComputePipeline(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxComputePipeline* outPipeline);
+GfxResult validateDeviceCreateComputePipelineAsync(GfxDevice device, const GfxComputePipelineDescriptor* descriptor, GfxCreateComputePipelineCallback callback);
+// Immediate data takes the bind group after the pipeline's own, which must stay below maxBindGroups
+GfxResult validatePipelineImmediateDataGroup(uint32_t bindGroupLayoutCount, uint32_t immediateDataRangeCount, uint32_t maxBindGroups);
 GfxResult validateDeviceCreateRenderPass(GfxDevice device, const GfxRenderPassDescriptor* descriptor, GfxRenderPass* outRenderPass);
 GfxResult validateDeviceCreateFramebuffer(GfxDevice device, const GfxFramebufferDescriptor* descriptor, GfxFramebuffer* outFramebuffer);
 GfxResult validateDeviceCreateCommandEncoder(GfxDevice device, const GfxCommandEncoderDescriptor* descriptor, GfxCommandEncoder* outEncoder);
+GfxResult validateDeviceCreateRenderBundleEncoder(GfxDevice device, const GfxRenderBundleEncoderDescriptor* descriptor, GfxRenderBundleEncoder* outEncoder);
 GfxResult validateDeviceCreateFence(GfxDevice device, const GfxFenceDescriptor* descriptor, GfxFence* outFence);
 GfxResult validateDeviceCreateSemaphore(GfxDevice device, const GfxSemaphoreDescriptor* descriptor, GfxSemaphore* outSemaphore);
 GfxResult validateDeviceCreateQuerySet(GfxDevice device, const GfxQuerySetDescriptor* descriptor, GfxQuerySet* outQuerySet);
 GfxResult validateRenderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder renderPassEncoder, GfxQuerySet querySet);
 GfxResult validateRenderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder renderPassEncoder);
 GfxResult validateDeviceGetLimits(GfxDevice device, GfxDeviceLimits* outLimits);
+GfxResult validateDeviceGetMemoryStats(GfxDevice device, GfxDeviceMemoryStats* outStats);
+GfxResult validateDeviceGetPipelineCacheData(GfxDevice device, size_t* dataSize);
+GfxResult validateDeviceGetUploadSemaphore(GfxDevice device, GfxSemaphore* outSemaphore);
+GfxResult validateDeviceUploadBuffer(GfxDevice device, GfxBuffer buffer, const void* data, uint64_t* outSignalValue);
+GfxResult validateDeviceUploadTexture(GfxDevice device, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, const void* data, uint64_t* outSignalValue);
+GfxResult validateDeviceGetProcTable(GfxDevice device, GfxProcTable* outProcTable);
 GfxResult validateSurfaceGetInfo(GfxSurface surface, GfxSurfaceInfo* outInfo);
 GfxResult validateSurfaceEnumerateSupportedFormats(GfxSurface surface, uint32_t* formatCount);
 GfxResult validateSurfaceEnumerateSupportedPresentModes(GfxSurface surface, uint32_t* presentModeCount);
@@ -52,11 +93,14 @@ GfxResult validateSwapchainPresent(GfxSwapchain swapchain, const GfxPresentDescr
 GfxResult validateBufferGetInfo(GfxBuffer buffer, GfxBufferInfo* outInfo);
 GfxResult validateBufferGetNativeHandle(GfxBuffer buffer, void** outHandle);
 GfxResult validateBufferMap(GfxBuffer buffer, void** outMappedPointer);
+GfxResult validateBufferGetMappedPointer(GfxBuffer buffer, void** outMappedPointer);
 GfxResult validateTextureGetInfo(GfxTexture texture, GfxTextureInfo* outInfo);
 GfxResult validateTextureGetNativeHandle(GfxTexture texture, void** outHandle);
 GfxResult validateTextureGetLayout(GfxTexture texture, GfxTextureLayout* outLayout);
 GfxResult validateTextureCreateView(GfxTexture texture, const GfxTextureViewDescriptor* descriptor, GfxTextureView* outView);
 GfxResult validateQueueSubmit(GfxQueue queue, const GfxSubmitDescriptor* submitInfo);
+GfxResult validateQueueSubmitBatch(GfxQueue queue, const GfxSubmitDescriptor* submitInfos, uint32_t submitCount);
+GfxResult validateQueueFlush(GfxQueue queue);
 GfxResult validateQueueWriteBuffer(GfxQueue queue, GfxBuffer buffer, const void* data);
 GfxResult validateQueueWriteTexture(GfxQueue queue, GfxTexture texture, const GfxOrigin3D* origin, const GfxExtent3D* extent, const void* data);
 GfxResult validateCommandEncoderBeginRenderPass(GfxCommandEncoder commandEncoder, const GfxRenderPassBeginDescriptor* beginDescriptor, GfxRenderPassEncoder* outRenderPass);
@@ -77,11 +121,26 @@ GfxResult validateRenderPassEncoderSetVertexBuffer(GfxRenderPassEncoder renderPa
 GfxResult validateRenderPassEncoderSetIndexBuffer(GfxRenderPassEncoder renderPassEncoder, GfxBuffer buffer);
 GfxResult validateRenderPassEncoderSetViewport(GfxRenderPassEncoder renderPassEncoder, const GfxViewport* viewport);
 GfxResult validateRenderPassEncoderSetScissorRect(GfxRenderPassEncoder renderPassEncoder, const GfxScissorRect* scissor);
+GfxResult validateRenderPassEncoderSetImmediateData(GfxRenderPassEncoder renderPassEncoder, uint32_t offset, const void* data, uint32_t size);
 GfxResult validateRenderPassEncoderDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer);
 GfxResult validateRenderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer);
+GfxResult validateRenderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint32_t stride);
+GfxResult validateRenderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, uint32_t stride);
+GfxResult validateRenderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, GfxBuffer countBuffer, uint32_t stride);
+GfxResult validateRenderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder renderPassEncoder, GfxBuffer indirectBuffer, GfxBuffer countBuffer, uint32_t stride);
+GfxResult validateRenderPassEncoderExecuteCommandStream(GfxRenderPassEncoder renderPassEncoder, const GfxCommand* commands, uint32_t commandCount);
+GfxResult validateRenderPassEncoderExecuteBundles(GfxRenderPassEncoder renderPassEncoder, const GfxRenderBundle* bundles, uint32_t bundleCount);
 GfxResult validateComputePassEncoderSetPipeline(GfxComputePassEncoder computePassEncoder, GfxComputePipeline pipeline);
 GfxResult validateComputePassEncoderSetBindGroup(GfxComputePassEncoder computePassEncoder, GfxBindGroup bindGroup);
+GfxResult validateComputePassEncoderSetImmediateData(GfxComputePassEncoder computePassEncoder, uint32_t offset, const void* data, uint32_t size);
 GfxResult validateComputePassEncoderDispatchIndirect(GfxComputePassEncoder computePassEncoder, GfxBuffer indirectBuffer);
+GfxResult validateRenderBundleEncoderSetPipeline(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderPipeline pipeline);
+GfxResult validateRenderBundleEncoderSetBindGroup(GfxRenderBundleEncoder renderBundleEncoder, GfxBindGroup bindGroup);
+GfxResult validateRenderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer);
+GfxResult validateRenderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder renderBundleEncoder, GfxBuffer buffer);
+GfxResult validateRenderBundleEncoderSetViewport(GfxRenderBundleEncoder renderBundleEncoder, const GfxViewport* viewport);
+GfxResult validateRenderBundleEncoderSetScissorRect(GfxRenderBundleEncoder renderBundleEncoder, const GfxScissorRect* scissor);
+GfxResult validateRenderBundleEncoderFinish(GfxRenderBundleEncoder renderBundleEncoder, GfxRenderBundle* outBundle);
 GfxResult validateFenceGetStatus(GfxFence fence, bool* isSignaled);
 GfxResult validateSemaphoreGetType(GfxSemaphore semaphore, GfxSemaphoreType* outType);
 GfxResult validateSemaphoreGetValue(GfxSemaphore semaphore, uint64_t* outValue);
@@ -91,6 +150,7 @@ GfxResult validateInstanceDestroy(GfxInstance instance);
 GfxResult validateAdapterDestroy(GfxAdapter adapter);
 GfxResult validateDeviceDestroy(GfxDevice device);
 GfxResult validateDeviceWaitIdle(GfxDevice device);
+GfxResult validateDevicePoll(GfxDevice device);
 GfxResult validateSurfaceDestroy(GfxSurface surface);
 GfxResult validateSwapchainDestroy(GfxSwapchain swapchain);
 GfxResult validateBufferDestroy(GfxBuffer buffer);
@@ -112,11 +172,16 @@ GfxResult validateQueueWaitIdle(GfxQueue queue);
 GfxResult validateCommandEncoderDestroy(GfxCommandEncoder commandEncoder);
 GfxResult validateCommandEncoderEnd(GfxCommandEncoder commandEncoder);
 GfxResult validateCommandEncoderBegin(GfxCommandEncoder commandEncoder);
+GfxResult validateCommandEncoderGetStats(GfxCommandEncoder commandEncoder, GfxCommandEncoderStats* outStats);
 GfxResult validateRenderPassEncoderDraw(GfxRenderPassEncoder renderPassEncoder);
 GfxResult validateRenderPassEncoderDrawIndexed(GfxRenderPassEncoder renderPassEncoder);
 GfxResult validateRenderPassEncoderEnd(GfxRenderPassEncoder renderPassEncoder);
 GfxResult validateComputePassEncoderDispatch(GfxComputePassEncoder computePassEncoder);
 GfxResult validateComputePassEncoderEnd(GfxComputePassEncoder computePassEncoder);
+GfxResult validateRenderBundleEncoderDestroy(GfxRenderBundleEncoder renderBundleEncoder);
+GfxResult validateRenderBundleEncoderDraw(GfxRenderBundleEncoder renderBundleEncoder);
+GfxResult validateRenderBundleEncoderDrawIndexed(GfxRenderBundleEncoder renderBundleEncoder);
+GfxResult validateRenderBundleDestroy(GfxRenderBundle renderBundle);
 GfxResult validateFenceDestroy(GfxFence fence);
 GfxResult validateFenceWait(GfxFence fence);
 GfxResult validateFenceReset(GfxFence fence);
@@ -1224,6 +1224,7 @@ struct SubmitDescriptor {
     // Wait semaphores (must be signaled before execution)
     std::vector<std::shared_ptr<Semaphore>> waitSemaphores;
     std::vector<uint64_t> waitValues; // For timeline semaphores, empty for binary
+    std::vector<PipelineStage> waitStageMasks; // Stages that wait on each semaphore, empty (or None entries) for the defaults
 
     // Signal semaphores (will be signaled after execution)
     std::vector<std::shared_ptr<Semaphore>> signalSemaphores;
@@ -1639,6 +1640,10 @@ public:
     virtual ~Queue() = default;
 
     virtual Result submit(const SubmitDescriptor& submitDescriptor) = 0;
+    // Same as submit() for each descriptor in order, with as few driver submits as possible
+    virtual Result submitBatch(const std::vector<SubmitDescriptor>& submitDescriptors) = 0;
+    // Submits work held back by deferred submits
+    virtual Result flush() = 0;
     virtual void writeBuffer(std::shared_ptr<Buffer> buffer, uint64_t offset, const void* data, uint64_t size) = 0;
     virtual void writeTexture(std::shared_ptr<Texture> texture, const Origin3D& origin, uint32_t mipLevel, const void* data, uint64_t dataSize, const Extent3D& extent, TextureLayout finalLayout) = 0;
     virtual void waitIdle() = 0;
@@ -1678,6 +1683,8 @@ public:
     virtual std::shared_ptr<Semaphore> createSemaphore(const SemaphoreDescriptor& descriptor = {}) = 0;
     virtual std::shared_ptr<QuerySet> createQuerySet(const QuerySetDescriptor& descriptor) = 0;
     virtual void waitIdle() = 0;
+    // Releases destroyed resources the GPU is done with, see gfxDevicePoll
+    virtual void poll() = 0;
     virtual DeviceLimits getLimits() const = 0;
     virtual bool supportsShaderFormat(ShaderSourceType format) const = 0;
     virtual AccessFlags getAccessFlagsForLayout(TextureLayout layout) const = 0;
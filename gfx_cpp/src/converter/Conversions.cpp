@@ -334,7 +334,7 @@ void convertAdapterDescriptor(const AdapterDescriptor& input, GfxAdapterDescript
     output.preference = cppAdapterPreferenceToCAdapterPreference(input.preference);
 }
 
-void convertSubmitDescriptor(const SubmitDescriptor& input, GfxSubmitDescriptor& output, std::vector<GfxCommandEncoder>& encoders, std::vector<GfxSemaphore>& waitSems, std::vector<GfxSemaphore>& signalSems)
+void convertSubmitDescriptor(const SubmitDescriptor& input, GfxSubmitDescriptor& output, std::vector<GfxCommandEncoder>& encoders, std::vector<GfxSemaphore>& waitSems, std::vector<GfxPipelineStageFlags>& waitStages, std::vector<GfxSemaphore>& signalSems)
 {
     // Convert command encoders
     encoders.clear();
@@ -356,6 +356,11 @@ void convertSubmitDescriptor(const SubmitDescriptor& input, GfxSubmitDescriptor&
         waitSems.push_back(impl->getHandle());
     }
 
+    waitStages.clear();
+    for (PipelineStage stage : input.waitStageMasks) {
+        waitStages.push_back(cppPipelineStageToCPipelineStage(stage));
+    }
+
     // Convert signal semaphores
     signalSems.clear();
     for (auto& sem : input.signalSemaphores) {
@@ -373,6 +378,7 @@ void convertSubmitDescriptor(const SubmitDescriptor& input, GfxSubmitDescriptor&
     output.commandEncoders = encoders.data();
     output.commandEncoderCount = static_cast<uint32_t>(encoders.size());
     output.waitSemaphores = waitSems.data();
+    output.waitStageMasks = waitStages.empty() ? nullptr : waitStages.data();
     output.waitSemaphoreCount = static_cast<uint32_t>(waitSems.size());
     output.signalSemaphores = signalSems.data();
     output.signalSemaphoreCount = static_cast<uint32_t>(signalSems.size());
@@ -390,6 +390,11 @@ void DeviceImpl::waitIdle()
     gfxDeviceWaitIdle(m_handle);
 }
 
+void DeviceImpl::poll()
+{
+    gfxDevicePoll(m_handle);
+}
+
 DeviceLimits DeviceImpl::getLimits() const
 {
     GfxDeviceLimits cLimits;
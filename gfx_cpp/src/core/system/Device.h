@@ -55,6 +55,8 @@ public:
 
     void waitIdle() override;
 
+    void poll() override;
+
     DeviceLimits getLimits() const override;
 
     bool supportsShaderFormat(ShaderSourceType format) const override;
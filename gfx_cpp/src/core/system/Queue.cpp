@@ -22,14 +22,39 @@ Result QueueImpl::submit(const SubmitDescriptor& submitDescriptor)
 {
     std::vector<GfxCommandEncoder> cEncoders;
     std::vector<GfxSemaphore> cWaitSems;
+    std::vector<GfxPipelineStageFlags> cWaitStages;
     std::vector<GfxSemaphore> cSignalSems;
 
     GfxSubmitDescriptor cDescriptor = {};
-    convertSubmitDescriptor(submitDescriptor, cDescriptor, cEncoders, cWaitSems, cSignalSems);
+    convertSubmitDescriptor(submitDescriptor, cDescriptor, cEncoders, cWaitSems, cWaitStages, cSignalSems);
 
     return cResultToCppResult(gfxQueueSubmit(m_handle, &cDescriptor));
 }
 
+Result QueueImpl::submitBatch(const std::vector<SubmitDescriptor>& submitDescriptors)
+{
+    // The C descriptors point into these until gfxQueueSubmitBatch returns
+    struct Storage {
+        std::vector<GfxCommandEncoder> encoders;
+        std::vector<GfxSemaphore> waitSems;
+        std::vector<GfxPipelineStageFlags> waitStages;
+        std::vector<GfxSemaphore> signalSems;
+    };
+    std::vector<Storage> storage(submitDescriptors.size());
+    std::vector<GfxSubmitDescriptor> cDescriptors(submitDescriptors.size());
+
+    for (size_t i = 0; i < submitDescriptors.size(); ++i) {
+        convertSubmitDescriptor(submitDescriptors[i], cDescriptors[i], storage[i].encoders, storage[i].waitSems, storage[i].waitStages, storage[i].signalSems);
+    }
+
+    return cResultToCppResult(gfxQueueSubmitBatch(m_handle, cDescriptors.data(), static_cast<uint32_t>(cDescriptors.size())));
+}
+
+Result QueueImpl::flush()
+{
+    return cResultToCppResult(gfxQueueFlush(m_handle));
+}
+
 void QueueImpl::writeBuffer(std::shared_ptr<Buffer> buffer, uint64_t offset, const void* data, uint64_t size)
 {
     auto impl = std::dynamic_pointer_cast<BufferImpl>(buffer);
@@ -6,6 +6,7 @@
 #include <gfx/gfx.h>
 
 #include <memory>
+#include <vector>
 
 namespace gfx {
 
@@ -16,6 +17,8 @@ public:
     ~QueueImpl() override = default;
 
     Result submit(const SubmitDescriptor& submitDescriptor) override;
+    Result submitBatch(const std::vector<SubmitDescriptor>& submitDescriptors) override;
+    Result flush() override;
     void writeBuffer(std::shared_ptr<Buffer> buffer, uint64_t offset, const void* data, uint64_t size) override;
     void writeTexture(std::shared_ptr<Texture> texture, const Origin3D& origin, uint32_t mipLevel, const void* data, uint64_t dataSize, const Extent3D& extent, TextureLayout finalLayout) override;
     void waitIdle() override;
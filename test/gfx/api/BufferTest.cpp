@@ -191,6 +191,66 @@ TEST_P(GfxBufferTest, MapUnmapBuffer)
     gfxBufferDestroy(buffer);
 }
 
+TEST_P(GfxBufferTest, PersistentMappedPointer)
+{
+    GfxBufferDescriptor desc = {};
+    desc.label = "Persistent Buffer";
+    desc.size = 256;
+    desc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_MAP_PERSISTENT | GFX_BUFFER_USAGE_UNIFORM);
+    desc.memoryProperties = GFX_FLAGS(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT);
+
+    GfxBuffer buffer = NULL;
+    GfxResult result = gfxDeviceCreateBuffer(device, &desc, &buffer);
+    if (result == GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED) {
+        GTEST_SKIP() << "Persistent mapping not supported by this backend";
+    }
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    void* first = NULL;
+    ASSERT_EQ(gfxBufferGetMappedPointer(buffer, &first), GFX_RESULT_SUCCESS);
+    ASSERT_NE(first, nullptr);
+
+    uint32_t testData[] = { 1, 2, 3, 4 };
+    std::memcpy(first, testData, sizeof(testData));
+
+    // The pointer is stable across calls and unaffected by map/unmap
+    void* mapped = NULL;
+    ASSERT_EQ(gfxBufferMap(buffer, 16, 16, &mapped), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(mapped, static_cast<char*>(first) + 16);
+    EXPECT_EQ(gfxBufferUnmap(buffer), GFX_RESULT_SUCCESS);
+
+    void* second = NULL;
+    ASSERT_EQ(gfxBufferGetMappedPointer(buffer, &second), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(static_cast<uint32_t*>(second)[3], 4u);
+
+    gfxBufferDestroy(buffer);
+}
+
+TEST_P(GfxBufferTest, PersistentMappedPointerRequiresUsage)
+{
+    GfxBufferDescriptor desc = {};
+    desc.size = 256;
+    desc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_MAP_WRITE | GFX_BUFFER_USAGE_COPY_SRC);
+    desc.memoryProperties = GFX_FLAGS(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT);
+
+    GfxBuffer buffer = NULL;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &desc, &buffer), GFX_RESULT_SUCCESS);
+
+    void* mappedData = NULL;
+    EXPECT_NE(gfxBufferGetMappedPointer(buffer, &mappedData), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxBufferGetMappedPointer(buffer, NULL), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+
+    gfxBufferDestroy(buffer);
+
+    // Persistent mapping needs host-visible memory
+    desc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_MAP_PERSISTENT | GFX_BUFFER_USAGE_UNIFORM);
+    desc.memoryProperties = GFX_FLAGS(GFX_MEMORY_PROPERTY_DEVICE_LOCAL);
+    buffer = NULL;
+    EXPECT_NE(gfxDeviceCreateBuffer(device, &desc, &buffer), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(buffer, nullptr);
+}
+
 TEST_P(GfxBufferTest, MapBufferInvalidArguments)
 {
     GfxBufferDescriptor desc = {};
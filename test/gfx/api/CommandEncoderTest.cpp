@@ -449,6 +449,45 @@ TEST_P(GfxCommandEncoderTest, PipelineBarrierEmpty)
     gfxCommandEncoderDestroy(encoder);
 }
 
+// Statistics tests
+TEST_P(GfxCommandEncoderTest, GetStatsWithNullEncoder)
+{
+    GfxCommandEncoderStats stats = {};
+    GfxResult result = gfxCommandEncoderGetStats(nullptr, &stats);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxCommandEncoderTest, GetStatsWithNullOutput)
+{
+    GfxCommandEncoder encoder = nullptr;
+    GfxCommandEncoderDescriptor desc = {};
+    desc.label = "test_encoder";
+    ASSERT_EQ(gfxDeviceCreateCommandEncoder(device, &desc, &encoder), GFX_RESULT_SUCCESS);
+
+    GfxResult result = gfxCommandEncoderGetStats(encoder, nullptr);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+
+    gfxCommandEncoderDestroy(encoder);
+}
+
+TEST_P(GfxCommandEncoderTest, GetStatsAfterBeginReportsNothingFiltered)
+{
+    GfxCommandEncoder encoder = nullptr;
+    GfxCommandEncoderDescriptor desc = {};
+    desc.label = "test_encoder";
+    ASSERT_EQ(gfxDeviceCreateCommandEncoder(device, &desc, &encoder), GFX_RESULT_SUCCESS);
+    ASSERT_EQ(gfxCommandEncoderBegin(encoder), GFX_RESULT_SUCCESS);
+
+    GfxCommandEncoderStats stats = {};
+    stats.filteredCommandCount = 42;
+    GfxResult result = gfxCommandEncoderGetStats(encoder, &stats);
+    EXPECT_EQ(result, GFX_RESULT_SUCCESS);
+    EXPECT_EQ(stats.filteredCommandCount, 0u);
+
+    gfxCommandEncoderEnd(encoder);
+    gfxCommandEncoderDestroy(encoder);
+}
+
 // ===========================================================================
 // Test Instantiation
 // ===========================================================================
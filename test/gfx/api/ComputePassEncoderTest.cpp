@@ -86,6 +86,13 @@ TEST_P(GfxComputePassEncoderTest, SetBindGroupWithNullEncoder)
     EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_P(GfxComputePassEncoderTest, SetImmediateDataWithNullEncoder)
+{
+    uint32_t data = 0;
+    GfxResult result = gfxComputePassEncoderSetImmediateData(nullptr, 0, &data, sizeof(data));
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_P(GfxComputePassEncoderTest, DispatchWithNullEncoder)
 {
     GfxResult result = gfxComputePassEncoderDispatch(nullptr, 1, 1, 1);
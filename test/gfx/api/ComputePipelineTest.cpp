@@ -275,6 +275,155 @@ TEST_P(GfxComputePipelineTest, CreateBasicComputePipeline)
     gfxShaderDestroy(computeShader);
 }
 
+// Test: Create ComputePipeline asynchronously
+TEST_P(GfxComputePipelineTest, CreateComputePipelineAsync)
+{
+    GfxShaderDescriptor shaderDesc = {};
+    shaderDesc.label = "Test Compute Shader";
+    if (backend == GFX_BACKEND_VULKAN) {
+        shaderDesc.sourceType = GFX_SHADER_SOURCE_SPIRV;
+        shaderDesc.code = spirvComputeShader;
+        shaderDesc.codeSize = sizeof(spirvComputeShader);
+    } else {
+        shaderDesc.sourceType = GFX_SHADER_SOURCE_WGSL;
+        shaderDesc.code = wgslComputeShader;
+        shaderDesc.codeSize = strlen(wgslComputeShader) + 1;
+    }
+    shaderDesc.entryPoint = "main";
+
+    GfxShader computeShader = nullptr;
+    GfxResult result = gfxDeviceCreateShader(device, &shaderDesc, &computeShader);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxComputePipelineDescriptor pipelineDesc = {};
+    pipelineDesc.label = "Async Compute Pipeline";
+    pipelineDesc.compute = computeShader;
+    pipelineDesc.entryPoint = "main";
+
+    struct Completion {
+        int callCount = 0;
+        GfxResult result = GFX_RESULT_ERROR_UNKNOWN;
+        GfxComputePipeline pipeline = nullptr;
+    } completion;
+
+    auto callback = [](GfxResult callbackResult, GfxComputePipeline pipeline, void* userData) {
+        auto* completion = static_cast<Completion*>(userData);
+        ++completion->callCount;
+        completion->result = callbackResult;
+        completion->pipeline = pipeline;
+    };
+
+    result = gfxDeviceCreateComputePipelineAsync(device, &pipelineDesc, callback, &completion);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    // Waiting for the device also waits for pending pipeline callbacks
+    ASSERT_EQ(gfxDeviceWaitIdle(device), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(completion.callCount, 1);
+    EXPECT_EQ(completion.result, GFX_RESULT_SUCCESS);
+    EXPECT_NE(completion.pipeline, nullptr);
+
+    gfxComputePipelineDestroy(completion.pipeline);
+    gfxShaderDestroy(computeShader);
+}
+
+// Test: Async creation requires a callback
+TEST_P(GfxComputePipelineTest, CreateComputePipelineAsyncWithNullCallback)
+{
+    GfxComputePipelineDescriptor pipelineDesc = {};
+    GfxResult result = gfxDeviceCreateComputePipelineAsync(device, &pipelineDesc, nullptr, nullptr);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+// Test: Immediate data ranges must be 4 byte aligned
+TEST_P(GfxComputePipelineTest, CreateComputePipelineWithUnalignedImmediateDataRange)
+{
+    GfxShaderDescriptor shaderDesc = {};
+    shaderDesc.label = "Test Compute Shader";
+    if (backend == GFX_BACKEND_VULKAN) {
+        shaderDesc.sourceType = GFX_SHADER_SOURCE_SPIRV;
+        shaderDesc.code = spirvComputeShader;
+        shaderDesc.codeSize = sizeof(spirvComputeShader);
+    } else {
+        shaderDesc.sourceType = GFX_SHADER_SOURCE_WGSL;
+        shaderDesc.code = wgslComputeShader;
+        shaderDesc.codeSize = strlen(wgslComputeShader) + 1;
+    }
+    shaderDesc.entryPoint = "main";
+
+    GfxShader computeShader = nullptr;
+    GfxResult result = gfxDeviceCreateShader(device, &shaderDesc, &computeShader);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxImmediateDataRange range = {};
+    range.visibility = GFX_SHADER_STAGE_COMPUTE;
+    range.offset = 0;
+    range.size = 6;
+
+    GfxComputePipelineDescriptor pipelineDesc = {};
+    pipelineDesc.compute = computeShader;
+    pipelineDesc.immediateDataRanges = &range;
+    pipelineDesc.immediateDataRangeCount = 1;
+
+    GfxComputePipeline pipeline = nullptr;
+    result = gfxDeviceCreateComputePipeline(device, &pipelineDesc, &pipeline);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(pipeline, nullptr);
+
+    gfxShaderDestroy(computeShader);
+}
+
+// Test: WebGPU reserves the bind group after the pipeline's own for immediate data
+TEST_P(GfxComputePipelineTest, CreateComputePipelineWithImmediateDataAndAllBindGroups)
+{
+    if (backend != GFX_BACKEND_WEBGPU) {
+        GTEST_SKIP() << "Only WebGPU reserves a bind group for immediate data";
+    }
+
+    GfxBindGroupLayoutEntry entry = {};
+    entry.binding = 0;
+    entry.visibility = GFX_SHADER_STAGE_COMPUTE;
+    entry.type = GFX_BINDING_TYPE_BUFFER;
+
+    GfxBindGroupLayoutDescriptor layoutDesc = {};
+    layoutDesc.entries = &entry;
+    layoutDesc.entryCount = 1;
+
+    GfxBindGroupLayout bindGroupLayout = nullptr;
+    ASSERT_EQ(gfxDeviceCreateBindGroupLayout(device, &layoutDesc, &bindGroupLayout), GFX_RESULT_SUCCESS);
+
+    GfxShaderDescriptor shaderDesc = {};
+    shaderDesc.sourceType = GFX_SHADER_SOURCE_WGSL;
+    shaderDesc.code = wgslComputeShader;
+    shaderDesc.codeSize = strlen(wgslComputeShader) + 1;
+    shaderDesc.entryPoint = "main";
+
+    GfxShader computeShader = nullptr;
+    ASSERT_EQ(gfxDeviceCreateShader(device, &shaderDesc, &computeShader), GFX_RESULT_SUCCESS);
+
+    GfxImmediateDataRange range = {};
+    range.visibility = GFX_SHADER_STAGE_COMPUTE;
+    range.offset = 0;
+    range.size = 16;
+
+    // The device has 4 bind groups, all taken by the pipeline
+    GfxBindGroupLayout bindGroupLayouts[4] = { bindGroupLayout, bindGroupLayout, bindGroupLayout, bindGroupLayout };
+
+    GfxComputePipelineDescriptor pipelineDesc = {};
+    pipelineDesc.compute = computeShader;
+    pipelineDesc.entryPoint = "main";
+    pipelineDesc.bindGroupLayouts = bindGroupLayouts;
+    pipelineDesc.bindGroupLayoutCount = 4;
+    pipelineDesc.immediateDataRanges = &range;
+    pipelineDesc.immediateDataRangeCount = 1;
+
+    GfxComputePipeline pipeline = nullptr;
+    EXPECT_EQ(gfxDeviceCreateComputePipeline(device, &pipelineDesc, &pipeline), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(pipeline, nullptr);
+
+    gfxShaderDestroy(computeShader);
+    gfxBindGroupLayoutDestroy(bindGroupLayout);
+}
+
 // Test: Create ComputePipeline with bind group layouts
 TEST_P(GfxComputePipelineTest, CreateComputePipelineWithBindGroupLayouts)
 {
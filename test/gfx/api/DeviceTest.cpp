@@ -1,5 +1,8 @@
 #include "CommonTest.h"
 
+#include <algorithm>
+#include <cstring>
+
 // C API tests compiled with C++ for GoogleTest compatibility
 
 // ===========================================================================
@@ -184,6 +187,62 @@ TEST_P(GfxDeviceTest, WaitIdle)
     EXPECT_EQ(result, GFX_RESULT_SUCCESS);
 }
 
+TEST_P(GfxDeviceTest, Poll)
+{
+    GfxDeviceDescriptor desc = {};
+
+    GfxResult result = gfxAdapterCreateDevice(adapter, &desc, &device);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    result = gfxDevicePoll(device);
+    EXPECT_EQ(result, GFX_RESULT_SUCCESS);
+}
+
+TEST_P(GfxDeviceTest, PollInvalidArguments)
+{
+    EXPECT_EQ(gfxDevicePoll(NULL), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxDeviceTest, DestroyBufferWithPendingUpload)
+{
+    GfxDeviceDescriptor desc = {};
+
+    GfxResult result = gfxAdapterCreateDevice(adapter, &desc, &device);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxQueue queue = NULL;
+    ASSERT_EQ(gfxDeviceGetQueue(device, &queue), GFX_RESULT_SUCCESS);
+
+    GfxBufferDescriptor bufferDesc = {};
+    bufferDesc.size = 256;
+    bufferDesc.usage = GFX_BUFFER_USAGE_COPY_DST;
+    bufferDesc.memoryProperties = GFX_MEMORY_PROPERTY_DEVICE_LOCAL;
+
+    GfxBuffer buffer = NULL;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &bufferDesc, &buffer), GFX_RESULT_SUCCESS);
+
+    // The staged copy into the buffer is still pending when it is destroyed
+    uint32_t data[64] = {};
+    ASSERT_EQ(gfxQueueWriteBuffer(queue, buffer, 0, data, sizeof(data)), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxBufferDestroy(buffer), GFX_RESULT_SUCCESS);
+
+    GfxFenceDescriptor fenceDesc = {};
+    fenceDesc.sType = GFX_STRUCTURE_TYPE_FENCE_DESCRIPTOR;
+    GfxFence fence = NULL;
+    ASSERT_EQ(gfxDeviceCreateFence(device, &fenceDesc, &fence), GFX_RESULT_SUCCESS);
+
+    GfxSubmitDescriptor submitDesc = {};
+    submitDesc.sType = GFX_STRUCTURE_TYPE_SUBMIT_DESCRIPTOR;
+    submitDesc.signalFence = fence;
+    EXPECT_EQ(gfxQueueSubmit(queue, &submitDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxFenceWait(fence, GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+
+    EXPECT_EQ(gfxDevicePoll(device), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxDeviceWaitIdle(device), GFX_RESULT_SUCCESS);
+
+    gfxFenceDestroy(fence);
+}
+
 TEST_P(GfxDeviceTest, GetLimits)
 {
     GfxDeviceDescriptor desc = {};
@@ -199,6 +258,287 @@ TEST_P(GfxDeviceTest, GetLimits)
     EXPECT_GT(limits.maxTextureDimension2D, 0u);
 }
 
+TEST_P(GfxDeviceTest, GetMemoryStats)
+{
+    GfxDeviceDescriptor desc = {};
+
+    GfxResult result = gfxAdapterCreateDevice(adapter, &desc, &device);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxDeviceMemoryStats stats = {};
+    result = gfxDeviceGetMemoryStats(device, &stats);
+    if (result == GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED) {
+        GTEST_SKIP() << "Memory statistics not supported by this backend";
+    }
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxBufferDescriptor bufferDesc = {};
+    bufferDesc.sType = GFX_STRUCTURE_TYPE_BUFFER_DESCRIPTOR;
+    bufferDesc.size = 1024;
+    bufferDesc.usage = GFX_BUFFER_USAGE_UNIFORM | GFX_BUFFER_USAGE_COPY_DST;
+    bufferDesc.memoryProperties = GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT;
+
+    GfxBuffer buffer = NULL;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &bufferDesc, &buffer), GFX_RESULT_SUCCESS);
+
+    GfxDeviceMemoryStats withBuffer = {};
+    ASSERT_EQ(gfxDeviceGetMemoryStats(device, &withBuffer), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(withBuffer.allocationCount, stats.allocationCount + 1);
+    EXPECT_GE(withBuffer.usedBytes, stats.usedBytes + bufferDesc.size);
+    EXPECT_GE(withBuffer.reservedBytes, withBuffer.usedBytes);
+    EXPECT_GE(withBuffer.fragmentation, 0.0f);
+    EXPECT_LE(withBuffer.fragmentation, 1.0f);
+
+    gfxBufferDestroy(buffer);
+}
+
+TEST_P(GfxDeviceTest, PipelineCacheDataRoundTrip)
+{
+    GfxDeviceDescriptor desc = {};
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &desc, &device), GFX_RESULT_SUCCESS);
+
+    size_t dataSize = 0;
+    GfxResult result = gfxDeviceGetPipelineCacheData(device, &dataSize, nullptr);
+    if (result == GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED) {
+        GTEST_SKIP() << "Pipeline cache data not supported by this backend";
+    }
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+    ASSERT_GT(dataSize, 0u);
+
+    std::vector<uint8_t> data(dataSize);
+    ASSERT_EQ(gfxDeviceGetPipelineCacheData(device, &dataSize, data.data()), GFX_RESULT_SUCCESS);
+
+    // Seeding a second device with the saved data must be accepted
+    GfxDevicePipelineCacheDescriptor cacheDesc = {};
+    cacheDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR;
+    cacheDesc.initialData = data.data();
+    cacheDesc.initialDataSize = dataSize;
+    bool accepted = false;
+    cacheDesc.initialDataAccepted = &accepted;
+
+    GfxDeviceDescriptor seededDesc = {};
+    seededDesc.pNext = &cacheDesc;
+    GfxDevice seededDevice = NULL;
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &seededDesc, &seededDevice), GFX_RESULT_SUCCESS);
+    EXPECT_TRUE(accepted);
+
+    size_t seededSize = 0;
+    EXPECT_EQ(gfxDeviceGetPipelineCacheData(seededDevice, &seededSize, nullptr), GFX_RESULT_SUCCESS);
+    EXPECT_GE(seededSize, dataSize);
+    gfxDeviceDestroy(seededDevice);
+}
+
+TEST_P(GfxDeviceTest, PipelineCacheDataFromOtherDriver_NotAccepted)
+{
+    // Not a cache header of any driver, so the device starts with an empty cache
+    std::vector<uint8_t> garbage(256, 0xcd);
+    GfxDevicePipelineCacheDescriptor cacheDesc = {};
+    cacheDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR;
+    cacheDesc.initialData = garbage.data();
+    cacheDesc.initialDataSize = garbage.size();
+    bool accepted = true;
+    cacheDesc.initialDataAccepted = &accepted;
+
+    GfxDeviceDescriptor desc = {};
+    desc.pNext = &cacheDesc;
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &desc, &device), GFX_RESULT_SUCCESS);
+    EXPECT_FALSE(accepted);
+}
+
+TEST_P(GfxDeviceTest, PipelineCacheDataInvalidArguments)
+{
+    GfxDeviceDescriptor desc = {};
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &desc, &device), GFX_RESULT_SUCCESS);
+
+    EXPECT_EQ(gfxDeviceGetPipelineCacheData(device, nullptr, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+
+    // Size without data is rejected at device creation
+    GfxDevicePipelineCacheDescriptor cacheDesc = {};
+    cacheDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_PIPELINE_CACHE_DESCRIPTOR;
+    cacheDesc.initialDataSize = 16;
+
+    GfxDeviceDescriptor badDesc = {};
+    badDesc.pNext = &cacheDesc;
+    GfxDevice badDevice = NULL;
+    EXPECT_EQ(gfxAdapterCreateDevice(adapter, &badDesc, &badDevice), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxDeviceTest, UploadQueueRequiresExtension)
+{
+    GfxDeviceDescriptor desc = {};
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &desc, &device), GFX_RESULT_SUCCESS);
+
+    GfxSemaphore semaphore = NULL;
+    EXPECT_EQ(gfxDeviceGetUploadSemaphore(device, &semaphore), GFX_RESULT_ERROR_FEATURE_NOT_SUPPORTED);
+}
+
+TEST_P(GfxDeviceTest, UploadQueueBufferSignalsSemaphore)
+{
+    uint32_t extensionCount = 0;
+    gfxAdapterEnumerateExtensions(adapter, &extensionCount, nullptr);
+    std::vector<const char*> supportedExtensions(extensionCount);
+    gfxAdapterEnumerateExtensions(adapter, &extensionCount, supportedExtensions.data());
+    bool supported = std::any_of(supportedExtensions.begin(), supportedExtensions.end(),
+        [](const char* name) { return strcmp(name, GFX_DEVICE_EXTENSION_UPLOAD_QUEUE) == 0; });
+    if (!supported) {
+        GTEST_SKIP() << "Upload queue not supported";
+    }
+
+    const char* deviceExtensions[] = { GFX_DEVICE_EXTENSION_UPLOAD_QUEUE };
+    GfxDeviceDescriptor desc = {};
+    desc.enabledExtensions = deviceExtensions;
+    desc.enabledExtensionCount = 1;
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &desc, &device), GFX_RESULT_SUCCESS);
+
+    GfxSemaphore semaphore = NULL;
+    ASSERT_EQ(gfxDeviceGetUploadSemaphore(device, &semaphore), GFX_RESULT_SUCCESS);
+    GfxSemaphoreType type = GFX_SEMAPHORE_TYPE_BINARY;
+    ASSERT_EQ(gfxSemaphoreGetType(semaphore, &type), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(type, GFX_SEMAPHORE_TYPE_TIMELINE);
+
+    GfxBufferDescriptor bufferDesc = {};
+    bufferDesc.sType = GFX_STRUCTURE_TYPE_BUFFER_DESCRIPTOR;
+    bufferDesc.size = 64 * 1024;
+    bufferDesc.usage = GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_COPY_DST;
+    bufferDesc.memoryProperties = GFX_MEMORY_PROPERTY_DEVICE_LOCAL;
+
+    GfxBuffer buffer = NULL;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &bufferDesc, &buffer), GFX_RESULT_SUCCESS);
+
+    std::vector<uint8_t> data(bufferDesc.size, 0x5a);
+    uint64_t first = 0;
+    uint64_t second = 0;
+    ASSERT_EQ(gfxDeviceUploadBuffer(device, buffer, 0, data.data(), data.size(), &first), GFX_RESULT_SUCCESS);
+    ASSERT_EQ(gfxDeviceUploadBuffer(device, buffer, 0, data.data(), data.size(), &second), GFX_RESULT_SUCCESS);
+    EXPECT_GT(first, 0u);
+    EXPECT_GT(second, first);
+
+    EXPECT_EQ(gfxSemaphoreWait(semaphore, second, GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+    uint64_t value = 0;
+    ASSERT_EQ(gfxSemaphoreGetValue(semaphore, &value), GFX_RESULT_SUCCESS);
+    EXPECT_GE(value, second);
+
+    gfxBufferDestroy(buffer);
+}
+
+TEST_P(GfxDeviceTest, GetProcTable)
+{
+    GfxDeviceDescriptor desc = {};
+
+    GfxResult result = gfxAdapterCreateDevice(adapter, &desc, &device);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxProcTable procTable = {};
+    result = gfxDeviceGetProcTable(device, &procTable);
+
+    EXPECT_EQ(result, GFX_RESULT_SUCCESS);
+    EXPECT_NE(procTable.queueSubmit, nullptr);
+    EXPECT_NE(procTable.renderPassEncoderDraw, nullptr);
+    EXPECT_NE(procTable.renderPassEncoderSetBindGroup, nullptr);
+    EXPECT_NE(procTable.computePassEncoderDispatch, nullptr);
+
+    // Proc table entries validate their arguments like the regular entry points
+    EXPECT_EQ(procTable.renderPassEncoderDraw(nullptr, 3, 1, 0, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(procTable.queueSubmit(nullptr, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxDeviceTest, GetProcTableInvalidArguments)
+{
+    GfxDeviceDescriptor desc = {};
+
+    GfxResult result = gfxAdapterCreateDevice(adapter, &desc, &device);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    result = gfxDeviceGetProcTable(device, nullptr);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+
+    GfxProcTable procTable = {};
+    result = gfxDeviceGetProcTable(nullptr, &procTable);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxDeviceTest, GetProcTableRecordsAndSubmits)
+{
+    GfxDeviceDescriptor desc = {};
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &desc, &device), GFX_RESULT_SUCCESS);
+
+    GfxProcTable procTable = {};
+    ASSERT_EQ(gfxDeviceGetProcTable(device, &procTable), GFX_RESULT_SUCCESS);
+
+    GfxQueue queue = NULL;
+    ASSERT_EQ(gfxDeviceGetQueue(device, &queue), GFX_RESULT_SUCCESS);
+
+    GfxBufferDescriptor srcDesc = {};
+    srcDesc.label = "Proc Table Source";
+    srcDesc.size = 256;
+    srcDesc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_COPY_SRC | GFX_BUFFER_USAGE_COPY_DST);
+    srcDesc.memoryProperties = GFX_MEMORY_PROPERTY_DEVICE_LOCAL;
+    GfxBuffer srcBuffer = NULL;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &srcDesc, &srcBuffer), GFX_RESULT_SUCCESS);
+
+    GfxBufferDescriptor dstDesc = {};
+    dstDesc.label = "Proc Table Readback";
+    dstDesc.size = 256;
+    dstDesc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_MAP_READ | GFX_BUFFER_USAGE_COPY_DST);
+    dstDesc.memoryProperties = GFX_FLAGS(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT);
+    GfxBuffer dstBuffer = NULL;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &dstDesc, &dstBuffer), GFX_RESULT_SUCCESS);
+
+    uint32_t data[64];
+    for (uint32_t i = 0; i < 64; ++i) {
+        data[i] = 0xA5000000u | i;
+    }
+    EXPECT_EQ(procTable.queueWriteBuffer(queue, srcBuffer, 0, data, sizeof(data)), GFX_RESULT_SUCCESS);
+
+    GfxCommandEncoderDescriptor encoderDesc = {};
+    encoderDesc.label = "Proc Table Encoder";
+    GfxCommandEncoder encoder = NULL;
+    ASSERT_EQ(gfxDeviceCreateCommandEncoder(device, &encoderDesc, &encoder), GFX_RESULT_SUCCESS);
+
+    // Copy the upper half to the front and the lower half behind it, so a wrong
+    // offset or size shows up in the readback
+    GfxCopyBufferToBufferDescriptor copyDesc = {};
+    copyDesc.source = srcBuffer;
+    copyDesc.destination = dstBuffer;
+    copyDesc.size = 128;
+    EXPECT_EQ(procTable.commandEncoderBegin(encoder), GFX_RESULT_SUCCESS);
+    copyDesc.sourceOffset = 128;
+    copyDesc.destinationOffset = 0;
+    EXPECT_EQ(procTable.commandEncoderCopyBufferToBuffer(encoder, &copyDesc), GFX_RESULT_SUCCESS);
+    copyDesc.sourceOffset = 0;
+    copyDesc.destinationOffset = 128;
+    EXPECT_EQ(procTable.commandEncoderCopyBufferToBuffer(encoder, &copyDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(procTable.commandEncoderEnd(encoder), GFX_RESULT_SUCCESS);
+
+    GfxFenceDescriptor fenceDesc = {};
+    fenceDesc.sType = GFX_STRUCTURE_TYPE_FENCE_DESCRIPTOR;
+    GfxFence fence = NULL;
+    ASSERT_EQ(gfxDeviceCreateFence(device, &fenceDesc, &fence), GFX_RESULT_SUCCESS);
+
+    GfxSubmitDescriptor submitDesc = {};
+    submitDesc.sType = GFX_STRUCTURE_TYPE_SUBMIT_DESCRIPTOR;
+    submitDesc.commandEncoders = &encoder;
+    submitDesc.commandEncoderCount = 1;
+    submitDesc.signalFence = fence;
+    EXPECT_EQ(procTable.queueSubmit(queue, &submitDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxFenceWait(fence, GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+
+    void* mapped = NULL;
+    ASSERT_EQ(gfxBufferMap(dstBuffer, 0, 256, &mapped), GFX_RESULT_SUCCESS);
+    ASSERT_NE(mapped, nullptr);
+    const uint32_t* result = static_cast<const uint32_t*>(mapped);
+    for (uint32_t i = 0; i < 32; ++i) {
+        EXPECT_EQ(result[i], data[32 + i]) << "at " << i;
+        EXPECT_EQ(result[32 + i], data[i]) << "at " << 32 + i;
+    }
+    EXPECT_EQ(gfxBufferUnmap(dstBuffer), GFX_RESULT_SUCCESS);
+
+    gfxFenceDestroy(fence);
+    gfxCommandEncoderDestroy(encoder);
+    gfxBufferDestroy(dstBuffer);
+    gfxBufferDestroy(srcBuffer);
+}
+
 TEST_P(GfxDeviceTest, MultipleDevices)
 {
     // WebGPU backend doesn't support multiple devices from the same adapter
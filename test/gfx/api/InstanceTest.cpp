@@ -1,6 +1,7 @@
 #include "CommonTest.h"
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -118,6 +119,73 @@ TEST_P(GfxInstanceTest, WithEnabledFeatures)
     // Surface feature may not be available in headless builds
 }
 
+TEST_P(GfxInstanceTest, WithValidationLevels)
+{
+    // Each instance is the only live one of the backend, so each picks its own level
+    const GfxValidationLevel levels[] = { GFX_VALIDATION_LEVEL_DISABLED, GFX_VALIDATION_LEVEL_HANDLES_ONLY, GFX_VALIDATION_LEVEL_FULL };
+    for (GfxValidationLevel level : levels) {
+        GfxInstanceValidationDescriptor validationDesc = {};
+        validationDesc.sType = GFX_STRUCTURE_TYPE_INSTANCE_VALIDATION_DESCRIPTOR;
+        validationDesc.pNext = nullptr;
+        validationDesc.level = level;
+
+        GfxInstanceDescriptor desc = {};
+        desc.sType = GFX_STRUCTURE_TYPE_INSTANCE_DESCRIPTOR;
+        desc.pNext = &validationDesc;
+        desc.backend = backend;
+
+        GfxInstance localInstance = NULL;
+        ASSERT_EQ(gfxCreateInstance(&desc, &localInstance), GFX_RESULT_SUCCESS);
+        EXPECT_NE(localInstance, nullptr);
+
+        // Handle checks in the C API layer are unaffected by the backend validation level
+        GfxAdapter adapter = NULL;
+        EXPECT_EQ(gfxInstanceRequestAdapter(localInstance, nullptr, &adapter), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+
+        EXPECT_EQ(gfxInstanceDestroy(localInstance), GFX_RESULT_SUCCESS);
+    }
+}
+
+TEST_P(GfxInstanceTest, WithValidationLevels_LaterInstanceWarnsInsteadOfChangingLevel)
+{
+    std::atomic<int> warningCount{ 0 };
+    gfxSetLogCallback([](GfxLogLevel level, const char*, void* userData) {
+        if (level == GFX_LOG_LEVEL_WARNING) {
+            ++*static_cast<std::atomic<int>*>(userData);
+        }
+    },
+        &warningCount);
+
+    GfxInstanceValidationDescriptor validationDesc = {};
+    validationDesc.sType = GFX_STRUCTURE_TYPE_INSTANCE_VALIDATION_DESCRIPTOR;
+    validationDesc.level = GFX_VALIDATION_LEVEL_HANDLES_ONLY;
+
+    GfxInstanceDescriptor desc = {};
+    desc.sType = GFX_STRUCTURE_TYPE_INSTANCE_DESCRIPTOR;
+    desc.pNext = &validationDesc;
+    desc.backend = backend;
+
+    GfxInstance first = NULL;
+    ASSERT_EQ(gfxCreateInstance(&desc, &first), GFX_RESULT_SUCCESS);
+    int warningsBefore = warningCount.load();
+
+    // Same level: nothing to report
+    GfxInstance same = NULL;
+    ASSERT_EQ(gfxCreateInstance(&desc, &same), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(warningCount.load(), warningsBefore);
+
+    // A different level is not applied while the first instance is alive
+    validationDesc.level = GFX_VALIDATION_LEVEL_FULL;
+    GfxInstance other = NULL;
+    ASSERT_EQ(gfxCreateInstance(&desc, &other), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(warningCount.load(), warningsBefore + 1);
+
+    EXPECT_EQ(gfxInstanceDestroy(other), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxInstanceDestroy(same), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxInstanceDestroy(first), GFX_RESULT_SUCCESS);
+    gfxSetLogCallback(nullptr, nullptr);
+}
+
 TEST_P(GfxInstanceTest, RequestAdapterInvalidArguments)
 {
     const char* extensions[] = { GFX_INSTANCE_EXTENSION_DEBUG };
@@ -159,6 +159,103 @@ TEST_P(GfxQueueTest, SubmitWithEmptyDescriptor)
     EXPECT_EQ(result, GFX_RESULT_SUCCESS);
 }
 
+// Test: Queue submit batch with NULL queue
+TEST_P(GfxQueueTest, SubmitBatchWithNullQueue)
+{
+    GfxSubmitDescriptor submitDescs[2] = {};
+    GfxResult result = gfxQueueSubmitBatch(nullptr, submitDescs, 2);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+// Test: Queue submit batch with NULL descriptors
+TEST_P(GfxQueueTest, SubmitBatchWithNullDescriptors)
+{
+    GfxQueue queue = nullptr;
+    GfxResult result = gfxDeviceGetQueue(device, &queue);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    result = gfxQueueSubmitBatch(queue, nullptr, 2);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+// Test: Queue submit batch signals the fence of every descriptor
+TEST_P(GfxQueueTest, SubmitBatchSignalsFences)
+{
+    GfxQueue queue = nullptr;
+    GfxResult result = gfxDeviceGetQueue(device, &queue);
+    ASSERT_EQ(result, GFX_RESULT_SUCCESS);
+
+    GfxFenceDescriptor fenceDesc = {};
+    fenceDesc.sType = GFX_STRUCTURE_TYPE_FENCE_DESCRIPTOR;
+    fenceDesc.signaled = false;
+
+    GfxFence fences[2] = {};
+    ASSERT_EQ(gfxDeviceCreateFence(device, &fenceDesc, &fences[0]), GFX_RESULT_SUCCESS);
+    ASSERT_EQ(gfxDeviceCreateFence(device, &fenceDesc, &fences[1]), GFX_RESULT_SUCCESS);
+
+    // A fence in the middle splits the batch, the last descriptor has none
+    GfxSubmitDescriptor submitDescs[4] = {};
+    for (GfxSubmitDescriptor& submitDesc : submitDescs) {
+        submitDesc.sType = GFX_STRUCTURE_TYPE_SUBMIT_DESCRIPTOR;
+    }
+    submitDescs[1].signalFence = fences[0];
+    submitDescs[2].signalFence = fences[1];
+
+    result = gfxQueueSubmitBatch(queue, submitDescs, 4);
+    EXPECT_EQ(result, GFX_RESULT_SUCCESS);
+
+    EXPECT_EQ(gfxFenceWait(fences[0], GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxFenceWait(fences[1], GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+
+    gfxFenceDestroy(fences[0]);
+    gfxFenceDestroy(fences[1]);
+}
+
+// Test: Queue flush with NULL queue
+TEST_P(GfxQueueTest, FlushWithNullQueue)
+{
+    EXPECT_EQ(gfxQueueFlush(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+// Test: Deferred submits reach the GPU at the next flush point
+TEST_P(GfxQueueTest, DeferredSubmitsFlush)
+{
+    GfxDeviceSubmitDescriptor submitModeDesc = {};
+    submitModeDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_SUBMIT_DESCRIPTOR;
+    submitModeDesc.deferSubmits = true;
+
+    GfxDeviceDescriptor deviceDesc = {};
+    deviceDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_DESCRIPTOR;
+    deviceDesc.pNext = &submitModeDesc;
+    deviceDesc.label = "Deferred Submit Device";
+
+    GfxDevice deferredDevice = nullptr;
+    ASSERT_EQ(gfxAdapterCreateDevice(adapter, &deviceDesc, &deferredDevice), GFX_RESULT_SUCCESS);
+
+    GfxQueue queue = nullptr;
+    ASSERT_EQ(gfxDeviceGetQueue(deferredDevice, &queue), GFX_RESULT_SUCCESS);
+
+    GfxFenceDescriptor fenceDesc = {};
+    fenceDesc.sType = GFX_STRUCTURE_TYPE_FENCE_DESCRIPTOR;
+    fenceDesc.signaled = false;
+    GfxFence fence = nullptr;
+    ASSERT_EQ(gfxDeviceCreateFence(deferredDevice, &fenceDesc, &fence), GFX_RESULT_SUCCESS);
+
+    GfxSubmitDescriptor submitDesc = {};
+    submitDesc.sType = GFX_STRUCTURE_TYPE_SUBMIT_DESCRIPTOR;
+    EXPECT_EQ(gfxQueueSubmit(queue, &submitDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxQueueSubmit(queue, &submitDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxQueueFlush(queue), GFX_RESULT_SUCCESS);
+
+    // A fence is a flush point on its own
+    submitDesc.signalFence = fence;
+    EXPECT_EQ(gfxQueueSubmit(queue, &submitDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxFenceWait(fence, GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+
+    gfxFenceDestroy(fence);
+    gfxDeviceDestroy(deferredDevice);
+}
+
 // Test: Queue write buffer with NULL queue
 TEST_P(GfxQueueTest, WriteBufferWithNullQueue)
 {
@@ -73,6 +73,69 @@ protected:
     GfxDevice device = nullptr;
 };
 
+// Simple WGSL vertex shader
+static const char* wgslVertexShader = R"(
+@vertex
+fn main(@location(0) position: vec3<f32>) -> @builtin(position) vec4<f32> {
+    return vec4<f32>(position, 1.0);
+}
+)";
+
+// Simple WGSL fragment shader
+static const char* wgslFragmentShader = R"(
+@fragment
+fn main() -> @location(0) vec4<f32> {
+    return vec4<f32>(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+// Simple SPIR-V vertex shader binary
+// Equivalent GLSL: void main() { gl_Position = vec4(position, 1.0); }
+static const uint32_t spirvVertexShader[] = {
+    0x07230203, 0x00010000, 0x0008000b, 0x0000001b, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+    0x0007000f, 0x00000000, 0x00000004, 0x6e69616d, 0x00000000, 0x0000000d, 0x00000012, 0x00030003,
+    0x00000002, 0x000001c2, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000b,
+    0x505f6c67, 0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x0000000b, 0x00000000, 0x505f6c67,
+    0x7469736f, 0x006e6f69, 0x00070006, 0x0000000b, 0x00000001, 0x505f6c67, 0x746e696f, 0x657a6953,
+    0x00000000, 0x00070006, 0x0000000b, 0x00000002, 0x435f6c67, 0x4470696c, 0x61747369, 0x0065636e,
+    0x00070006, 0x0000000b, 0x00000003, 0x435f6c67, 0x446c6c75, 0x61747369, 0x0065636e, 0x00030005,
+    0x0000000d, 0x00000000, 0x00050005, 0x00000012, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00030047,
+    0x0000000b, 0x00000002, 0x00050048, 0x0000000b, 0x00000000, 0x0000000b, 0x00000000, 0x00050048,
+    0x0000000b, 0x00000001, 0x0000000b, 0x00000001, 0x00050048, 0x0000000b, 0x00000002, 0x0000000b,
+    0x00000003, 0x00050048, 0x0000000b, 0x00000003, 0x0000000b, 0x00000004, 0x00040047, 0x00000012,
+    0x0000001e, 0x00000000, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00030016,
+    0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006, 0x00000004, 0x00040015, 0x00000008,
+    0x00000020, 0x00000000, 0x0004002b, 0x00000008, 0x00000009, 0x00000001, 0x0004001c, 0x0000000a,
+    0x00000006, 0x00000009, 0x0006001e, 0x0000000b, 0x00000007, 0x00000006, 0x0000000a, 0x0000000a,
+    0x00040020, 0x0000000c, 0x00000003, 0x0000000b, 0x0004003b, 0x0000000c, 0x0000000d, 0x00000003,
+    0x00040015, 0x0000000e, 0x00000020, 0x00000001, 0x0004002b, 0x0000000e, 0x0000000f, 0x00000000,
+    0x00040017, 0x00000010, 0x00000006, 0x00000003, 0x00040020, 0x00000011, 0x00000001, 0x00000010,
+    0x0004003b, 0x00000011, 0x00000012, 0x00000001, 0x0004002b, 0x00000006, 0x00000014, 0x3f800000,
+    0x00040020, 0x00000019, 0x00000003, 0x00000007, 0x00050036, 0x00000002, 0x00000004, 0x00000000,
+    0x00000003, 0x000200f8, 0x00000005, 0x0004003d, 0x00000010, 0x00000013, 0x00000012, 0x00050051,
+    0x00000006, 0x00000015, 0x00000013, 0x00000000, 0x00050051, 0x00000006, 0x00000016, 0x00000013,
+    0x00000001, 0x00050051, 0x00000006, 0x00000017, 0x00000013, 0x00000002, 0x00070050, 0x00000007,
+    0x00000018, 0x00000015, 0x00000016, 0x00000017, 0x00000014, 0x00050041, 0x00000019, 0x0000001a,
+    0x0000000d, 0x0000000f, 0x0003003e, 0x0000001a, 0x00000018, 0x000100fd, 0x00010038
+};
+
+// Simple SPIR-V fragment shader binary
+// Equivalent GLSL: void main() { fragColor = vec4(1.0, 0.0, 0.0, 1.0); }
+static const uint32_t spirvFragmentShader[] = {
+    0x07230203, 0x00010000, 0x0008000b, 0x0000000d, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+    0x0006000f, 0x00000004, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00030010, 0x00000004,
+    0x00000007, 0x00030003, 0x00000002, 0x000001c2, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000,
+    0x00050005, 0x00000009, 0x67617266, 0x6f6c6f43, 0x00000072, 0x00040047, 0x00000009, 0x0000001e,
+    0x00000000, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006,
+    0x00000020, 0x00040017, 0x00000007, 0x00000006, 0x00000004, 0x00040020, 0x00000008, 0x00000003,
+    0x00000007, 0x0004003b, 0x00000008, 0x00000009, 0x00000003, 0x0004002b, 0x00000006, 0x0000000a,
+    0x3f800000, 0x0004002b, 0x00000006, 0x0000000b, 0x00000000, 0x0007002c, 0x00000007, 0x0000000c,
+    0x0000000a, 0x0000000b, 0x0000000b, 0x0000000a, 0x00050036, 0x00000002, 0x00000004, 0x00000000,
+    0x00000003, 0x000200f8, 0x00000005, 0x0003003e, 0x00000009, 0x0000000c, 0x000100fd, 0x00010038
+};
+
 // NULL parameter validation tests
 TEST_P(GfxRenderPassEncoderTest, SetPipelineWithNullEncoder)
 {
@@ -134,6 +197,13 @@ TEST_P(GfxRenderPassEncoderTest, SetScissorRectWithNullScissor)
     EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_P(GfxRenderPassEncoderTest, SetImmediateDataWithNullEncoder)
+{
+    uint32_t data = 0;
+    GfxResult result = gfxRenderPassEncoderSetImmediateData(nullptr, 0, &data, sizeof(data));
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_P(GfxRenderPassEncoderTest, DrawWithNullEncoder)
 {
     GfxResult result = gfxRenderPassEncoderDraw(nullptr, 3, 1, 0, 0);
@@ -158,12 +228,321 @@ TEST_P(GfxRenderPassEncoderTest, DrawIndexedIndirectWithNullEncoder)
     EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_P(GfxRenderPassEncoderTest, MultiDrawIndirectWithNullEncoder)
+{
+    GfxResult result = gfxRenderPassEncoderMultiDrawIndirect(nullptr, nullptr, 0, 4, 0);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxRenderPassEncoderTest, MultiDrawIndexedIndirectWithNullEncoder)
+{
+    GfxResult result = gfxRenderPassEncoderMultiDrawIndexedIndirect(nullptr, nullptr, 0, 4, 0);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxRenderPassEncoderTest, MultiDrawIndirectCountWithNullEncoder)
+{
+    GfxResult result = gfxRenderPassEncoderMultiDrawIndirectCount(nullptr, nullptr, 0, nullptr, 0, 4, 0);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxRenderPassEncoderTest, MultiDrawIndexedIndirectCountWithNullEncoder)
+{
+    GfxResult result = gfxRenderPassEncoderMultiDrawIndexedIndirectCount(nullptr, nullptr, 0, nullptr, 0, 4, 0);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxRenderPassEncoderTest, ExecuteCommandStreamWithNullEncoder)
+{
+    GfxCommand command = {};
+    command.type = GFX_COMMAND_TYPE_DRAW;
+    command.draw.vertexCount = 3;
+    command.draw.instanceCount = 1;
+    GfxResult result = gfxRenderPassEncoderExecuteCommandStream(nullptr, &command, 1);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+// Replays a stream into a cleared target and reads it back: the scissor must limit the
+// full-screen triangle to the left half, so state records apply in stream order
+TEST_P(GfxRenderPassEncoderTest, ExecuteCommandStreamDraws)
+{
+    constexpr uint32_t width = 64; // 256-byte rows, so the readback is tightly packed on every backend
+    constexpr uint32_t height = 16;
+
+    GfxQueue queue = nullptr;
+    ASSERT_EQ(gfxDeviceGetQueue(device, &queue), GFX_RESULT_SUCCESS);
+
+    GfxTextureDescriptor textureDesc = {};
+    textureDesc.sType = GFX_STRUCTURE_TYPE_TEXTURE_DESCRIPTOR;
+    textureDesc.label = "Command Stream Target";
+    textureDesc.type = GFX_TEXTURE_TYPE_2D;
+    textureDesc.size = { width, height, 1 };
+    textureDesc.arrayLayerCount = 1;
+    textureDesc.mipLevelCount = 1;
+    textureDesc.sampleCount = GFX_SAMPLE_COUNT_1;
+    textureDesc.format = GFX_FORMAT_R8G8B8A8_UNORM;
+    textureDesc.usage = GFX_FLAGS(GFX_TEXTURE_USAGE_RENDER_ATTACHMENT | GFX_TEXTURE_USAGE_COPY_SRC);
+    GfxTexture texture = nullptr;
+    ASSERT_EQ(gfxDeviceCreateTexture(device, &textureDesc, &texture), GFX_RESULT_SUCCESS);
+
+    GfxTextureViewDescriptor viewDesc = {};
+    viewDesc.sType = GFX_STRUCTURE_TYPE_TEXTURE_VIEW_DESCRIPTOR;
+    viewDesc.viewType = GFX_TEXTURE_VIEW_TYPE_2D;
+    viewDesc.format = GFX_FORMAT_R8G8B8A8_UNORM;
+    viewDesc.mipLevelCount = 1;
+    viewDesc.arrayLayerCount = 1;
+    GfxTextureView view = nullptr;
+    ASSERT_EQ(gfxTextureCreateView(texture, &viewDesc, &view), GFX_RESULT_SUCCESS);
+
+    GfxRenderPassColorAttachment colorAttachment = {};
+    colorAttachment.target.format = GFX_FORMAT_R8G8B8A8_UNORM;
+    colorAttachment.target.sampleCount = GFX_SAMPLE_COUNT_1;
+    colorAttachment.target.ops.loadOp = GFX_LOAD_OP_CLEAR;
+    colorAttachment.target.ops.storeOp = GFX_STORE_OP_STORE;
+    colorAttachment.target.finalLayout = GFX_TEXTURE_LAYOUT_TRANSFER_SRC;
+
+    GfxRenderPassDescriptor renderPassDesc = {};
+    renderPassDesc.sType = GFX_STRUCTURE_TYPE_RENDER_PASS_DESCRIPTOR;
+    renderPassDesc.colorAttachments = &colorAttachment;
+    renderPassDesc.colorAttachmentCount = 1;
+    GfxRenderPass renderPass = nullptr;
+    ASSERT_EQ(gfxDeviceCreateRenderPass(device, &renderPassDesc, &renderPass), GFX_RESULT_SUCCESS);
+
+    GfxFramebufferAttachment framebufferAttachment = { view, nullptr };
+    GfxFramebufferDescriptor framebufferDesc = {};
+    framebufferDesc.sType = GFX_STRUCTURE_TYPE_FRAMEBUFFER_DESCRIPTOR;
+    framebufferDesc.renderPass = renderPass;
+    framebufferDesc.colorAttachments = &framebufferAttachment;
+    framebufferDesc.colorAttachmentCount = 1;
+    framebufferDesc.extent = { width, height };
+    GfxFramebuffer framebuffer = nullptr;
+    ASSERT_EQ(gfxDeviceCreateFramebuffer(device, &framebufferDesc, &framebuffer), GFX_RESULT_SUCCESS);
+
+    GfxShaderDescriptor vertexShaderDesc = {};
+    GfxShaderDescriptor fragmentShaderDesc = {};
+    if (backend == GFX_BACKEND_VULKAN) {
+        vertexShaderDesc.sourceType = GFX_SHADER_SOURCE_SPIRV;
+        vertexShaderDesc.code = spirvVertexShader;
+        vertexShaderDesc.codeSize = sizeof(spirvVertexShader);
+        fragmentShaderDesc.sourceType = GFX_SHADER_SOURCE_SPIRV;
+        fragmentShaderDesc.code = spirvFragmentShader;
+        fragmentShaderDesc.codeSize = sizeof(spirvFragmentShader);
+    } else {
+        vertexShaderDesc.sourceType = GFX_SHADER_SOURCE_WGSL;
+        vertexShaderDesc.code = wgslVertexShader;
+        vertexShaderDesc.codeSize = strlen(wgslVertexShader) + 1;
+        fragmentShaderDesc.sourceType = GFX_SHADER_SOURCE_WGSL;
+        fragmentShaderDesc.code = wgslFragmentShader;
+        fragmentShaderDesc.codeSize = strlen(wgslFragmentShader) + 1;
+    }
+    vertexShaderDesc.entryPoint = "main";
+    fragmentShaderDesc.entryPoint = "main";
+    GfxShader vertexShader = nullptr;
+    GfxShader fragmentShader = nullptr;
+    ASSERT_EQ(gfxDeviceCreateShader(device, &vertexShaderDesc, &vertexShader), GFX_RESULT_SUCCESS);
+    ASSERT_EQ(gfxDeviceCreateShader(device, &fragmentShaderDesc, &fragmentShader), GFX_RESULT_SUCCESS);
+
+    GfxVertexAttribute vertexAttr = {};
+    vertexAttr.format = GFX_FORMAT_R32G32B32_FLOAT;
+    vertexAttr.shaderLocation = 0;
+
+    GfxVertexBufferLayout vertexBufferLayout = {};
+    vertexBufferLayout.arrayStride = 12;
+    vertexBufferLayout.attributes = &vertexAttr;
+    vertexBufferLayout.attributeCount = 1;
+    vertexBufferLayout.stepMode = GFX_VERTEX_STEP_MODE_VERTEX;
+
+    GfxVertexState vertexState = {};
+    vertexState.module = vertexShader;
+    vertexState.entryPoint = "main";
+    vertexState.buffers = &vertexBufferLayout;
+    vertexState.bufferCount = 1;
+
+    GfxColorTargetState colorTarget = {};
+    colorTarget.format = GFX_FORMAT_R8G8B8A8_UNORM;
+    colorTarget.writeMask = GFX_COLOR_WRITE_MASK_ALL;
+
+    GfxFragmentState fragmentState = {};
+    fragmentState.module = fragmentShader;
+    fragmentState.entryPoint = "main";
+    fragmentState.targets = &colorTarget;
+    fragmentState.targetCount = 1;
+
+    GfxPrimitiveState primitiveState = {};
+    primitiveState.topology = GFX_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    primitiveState.stripIndexFormat = GFX_INDEX_FORMAT_UNDEFINED;
+    primitiveState.frontFace = GFX_FRONT_FACE_COUNTER_CLOCKWISE;
+    primitiveState.cullMode = GFX_CULL_MODE_NONE;
+    primitiveState.polygonMode = GFX_POLYGON_MODE_FILL;
+
+    GfxRenderPipelineDescriptor pipelineDesc = {};
+    pipelineDesc.sType = GFX_STRUCTURE_TYPE_RENDER_PIPELINE_DESCRIPTOR;
+    pipelineDesc.renderPass = renderPass;
+    pipelineDesc.vertex = &vertexState;
+    pipelineDesc.fragment = &fragmentState;
+    pipelineDesc.primitive = &primitiveState;
+    pipelineDesc.sampleCount = GFX_SAMPLE_COUNT_1;
+    GfxRenderPipeline pipeline = nullptr;
+    ASSERT_EQ(gfxDeviceCreateRenderPipeline(device, &pipelineDesc, &pipeline), GFX_RESULT_SUCCESS);
+
+    // One triangle covering the whole target, whatever the clip-space Y direction
+    const float vertices[] = { -1.0f, -1.0f, 0.0f, 3.0f, -1.0f, 0.0f, -1.0f, 3.0f, 0.0f };
+    GfxBufferDescriptor vertexBufferDesc = {};
+    vertexBufferDesc.size = sizeof(vertices);
+    vertexBufferDesc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_COPY_DST);
+    vertexBufferDesc.memoryProperties = GFX_MEMORY_PROPERTY_DEVICE_LOCAL;
+    GfxBuffer vertexBuffer = nullptr;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &vertexBufferDesc, &vertexBuffer), GFX_RESULT_SUCCESS);
+    ASSERT_EQ(gfxQueueWriteBuffer(queue, vertexBuffer, 0, vertices, sizeof(vertices)), GFX_RESULT_SUCCESS);
+
+    GfxBufferDescriptor readbackDesc = {};
+    readbackDesc.size = width * height * 4;
+    readbackDesc.usage = GFX_FLAGS(GFX_BUFFER_USAGE_MAP_READ | GFX_BUFFER_USAGE_COPY_DST);
+    readbackDesc.memoryProperties = GFX_FLAGS(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT);
+    GfxBuffer readback = nullptr;
+    ASSERT_EQ(gfxDeviceCreateBuffer(device, &readbackDesc, &readback), GFX_RESULT_SUCCESS);
+
+    GfxCommandEncoderDescriptor encoderDesc = {};
+    GfxCommandEncoder encoder = nullptr;
+    ASSERT_EQ(gfxDeviceCreateCommandEncoder(device, &encoderDesc, &encoder), GFX_RESULT_SUCCESS);
+
+    const GfxColor clearColor = { 0.0f, 0.0f, 1.0f, 1.0f };
+    GfxRenderPassBeginDescriptor beginDesc = {};
+    beginDesc.sType = GFX_STRUCTURE_TYPE_RENDER_PASS_BEGIN_DESCRIPTOR;
+    beginDesc.renderPass = renderPass;
+    beginDesc.framebuffer = framebuffer;
+    beginDesc.colorClearValues = &clearColor;
+    beginDesc.colorClearValueCount = 1;
+    GfxRenderPassEncoder passEncoder = nullptr;
+    ASSERT_EQ(gfxCommandEncoderBeginRenderPass(encoder, &beginDesc, &passEncoder), GFX_RESULT_SUCCESS);
+
+    GfxCommand commands[5] = {};
+    commands[0].type = GFX_COMMAND_TYPE_SET_PIPELINE;
+    commands[0].setPipeline.pipeline = pipeline;
+    commands[1].type = GFX_COMMAND_TYPE_SET_VERTEX_BUFFER;
+    commands[1].setVertexBuffer.buffer = vertexBuffer;
+    commands[1].setVertexBuffer.size = sizeof(vertices);
+    commands[2].type = GFX_COMMAND_TYPE_SET_VIEWPORT;
+    commands[2].setViewport = { 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f };
+    commands[3].type = GFX_COMMAND_TYPE_SET_SCISSOR_RECT;
+    commands[3].setScissorRect = { { 0, 0 }, { width / 2, height } };
+    commands[4].type = GFX_COMMAND_TYPE_DRAW;
+    commands[4].draw.vertexCount = 3;
+    commands[4].draw.instanceCount = 1;
+    EXPECT_EQ(gfxRenderPassEncoderExecuteCommandStream(passEncoder, commands, 5), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxRenderPassEncoderEnd(passEncoder), GFX_RESULT_SUCCESS);
+
+    GfxCopyTextureToBufferDescriptor copyDesc = {};
+    copyDesc.source = texture;
+    copyDesc.destination = readback;
+    copyDesc.extent = { width, height, 1 };
+    copyDesc.finalLayout = GFX_TEXTURE_LAYOUT_TRANSFER_SRC;
+    EXPECT_EQ(gfxCommandEncoderCopyTextureToBuffer(encoder, &copyDesc), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxCommandEncoderEnd(encoder), GFX_RESULT_SUCCESS);
+
+    GfxFenceDescriptor fenceDesc = {};
+    fenceDesc.sType = GFX_STRUCTURE_TYPE_FENCE_DESCRIPTOR;
+    GfxFence fence = nullptr;
+    ASSERT_EQ(gfxDeviceCreateFence(device, &fenceDesc, &fence), GFX_RESULT_SUCCESS);
+
+    GfxSubmitDescriptor submitDesc = {};
+    submitDesc.sType = GFX_STRUCTURE_TYPE_SUBMIT_DESCRIPTOR;
+    submitDesc.commandEncoders = &encoder;
+    submitDesc.commandEncoderCount = 1;
+    submitDesc.signalFence = fence;
+    ASSERT_EQ(gfxQueueSubmit(queue, &submitDesc), GFX_RESULT_SUCCESS);
+    ASSERT_EQ(gfxFenceWait(fence, GFX_TIMEOUT_INFINITE), GFX_RESULT_SUCCESS);
+
+    void* mapped = nullptr;
+    ASSERT_EQ(gfxBufferMap(readback, 0, readbackDesc.size, &mapped), GFX_RESULT_SUCCESS);
+    ASSERT_NE(mapped, nullptr);
+    const uint8_t* pixels = static_cast<const uint8_t*>(mapped);
+    for (uint32_t y = 0; y < height; y += height - 1) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint8_t* pixel = pixels + (y * width + x) * 4;
+            const bool drawn = x < width / 2;
+            EXPECT_EQ(pixel[0], drawn ? 255 : 0) << "at " << x << "," << y;
+            EXPECT_EQ(pixel[2], drawn ? 0 : 255) << "at " << x << "," << y;
+            EXPECT_EQ(pixel[3], 255) << "at " << x << "," << y;
+        }
+    }
+    EXPECT_EQ(gfxBufferUnmap(readback), GFX_RESULT_SUCCESS);
+
+    gfxFenceDestroy(fence);
+    gfxCommandEncoderDestroy(encoder);
+    gfxBufferDestroy(readback);
+    gfxBufferDestroy(vertexBuffer);
+    gfxRenderPipelineDestroy(pipeline);
+    gfxShaderDestroy(fragmentShader);
+    gfxShaderDestroy(vertexShader);
+    gfxFramebufferDestroy(framebuffer);
+    gfxRenderPassDestroy(renderPass);
+    gfxTextureViewDestroy(view);
+    gfxTextureDestroy(texture);
+}
+
 TEST_P(GfxRenderPassEncoderTest, EndWithNullEncoder)
 {
     GfxResult result = gfxRenderPassEncoderEnd(nullptr);
     EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_P(GfxRenderPassEncoderTest, ExecuteBundlesWithNullEncoder)
+{
+    GfxResult result = gfxRenderPassEncoderExecuteBundles(nullptr, nullptr, 0);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxRenderPassEncoderTest, CreateRenderBundleEncoderWithNullRenderPass)
+{
+    GfxRenderBundleEncoderDescriptor desc = {};
+    desc.sType = GFX_STRUCTURE_TYPE_RENDER_BUNDLE_ENCODER_DESCRIPTOR;
+    desc.renderPass = nullptr;
+
+    GfxRenderBundleEncoder encoder = nullptr;
+    GfxResult result = gfxDeviceCreateRenderBundleEncoder(device, &desc, &encoder);
+    EXPECT_EQ(result, GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_P(GfxRenderPassEncoderTest, RenderBundleEncoderFinishTwice)
+{
+    GfxRenderPassColorAttachment colorAttachment = {};
+    colorAttachment.target.format = GFX_FORMAT_R8G8B8A8_UNORM;
+    colorAttachment.target.sampleCount = GFX_SAMPLE_COUNT_1;
+    colorAttachment.target.ops.loadOp = GFX_LOAD_OP_CLEAR;
+    colorAttachment.target.ops.storeOp = GFX_STORE_OP_STORE;
+    colorAttachment.target.finalLayout = GFX_TEXTURE_LAYOUT_COLOR_ATTACHMENT;
+
+    GfxRenderPassDescriptor renderPassDesc = {};
+    renderPassDesc.colorAttachments = &colorAttachment;
+    renderPassDesc.colorAttachmentCount = 1;
+
+    GfxRenderPass renderPass = nullptr;
+    ASSERT_EQ(gfxDeviceCreateRenderPass(device, &renderPassDesc, &renderPass), GFX_RESULT_SUCCESS);
+
+    GfxRenderBundleEncoderDescriptor desc = {};
+    desc.sType = GFX_STRUCTURE_TYPE_RENDER_BUNDLE_ENCODER_DESCRIPTOR;
+    desc.label = "Test Bundle Encoder";
+    desc.renderPass = renderPass;
+
+    GfxRenderBundleEncoder encoder = nullptr;
+    ASSERT_EQ(gfxDeviceCreateRenderBundleEncoder(device, &desc, &encoder), GFX_RESULT_SUCCESS);
+
+    GfxViewport viewport = { 0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f };
+    EXPECT_EQ(gfxRenderBundleEncoderSetViewport(encoder, &viewport), GFX_RESULT_SUCCESS);
+
+    GfxRenderBundle bundle = nullptr;
+    EXPECT_EQ(gfxRenderBundleEncoderFinish(encoder, &bundle), GFX_RESULT_SUCCESS);
+    EXPECT_NE(bundle, nullptr);
+
+    GfxRenderBundle secondBundle = nullptr;
+    EXPECT_EQ(gfxRenderBundleEncoderFinish(encoder, &secondBundle), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(gfxRenderBundleDestroy(bundle), GFX_RESULT_SUCCESS);
+    EXPECT_EQ(gfxRenderBundleEncoderDestroy(encoder), GFX_RESULT_SUCCESS);
+    gfxRenderPassDestroy(renderPass);
+}
+
 // ===========================================================================
 // Test Instantiation
 // ===========================================================================
@@ -49,7 +49,9 @@ public:
     MOCK_METHOD(GfxResult, deviceCreateBindGroupLayout, (GfxDevice, const GfxBindGroupLayoutDescriptor*, GfxBindGroupLayout*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateBindGroup, (GfxDevice, const GfxBindGroupDescriptor*, GfxBindGroup*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateRenderPipeline, (GfxDevice, const GfxRenderPipelineDescriptor*, GfxRenderPipeline*), (const, override));
+    MOCK_METHOD(GfxResult, deviceCreateRenderPipelineAsync, (GfxDevice, const GfxRenderPipelineDescriptor*, GfxCreateRenderPipelineCallback, void*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateComputePipeline, (GfxDevice, const GfxComputePipelineDescriptor*, GfxComputePipeline*), (const, override));
+    MOCK_METHOD(GfxResult, deviceCreateComputePipelineAsync, (GfxDevice, const GfxComputePipelineDescriptor*, GfxCreateComputePipelineCallback, void*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateCommandEncoder, (GfxDevice, const GfxCommandEncoderDescriptor*, GfxCommandEncoder*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateRenderPass, (GfxDevice, const GfxRenderPassDescriptor*, GfxRenderPass*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateFramebuffer, (GfxDevice, const GfxFramebufferDescriptor*, GfxFramebuffer*), (const, override));
@@ -57,7 +59,14 @@ public:
     MOCK_METHOD(GfxResult, deviceCreateSemaphore, (GfxDevice, const GfxSemaphoreDescriptor*, GfxSemaphore*), (const, override));
     MOCK_METHOD(GfxResult, deviceCreateQuerySet, (GfxDevice, const GfxQuerySetDescriptor*, GfxQuerySet*), (const, override));
     MOCK_METHOD(GfxResult, deviceWaitIdle, (GfxDevice), (const, override));
+    MOCK_METHOD(GfxResult, devicePoll, (GfxDevice), (const, override));
     MOCK_METHOD(GfxResult, deviceGetLimits, (GfxDevice, GfxDeviceLimits*), (const, override));
+    MOCK_METHOD(GfxResult, deviceGetMemoryStats, (GfxDevice, GfxDeviceMemoryStats*), (const, override));
+    MOCK_METHOD(GfxResult, deviceGetPipelineCacheData, (GfxDevice, size_t*, void*), (const, override));
+    MOCK_METHOD(GfxResult, deviceGetUploadSemaphore, (GfxDevice, GfxSemaphore*), (const, override));
+    MOCK_METHOD(GfxResult, deviceUploadBuffer, (GfxDevice, GfxBuffer, uint64_t, const void*, uint64_t, uint64_t*), (const, override));
+    MOCK_METHOD(GfxResult, deviceUploadTexture, (GfxDevice, GfxTexture, const GfxOrigin3D*, const GfxExtent3D*, uint32_t, const void*, uint64_t, GfxTextureLayout, uint64_t*), (const, override));
+    MOCK_METHOD(GfxResult, deviceGetProcTable, (GfxDevice, GfxProcTable*), (const, override));
 
     // Surface functions
     MOCK_METHOD(GfxResult, surfaceDestroy, (GfxSurface), (const, override));
@@ -78,6 +87,7 @@ public:
     MOCK_METHOD(GfxResult, bufferGetInfo, (GfxBuffer, GfxBufferInfo*), (const, override));
     MOCK_METHOD(GfxResult, bufferGetNativeHandle, (GfxBuffer, void**), (const, override));
     MOCK_METHOD(GfxResult, bufferMap, (GfxBuffer, uint64_t, uint64_t, void**), (const, override));
+    MOCK_METHOD(GfxResult, bufferGetMappedPointer, (GfxBuffer, void**), (const, override));
     MOCK_METHOD(GfxResult, bufferUnmap, (GfxBuffer), (const, override));
 
     // Texture functions
@@ -130,6 +140,7 @@ public:
     MOCK_METHOD(GfxResult, commandEncoderResolveQuerySet, (GfxCommandEncoder, GfxQuerySet, uint32_t, uint32_t, GfxBuffer, uint64_t), (const, override));
     MOCK_METHOD(GfxResult, commandEncoderEnd, (GfxCommandEncoder), (const, override));
     MOCK_METHOD(GfxResult, commandEncoderBegin, (GfxCommandEncoder), (const, override));
+    MOCK_METHOD(GfxResult, commandEncoderGetStats, (GfxCommandEncoder, GfxCommandEncoderStats*), (const, override));
 
     // RenderPassEncoder functions
     MOCK_METHOD(GfxResult, renderPassEncoderSetPipeline, (GfxRenderPassEncoder, GfxRenderPipeline), (const, override));
@@ -138,23 +149,45 @@ public:
     MOCK_METHOD(GfxResult, renderPassEncoderSetIndexBuffer, (GfxRenderPassEncoder, GfxBuffer, GfxIndexFormat, uint64_t, uint64_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderSetViewport, (GfxRenderPassEncoder, const GfxViewport*), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderSetScissorRect, (GfxRenderPassEncoder, const GfxScissorRect*), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderSetImmediateData, (GfxRenderPassEncoder, uint32_t, const void*, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderDraw, (GfxRenderPassEncoder, uint32_t, uint32_t, uint32_t, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderDrawIndexed, (GfxRenderPassEncoder, uint32_t, uint32_t, uint32_t, int32_t, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderDrawIndirect, (GfxRenderPassEncoder, GfxBuffer, uint64_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderDrawIndexedIndirect, (GfxRenderPassEncoder, GfxBuffer, uint64_t), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderMultiDrawIndirect, (GfxRenderPassEncoder, GfxBuffer, uint64_t, uint32_t, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderMultiDrawIndexedIndirect, (GfxRenderPassEncoder, GfxBuffer, uint64_t, uint32_t, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderMultiDrawIndirectCount, (GfxRenderPassEncoder, GfxBuffer, uint64_t, GfxBuffer, uint64_t, uint32_t, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderMultiDrawIndexedIndirectCount, (GfxRenderPassEncoder, GfxBuffer, uint64_t, GfxBuffer, uint64_t, uint32_t, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderExecuteCommandStream, (GfxRenderPassEncoder, const GfxCommand*, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderEnd, (GfxRenderPassEncoder), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderBeginOcclusionQuery, (GfxRenderPassEncoder, GfxQuerySet, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, renderPassEncoderEndOcclusionQuery, (GfxRenderPassEncoder), (const, override));
+    MOCK_METHOD(GfxResult, renderPassEncoderExecuteBundles, (GfxRenderPassEncoder, const GfxRenderBundle*, uint32_t), (const, override));
 
     // ComputePassEncoder functions
     MOCK_METHOD(GfxResult, computePassEncoderSetPipeline, (GfxComputePassEncoder, GfxComputePipeline), (const, override));
     MOCK_METHOD(GfxResult, computePassEncoderSetBindGroup, (GfxComputePassEncoder, uint32_t, GfxBindGroup, const uint32_t*, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, computePassEncoderSetImmediateData, (GfxComputePassEncoder, uint32_t, const void*, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, computePassEncoderDispatch, (GfxComputePassEncoder, uint32_t, uint32_t, uint32_t), (const, override));
     MOCK_METHOD(GfxResult, computePassEncoderDispatchIndirect, (GfxComputePassEncoder, GfxBuffer, uint64_t), (const, override));
     MOCK_METHOD(GfxResult, computePassEncoderEnd, (GfxComputePassEncoder), (const, override));
+    MOCK_METHOD(GfxResult, deviceCreateRenderBundleEncoder, (GfxDevice, const GfxRenderBundleEncoderDescriptor*, GfxRenderBundleEncoder*), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderDestroy, (GfxRenderBundleEncoder), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderSetPipeline, (GfxRenderBundleEncoder, GfxRenderPipeline), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderSetBindGroup, (GfxRenderBundleEncoder, uint32_t, GfxBindGroup, const uint32_t*, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderSetVertexBuffer, (GfxRenderBundleEncoder, uint32_t, GfxBuffer, uint64_t, uint64_t), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderSetIndexBuffer, (GfxRenderBundleEncoder, GfxBuffer, GfxIndexFormat, uint64_t, uint64_t), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderSetViewport, (GfxRenderBundleEncoder, const GfxViewport*), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderSetScissorRect, (GfxRenderBundleEncoder, const GfxScissorRect*), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderDraw, (GfxRenderBundleEncoder, uint32_t, uint32_t, uint32_t, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderDrawIndexed, (GfxRenderBundleEncoder, uint32_t, uint32_t, uint32_t, int32_t, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleEncoderFinish, (GfxRenderBundleEncoder, GfxRenderBundle*), (const, override));
+    MOCK_METHOD(GfxResult, renderBundleDestroy, (GfxRenderBundle), (const, override));
 
     // Queue functions
     MOCK_METHOD(GfxResult, queueSubmit, (GfxQueue, const GfxSubmitDescriptor*), (const, override));
+    MOCK_METHOD(GfxResult, queueSubmitBatch, (GfxQueue, const GfxSubmitDescriptor*, uint32_t), (const, override));
+    MOCK_METHOD(GfxResult, queueFlush, (GfxQueue), (const, override));
     MOCK_METHOD(GfxResult, queueWriteBuffer, (GfxQueue, GfxBuffer, uint64_t, const void*, uint64_t), (const, override));
     MOCK_METHOD(GfxResult, queueWriteTexture, (GfxQueue, GfxTexture, const GfxOrigin3D*, const GfxExtent3D*, uint32_t, const void*, uint64_t, GfxTextureLayout), (const, override));
     MOCK_METHOD(GfxResult, queueWaitIdle, (GfxQueue), (const, override));
@@ -574,6 +607,18 @@ TEST_F(GfxImplTest, BufferMap_NullOutPointer_ReturnsError)
     ASSERT_EQ(gfxBufferMap(buffer, 0, 0, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, BufferGetMappedPointer_NullBuffer_ReturnsError)
+{
+    void* mapped;
+    ASSERT_EQ(gfxBufferGetMappedPointer(nullptr, &mapped), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, BufferGetMappedPointer_NullOutPointer_ReturnsError)
+{
+    GfxBuffer buffer = reinterpret_cast<GfxBuffer>(0x1);
+    ASSERT_EQ(gfxBufferGetMappedPointer(buffer, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(GfxImplTest, BufferUnmap_NullBuffer_ReturnsError)
 {
     ASSERT_EQ(gfxBufferUnmap(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
@@ -699,6 +744,34 @@ TEST_F(GfxImplTest, DeviceCreateComputePipeline_NullOutPipeline_ReturnsError)
     ASSERT_EQ(gfxDeviceCreateComputePipeline(device, &desc, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, DeviceCreateRenderPipelineAsync_NullDevice_ReturnsError)
+{
+    GfxRenderPipelineDescriptor desc = {};
+    auto callback = [](GfxResult, GfxRenderPipeline, void*) {};
+    ASSERT_EQ(gfxDeviceCreateRenderPipelineAsync(nullptr, &desc, callback, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceCreateRenderPipelineAsync_NullCallback_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    GfxRenderPipelineDescriptor desc = {};
+    ASSERT_EQ(gfxDeviceCreateRenderPipelineAsync(device, &desc, nullptr, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceCreateComputePipelineAsync_NullDescriptor_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    auto callback = [](GfxResult, GfxComputePipeline, void*) {};
+    ASSERT_EQ(gfxDeviceCreateComputePipelineAsync(device, nullptr, callback, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceCreateComputePipelineAsync_NullCallback_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    GfxComputePipelineDescriptor desc = {};
+    ASSERT_EQ(gfxDeviceCreateComputePipelineAsync(device, &desc, nullptr, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 // ============================================================================
 // Command Encoder Tests
 // ============================================================================
@@ -732,6 +805,18 @@ TEST_F(GfxImplTest, CommandEncoderEnd_NullEncoder_ReturnsError)
     ASSERT_EQ(gfxCommandEncoderEnd(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, CommandEncoderGetStats_NullEncoder_ReturnsError)
+{
+    GfxCommandEncoderStats stats;
+    ASSERT_EQ(gfxCommandEncoderGetStats(nullptr, &stats), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, CommandEncoderGetStats_NullOutStats_ReturnsError)
+{
+    GfxCommandEncoder encoder = reinterpret_cast<GfxCommandEncoder>(0x1);
+    ASSERT_EQ(gfxCommandEncoderGetStats(encoder, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 // ============================================================================
 // Queue Tests
 // ============================================================================
@@ -759,6 +844,17 @@ TEST_F(GfxImplTest, QueueWaitIdle_NullQueue_ReturnsError)
     ASSERT_EQ(gfxQueueWaitIdle(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, QueueSubmitBatch_NullQueue_ReturnsError)
+{
+    GfxSubmitDescriptor descs[2] = {};
+    ASSERT_EQ(gfxQueueSubmitBatch(nullptr, descs, 2), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, QueueFlush_NullQueue_ReturnsError)
+{
+    ASSERT_EQ(gfxQueueFlush(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 // ============================================================================
 // Swapchain Tests
 // ============================================================================
@@ -1167,6 +1263,11 @@ TEST_F(GfxImplTest, DeviceWaitIdle_NullDevice_ReturnsError)
     ASSERT_EQ(gfxDeviceWaitIdle(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, DevicePoll_NullDevice_ReturnsError)
+{
+    ASSERT_EQ(gfxDevicePoll(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(GfxImplTest, DeviceGetLimits_NullDevice_ReturnsError)
 {
     GfxDeviceLimits limits;
@@ -1179,6 +1280,80 @@ TEST_F(GfxImplTest, DeviceGetLimits_NullOutLimits_ReturnsError)
     ASSERT_EQ(gfxDeviceGetLimits(device, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, DeviceGetMemoryStats_NullDevice_ReturnsError)
+{
+    GfxDeviceMemoryStats stats;
+    ASSERT_EQ(gfxDeviceGetMemoryStats(nullptr, &stats), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetMemoryStats_NullOutStats_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    ASSERT_EQ(gfxDeviceGetMemoryStats(device, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetPipelineCacheData_NullDevice_ReturnsError)
+{
+    size_t dataSize = 0;
+    ASSERT_EQ(gfxDeviceGetPipelineCacheData(nullptr, &dataSize, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetPipelineCacheData_NullDataSize_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    ASSERT_EQ(gfxDeviceGetPipelineCacheData(device, nullptr, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetUploadSemaphore_NullDevice_ReturnsError)
+{
+    GfxSemaphore semaphore = nullptr;
+    ASSERT_EQ(gfxDeviceGetUploadSemaphore(nullptr, &semaphore), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetUploadSemaphore_NullOutSemaphore_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    ASSERT_EQ(gfxDeviceGetUploadSemaphore(device, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceUploadBuffer_NullBuffer_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    uint32_t data = 0;
+    uint64_t value = 0;
+    ASSERT_EQ(gfxDeviceUploadBuffer(device, nullptr, 0, &data, sizeof(data), &value), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceUploadBuffer_NullOutSignalValue_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    GfxBuffer buffer = reinterpret_cast<GfxBuffer>(0x1);
+    uint32_t data = 0;
+    ASSERT_EQ(gfxDeviceUploadBuffer(device, buffer, 0, &data, sizeof(data), nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceUploadTexture_NullExtent_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    GfxTexture texture = reinterpret_cast<GfxTexture>(0x1);
+    GfxOrigin3D origin = {};
+    uint32_t data = 0;
+    uint64_t value = 0;
+    ASSERT_EQ(gfxDeviceUploadTexture(device, texture, &origin, nullptr, 0, &data, sizeof(data), GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY, &value), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetProcTable_NullDevice_ReturnsError)
+{
+    GfxProcTable procTable;
+    ASSERT_EQ(gfxDeviceGetProcTable(nullptr, &procTable), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceGetProcTable_NullOutProcTable_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    ASSERT_EQ(gfxDeviceGetProcTable(device, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 // Pipeline Destroy
 TEST_F(GfxImplTest, RenderPipelineDestroy_NullPipeline_ReturnsError)
 {
@@ -1356,6 +1531,12 @@ TEST_F(GfxImplTest, RenderPassEncoderSetScissorRect_NullEncoder_ReturnsError)
     ASSERT_EQ(gfxRenderPassEncoderSetScissorRect(nullptr, &scissor), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, RenderPassEncoderSetImmediateData_NullEncoder_ReturnsError)
+{
+    uint32_t data = 0;
+    ASSERT_EQ(gfxRenderPassEncoderSetImmediateData(nullptr, 0, &data, sizeof(data)), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(GfxImplTest, RenderPassEncoderDraw_NullEncoder_ReturnsError)
 {
     ASSERT_EQ(gfxRenderPassEncoderDraw(nullptr, 0, 0, 0, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
@@ -1378,6 +1559,45 @@ TEST_F(GfxImplTest, RenderPassEncoderDrawIndexedIndirect_NullEncoder_ReturnsErro
     ASSERT_EQ(gfxRenderPassEncoderDrawIndexedIndirect(nullptr, buffer, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, RenderPassEncoderMultiDrawIndirect_NullEncoder_ReturnsError)
+{
+    GfxBuffer buffer = reinterpret_cast<GfxBuffer>(0x1);
+    ASSERT_EQ(gfxRenderPassEncoderMultiDrawIndirect(nullptr, buffer, 0, 4, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderPassEncoderMultiDrawIndexedIndirect_NullEncoder_ReturnsError)
+{
+    GfxBuffer buffer = reinterpret_cast<GfxBuffer>(0x1);
+    ASSERT_EQ(gfxRenderPassEncoderMultiDrawIndexedIndirect(nullptr, buffer, 0, 4, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderPassEncoderMultiDrawIndirectCount_NullEncoder_ReturnsError)
+{
+    GfxBuffer buffer = reinterpret_cast<GfxBuffer>(0x1);
+    GfxBuffer countBuffer = reinterpret_cast<GfxBuffer>(0x2);
+    ASSERT_EQ(gfxRenderPassEncoderMultiDrawIndirectCount(nullptr, buffer, 0, countBuffer, 0, 4, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderPassEncoderMultiDrawIndexedIndirectCount_NullEncoder_ReturnsError)
+{
+    GfxBuffer buffer = reinterpret_cast<GfxBuffer>(0x1);
+    GfxBuffer countBuffer = reinterpret_cast<GfxBuffer>(0x2);
+    ASSERT_EQ(gfxRenderPassEncoderMultiDrawIndexedIndirectCount(nullptr, buffer, 0, countBuffer, 0, 4, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderPassEncoderExecuteCommandStream_NullEncoder_ReturnsError)
+{
+    GfxCommand command = {};
+    command.type = GFX_COMMAND_TYPE_DRAW;
+    ASSERT_EQ(gfxRenderPassEncoderExecuteCommandStream(nullptr, &command, 1), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderPassEncoderExecuteCommandStream_NullCommands_ReturnsError)
+{
+    GfxRenderPassEncoder encoder = reinterpret_cast<GfxRenderPassEncoder>(0x1);
+    ASSERT_EQ(gfxRenderPassEncoderExecuteCommandStream(encoder, nullptr, 1), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(GfxImplTest, RenderPassEncoderBeginOcclusionQuery_NullEncoder_ReturnsError)
 {
     GfxQuerySet querySet = reinterpret_cast<GfxQuerySet>(0x1);
@@ -1389,6 +1609,18 @@ TEST_F(GfxImplTest, RenderPassEncoderEndOcclusionQuery_NullEncoder_ReturnsError)
     ASSERT_EQ(gfxRenderPassEncoderEndOcclusionQuery(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, RenderPassEncoderExecuteBundles_NullEncoder_ReturnsError)
+{
+    GfxRenderBundle bundle = reinterpret_cast<GfxRenderBundle>(0x1);
+    ASSERT_EQ(gfxRenderPassEncoderExecuteBundles(nullptr, &bundle, 1), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderPassEncoderExecuteBundles_NullBundles_ReturnsError)
+{
+    GfxRenderPassEncoder encoder = reinterpret_cast<GfxRenderPassEncoder>(0x1);
+    ASSERT_EQ(gfxRenderPassEncoderExecuteBundles(encoder, nullptr, 1), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(GfxImplTest, RenderPassEncoderEnd_NullEncoder_ReturnsError)
 {
     ASSERT_EQ(gfxRenderPassEncoderEnd(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
@@ -1407,6 +1639,12 @@ TEST_F(GfxImplTest, ComputePassEncoderSetBindGroup_NullEncoder_ReturnsError)
     ASSERT_EQ(gfxComputePassEncoderSetBindGroup(nullptr, 0, bindGroup, nullptr, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+TEST_F(GfxImplTest, ComputePassEncoderSetImmediateData_NullEncoder_ReturnsError)
+{
+    uint32_t data = 0;
+    ASSERT_EQ(gfxComputePassEncoderSetImmediateData(nullptr, 0, &data, sizeof(data)), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(GfxImplTest, ComputePassEncoderDispatch_NullEncoder_ReturnsError)
 {
     ASSERT_EQ(gfxComputePassEncoderDispatch(nullptr, 1, 1, 1), GFX_RESULT_ERROR_INVALID_ARGUMENT);
@@ -1423,6 +1661,56 @@ TEST_F(GfxImplTest, ComputePassEncoderEnd_NullEncoder_ReturnsError)
     ASSERT_EQ(gfxComputePassEncoderEnd(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
+// RenderBundle Encoder Operations
+TEST_F(GfxImplTest, DeviceCreateRenderBundleEncoder_NullDevice_ReturnsError)
+{
+    GfxRenderBundleEncoderDescriptor desc = {};
+    desc.renderPass = reinterpret_cast<GfxRenderPass>(0x1);
+    GfxRenderBundleEncoder encoder;
+    ASSERT_EQ(gfxDeviceCreateRenderBundleEncoder(nullptr, &desc, &encoder), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, DeviceCreateRenderBundleEncoder_NullOutput_ReturnsError)
+{
+    GfxDevice device = reinterpret_cast<GfxDevice>(0x1);
+    GfxRenderBundleEncoderDescriptor desc = {};
+    desc.renderPass = reinterpret_cast<GfxRenderPass>(0x1);
+    ASSERT_EQ(gfxDeviceCreateRenderBundleEncoder(device, &desc, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderBundleEncoderSetPipeline_NullEncoder_ReturnsError)
+{
+    GfxRenderPipeline pipeline = reinterpret_cast<GfxRenderPipeline>(0x1);
+    ASSERT_EQ(gfxRenderBundleEncoderSetPipeline(nullptr, pipeline), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderBundleEncoderDraw_NullEncoder_ReturnsError)
+{
+    ASSERT_EQ(gfxRenderBundleEncoderDraw(nullptr, 3, 1, 0, 0), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderBundleEncoderFinish_NullEncoder_ReturnsError)
+{
+    GfxRenderBundle bundle;
+    ASSERT_EQ(gfxRenderBundleEncoderFinish(nullptr, &bundle), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderBundleEncoderFinish_NullOutput_ReturnsError)
+{
+    GfxRenderBundleEncoder encoder = reinterpret_cast<GfxRenderBundleEncoder>(0x1);
+    ASSERT_EQ(gfxRenderBundleEncoderFinish(encoder, nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderBundleEncoderDestroy_NullEncoder_ReturnsError)
+{
+    ASSERT_EQ(gfxRenderBundleEncoderDestroy(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(GfxImplTest, RenderBundleDestroy_NullBundle_ReturnsError)
+{
+    ASSERT_EQ(gfxRenderBundleDestroy(nullptr), GFX_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
 // Fence Operations
 TEST_F(GfxImplTest, FenceGetStatus_NullFence_ReturnsError)
 {
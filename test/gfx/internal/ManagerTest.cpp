@@ -8,6 +8,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
 using ::testing::Return;
 
 namespace gfx::backend::test {
@@ -41,7 +46,9 @@ public:
     GfxResult deviceCreateBindGroupLayout(GfxDevice, const GfxBindGroupLayoutDescriptor*, GfxBindGroupLayout*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateBindGroup(GfxDevice, const GfxBindGroupDescriptor*, GfxBindGroup*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateRenderPipeline(GfxDevice, const GfxRenderPipelineDescriptor*, GfxRenderPipeline*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceCreateRenderPipelineAsync(GfxDevice, const GfxRenderPipelineDescriptor*, GfxCreateRenderPipelineCallback, void*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateComputePipeline(GfxDevice, const GfxComputePipelineDescriptor*, GfxComputePipeline*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceCreateComputePipelineAsync(GfxDevice, const GfxComputePipelineDescriptor*, GfxCreateComputePipelineCallback, void*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateCommandEncoder(GfxDevice, const GfxCommandEncoderDescriptor*, GfxCommandEncoder*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateRenderPass(GfxDevice, const GfxRenderPassDescriptor*, GfxRenderPass*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateFramebuffer(GfxDevice, const GfxFramebufferDescriptor*, GfxFramebuffer*) const override { return GFX_RESULT_SUCCESS; }
@@ -49,8 +56,15 @@ public:
     GfxResult deviceCreateSemaphore(GfxDevice, const GfxSemaphoreDescriptor*, GfxSemaphore*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceCreateQuerySet(GfxDevice, const GfxQuerySetDescriptor*, GfxQuerySet*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceWaitIdle(GfxDevice) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult devicePoll(GfxDevice) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceGetLimits(GfxDevice, GfxDeviceLimits*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceGetMemoryStats(GfxDevice, GfxDeviceMemoryStats*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceGetPipelineCacheData(GfxDevice, size_t*, void*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceGetUploadSemaphore(GfxDevice, GfxSemaphore*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceUploadBuffer(GfxDevice, GfxBuffer, uint64_t, const void*, uint64_t, uint64_t*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceUploadTexture(GfxDevice, GfxTexture, const GfxOrigin3D*, const GfxExtent3D*, uint32_t, const void*, uint64_t, GfxTextureLayout, uint64_t*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult deviceSupportsShaderFormat(GfxDevice, GfxShaderSourceType, bool*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceGetProcTable(GfxDevice, GfxProcTable*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult surfaceDestroy(GfxSurface) const override { return GFX_RESULT_SUCCESS; }
     GfxResult surfaceGetInfo(GfxSurface, GfxSurfaceInfo*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult surfaceEnumerateSupportedFormats(GfxSurface, uint32_t*, GfxFormat*) const override { return GFX_RESULT_SUCCESS; }
@@ -65,6 +79,7 @@ public:
     GfxResult bufferGetInfo(GfxBuffer, GfxBufferInfo*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult bufferGetNativeHandle(GfxBuffer, void**) const override { return GFX_RESULT_SUCCESS; }
     GfxResult bufferMap(GfxBuffer, uint64_t, uint64_t, void**) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult bufferGetMappedPointer(GfxBuffer, void**) const override { return GFX_RESULT_SUCCESS; }
     GfxResult bufferUnmap(GfxBuffer) const override { return GFX_RESULT_SUCCESS; }
     GfxResult bufferFlushMappedRange(GfxBuffer, uint64_t, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult bufferInvalidateMappedRange(GfxBuffer, uint64_t, uint64_t) const override { return GFX_RESULT_SUCCESS; }
@@ -84,6 +99,8 @@ public:
     GfxResult framebufferDestroy(GfxFramebuffer) const override { return GFX_RESULT_SUCCESS; }
     GfxResult querySetDestroy(GfxQuerySet) const override { return GFX_RESULT_SUCCESS; }
     GfxResult queueSubmit(GfxQueue, const GfxSubmitDescriptor*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult queueSubmitBatch(GfxQueue, const GfxSubmitDescriptor*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult queueFlush(GfxQueue) const override { return GFX_RESULT_SUCCESS; }
     GfxResult queueWriteBuffer(GfxQueue, GfxBuffer, uint64_t, const void*, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult queueWriteTexture(GfxQueue, GfxTexture, const GfxOrigin3D*, const GfxExtent3D*, uint32_t, const void*, uint64_t, GfxTextureLayout) const override { return GFX_RESULT_SUCCESS; }
     GfxResult queueWaitIdle(GfxQueue) const override { return GFX_RESULT_SUCCESS; }
@@ -102,24 +119,45 @@ public:
     GfxResult commandEncoderResolveQuerySet(GfxCommandEncoder, GfxQuerySet, uint32_t, uint32_t, GfxBuffer, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult commandEncoderEnd(GfxCommandEncoder) const override { return GFX_RESULT_SUCCESS; }
     GfxResult commandEncoderBegin(GfxCommandEncoder) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult commandEncoderGetStats(GfxCommandEncoder, GfxCommandEncoderStats*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderSetPipeline(GfxRenderPassEncoder, GfxRenderPipeline) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderSetBindGroup(GfxRenderPassEncoder, uint32_t, GfxBindGroup, const uint32_t*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderSetVertexBuffer(GfxRenderPassEncoder, uint32_t, GfxBuffer, uint64_t, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderSetIndexBuffer(GfxRenderPassEncoder, GfxBuffer, GfxIndexFormat, uint64_t, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderSetViewport(GfxRenderPassEncoder, const GfxViewport*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderSetScissorRect(GfxRenderPassEncoder, const GfxScissorRect*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderSetImmediateData(GfxRenderPassEncoder, uint32_t, const void*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderDraw(GfxRenderPassEncoder, uint32_t, uint32_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderDrawIndexed(GfxRenderPassEncoder, uint32_t, uint32_t, uint32_t, int32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderDrawIndirect(GfxRenderPassEncoder, GfxBuffer, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderDrawIndexedIndirect(GfxRenderPassEncoder, GfxBuffer, uint64_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderMultiDrawIndirect(GfxRenderPassEncoder, GfxBuffer, uint64_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderMultiDrawIndexedIndirect(GfxRenderPassEncoder, GfxBuffer, uint64_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderMultiDrawIndirectCount(GfxRenderPassEncoder, GfxBuffer, uint64_t, GfxBuffer, uint64_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderMultiDrawIndexedIndirectCount(GfxRenderPassEncoder, GfxBuffer, uint64_t, GfxBuffer, uint64_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderExecuteCommandStream(GfxRenderPassEncoder, const GfxCommand*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderEnd(GfxRenderPassEncoder) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderBeginOcclusionQuery(GfxRenderPassEncoder, GfxQuerySet, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult renderPassEncoderEndOcclusionQuery(GfxRenderPassEncoder) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderPassEncoderExecuteBundles(GfxRenderPassEncoder, const GfxRenderBundle*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult computePassEncoderSetPipeline(GfxComputePassEncoder, GfxComputePipeline) const override { return GFX_RESULT_SUCCESS; }
     GfxResult computePassEncoderSetBindGroup(GfxComputePassEncoder, uint32_t, GfxBindGroup, const uint32_t*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult computePassEncoderSetImmediateData(GfxComputePassEncoder, uint32_t, const void*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult computePassEncoderDispatch(GfxComputePassEncoder, uint32_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult computePassEncoderDispatchIndirect(GfxComputePassEncoder, GfxBuffer, uint64_t) const override { return GFX_RESULT_SUCCESS; }
     GfxResult computePassEncoderEnd(GfxComputePassEncoder) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult deviceCreateRenderBundleEncoder(GfxDevice, const GfxRenderBundleEncoderDescriptor*, GfxRenderBundleEncoder*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderDestroy(GfxRenderBundleEncoder) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderSetPipeline(GfxRenderBundleEncoder, GfxRenderPipeline) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderSetBindGroup(GfxRenderBundleEncoder, uint32_t, GfxBindGroup, const uint32_t*, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderSetVertexBuffer(GfxRenderBundleEncoder, uint32_t, GfxBuffer, uint64_t, uint64_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderSetIndexBuffer(GfxRenderBundleEncoder, GfxBuffer, GfxIndexFormat, uint64_t, uint64_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderSetViewport(GfxRenderBundleEncoder, const GfxViewport*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderSetScissorRect(GfxRenderBundleEncoder, const GfxScissorRect*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderDraw(GfxRenderBundleEncoder, uint32_t, uint32_t, uint32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderDrawIndexed(GfxRenderBundleEncoder, uint32_t, uint32_t, uint32_t, int32_t, uint32_t) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleEncoderFinish(GfxRenderBundleEncoder, GfxRenderBundle*) const override { return GFX_RESULT_SUCCESS; }
+    GfxResult renderBundleDestroy(GfxRenderBundle) const override { return GFX_RESULT_SUCCESS; }
     GfxResult fenceDestroy(GfxFence) const override { return GFX_RESULT_SUCCESS; }
     GfxResult fenceGetStatus(GfxFence, bool*) const override { return GFX_RESULT_SUCCESS; }
     GfxResult fenceWait(GfxFence, uint64_t) const override { return GFX_RESULT_SUCCESS; }
@@ -296,4 +334,86 @@ TEST_F(ManagerTest, LoadSameBackendTwice)
     ASSERT_NE(backend, nullptr);
 }
 
+TEST_F(ManagerTest, GetBackendReturnsTypeInSingleLookup)
+{
+    auto mockBackend = std::make_unique<MinimalMockBackend>();
+    manager->loadBackend(GFX_BACKEND_WEBGPU, std::move(mockBackend));
+
+    void* testHandle = reinterpret_cast<void*>(0x3000);
+    manager->wrap(GFX_BACKEND_WEBGPU, testHandle);
+
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = manager->getBackend(testHandle, &backendType);
+    ASSERT_NE(backend, nullptr);
+    EXPECT_EQ(backend, manager->getBackend(GFX_BACKEND_WEBGPU).get());
+    EXPECT_EQ(backendType, GFX_BACKEND_WEBGPU);
+
+    manager->unwrap(testHandle);
+}
+
+TEST_F(ManagerTest, GetBackendUnknownHandleLeavesTypeUntouched)
+{
+    GfxBackend backendType = GFX_BACKEND_AUTO;
+    auto backend = manager->getBackend(reinterpret_cast<void*>(0x99999999), &backendType);
+    EXPECT_EQ(backend, nullptr);
+    EXPECT_EQ(backendType, GFX_BACKEND_AUTO);
+}
+
+TEST_F(ManagerTest, ConcurrentLookupsWhileWrapping)
+{
+    auto mockBackend = std::make_unique<MinimalMockBackend>();
+    manager->loadBackend(GFX_BACKEND_VULKAN, std::move(mockBackend));
+
+    // Long-lived handles that every reader thread resolves repeatedly (like encoders during recording)
+    constexpr uintptr_t baseAddress = 0x100000;
+    constexpr uint32_t handleCount = 256;
+    std::vector<void*> handles;
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        void* handle = reinterpret_cast<void*>(baseAddress + i * 64);
+        manager->wrap(GFX_BACKEND_VULKAN, handle);
+        handles.push_back(handle);
+    }
+
+    constexpr uint32_t readerCount = 8;
+    constexpr uint32_t iterations = 20000;
+    std::atomic<uint32_t> failures{ 0 };
+    std::atomic<bool> stop{ false };
+
+    // A writer keeps creating and destroying unrelated handles while readers run
+    std::thread writer([&]() {
+        uintptr_t address = 0x800000;
+        while (!stop.load(std::memory_order_relaxed)) {
+            void* handle = reinterpret_cast<void*>(address);
+            manager->wrap(GFX_BACKEND_VULKAN, handle);
+            manager->unwrap(handle);
+            address += 16;
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (uint32_t t = 0; t < readerCount; ++t) {
+        readers.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < iterations; ++i) {
+                void* handle = handles[(i + t * 31) % handleCount];
+                GfxBackend backendType = GFX_BACKEND_AUTO;
+                if (!manager->getBackend(handle, &backendType) || backendType != GFX_BACKEND_VULKAN) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    stop.store(true, std::memory_order_relaxed);
+    writer.join();
+
+    EXPECT_EQ(failures.load(), 0u) << "Every lookup of a live handle should resolve while other handles are wrapped/unwrapped";
+
+    for (void* handle : handles) {
+        manager->unwrap(handle);
+    }
+}
+
 } // namespace gfx::backend::test
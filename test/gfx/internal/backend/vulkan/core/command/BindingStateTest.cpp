@@ -0,0 +1,173 @@
+#include <backend/vulkan/core/command/BindingState.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+// Test Vulkan core BindingState class
+// These tests only compare handle values and don't need a Vulkan device
+
+namespace {
+
+// Handles are pointers or uint64_t depending on the platform
+template <typename T>
+T fakeHandle(uint64_t value)
+{
+    T handle{};
+    std::memcpy(&handle, &value, sizeof(handle));
+    return handle;
+}
+
+// ============================================================================
+// Pipeline and Descriptor Set Tests
+// ============================================================================
+
+TEST(VulkanBindingStateTest, SetPipeline_FiltersSamePipeline)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto pipelineA = fakeHandle<VkPipeline>(1);
+    auto pipelineB = fakeHandle<VkPipeline>(2);
+
+    EXPECT_TRUE(state.setPipeline(pipelineA));
+    EXPECT_FALSE(state.setPipeline(pipelineA));
+    EXPECT_TRUE(state.setPipeline(pipelineB));
+    EXPECT_TRUE(state.setPipeline(pipelineA));
+    EXPECT_EQ(state.filteredCount(), 1u);
+}
+
+TEST(VulkanBindingStateTest, SetDescriptorSet_ComparesDynamicOffsets)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto layout = fakeHandle<VkPipelineLayout>(1);
+    auto set = fakeHandle<VkDescriptorSet>(2);
+    const uint32_t offsetsA[] = { 0, 256 };
+    const uint32_t offsetsB[] = { 0, 512 };
+
+    EXPECT_TRUE(state.setDescriptorSet(0, layout, set, offsetsA, 2));
+    EXPECT_FALSE(state.setDescriptorSet(0, layout, set, offsetsA, 2));
+    EXPECT_TRUE(state.setDescriptorSet(0, layout, set, offsetsB, 2));
+    EXPECT_TRUE(state.setDescriptorSet(0, layout, set, offsetsB, 1));
+    EXPECT_EQ(state.filteredCount(), 1u);
+}
+
+TEST(VulkanBindingStateTest, SetDescriptorSet_TracksIndicesSeparately)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto layout = fakeHandle<VkPipelineLayout>(1);
+    auto set = fakeHandle<VkDescriptorSet>(2);
+
+    EXPECT_TRUE(state.setDescriptorSet(0, layout, set, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(2, layout, set, nullptr, 0));
+    EXPECT_FALSE(state.setDescriptorSet(0, layout, set, nullptr, 0));
+    EXPECT_FALSE(state.setDescriptorSet(2, layout, set, nullptr, 0));
+}
+
+TEST(VulkanBindingStateTest, SetDescriptorSet_RebindsForDifferentLayout)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto layoutA = fakeHandle<VkPipelineLayout>(1);
+    auto layoutB = fakeHandle<VkPipelineLayout>(2);
+    auto set = fakeHandle<VkDescriptorSet>(3);
+
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutA, set, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutB, set, nullptr, 0));
+    EXPECT_EQ(state.filteredCount(), 0u);
+}
+
+TEST(VulkanBindingStateTest, SetDescriptorSet_LayoutChangeDisturbsHigherSets)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto layoutA = fakeHandle<VkPipelineLayout>(1);
+    auto layoutB = fakeHandle<VkPipelineLayout>(2);
+    auto setX = fakeHandle<VkDescriptorSet>(3);
+    auto setY = fakeHandle<VkDescriptorSet>(4);
+
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutA, setX, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(1, layoutA, setY, nullptr, 0));
+    // Binding set 0 under layout B disturbs set 1 in the command buffer
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutB, setX, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutA, setX, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(1, layoutA, setY, nullptr, 0));
+    EXPECT_EQ(state.filteredCount(), 0u);
+}
+
+TEST(VulkanBindingStateTest, SetDescriptorSet_LayoutChangeDisturbsLowerSetsOfOtherLayouts)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto layoutA = fakeHandle<VkPipelineLayout>(1);
+    auto layoutB = fakeHandle<VkPipelineLayout>(2);
+    auto setX = fakeHandle<VkDescriptorSet>(3);
+    auto setY = fakeHandle<VkDescriptorSet>(4);
+
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutA, setX, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(1, layoutB, setY, nullptr, 0));
+    EXPECT_TRUE(state.setDescriptorSet(0, layoutA, setX, nullptr, 0));
+    // Same layout for the lower set keeps it
+    EXPECT_TRUE(state.setDescriptorSet(1, layoutA, setY, nullptr, 0));
+    EXPECT_FALSE(state.setDescriptorSet(0, layoutA, setX, nullptr, 0));
+    EXPECT_EQ(state.filteredCount(), 1u);
+}
+
+// ============================================================================
+// Buffer Tests
+// ============================================================================
+
+TEST(VulkanBindingStateTest, SetVertexBuffer_ComparesSlotAndOffset)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto buffer = fakeHandle<VkBuffer>(1);
+
+    EXPECT_TRUE(state.setVertexBuffer(0, buffer, 0));
+    EXPECT_FALSE(state.setVertexBuffer(0, buffer, 0));
+    EXPECT_TRUE(state.setVertexBuffer(1, buffer, 0));
+    EXPECT_TRUE(state.setVertexBuffer(0, buffer, 64));
+    EXPECT_EQ(state.filteredCount(), 1u);
+}
+
+TEST(VulkanBindingStateTest, SetIndexBuffer_ComparesIndexType)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto buffer = fakeHandle<VkBuffer>(1);
+
+    EXPECT_TRUE(state.setIndexBuffer(buffer, 0, VK_INDEX_TYPE_UINT16));
+    EXPECT_FALSE(state.setIndexBuffer(buffer, 0, VK_INDEX_TYPE_UINT16));
+    EXPECT_TRUE(state.setIndexBuffer(buffer, 0, VK_INDEX_TYPE_UINT32));
+    EXPECT_EQ(state.filteredCount(), 1u);
+}
+
+// ============================================================================
+// Dynamic State Tests
+// ============================================================================
+
+TEST(VulkanBindingStateTest, SetViewportAndScissor_FiltersSameValues)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    VkViewport viewport = { 0.0f, 0.0f, 800.0f, 600.0f, 0.0f, 1.0f };
+    VkRect2D scissor = { { 0, 0 }, { 800, 600 } };
+
+    EXPECT_TRUE(state.setViewport(viewport));
+    EXPECT_FALSE(state.setViewport(viewport));
+    viewport.maxDepth = 0.5f;
+    EXPECT_TRUE(state.setViewport(viewport));
+
+    EXPECT_TRUE(state.setScissor(scissor));
+    EXPECT_FALSE(state.setScissor(scissor));
+    EXPECT_EQ(state.filteredCount(), 2u);
+}
+
+TEST(VulkanBindingStateTest, Invalidate_ForgetsBoundState)
+{
+    gfx::backend::vulkan::core::BindingState state;
+    auto pipeline = fakeHandle<VkPipeline>(1);
+    auto buffer = fakeHandle<VkBuffer>(2);
+
+    state.setPipeline(pipeline);
+    state.setVertexBuffer(0, buffer, 0);
+    state.invalidate();
+
+    EXPECT_TRUE(state.setPipeline(pipeline));
+    EXPECT_TRUE(state.setVertexBuffer(0, buffer, 0));
+    EXPECT_EQ(state.filteredCount(), 0u);
+}
+
+} // anonymous namespace
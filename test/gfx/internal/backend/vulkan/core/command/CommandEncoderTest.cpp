@@ -1,4 +1,5 @@
 #include <backend/vulkan/core/command/CommandEncoder.h>
+#include <backend/vulkan/core/command/CommandPoolArena.h>
 #include <backend/vulkan/core/query/QuerySet.h>
 #include <backend/vulkan/core/resource/Buffer.h>
 #include <backend/vulkan/core/resource/Texture.h>
@@ -8,6 +9,8 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -308,6 +311,138 @@ TEST_F(VulkanCommandEncoderTest, PipelineBarrier_WithNoBarriers)
     encoder->end();
 }
 
+// ============================================================================
+// Barrier Inference Tests
+// ============================================================================
+
+TEST_F(VulkanCommandEncoderTest, CopyBufferToTexture_BatchesFinalTransitionWithNextCopy)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024 * 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    auto buffer = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    gfx::backend::vulkan::core::TextureCreateInfo textureInfo{};
+    textureInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    textureInfo.size = { 256, 256, 1 };
+    textureInfo.mipLevelCount = 2;
+    textureInfo.arrayLayers = 1;
+    textureInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    textureInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    textureInfo.imageType = VK_IMAGE_TYPE_2D;
+    textureInfo.flags = 0;
+    auto texture = std::make_unique<gfx::backend::vulkan::core::Texture>(device.get(), textureInfo);
+
+    auto encoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    encoder->begin();
+    encoder->copyBufferToTexture(buffer.get(), 0, texture.get(), { 0, 0, 0 }, { 256, 256, 1 }, 0, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    encoder->copyBufferToTexture(buffer.get(), 0, texture.get(), { 0, 0, 0 }, { 128, 128, 1 }, 1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    encoder->end();
+
+    // Mip 0 becomes shader readable in the same barrier that prepares mip 1 for its copy
+    const auto& stats = encoder->barrierStats();
+    EXPECT_EQ(stats.barrierCount, 4u);
+    EXPECT_EQ(stats.pipelineBarrierCount, 3u);
+    EXPECT_EQ(texture->getLayout(0, 0), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(texture->getLayout(1, 0), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+TEST_F(VulkanCommandEncoderTest, CopyTextureToBuffer_RepeatedReads_ElideBarriers)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo textureInfo{};
+    textureInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    textureInfo.size = { 256, 256, 1 };
+    textureInfo.mipLevelCount = 1;
+    textureInfo.arrayLayers = 1;
+    textureInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    textureInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    textureInfo.imageType = VK_IMAGE_TYPE_2D;
+    textureInfo.flags = 0;
+    auto texture = std::make_unique<gfx::backend::vulkan::core::Texture>(device.get(), textureInfo);
+
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 256 * 256 * 4;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    auto bufferA = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+    auto bufferB = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    auto encoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    encoder->begin();
+    encoder->copyTextureToBuffer(texture.get(), { 0, 0, 0 }, 0, bufferA.get(), 0, { 256, 256, 1 }, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    encoder->copyTextureToBuffer(texture.get(), { 0, 0, 0 }, 0, bufferB.get(), 0, { 256, 256, 1 }, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    encoder->end();
+
+    // Only the first transition to TRANSFER_SRC needs a barrier, the texture is only read after it
+    const auto& stats = encoder->barrierStats();
+    EXPECT_EQ(stats.barrierCount, 1u);
+    EXPECT_EQ(stats.elidedBarrierCount, 3u);
+}
+
+TEST_F(VulkanCommandEncoderTest, CopyBufferToBuffer_ReadAfterWrite_InsertsBarrier)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    auto bufferA = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+    auto bufferB = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+    auto bufferC = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    auto encoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    encoder->begin();
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 0, 512);
+    EXPECT_EQ(encoder->barrierStats().barrierCount, 0u);
+
+    encoder->copyBufferToBuffer(bufferB.get(), 256, bufferC.get(), 0, 256);
+    EXPECT_EQ(encoder->barrierStats().barrierCount, 1u);
+    encoder->end();
+}
+
+TEST_F(VulkanCommandEncoderTest, CopyBufferToBuffer_DisjointRanges_NoBarrier)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    auto bufferA = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+    auto bufferB = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    auto encoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    encoder->begin();
+    // Writes to different ranges and reads of the same range don't conflict
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 0, 256);
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 256, 256);
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 512, 256);
+    encoder->end();
+
+    EXPECT_EQ(encoder->barrierStats().barrierCount, 0u);
+}
+
+TEST_F(VulkanCommandEncoderTest, Reset_ClearsBarrierStats)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    auto bufferA = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+    auto bufferB = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    auto encoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 0, 256);
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 0, 256);
+    encoder->end();
+    EXPECT_EQ(encoder->barrierStats().barrierCount, 1u);
+
+    // Accesses recorded before the reset don't conflict with new ones
+    encoder->reset();
+    EXPECT_EQ(encoder->barrierStats().barrierCount, 0u);
+    encoder->copyBufferToBuffer(bufferA.get(), 0, bufferB.get(), 0, 256);
+    encoder->end();
+    EXPECT_EQ(encoder->barrierStats().barrierCount, 0u);
+}
+
 // ============================================================================
 // Query Tests
 // ============================================================================
@@ -375,4 +510,85 @@ TEST_F(VulkanCommandEncoderTest, MultipleCommandEncoders_CanCoexist)
     EXPECT_NE(encoder1->handle(), encoder3->handle());
 }
 
+// ============================================================================
+// Command Pool Reuse Tests
+// ============================================================================
+
+TEST_F(VulkanCommandEncoderTest, Destroy_ReturnsPoolForReuse)
+{
+    auto* arena = device->getCommandPoolArena();
+
+    VkCommandBuffer first = VK_NULL_HANDLE;
+    {
+        gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+        first = encoder.handle();
+    }
+    auto afterFirst = arena->getStats();
+    EXPECT_EQ(afterFirst.idlePoolCount, 1u);
+
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    EXPECT_EQ(encoder.handle(), first);
+
+    auto stats = arena->getStats();
+    EXPECT_EQ(stats.poolCount, afterFirst.poolCount);
+    EXPECT_EQ(stats.idlePoolCount, 0u);
+    EXPECT_EQ(stats.reuseCount, afterFirst.reuseCount + 1);
+}
+
+TEST_F(VulkanCommandEncoderTest, ReusedEncoder_StartsRecordingCleanly)
+{
+    {
+        gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+        encoder.end();
+    }
+
+    // The recycled pool was reset, so the new encoder can record and end again
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    encoder.end();
+    encoder.reset();
+    encoder.end();
+}
+
+TEST_F(VulkanCommandEncoderTest, CreateDestroy_FromWorkerThreads_ReusesPools)
+{
+    constexpr int THREAD_COUNT = 4;
+    constexpr int ITERATIONS = 250;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([this]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+                encoder.end();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // At most one pool per concurrently live encoder
+    auto stats = device->getCommandPoolArena()->getStats();
+    EXPECT_LE(stats.poolCount, static_cast<uint32_t>(THREAD_COUNT));
+    EXPECT_EQ(stats.idlePoolCount, stats.poolCount);
+}
+
+TEST_F(VulkanCommandEncoderTest, CreateDestroyRepeatedly_RecyclesOnePool)
+{
+    constexpr int ITERATIONS = 1000;
+    auto* arena = device->getCommandPoolArena();
+    auto before = arena->getStats();
+
+    // Only the first encoder may create a pool, every later one takes the recycled one
+    for (int i = 0; i < ITERATIONS; ++i) {
+        gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+        ASSERT_NE(encoder.handle(), VK_NULL_HANDLE);
+    }
+
+    auto stats = arena->getStats();
+    EXPECT_LE(stats.poolCount, before.poolCount + 1);
+    EXPECT_EQ(stats.idlePoolCount, stats.poolCount);
+    EXPECT_GE(stats.reuseCount, before.reuseCount + ITERATIONS - 1);
+}
+
 } // anonymous namespace
@@ -0,0 +1,263 @@
+#include <backend/vulkan/core/command/CommandEncoder.h>
+#include <backend/vulkan/core/command/CommandPoolArena.h>
+#include <backend/vulkan/core/command/RenderBundle.h>
+#include <backend/vulkan/core/command/RenderBundleEncoder.h>
+#include <backend/vulkan/core/command/RenderPassEncoder.h>
+#include <backend/vulkan/core/render/Framebuffer.h>
+#include <backend/vulkan/core/render/RenderPass.h>
+#include <backend/vulkan/core/resource/Buffer.h>
+#include <backend/vulkan/core/resource/Texture.h>
+#include <backend/vulkan/core/resource/TextureView.h>
+#include <backend/vulkan/core/system/Device.h>
+#include <backend/vulkan/core/system/Instance.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Test Vulkan core RenderBundleEncoder and RenderBundle classes
+// These tests verify the internal secondary command buffer recording, not the public API
+
+namespace {
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class VulkanRenderBundleEncoderTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        try {
+            gfx::backend::vulkan::core::InstanceCreateInfo instInfo{};
+            instInfo.enabledExtensions = {};
+            instance = std::make_unique<gfx::backend::vulkan::core::Instance>(instInfo);
+
+            gfx::backend::vulkan::core::AdapterCreateInfo adapterInfo{};
+            adapterInfo.adapterIndex = 0;
+            adapter = instance->requestAdapter(adapterInfo);
+
+            gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+            device = std::make_unique<gfx::backend::vulkan::core::Device>(adapter, deviceInfo);
+
+            gfx::backend::vulkan::core::RenderPassCreateInfo rpInfo{};
+            gfx::backend::vulkan::core::RenderPassColorAttachment colorAtt{};
+            colorAtt.target.format = VK_FORMAT_R8G8B8A8_UNORM;
+            colorAtt.target.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+            colorAtt.target.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            colorAtt.target.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+            colorAtt.target.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            rpInfo.colorAttachments.push_back(colorAtt);
+            renderPass = std::make_unique<gfx::backend::vulkan::core::RenderPass>(device.get(), rpInfo);
+
+            gfx::backend::vulkan::core::TextureCreateInfo texInfo{};
+            texInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+            texInfo.size = { 256, 256, 1 };
+            texInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+            texInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+            texInfo.mipLevelCount = 1;
+            texInfo.imageType = VK_IMAGE_TYPE_2D;
+            texInfo.arrayLayers = 1;
+            texInfo.flags = 0;
+            texture = std::make_unique<gfx::backend::vulkan::core::Texture>(device.get(), texInfo);
+
+            gfx::backend::vulkan::core::TextureViewCreateInfo viewInfo{};
+            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+            viewInfo.baseMipLevel = 0;
+            viewInfo.mipLevelCount = 1;
+            viewInfo.baseArrayLayer = 0;
+            viewInfo.arrayLayerCount = 1;
+            textureView = std::make_unique<gfx::backend::vulkan::core::TextureView>(texture.get(), viewInfo);
+
+            gfx::backend::vulkan::core::FramebufferCreateInfo fbInfo{};
+            fbInfo.renderPass = renderPass->handle();
+            fbInfo.attachments.push_back(textureView->handle());
+            fbInfo.width = 256;
+            fbInfo.height = 256;
+            fbInfo.colorAttachmentCount = 1;
+            fbInfo.hasDepthResolve = false;
+            framebuffer = std::make_unique<gfx::backend::vulkan::core::Framebuffer>(device.get(), fbInfo);
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "Failed to set up Vulkan: " << e.what();
+        }
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::RenderPassEncoder> beginPass(gfx::backend::vulkan::core::CommandEncoder* commandEncoder)
+    {
+        gfx::backend::vulkan::core::RenderPassEncoderBeginInfo beginInfo{};
+        VkClearColorValue clearColor = { { 0.0f, 0.0f, 0.0f, 1.0f } };
+        beginInfo.colorClearValues = { clearColor };
+        return std::make_unique<gfx::backend::vulkan::core::RenderPassEncoder>(commandEncoder, renderPass.get(), framebuffer.get(), beginInfo);
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
+    gfx::backend::vulkan::core::Adapter* adapter = nullptr;
+    std::unique_ptr<gfx::backend::vulkan::core::Device> device;
+    std::unique_ptr<gfx::backend::vulkan::core::RenderPass> renderPass;
+    std::unique_ptr<gfx::backend::vulkan::core::Texture> texture;
+    std::unique_ptr<gfx::backend::vulkan::core::TextureView> textureView;
+    std::unique_ptr<gfx::backend::vulkan::core::Framebuffer> framebuffer;
+};
+
+// ============================================================================
+// Recording Tests
+// ============================================================================
+
+TEST_F(VulkanRenderBundleEncoderTest, Create_CreatesSuccessfully)
+{
+    gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+
+    EXPECT_NE(encoder.handle(), VK_NULL_HANDLE);
+    EXPECT_EQ(encoder.device(), device.get());
+    EXPECT_FALSE(encoder.isFinished());
+}
+
+TEST_F(VulkanRenderBundleEncoderTest, Finish_HandsCommandBufferToBundle)
+{
+    gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+    VkCommandBuffer commandBuffer = encoder.handle();
+
+    encoder.setViewport({ 0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f });
+    encoder.setScissorRect({ 0, 0, 256, 256 });
+    auto bundle = encoder.finish();
+
+    ASSERT_NE(bundle, nullptr);
+    EXPECT_EQ(bundle->handle(), commandBuffer);
+    EXPECT_TRUE(encoder.isFinished());
+}
+
+TEST_F(VulkanRenderBundleEncoderTest, SetVertexBuffer_WorksCorrectly)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    auto buffer = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+    EXPECT_NO_THROW(encoder.setVertexBuffer(0, buffer.get(), 0));
+    EXPECT_NO_THROW(encoder.finish());
+}
+
+// ============================================================================
+// Execution Tests
+// ============================================================================
+
+TEST_F(VulkanRenderBundleEncoderTest, ExecuteBundles_SwitchesPassToBundleMode)
+{
+    gfx::backend::vulkan::core::RenderBundleEncoder bundleEncoder(device.get(), renderPass.get());
+    auto bundle = bundleEncoder.finish();
+
+    auto commandEncoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+    commandEncoder->begin();
+    {
+        auto pass = beginPass(commandEncoder.get());
+        EXPECT_TRUE(pass->acceptsInlineCommands());
+        EXPECT_TRUE(pass->acceptsBundles());
+
+        // Viewport before the first bundle is dropped instead of deciding the mode
+        pass->setViewport({ 0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f });
+        EXPECT_TRUE(pass->acceptsBundles());
+
+        gfx::backend::vulkan::core::RenderBundle* bundles[] = { bundle.get(), bundle.get() };
+        pass->executeBundles(bundles, 2);
+
+        EXPECT_FALSE(pass->acceptsInlineCommands());
+        EXPECT_TRUE(pass->acceptsBundles());
+    }
+    commandEncoder->end();
+}
+
+TEST_F(VulkanRenderBundleEncoderTest, InlineCommand_RejectsBundles)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    auto buffer = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    auto commandEncoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+    commandEncoder->begin();
+    {
+        auto pass = beginPass(commandEncoder.get());
+        pass->setVertexBuffer(0, buffer.get(), 0);
+
+        EXPECT_TRUE(pass->acceptsInlineCommands());
+        EXPECT_FALSE(pass->acceptsBundles());
+    }
+    commandEncoder->end();
+}
+
+TEST_F(VulkanRenderBundleEncoderTest, RecordOnWorkerThreads_ExecutesInOnePass)
+{
+    constexpr int THREAD_COUNT = 4;
+
+    std::vector<std::unique_ptr<gfx::backend::vulkan::core::RenderBundle>> bundles(THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([this, &bundles, t]() {
+            gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+            encoder.setViewport({ 0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f });
+            encoder.setScissorRect({ 0, 0, 256, 256 });
+            bundles[t] = encoder.finish();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<gfx::backend::vulkan::core::RenderBundle*> bundlePtrs;
+    for (const auto& bundle : bundles) {
+        ASSERT_NE(bundle, nullptr);
+        bundlePtrs.push_back(bundle.get());
+    }
+
+    auto commandEncoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+    commandEncoder->begin();
+    {
+        auto pass = beginPass(commandEncoder.get());
+        pass->executeBundles(bundlePtrs.data(), static_cast<uint32_t>(bundlePtrs.size()));
+    }
+    commandEncoder->end();
+}
+
+// ============================================================================
+// Command Pool Reuse Tests
+// ============================================================================
+
+TEST_F(VulkanRenderBundleEncoderTest, DestroyBundle_ReturnsSecondaryPoolForReuse)
+{
+    auto* arena = device->getCommandPoolArena();
+
+    VkCommandBuffer first = VK_NULL_HANDLE;
+    {
+        gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+        first = encoder.handle();
+        auto bundle = encoder.finish();
+    }
+    auto afterFirst = arena->getStats();
+    EXPECT_EQ(afterFirst.idlePoolCount, 1u);
+
+    // Primary encoders don't take secondary pools
+    {
+        gfx::backend::vulkan::core::CommandEncoder commandEncoder(device.get());
+        EXPECT_NE(commandEncoder.handle(), first);
+    }
+
+    gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+    EXPECT_EQ(encoder.handle(), first);
+    EXPECT_EQ(arena->getStats().reuseCount, afterFirst.reuseCount + 1);
+}
+
+TEST_F(VulkanRenderBundleEncoderTest, DestroyUnfinishedEncoder_ReturnsPool)
+{
+    {
+        gfx::backend::vulkan::core::RenderBundleEncoder encoder(device.get(), renderPass.get());
+    }
+
+    auto stats = device->getCommandPoolArena()->getStats();
+    EXPECT_EQ(stats.idlePoolCount, stats.poolCount);
+}
+
+} // anonymous namespace
@@ -186,6 +186,43 @@ TEST_F(VulkanRenderPassEncoderTest, SetIndexBuffer_WorksCorrectly)
     commandEncoder->end();
 }
 
+TEST_F(VulkanRenderPassEncoderTest, RedundantBinds_AreFilteredAndCounted)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    auto buffer = std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), bufferInfo);
+
+    auto commandEncoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    commandEncoder->begin();
+
+    gfx::backend::vulkan::core::RenderPassEncoderBeginInfo beginInfo{};
+    VkClearColorValue clearColor = { { 0.0f, 0.0f, 0.0f, 1.0f } };
+    beginInfo.colorClearValues = { clearColor };
+
+    {
+        auto encoder = std::make_unique<gfx::backend::vulkan::core::RenderPassEncoder>(commandEncoder.get(), renderPass.get(), framebuffer.get(), beginInfo);
+
+        encoder->setVertexBuffer(0, buffer.get(), 0);
+        encoder->setVertexBuffer(0, buffer.get(), 0);
+        encoder->setVertexBuffer(0, buffer.get(), 256);
+        encoder->setIndexBuffer(buffer.get(), VK_INDEX_TYPE_UINT16, 512);
+        encoder->setIndexBuffer(buffer.get(), VK_INDEX_TYPE_UINT16, 512);
+
+        gfx::backend::vulkan::core::Viewport viewport = { 0.0f, 0.0f, 800.0f, 600.0f, 0.0f, 1.0f };
+        encoder->setViewport(viewport);
+        encoder->setViewport(viewport);
+
+        EXPECT_EQ(encoder->filteredCommandCount(), 3u);
+    }
+
+    // Counts are handed to the command encoder when the pass ends
+    EXPECT_EQ(commandEncoder->filteredCommandCount(), 3u);
+
+    commandEncoder->end();
+}
+
 // ============================================================================
 // Viewport and Scissor Tests
 // ============================================================================
@@ -238,6 +275,31 @@ TEST_F(VulkanRenderPassEncoderTest, SetScissorRect_WorksCorrectly)
     commandEncoder->end();
 }
 
+TEST_F(VulkanRenderPassEncoderTest, SetViewport_LeavesContentsUndecided)
+{
+    auto commandEncoder = std::make_unique<gfx::backend::vulkan::core::CommandEncoder>(device.get());
+
+    commandEncoder->begin();
+
+    gfx::backend::vulkan::core::RenderPassEncoderBeginInfo beginInfo{};
+    VkClearColorValue clearColor = { { 0.0f, 0.0f, 0.0f, 1.0f } };
+    beginInfo.colorClearValues = { clearColor };
+
+    {
+        auto encoder = std::make_unique<gfx::backend::vulkan::core::RenderPassEncoder>(commandEncoder.get(), renderPass.get(), framebuffer.get(), beginInfo);
+        EXPECT_TRUE(encoder->acceptsBundles());
+
+        gfx::backend::vulkan::core::Viewport viewport = { 0.0f, 0.0f, 800.0f, 600.0f, 0.0f, 1.0f };
+        encoder->setViewport(viewport);
+
+        // The pass can still execute bundles, which use their own viewport
+        EXPECT_TRUE(encoder->acceptsInlineCommands());
+        EXPECT_TRUE(encoder->acceptsBundles());
+    }
+
+    commandEncoder->end();
+}
+
 // ============================================================================
 // Query Tests
 // ============================================================================
@@ -109,6 +109,25 @@ TEST_F(VulkanComputePipelineTest, Handle_ReturnsValidVkPipeline)
 }
 
 TEST_F(VulkanComputePipelineTest, Handle_IsUnique)
+{
+    gfx::backend::vulkan::core::ShaderCreateInfo shaderInfo{};
+    shaderInfo.code = MINIMAL_COMPUTE_SPIRV;
+    shaderInfo.codeSize = sizeof(MINIMAL_COMPUTE_SPIRV);
+    auto shader1 = std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
+    auto shader2 = std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
+
+    gfx::backend::vulkan::core::ComputePipelineCreateInfo createInfo{};
+    createInfo.module = shader1->handle();
+    createInfo.entryPoint = "main";
+    auto pipeline1 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
+
+    createInfo.module = shader2->handle();
+    auto pipeline2 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
+
+    EXPECT_NE(pipeline1->handle(), pipeline2->handle());
+}
+
+TEST_F(VulkanComputePipelineTest, Handle_IsSharedForIdenticalCreateInfo)
 {
     gfx::backend::vulkan::core::ShaderCreateInfo shaderInfo{};
     shaderInfo.code = MINIMAL_COMPUTE_SPIRV;
@@ -122,7 +141,11 @@ TEST_F(VulkanComputePipelineTest, Handle_IsUnique)
     auto pipeline1 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
     auto pipeline2 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
 
-    EXPECT_NE(pipeline1->handle(), pipeline2->handle());
+    EXPECT_EQ(pipeline1->handle(), pipeline2->handle());
+
+    // The shared pipeline stays alive until its last user is destroyed
+    pipeline1.reset();
+    EXPECT_NE(pipeline2->handle(), VK_NULL_HANDLE);
 }
 
 // ============================================================================
@@ -146,7 +169,7 @@ TEST_F(VulkanComputePipelineTest, Layout_ReturnsValidVkPipelineLayout)
     EXPECT_NE(layout, VK_NULL_HANDLE);
 }
 
-TEST_F(VulkanComputePipelineTest, Layout_IsUnique)
+TEST_F(VulkanComputePipelineTest, Layout_IsSharedForIdenticalBindGroupLayouts)
 {
     gfx::backend::vulkan::core::ShaderCreateInfo shaderInfo{};
     shaderInfo.code = MINIMAL_COMPUTE_SPIRV;
@@ -160,7 +183,7 @@ TEST_F(VulkanComputePipelineTest, Layout_IsUnique)
     auto pipeline1 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
     auto pipeline2 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
 
-    EXPECT_NE(pipeline1->layout(), pipeline2->layout());
+    EXPECT_EQ(pipeline1->layout(), pipeline2->layout());
 }
 
 // ============================================================================
@@ -212,14 +235,19 @@ TEST_F(VulkanComputePipelineTest, MultipleComputePipelines_CanCoexist)
     gfx::backend::vulkan::core::ShaderCreateInfo shaderInfo{};
     shaderInfo.code = MINIMAL_COMPUTE_SPIRV;
     shaderInfo.codeSize = sizeof(MINIMAL_COMPUTE_SPIRV);
-    auto shader = std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
+    auto shader1 = std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
+    auto shader2 = std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
+    auto shader3 = std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
 
+    // Different shader modules, so the pipelines are not shared
     gfx::backend::vulkan::core::ComputePipelineCreateInfo createInfo{};
-    createInfo.module = shader->handle();
     createInfo.entryPoint = "main";
 
+    createInfo.module = shader1->handle();
     auto pipeline1 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
+    createInfo.module = shader2->handle();
     auto pipeline2 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
+    createInfo.module = shader3->handle();
     auto pipeline3 = std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo);
 
     EXPECT_NE(pipeline1->handle(), VK_NULL_HANDLE);
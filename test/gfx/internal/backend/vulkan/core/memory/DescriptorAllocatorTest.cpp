@@ -0,0 +1,181 @@
+#include <backend/vulkan/core/memory/DescriptorAllocator.h>
+#include <backend/vulkan/core/resource/BindGroupLayout.h>
+#include <backend/vulkan/core/system/Adapter.h>
+#include <backend/vulkan/core/system/Device.h>
+#include <backend/vulkan/core/system/Instance.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+// Test Vulkan core DescriptorAllocator class
+// These tests verify the internal descriptor set allocator, not the public API
+
+namespace {
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class VulkanDescriptorAllocatorTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        try {
+            gfx::backend::vulkan::core::InstanceCreateInfo instInfo{};
+            instInfo.enabledExtensions = {};
+            instance = std::make_unique<gfx::backend::vulkan::core::Instance>(instInfo);
+
+            gfx::backend::vulkan::core::AdapterCreateInfo adapterInfo{};
+            adapterInfo.adapterIndex = 0;
+            adapter = instance->requestAdapter(adapterInfo);
+
+            gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+            device = std::make_unique<gfx::backend::vulkan::core::Device>(adapter, deviceInfo);
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "Failed to set up Vulkan: " << e.what();
+        }
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::BindGroupLayout> createUniformLayout()
+    {
+        gfx::backend::vulkan::core::BindGroupLayoutEntry entry{};
+        entry.binding = 0;
+        entry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        entry.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+        gfx::backend::vulkan::core::BindGroupLayoutCreateInfo layoutInfo{};
+        layoutInfo.entries = { entry };
+        return std::make_unique<gfx::backend::vulkan::core::BindGroupLayout>(device.get(), layoutInfo);
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
+    gfx::backend::vulkan::core::Adapter* adapter = nullptr;
+    std::unique_ptr<gfx::backend::vulkan::core::Device> device;
+};
+
+const std::vector<VkDescriptorPoolSize> UNIFORM_REQUIREMENTS = { { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1 } };
+
+// ============================================================================
+// Allocation Tests
+// ============================================================================
+
+TEST_F(VulkanDescriptorAllocatorTest, Allocate_SharesPoolBetweenSets)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layout = createUniformLayout();
+
+    auto first = allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS);
+    auto second = allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS);
+
+    EXPECT_NE(first.set, VK_NULL_HANDLE);
+    EXPECT_NE(second.set, VK_NULL_HANDLE);
+    EXPECT_NE(first.set, second.set);
+    EXPECT_EQ(first.pool, second.pool);
+    EXPECT_EQ(allocator.getStats().poolCount, 1u);
+    EXPECT_EQ(allocator.getStats().allocatedSetCount, 2u);
+
+    allocator.releaseLayout(layout->handle());
+}
+
+TEST_F(VulkanDescriptorAllocatorTest, Allocate_GrowsWhenPoolIsFull)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layout = createUniformLayout();
+
+    std::vector<gfx::backend::vulkan::core::DescriptorSetAllocation> allocations;
+    for (int i = 0; i < 500; ++i) {
+        allocations.push_back(allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS));
+    }
+
+    auto stats = allocator.getStats();
+    EXPECT_GT(stats.poolCount, 1u);
+    // Pools double in size, so far fewer pools than sets
+    EXPECT_LT(stats.poolCount, 10u);
+    EXPECT_EQ(stats.allocatedSetCount, 500u);
+}
+
+TEST_F(VulkanDescriptorAllocatorTest, Allocate_ReusesFreedSpaceInOlderPool)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layoutA = createUniformLayout();
+    auto layoutB = createUniformLayout();
+
+    // Fill the first two pools (64 and 128 sets)
+    std::vector<gfx::backend::vulkan::core::DescriptorSetAllocation> allocations;
+    for (int i = 0; i < 64 + 128; ++i) {
+        allocations.push_back(allocator.allocate(layoutA->handle(), UNIFORM_REQUIREMENTS));
+    }
+    ASSERT_EQ(allocator.getStats().poolCount, 2u);
+
+    // Without its layout the set goes back to the oldest pool, which must be used again
+    allocator.releaseLayout(layoutA->handle());
+    allocator.recycle(layoutA->handle(), allocations.front());
+
+    auto allocation = allocator.allocate(layoutB->handle(), UNIFORM_REQUIREMENTS);
+    EXPECT_EQ(allocation.pool, allocations.front().pool);
+    EXPECT_EQ(allocator.getStats().poolCount, 2u);
+}
+
+TEST_F(VulkanDescriptorAllocatorTest, Recycle_ReusesSetForSameLayout)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layout = createUniformLayout();
+
+    auto first = allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS);
+    allocator.recycle(layout->handle(), first);
+    EXPECT_EQ(allocator.getStats().recycledSetCount, 1u);
+
+    auto second = allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS);
+    EXPECT_EQ(second.set, first.set);
+    EXPECT_EQ(allocator.getStats().recycledSetCount, 0u);
+    EXPECT_EQ(allocator.getStats().allocatedSetCount, 1u);
+}
+
+TEST_F(VulkanDescriptorAllocatorTest, Recycle_DoesNotShareAcrossLayouts)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layoutA = createUniformLayout();
+    auto layoutB = createUniformLayout();
+
+    auto first = allocator.allocate(layoutA->handle(), UNIFORM_REQUIREMENTS);
+    allocator.recycle(layoutA->handle(), first);
+
+    auto second = allocator.allocate(layoutB->handle(), UNIFORM_REQUIREMENTS);
+    EXPECT_NE(second.set, first.set);
+    EXPECT_EQ(allocator.getStats().recycledSetCount, 1u);
+
+    allocator.releaseLayout(layoutA->handle());
+    allocator.releaseLayout(layoutB->handle());
+}
+
+TEST_F(VulkanDescriptorAllocatorTest, ReleaseLayout_FreesRecycledSets)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layout = createUniformLayout();
+
+    auto allocation = allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS);
+    allocator.recycle(layout->handle(), allocation);
+    allocator.releaseLayout(layout->handle());
+
+    auto stats = allocator.getStats();
+    EXPECT_EQ(stats.recycledSetCount, 0u);
+    EXPECT_EQ(stats.allocatedSetCount, 0u);
+}
+
+TEST_F(VulkanDescriptorAllocatorTest, Recycle_AfterReleaseLayout_FreesSet)
+{
+    gfx::backend::vulkan::core::DescriptorAllocator allocator(device->handle());
+    auto layout = createUniformLayout();
+
+    // A bind group outliving its layout must not put its set back on the reuse list
+    auto allocation = allocator.allocate(layout->handle(), UNIFORM_REQUIREMENTS);
+    allocator.releaseLayout(layout->handle());
+    allocator.recycle(layout->handle(), allocation);
+
+    auto stats = allocator.getStats();
+    EXPECT_EQ(stats.recycledSetCount, 0u);
+    EXPECT_EQ(stats.allocatedSetCount, 0u);
+}
+
+} // namespace
@@ -4,10 +4,14 @@
 #include <backend/vulkan/core/resource/TextureView.h>
 #include <backend/vulkan/core/system/Adapter.h>
 #include <backend/vulkan/core/system/Device.h>
+#include <backend/vulkan/core/system/FramebufferCache.h>
 #include <backend/vulkan/core/system/Instance.h>
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <vector>
+
 // Test Vulkan core Framebuffer class
 // These tests verify the internal framebuffer implementation
 
@@ -36,6 +40,57 @@ protected:
         }
     }
 
+    std::unique_ptr<gfx::backend::vulkan::core::RenderPass> createColorRenderPass(VkAttachmentLoadOp loadOp)
+    {
+        gfx::backend::vulkan::core::RenderPassCreateInfo rpInfo{};
+        gfx::backend::vulkan::core::RenderPassColorAttachment colorAtt{};
+        colorAtt.target.format = VK_FORMAT_R8G8B8A8_UNORM;
+        colorAtt.target.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+        colorAtt.target.loadOp = loadOp;
+        colorAtt.target.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAtt.target.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        rpInfo.colorAttachments.push_back(colorAtt);
+        return std::make_unique<gfx::backend::vulkan::core::RenderPass>(device.get(), rpInfo);
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Texture> createColorTexture()
+    {
+        gfx::backend::vulkan::core::TextureCreateInfo texInfo{};
+        texInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        texInfo.size = { 256, 256, 1 };
+        texInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        texInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+        texInfo.mipLevelCount = 1;
+        texInfo.imageType = VK_IMAGE_TYPE_2D;
+        texInfo.arrayLayers = 1;
+        texInfo.flags = 0;
+        return std::make_unique<gfx::backend::vulkan::core::Texture>(device.get(), texInfo);
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::TextureView> createColorView(gfx::backend::vulkan::core::Texture* texture)
+    {
+        gfx::backend::vulkan::core::TextureViewCreateInfo viewInfo{};
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        viewInfo.baseMipLevel = 0;
+        viewInfo.mipLevelCount = 1;
+        viewInfo.baseArrayLayer = 0;
+        viewInfo.arrayLayerCount = 1;
+        return std::make_unique<gfx::backend::vulkan::core::TextureView>(texture, viewInfo);
+    }
+
+    static gfx::backend::vulkan::core::FramebufferCreateInfo makeCachedInfo(const gfx::backend::vulkan::core::RenderPass& renderPass, VkImageView view)
+    {
+        gfx::backend::vulkan::core::FramebufferCreateInfo fbInfo{};
+        fbInfo.renderPass = renderPass.handle();
+        fbInfo.renderPassKey = renderPass.compatibilityKey();
+        fbInfo.attachments.push_back(view);
+        fbInfo.width = 256;
+        fbInfo.height = 256;
+        fbInfo.colorAttachmentCount = 1;
+        return fbInfo;
+    }
+
     std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
     gfx::backend::vulkan::core::Adapter* adapter = nullptr;
     std::unique_ptr<gfx::backend::vulkan::core::Device> device;
@@ -539,4 +594,129 @@ TEST_F(VulkanFramebufferTest, CreateAndDestroy_WorksCorrectly)
     // Framebuffer destroyed, no crash
 }
 
+// ============================================================================
+// Cache Tests
+// ============================================================================
+
+TEST_F(VulkanFramebufferTest, RecreateForSameViews_ReusesHandle)
+{
+    auto renderPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto texture = createColorTexture();
+    auto view = createColorView(texture.get());
+    auto* cache = device->getFramebufferCache();
+
+    VkFramebuffer firstHandle = VK_NULL_HANDLE;
+    {
+        gfx::backend::vulkan::core::Framebuffer framebuffer(device.get(), makeCachedInfo(*renderPass, view->handle()));
+        firstHandle = framebuffer.handle();
+    }
+    EXPECT_EQ(cache->getStats().idleFramebufferCount, 1u);
+
+    // Like an app recreating its framebuffer every frame
+    const uint64_t hitsBefore = cache->getStats().hitCount;
+    gfx::backend::vulkan::core::Framebuffer framebuffer(device.get(), makeCachedInfo(*renderPass, view->handle()));
+
+    EXPECT_EQ(framebuffer.handle(), firstHandle);
+    EXPECT_EQ(cache->getStats().hitCount, hitsBefore + 1);
+    EXPECT_EQ(cache->getStats().idleFramebufferCount, 0u);
+}
+
+TEST_F(VulkanFramebufferTest, CompatibleRenderPasses_ShareHandle)
+{
+    auto clearPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto loadPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_LOAD);
+    auto texture = createColorTexture();
+    auto view = createColorView(texture.get());
+
+    gfx::backend::vulkan::core::Framebuffer clearFramebuffer(device.get(), makeCachedInfo(*clearPass, view->handle()));
+    gfx::backend::vulkan::core::Framebuffer loadFramebuffer(device.get(), makeCachedInfo(*loadPass, view->handle()));
+
+    EXPECT_EQ(clearFramebuffer.handle(), loadFramebuffer.handle());
+}
+
+TEST_F(VulkanFramebufferTest, DifferentViews_DoNotShareHandle)
+{
+    auto renderPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto texture = createColorTexture();
+    auto firstView = createColorView(texture.get());
+    auto secondView = createColorView(texture.get());
+
+    gfx::backend::vulkan::core::Framebuffer first(device.get(), makeCachedInfo(*renderPass, firstView->handle()));
+    gfx::backend::vulkan::core::Framebuffer second(device.get(), makeCachedInfo(*renderPass, secondView->handle()));
+
+    EXPECT_NE(first.handle(), second.handle());
+}
+
+TEST_F(VulkanFramebufferTest, DestroyingView_DestroysIdleFramebuffer)
+{
+    auto renderPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto texture = createColorTexture();
+    auto view = createColorView(texture.get());
+    auto* cache = device->getFramebufferCache();
+    const uint32_t countBefore = cache->getStats().framebufferCount;
+
+    {
+        gfx::backend::vulkan::core::Framebuffer framebuffer(device.get(), makeCachedInfo(*renderPass, view->handle()));
+    }
+    EXPECT_EQ(cache->getStats().framebufferCount, countBefore + 1);
+
+    view.reset();
+    EXPECT_EQ(cache->getStats().framebufferCount, countBefore);
+    EXPECT_EQ(cache->getStats().idleFramebufferCount, 0u);
+}
+
+TEST_F(VulkanFramebufferTest, IdleFramebuffers_AreBounded)
+{
+    auto renderPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto texture = createColorTexture();
+    auto* cache = device->getFramebufferCache();
+
+    std::vector<std::unique_ptr<gfx::backend::vulkan::core::TextureView>> views;
+    for (uint32_t i = 0; i < gfx::backend::vulkan::core::FramebufferCache::MAX_IDLE_FRAMEBUFFERS + 8; ++i) {
+        views.push_back(createColorView(texture.get()));
+        gfx::backend::vulkan::core::Framebuffer framebuffer(device.get(), makeCachedInfo(*renderPass, views.back()->handle()));
+    }
+
+    EXPECT_EQ(cache->getStats().idleFramebufferCount, gfx::backend::vulkan::core::FramebufferCache::MAX_IDLE_FRAMEBUFFERS);
+}
+
+TEST_F(VulkanFramebufferTest, WithoutAttachmentInfos_IsNotImageless)
+{
+    auto renderPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto texture = createColorTexture();
+    auto view = createColorView(texture.get());
+
+    gfx::backend::vulkan::core::Framebuffer framebuffer(device.get(), makeCachedInfo(*renderPass, view->handle()));
+
+    EXPECT_TRUE(framebuffer.imagelessAttachments().empty());
+}
+
+TEST_F(VulkanFramebufferTest, Imageless_SharedBetweenViewsWithSameProperties)
+{
+    if (!device->supportsImagelessFramebuffer()) {
+        GTEST_SKIP() << "Imageless framebuffers not supported";
+    }
+
+    auto renderPass = createColorRenderPass(VK_ATTACHMENT_LOAD_OP_CLEAR);
+    auto firstTexture = createColorTexture();
+    auto secondTexture = createColorTexture();
+    auto firstView = createColorView(firstTexture.get());
+    auto secondView = createColorView(secondTexture.get());
+
+    // Like the framebuffers of two swapchain images
+    auto firstInfo = makeCachedInfo(*renderPass, firstView->handle());
+    firstInfo.attachmentInfos.push_back(firstView->getFramebufferAttachmentInfo());
+    auto secondInfo = makeCachedInfo(*renderPass, secondView->handle());
+    secondInfo.attachmentInfos.push_back(secondView->getFramebufferAttachmentInfo());
+
+    gfx::backend::vulkan::core::Framebuffer first(device.get(), firstInfo);
+    gfx::backend::vulkan::core::Framebuffer second(device.get(), secondInfo);
+
+    EXPECT_EQ(first.handle(), second.handle());
+    ASSERT_EQ(first.imagelessAttachments().size(), 1u);
+    ASSERT_EQ(second.imagelessAttachments().size(), 1u);
+    EXPECT_EQ(first.imagelessAttachments()[0], firstView->handle());
+    EXPECT_EQ(second.imagelessAttachments()[0], secondView->handle());
+}
+
 } // namespace
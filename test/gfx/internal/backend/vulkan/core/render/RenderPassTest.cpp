@@ -439,6 +439,53 @@ TEST_F(VulkanRenderPassTest, HasDepthStencil_ReturnsFalseWhenAbsent)
     EXPECT_FALSE(renderPass.hasDepthStencil());
 }
 
+// ============================================================================
+// Compatibility Tests
+// ============================================================================
+
+TEST_F(VulkanRenderPassTest, CompatibilityKey_IgnoresLoadStoreOps)
+{
+    gfx::backend::vulkan::core::RenderPassColorAttachment colorAtt{};
+    colorAtt.target.format = VK_FORMAT_R8G8B8A8_UNORM;
+    colorAtt.target.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    colorAtt.target.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colorAtt.target.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAtt.target.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    gfx::backend::vulkan::core::RenderPassCreateInfo clearInfo{};
+    clearInfo.colorAttachments.push_back(colorAtt);
+    gfx::backend::vulkan::core::RenderPass clearPass(device.get(), clearInfo);
+
+    colorAtt.target.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    colorAtt.target.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    gfx::backend::vulkan::core::RenderPassCreateInfo loadInfo{};
+    loadInfo.colorAttachments.push_back(colorAtt);
+    gfx::backend::vulkan::core::RenderPass loadPass(device.get(), loadInfo);
+
+    EXPECT_EQ(clearPass.compatibilityKey(), loadPass.compatibilityKey());
+}
+
+TEST_F(VulkanRenderPassTest, CompatibilityKey_DependsOnFormat)
+{
+    gfx::backend::vulkan::core::RenderPassColorAttachment colorAtt{};
+    colorAtt.target.format = VK_FORMAT_R8G8B8A8_UNORM;
+    colorAtt.target.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    colorAtt.target.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colorAtt.target.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAtt.target.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    gfx::backend::vulkan::core::RenderPassCreateInfo unormInfo{};
+    unormInfo.colorAttachments.push_back(colorAtt);
+    gfx::backend::vulkan::core::RenderPass unormPass(device.get(), unormInfo);
+
+    colorAtt.target.format = VK_FORMAT_B8G8R8A8_UNORM;
+    gfx::backend::vulkan::core::RenderPassCreateInfo bgraInfo{};
+    bgraInfo.colorAttachments.push_back(colorAtt);
+    gfx::backend::vulkan::core::RenderPass bgraPass(device.get(), bgraInfo);
+
+    EXPECT_NE(unormPass.compatibilityKey(), bgraPass.compatibilityKey());
+}
+
 // ============================================================================
 // Lifecycle Tests
 // ============================================================================
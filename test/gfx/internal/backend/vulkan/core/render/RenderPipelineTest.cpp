@@ -571,9 +571,42 @@ TEST_F(VulkanRenderPipelineTest, MultiplePipelines_HaveUniqueHandles)
     createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
 
     gfx::backend::vulkan::core::RenderPipeline pipeline1(device.get(), createInfo);
+    createInfo.primitive.cullMode = VK_CULL_MODE_BACK_BIT;
     gfx::backend::vulkan::core::RenderPipeline pipeline2(device.get(), createInfo);
 
     EXPECT_NE(pipeline1.handle(), pipeline2.handle());
+    EXPECT_EQ(pipeline1.layout(), pipeline2.layout());
+}
+
+TEST_F(VulkanRenderPipelineTest, IdenticalPipelines_ShareHandles)
+{
+    gfx::backend::vulkan::core::RenderPipelineCreateInfo createInfo{};
+    createInfo.renderPass = renderPass->handle();
+
+    createInfo.vertex.module = vertexShader->handle();
+    createInfo.vertex.entryPoint = "main";
+
+    createInfo.fragment.module = fragmentShader->handle();
+    createInfo.fragment.entryPoint = "main";
+
+    gfx::backend::vulkan::core::ColorTargetState colorTarget{};
+    colorTarget.format = VK_FORMAT_R8G8B8A8_UNORM;
+    colorTarget.writeMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorTarget.blendState.blendEnable = VK_FALSE;
+    createInfo.fragment.targets.push_back(colorTarget);
+
+    createInfo.primitive.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    createInfo.primitive.polygonMode = VK_POLYGON_MODE_FILL;
+    createInfo.primitive.cullMode = VK_CULL_MODE_NONE;
+    createInfo.primitive.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+
+    gfx::backend::vulkan::core::RenderPipeline pipeline1(device.get(), createInfo);
+    gfx::backend::vulkan::core::RenderPipeline pipeline2(device.get(), createInfo);
+
+    EXPECT_EQ(pipeline1.handle(), pipeline2.handle());
+    EXPECT_EQ(pipeline1.layout(), pipeline2.layout());
 }
 
 // ============================================================================
@@ -1,3 +1,4 @@
+#include <backend/vulkan/core/memory/DescriptorAllocator.h>
 #include <backend/vulkan/core/resource/BindGroup.h>
 #include <backend/vulkan/core/resource/BindGroupLayout.h>
 #include <backend/vulkan/core/resource/Buffer.h>
@@ -663,4 +664,77 @@ TEST_F(VulkanBindGroupTest, CreateComplexComputeBindGroup_CreatesSuccessfully)
     EXPECT_NE(bindGroup.handle(), VK_NULL_HANDLE);
 }
 
+// ============================================================================
+// Descriptor Set Recycling Tests
+// ============================================================================
+
+TEST_F(VulkanBindGroupTest, Destroy_RecyclesDescriptorSetForSameLayout)
+{
+    gfx::backend::vulkan::core::BindGroupLayoutCreateInfo layoutInfo{};
+    layoutInfo.entries = {};
+    gfx::backend::vulkan::core::BindGroupLayout layout(device.get(), layoutInfo);
+
+    gfx::backend::vulkan::core::BindGroupCreateInfo createInfo{};
+    createInfo.layout = layout.handle();
+    createInfo.entries = {};
+
+    VkDescriptorSet firstSet = VK_NULL_HANDLE;
+    {
+        gfx::backend::vulkan::core::BindGroup bindGroup(device.get(), createInfo);
+        firstSet = bindGroup.handle();
+    }
+    EXPECT_EQ(device->getDescriptorAllocator()->getStats().recycledSetCount, 1u);
+
+    gfx::backend::vulkan::core::BindGroup bindGroup(device.get(), createInfo);
+    EXPECT_EQ(bindGroup.handle(), firstSet);
+}
+
+TEST_F(VulkanBindGroupTest, CreateDestroyRepeatedly_ReusesOneDescriptorSet)
+{
+    gfx::backend::vulkan::core::BindGroupLayoutEntry layoutEntry{};
+    layoutEntry.binding = 0;
+    layoutEntry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    layoutEntry.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    gfx::backend::vulkan::core::BindGroupLayoutCreateInfo layoutInfo{};
+    layoutInfo.entries = { layoutEntry };
+    gfx::backend::vulkan::core::BindGroupLayout layout(device.get(), layoutInfo);
+
+    gfx::backend::vulkan::core::BufferCreateInfo bufferInfo{};
+    bufferInfo.size = 256;
+    bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    bufferInfo.memoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    gfx::backend::vulkan::core::Buffer buffer(device.get(), bufferInfo);
+
+    gfx::backend::vulkan::core::BindGroupEntry entry{};
+    entry.binding = 0;
+    entry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    entry.buffer = buffer.handle();
+    entry.bufferOffset = 0;
+    entry.bufferSize = 256;
+
+    gfx::backend::vulkan::core::BindGroupCreateInfo createInfo{};
+    createInfo.layout = layout.handle();
+    createInfo.entries = { entry };
+
+    auto* allocator = device->getDescriptorAllocator();
+    auto before = allocator->getStats();
+
+    // Every bind group after the first takes the set the previous one returned
+    VkDescriptorSet firstSet = VK_NULL_HANDLE;
+    for (int i = 0; i < 1000; ++i) {
+        gfx::backend::vulkan::core::BindGroup bindGroup(device.get(), createInfo);
+        ASSERT_NE(bindGroup.handle(), VK_NULL_HANDLE);
+        if (i == 0) {
+            firstSet = bindGroup.handle();
+        }
+        EXPECT_EQ(bindGroup.handle(), firstSet);
+    }
+
+    auto after = allocator->getStats();
+    EXPECT_EQ(after.allocatedSetCount, before.allocatedSetCount + 1);
+    EXPECT_EQ(after.recycledSetCount, before.recycledSetCount + 1);
+    EXPECT_LE(after.poolCount, before.poolCount + 1);
+}
+
 } // namespace
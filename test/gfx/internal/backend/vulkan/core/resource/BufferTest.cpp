@@ -200,6 +200,39 @@ TEST_F(VulkanBufferTest, MapBuffer_HostVisible_MapsSuccessfully)
     buffer.unmap();
 }
 
+TEST_F(VulkanBufferTest, MapBuffer_HostVisible_PointerIsStable)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo createInfo{};
+    createInfo.size = 256;
+    createInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    createInfo.memoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    gfx::backend::vulkan::core::Buffer buffer(device.get(), createInfo);
+
+    void* persistent = buffer.getMappedPointer();
+    ASSERT_NE(persistent, nullptr);
+
+    void* mappedPtr = buffer.map(64, 64);
+    EXPECT_EQ(mappedPtr, static_cast<char*>(persistent) + 64);
+    buffer.unmap();
+
+    EXPECT_EQ(buffer.getMappedPointer(), persistent);
+    EXPECT_EQ(buffer.map(0, 0), persistent);
+}
+
+TEST_F(VulkanBufferTest, MapBuffer_DeviceLocal_HasNoMappedPointer)
+{
+    gfx::backend::vulkan::core::BufferCreateInfo createInfo{};
+    createInfo.size = 256;
+    createInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    createInfo.memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+    gfx::backend::vulkan::core::Buffer buffer(device.get(), createInfo);
+
+    EXPECT_EQ(buffer.getMappedPointer(), nullptr);
+    EXPECT_EQ(buffer.map(0, 0), nullptr);
+}
+
 TEST_F(VulkanBufferTest, MapBuffer_WriteData_SuccessfullyWrites)
 {
     gfx::backend::vulkan::core::BufferCreateInfo createInfo{};
@@ -2,9 +2,12 @@
 #include <backend/vulkan/core/system/Adapter.h>
 #include <backend/vulkan/core/system/Device.h>
 #include <backend/vulkan/core/system/Instance.h>
+#include <backend/vulkan/core/system/SamplerCache.h>
 
 #include <gtest/gtest.h>
 
+#include <memory>
+
 // Test Vulkan core Sampler class
 // These tests verify the internal sampler implementation, not the public API
 
@@ -488,4 +491,78 @@ TEST_F(VulkanSamplerTest, CreateShadowMapSampler_CreatesSuccessfully)
     EXPECT_NE(sampler.handle(), VK_NULL_HANDLE);
 }
 
+TEST_F(VulkanSamplerTest, IdenticalCreateInfos_ShareHandle)
+{
+    gfx::backend::vulkan::core::SamplerCreateInfo createInfo{};
+    createInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    createInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    createInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    createInfo.magFilter = VK_FILTER_LINEAR;
+    createInfo.minFilter = VK_FILTER_LINEAR;
+    createInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    createInfo.lodMinClamp = 0.0f;
+    createInfo.lodMaxClamp = 16.0f;
+    createInfo.maxAnisotropy = 1;
+    createInfo.compareOp = VK_COMPARE_OP_MAX_ENUM;
+
+    auto* cache = device->getSamplerCache();
+    auto before = cache->getStats();
+
+    gfx::backend::vulkan::core::Sampler first(device.get(), createInfo);
+    gfx::backend::vulkan::core::Sampler second(device.get(), createInfo);
+
+    EXPECT_EQ(first.handle(), second.handle());
+    EXPECT_EQ(cache->getStats().samplerCount, before.samplerCount + 1);
+    EXPECT_EQ(cache->getStats().hitCount, before.hitCount + 1);
+}
+
+TEST_F(VulkanSamplerTest, DifferentCreateInfos_DoNotShareHandle)
+{
+    gfx::backend::vulkan::core::SamplerCreateInfo createInfo{};
+    createInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    createInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    createInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    createInfo.magFilter = VK_FILTER_LINEAR;
+    createInfo.minFilter = VK_FILTER_LINEAR;
+    createInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    createInfo.lodMinClamp = 0.0f;
+    createInfo.lodMaxClamp = 16.0f;
+    createInfo.maxAnisotropy = 1;
+    createInfo.compareOp = VK_COMPARE_OP_MAX_ENUM;
+
+    gfx::backend::vulkan::core::Sampler linear(device.get(), createInfo);
+    createInfo.lodMaxClamp = 1.0f;
+    gfx::backend::vulkan::core::Sampler clamped(device.get(), createInfo);
+
+    EXPECT_NE(linear.handle(), clamped.handle());
+}
+
+TEST_F(VulkanSamplerTest, LastRelease_DestroysSharedSampler)
+{
+    gfx::backend::vulkan::core::SamplerCreateInfo createInfo{};
+    createInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    createInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    createInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    createInfo.magFilter = VK_FILTER_NEAREST;
+    createInfo.minFilter = VK_FILTER_NEAREST;
+    createInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    createInfo.lodMinClamp = 0.0f;
+    createInfo.lodMaxClamp = 4.0f;
+    createInfo.maxAnisotropy = 1;
+    createInfo.compareOp = VK_COMPARE_OP_MAX_ENUM;
+
+    auto* cache = device->getSamplerCache();
+    const uint32_t countBefore = cache->getStats().samplerCount;
+    {
+        auto first = std::make_unique<gfx::backend::vulkan::core::Sampler>(device.get(), createInfo);
+        auto second = std::make_unique<gfx::backend::vulkan::core::Sampler>(device.get(), createInfo);
+
+        first.reset();
+        // Still referenced by the second sampler
+        EXPECT_EQ(cache->getStats().samplerCount, countBefore + 1);
+        EXPECT_NE(second->handle(), VK_NULL_HANDLE);
+    }
+    EXPECT_EQ(cache->getStats().samplerCount, countBefore);
+}
+
 } // namespace
@@ -1,3 +1,5 @@
+#include <backend/vulkan/core/command/BarrierBatch.h>
+#include <backend/vulkan/core/command/CommandEncoder.h>
 #include <backend/vulkan/core/resource/Texture.h>
 #include <backend/vulkan/core/system/Adapter.h>
 #include <backend/vulkan/core/system/Device.h>
@@ -363,6 +365,90 @@ TEST_F(VulkanTextureTest, SetLayout_UpdatesLayout_Correctly)
     EXPECT_EQ(texture.getLayout(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 }
 
+TEST_F(VulkanTextureTest, SetLayout_AppliesToEverySubresource)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo createInfo{};
+    createInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    createInfo.size = { 64, 64, 1 };
+    createInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    createInfo.mipLevelCount = 3;
+    createInfo.imageType = VK_IMAGE_TYPE_2D;
+    createInfo.arrayLayers = 2;
+    createInfo.flags = 0;
+
+    gfx::backend::vulkan::core::Texture texture(device.get(), createInfo);
+
+    texture.setLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(texture.getLayout(0, 0), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(texture.getLayout(2, 1), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(texture.getSubresourceState(1, 1).accessMask, static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT));
+}
+
+TEST_F(VulkanTextureTest, TransitionLayout_TracksSubresourcesIndependently)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo createInfo{};
+    createInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    createInfo.size = { 64, 64, 1 };
+    createInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    createInfo.mipLevelCount = 2;
+    createInfo.imageType = VK_IMAGE_TYPE_2D;
+    createInfo.arrayLayers = 4;
+    createInfo.flags = 0;
+
+    gfx::backend::vulkan::core::Texture texture(device.get(), createInfo);
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    gfx::backend::vulkan::core::BarrierBatch& batch = encoder.barriers();
+
+    texture.transitionLayout(batch, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, 1, 1, 2);
+    EXPECT_EQ(texture.getLayout(0, 0), VK_IMAGE_LAYOUT_UNDEFINED);
+    EXPECT_EQ(texture.getLayout(0, 1), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    EXPECT_EQ(texture.getLayout(0, 2), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    EXPECT_EQ(texture.getLayout(0, 3), VK_IMAGE_LAYOUT_UNDEFINED);
+    EXPECT_EQ(texture.getLayout(1, 1), VK_IMAGE_LAYOUT_UNDEFINED);
+
+    // Layers 0 and 3 share one state, layers 1-2 another, and mip 1 is still uniform
+    texture.transitionLayout(batch, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 2, 0, 4);
+    batch.flush();
+    encoder.end();
+
+    EXPECT_EQ(encoder.barrierStats().barrierCount, 1u + 3u + 1u);
+    EXPECT_EQ(encoder.barrierStats().pipelineBarrierCount, 2u);
+    EXPECT_EQ(texture.getLayout(0, 3), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(texture.getLayout(1, 2), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+TEST_F(VulkanTextureTest, TransitionLayout_ReadAfterRead_IsElided)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo createInfo{};
+    createInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    createInfo.size = { 64, 64, 1 };
+    createInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    createInfo.mipLevelCount = 1;
+    createInfo.imageType = VK_IMAGE_TYPE_2D;
+    createInfo.arrayLayers = 1;
+    createInfo.flags = 0;
+
+    gfx::backend::vulkan::core::Texture texture(device.get(), createInfo);
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    gfx::backend::vulkan::core::BarrierBatch& batch = encoder.barriers();
+
+    texture.transitionLayout(batch, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 1, 0, 1);
+    texture.transitionLayout(batch, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 1, 0, 1);
+    EXPECT_EQ(batch.getStats().elidedBarrierCount, 1u);
+
+    // Writes always wait for what came before, even in the same layout
+    texture.transitionLayout(batch, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, 1, 0, 1);
+    texture.transitionLayout(batch, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, 1, 0, 1);
+    batch.flush();
+    encoder.end();
+
+    EXPECT_EQ(batch.getStats().elidedBarrierCount, 1u);
+    EXPECT_EQ(batch.getStats().barrierCount, 3u);
+}
+
 // ============================================================================
 // Texture Import Tests
 // ============================================================================
@@ -581,4 +581,36 @@ TEST_F(VulkanTextureViewTest, GetFormat_ReturnsCorrectFormat)
     EXPECT_EQ(textureView.getFormat(), VK_FORMAT_R16G16B16A16_SFLOAT);
 }
 
+TEST_F(VulkanTextureViewTest, GetFramebufferAttachmentInfo_DescribesViewedSubresource)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo textureInfo{};
+    textureInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    textureInfo.size = { 512, 256, 1 };
+    textureInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    textureInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    textureInfo.mipLevelCount = 3;
+    textureInfo.imageType = VK_IMAGE_TYPE_2D;
+    textureInfo.arrayLayers = 4;
+    textureInfo.flags = 0;
+    gfx::backend::vulkan::core::Texture texture(device.get(), textureInfo);
+
+    gfx::backend::vulkan::core::TextureViewCreateInfo viewInfo{};
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    viewInfo.format = VK_FORMAT_UNDEFINED;
+    viewInfo.baseMipLevel = 2;
+    viewInfo.mipLevelCount = 1;
+    viewInfo.baseArrayLayer = 1;
+    viewInfo.arrayLayerCount = 2;
+
+    gfx::backend::vulkan::core::TextureView textureView(&texture, viewInfo);
+    gfx::backend::vulkan::core::FramebufferAttachmentInfo info = textureView.getFramebufferAttachmentInfo();
+
+    EXPECT_EQ(info.flags, 0u);
+    EXPECT_EQ(info.usage, textureInfo.usage);
+    EXPECT_EQ(info.width, 128u);
+    EXPECT_EQ(info.height, 64u);
+    EXPECT_EQ(info.layerCount, 2u);
+    EXPECT_EQ(info.format, VK_FORMAT_R8G8B8A8_UNORM);
+}
+
 } // namespace
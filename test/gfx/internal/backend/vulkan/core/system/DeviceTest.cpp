@@ -5,6 +5,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 // Test Vulkan core Device class
 // These tests verify the internal device implementation, not the public API
 
@@ -213,6 +216,72 @@ TEST_F(VulkanDeviceTest, WaitIdleMultipleTimes_WorksCorrectly)
     device.waitIdle();
 }
 
+// ============================================================================
+// Deferred Destruction Tests
+// ============================================================================
+
+TEST_F(VulkanDeviceTest, DeferDestroy_HeldUntilSerialCompletes)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo createInfo{};
+    gfx::backend::vulkan::core::Device device(adapter, createInfo);
+    if (!device.supportsTimelineSemaphores()) {
+        GTEST_SKIP() << "Timeline semaphores not supported";
+    }
+
+    // Work submitted before the destroy may still use the object
+    gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+    ASSERT_EQ(device.getQueue()->submit(submitInfo), VK_SUCCESS);
+
+    bool destroyed = false;
+    device.deferDestroy([&destroyed]() { destroyed = true; });
+
+    // Nothing was submitted since, so the serial has not even been signaled yet
+    device.releaseCompletedDestroys();
+    EXPECT_FALSE(destroyed);
+
+    device.waitIdle();
+    EXPECT_TRUE(destroyed);
+}
+
+TEST_F(VulkanDeviceTest, DeferDestroy_WithoutSubmittedWork_ReleasedRightAway)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo createInfo{};
+    gfx::backend::vulkan::core::Device device(adapter, createInfo);
+
+    // No queue got work, so no serial has to be waited on
+    bool destroyed = false;
+    device.deferDestroy([&destroyed]() { destroyed = true; });
+    device.releaseCompletedDestroys();
+    EXPECT_TRUE(destroyed);
+}
+
+TEST_F(VulkanDeviceTest, DeferDestroy_ReleasedByPoll)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo createInfo{};
+    gfx::backend::vulkan::core::Device device(adapter, createInfo);
+
+    bool destroyed = false;
+    device.deferDestroy([&destroyed]() { destroyed = true; });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!destroyed && std::chrono::steady_clock::now() < deadline) {
+        device.poll();
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(destroyed);
+}
+
+TEST_F(VulkanDeviceTest, DeferDestroy_ReleasedWithDevice)
+{
+    bool destroyed = false;
+    {
+        gfx::backend::vulkan::core::DeviceCreateInfo createInfo{};
+        gfx::backend::vulkan::core::Device device(adapter, createInfo);
+        device.deferDestroy([&destroyed]() { destroyed = true; });
+    }
+    EXPECT_TRUE(destroyed);
+}
+
 // ============================================================================
 // Extension Function Loading Tests
 // ============================================================================
@@ -356,4 +425,25 @@ TEST_F(VulkanDeviceTest, SupportsShaderFormat_WGSL)
     EXPECT_FALSE(supported);
 }
 
+// ============================================================================
+// Indirect Draw Support Tests
+// ============================================================================
+
+TEST_F(VulkanDeviceTest, SupportsMultiDrawIndirect_MatchesAdapterFeature)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo createInfo{};
+    gfx::backend::vulkan::core::Device device(adapter, createInfo);
+
+    EXPECT_EQ(device.supportsMultiDrawIndirect(), adapter->getFeatures().multiDrawIndirect == VK_TRUE);
+}
+
+TEST_F(VulkanDeviceTest, DrawIndirectCount_NotLoadedUnlessEnabled)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo createInfo{};
+    gfx::backend::vulkan::core::Device device(adapter, createInfo);
+
+    EXPECT_EQ(device.getCmdDrawIndirectCount(), nullptr);
+    EXPECT_EQ(device.getCmdDrawIndexedIndirectCount(), nullptr);
+}
+
 } // namespace
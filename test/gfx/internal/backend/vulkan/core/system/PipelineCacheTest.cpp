@@ -0,0 +1,142 @@
+#include <backend/vulkan/core/system/Adapter.h>
+#include <backend/vulkan/core/system/Device.h>
+#include <backend/vulkan/core/system/Instance.h>
+#include <backend/vulkan/core/system/PipelineCache.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+// Test Vulkan core PipelineCache class
+// These tests verify the internal pipeline cache implementation, not the public API
+
+namespace {
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class VulkanPipelineCacheTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        try {
+            gfx::backend::vulkan::core::InstanceCreateInfo instInfo{};
+            instInfo.enabledExtensions = {};
+            instance = std::make_unique<gfx::backend::vulkan::core::Instance>(instInfo);
+
+            gfx::backend::vulkan::core::AdapterCreateInfo adapterInfo{};
+            adapterInfo.adapterIndex = 0;
+            adapter = instance->requestAdapter(adapterInfo);
+
+            gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+            device = std::make_unique<gfx::backend::vulkan::core::Device>(adapter, deviceInfo);
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "Failed to set up Vulkan: " << e.what();
+        }
+    }
+
+    std::vector<uint8_t> getCacheData(const gfx::backend::vulkan::core::PipelineCache* cache)
+    {
+        size_t size = 0;
+        EXPECT_EQ(cache->getData(&size, nullptr), VK_SUCCESS);
+        std::vector<uint8_t> data(size);
+        EXPECT_EQ(cache->getData(&size, data.data()), VK_SUCCESS);
+        data.resize(size);
+        return data;
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
+    gfx::backend::vulkan::core::Adapter* adapter = nullptr;
+    std::unique_ptr<gfx::backend::vulkan::core::Device> device;
+};
+
+// ============================================================================
+// Header Validation Tests
+// ============================================================================
+
+TEST_F(VulkanPipelineCacheTest, IsCompatible_OwnData_ReturnsTrue)
+{
+    auto data = getCacheData(device->getPipelineCache());
+
+    EXPECT_TRUE(gfx::backend::vulkan::core::PipelineCache::isCompatible(data.data(), data.size(), adapter->getProperties()));
+}
+
+TEST_F(VulkanPipelineCacheTest, IsCompatible_Truncated_ReturnsFalse)
+{
+    auto data = getCacheData(device->getPipelineCache());
+
+    EXPECT_FALSE(gfx::backend::vulkan::core::PipelineCache::isCompatible(data.data(), 8, adapter->getProperties()));
+    EXPECT_FALSE(gfx::backend::vulkan::core::PipelineCache::isCompatible(nullptr, data.size(), adapter->getProperties()));
+}
+
+TEST_F(VulkanPipelineCacheTest, IsCompatible_Garbage_ReturnsFalse)
+{
+    std::vector<uint8_t> garbage(256, 0xcd);
+
+    EXPECT_FALSE(gfx::backend::vulkan::core::PipelineCache::isCompatible(garbage.data(), garbage.size(), adapter->getProperties()));
+}
+
+TEST_F(VulkanPipelineCacheTest, IsCompatible_DifferentUUID_ReturnsFalse)
+{
+    auto data = getCacheData(device->getPipelineCache());
+
+    VkPhysicalDeviceProperties otherDriver = adapter->getProperties();
+    otherDriver.pipelineCacheUUID[0] ^= 0xff;
+
+    EXPECT_FALSE(gfx::backend::vulkan::core::PipelineCache::isCompatible(data.data(), data.size(), otherDriver));
+}
+
+// ============================================================================
+// Creation Tests
+// ============================================================================
+
+TEST_F(VulkanPipelineCacheTest, Create_WithOwnData_Succeeds)
+{
+    auto data = getCacheData(device->getPipelineCache());
+
+    gfx::backend::vulkan::core::PipelineCache seeded(device.get(), data.data(), data.size());
+
+    EXPECT_NE(seeded.handle(), VK_NULL_HANDLE);
+    EXPECT_TRUE(seeded.initialDataAccepted());
+    EXPECT_GE(getCacheData(&seeded).size(), data.size());
+}
+
+TEST_F(VulkanPipelineCacheTest, Create_WithGarbage_StartsEmpty)
+{
+    std::vector<uint8_t> garbage(256, 0xcd);
+
+    gfx::backend::vulkan::core::PipelineCache cache(device.get(), garbage.data(), garbage.size());
+
+    EXPECT_NE(cache.handle(), VK_NULL_HANDLE);
+    EXPECT_FALSE(cache.initialDataAccepted());
+    auto data = getCacheData(&cache);
+    EXPECT_TRUE(gfx::backend::vulkan::core::PipelineCache::isCompatible(data.data(), data.size(), adapter->getProperties()));
+}
+
+TEST_F(VulkanPipelineCacheTest, GetData_BufferTooSmall_ReturnsIncomplete)
+{
+    size_t size = 0;
+    ASSERT_EQ(device->getPipelineCache()->getData(&size, nullptr), VK_SUCCESS);
+    ASSERT_GT(size, 1u);
+
+    std::vector<uint8_t> data(size - 1);
+    size_t smallSize = data.size();
+    EXPECT_EQ(device->getPipelineCache()->getData(&smallSize, data.data()), VK_INCOMPLETE);
+}
+
+TEST_F(VulkanPipelineCacheTest, Device_WithCacheData_UsesIt)
+{
+    auto data = getCacheData(device->getPipelineCache());
+
+    gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+    deviceInfo.pipelineCacheData = data.data();
+    deviceInfo.pipelineCacheDataSize = data.size();
+    gfx::backend::vulkan::core::Device seededDevice(adapter, deviceInfo);
+
+    ASSERT_NE(seededDevice.getPipelineCache(), nullptr);
+    EXPECT_NE(seededDevice.getPipelineCache()->handle(), VK_NULL_HANDLE);
+}
+
+} // namespace
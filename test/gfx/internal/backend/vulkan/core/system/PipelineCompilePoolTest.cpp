@@ -0,0 +1,61 @@
+#include <backend/vulkan/core/system/PipelineCompilePool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+// Test Vulkan core PipelineCompilePool class
+// The pool doesn't touch Vulkan, so these tests run without a device
+
+namespace {
+
+TEST(VulkanPipelineCompilePoolTest, DefaultThreadCount_IsAtLeastOne)
+{
+    EXPECT_GE(gfx::backend::vulkan::core::PipelineCompilePool::defaultThreadCount(), 1u);
+}
+
+TEST(VulkanPipelineCompilePoolTest, ZeroThreadCount_UsesDefault)
+{
+    gfx::backend::vulkan::core::PipelineCompilePool pool(0);
+    EXPECT_EQ(pool.getThreadCount(), gfx::backend::vulkan::core::PipelineCompilePool::defaultThreadCount());
+}
+
+TEST(VulkanPipelineCompilePoolTest, ExplicitThreadCount_IsUsed)
+{
+    gfx::backend::vulkan::core::PipelineCompilePool pool(3);
+    EXPECT_EQ(pool.getThreadCount(), 3u);
+}
+
+TEST(VulkanPipelineCompilePoolTest, WaitIdle_RunsEverySubmittedTask)
+{
+    gfx::backend::vulkan::core::PipelineCompilePool pool(2);
+
+    std::atomic<int> counter = 0;
+    for (int i = 0; i < 100; ++i) {
+        pool.submit([&counter]() { ++counter; });
+    }
+    pool.waitIdle();
+
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(VulkanPipelineCompilePoolTest, WaitIdle_WithoutTasks_Returns)
+{
+    gfx::backend::vulkan::core::PipelineCompilePool pool(1);
+    pool.waitIdle();
+}
+
+TEST(VulkanPipelineCompilePoolTest, Destructor_RunsQueuedTasks)
+{
+    std::atomic<int> counter = 0;
+    {
+        gfx::backend::vulkan::core::PipelineCompilePool pool(1);
+        for (int i = 0; i < 10; ++i) {
+            pool.submit([&counter]() { ++counter; });
+        }
+    }
+
+    EXPECT_EQ(counter.load(), 10);
+}
+
+} // namespace
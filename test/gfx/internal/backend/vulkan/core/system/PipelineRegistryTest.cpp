@@ -0,0 +1,276 @@
+#include <backend/vulkan/core/compute/ComputePipeline.h>
+#include <backend/vulkan/core/resource/BindGroupLayout.h>
+#include <backend/vulkan/core/resource/Shader.h>
+#include <backend/vulkan/core/system/Adapter.h>
+#include <backend/vulkan/core/system/Device.h>
+#include <backend/vulkan/core/system/Instance.h>
+#include <backend/vulkan/core/system/PipelineRegistry.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+// Test Vulkan core PipelineRegistry class
+// These tests verify the internal pipeline deduplication, not the public API
+
+namespace {
+
+// Minimal compute shader SPIR-V (empty main function, workgroup size 1,1,1)
+static const uint32_t MINIMAL_COMPUTE_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00080001, 0x00000009, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+    0x0005000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060010, 0x00000004, 0x00000011,
+    0x00000001, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x00040005, 0x00000004,
+    0x6e69616d, 0x00000000, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00050036,
+    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000008, 0x000100fd, 0x00010038
+};
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class VulkanPipelineRegistryTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        try {
+            gfx::backend::vulkan::core::InstanceCreateInfo instInfo{};
+            instInfo.enabledExtensions = {};
+            instance = std::make_unique<gfx::backend::vulkan::core::Instance>(instInfo);
+
+            gfx::backend::vulkan::core::AdapterCreateInfo adapterInfo{};
+            adapterInfo.adapterIndex = 0;
+            adapter = instance->requestAdapter(adapterInfo);
+
+            gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+            device = std::make_unique<gfx::backend::vulkan::core::Device>(adapter, deviceInfo);
+            registry = device->getPipelineRegistry();
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "Failed to set up Vulkan: " << e.what();
+        }
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Shader> createShader()
+    {
+        gfx::backend::vulkan::core::ShaderCreateInfo shaderInfo{};
+        shaderInfo.code = MINIMAL_COMPUTE_SPIRV;
+        shaderInfo.codeSize = sizeof(MINIMAL_COMPUTE_SPIRV);
+        return std::make_unique<gfx::backend::vulkan::core::Shader>(device.get(), shaderInfo);
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::BindGroupLayout> createUniformLayout()
+    {
+        gfx::backend::vulkan::core::BindGroupLayoutEntry entry{};
+        entry.binding = 0;
+        entry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        entry.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+        gfx::backend::vulkan::core::BindGroupLayoutCreateInfo layoutInfo{};
+        layoutInfo.entries = { entry };
+        return std::make_unique<gfx::backend::vulkan::core::BindGroupLayout>(device.get(), layoutInfo);
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
+    gfx::backend::vulkan::core::Adapter* adapter = nullptr;
+    std::unique_ptr<gfx::backend::vulkan::core::Device> device;
+    gfx::backend::vulkan::core::PipelineRegistry* registry = nullptr;
+};
+
+// ============================================================================
+// Pipeline Layout Tests
+// ============================================================================
+
+TEST_F(VulkanPipelineRegistryTest, AcquirePipelineLayout_SameSetLayouts_SharesLayout)
+{
+    auto setLayout = createUniformLayout();
+
+    VkPipelineLayout first = registry->acquirePipelineLayout({ setLayout->handle() });
+    VkPipelineLayout second = registry->acquirePipelineLayout({ setLayout->handle() });
+
+    EXPECT_NE(first, VK_NULL_HANDLE);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(registry->getStats().layoutCount, 1u);
+    EXPECT_EQ(registry->getStats().layoutHits, 1u);
+
+    registry->releasePipelineLayout(first);
+    EXPECT_EQ(registry->getStats().layoutCount, 1u);
+    registry->releasePipelineLayout(second);
+    EXPECT_EQ(registry->getStats().layoutCount, 0u);
+}
+
+TEST_F(VulkanPipelineRegistryTest, AcquirePipelineLayout_DifferentSetLayouts_CreatesNewLayout)
+{
+    auto setLayoutA = createUniformLayout();
+    auto setLayoutB = createUniformLayout();
+
+    VkPipelineLayout first = registry->acquirePipelineLayout({ setLayoutA->handle() });
+    VkPipelineLayout second = registry->acquirePipelineLayout({ setLayoutB->handle() });
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(registry->getStats().layoutCount, 2u);
+
+    registry->releasePipelineLayout(first);
+    registry->releasePipelineLayout(second);
+}
+
+TEST_F(VulkanPipelineRegistryTest, ForgetDescriptorSetLayout_StopsSharingLayout)
+{
+    auto setLayout = createUniformLayout();
+
+    VkPipelineLayout first = registry->acquirePipelineLayout({ setLayout->handle() });
+    registry->forgetDescriptorSetLayout(setLayout->handle());
+    VkPipelineLayout second = registry->acquirePipelineLayout({ setLayout->handle() });
+
+    EXPECT_NE(first, second);
+
+    registry->releasePipelineLayout(first);
+    registry->releasePipelineLayout(second);
+    EXPECT_EQ(registry->getStats().layoutCount, 0u);
+}
+
+TEST_F(VulkanPipelineRegistryTest, AcquirePipelineLayout_DifferentPushConstantRanges_CreatesNewLayout)
+{
+    auto setLayout = createUniformLayout();
+
+    VkPipelineLayout withoutRanges = registry->acquirePipelineLayout({ setLayout->handle() });
+    VkPipelineLayout withRanges = registry->acquirePipelineLayout({ setLayout->handle() }, { { VK_SHADER_STAGE_COMPUTE_BIT, 0, 16 } });
+    VkPipelineLayout sameRanges = registry->acquirePipelineLayout({ setLayout->handle() }, { { VK_SHADER_STAGE_COMPUTE_BIT, 0, 16 } });
+
+    EXPECT_NE(withoutRanges, withRanges);
+    EXPECT_EQ(withRanges, sameRanges);
+    EXPECT_EQ(registry->getStats().layoutCount, 2u);
+
+    registry->releasePipelineLayout(withoutRanges);
+    registry->releasePipelineLayout(withRanges);
+    registry->releasePipelineLayout(sameRanges);
+    EXPECT_EQ(registry->getStats().layoutCount, 0u);
+}
+
+// ============================================================================
+// Pipeline Tests
+// ============================================================================
+
+TEST_F(VulkanPipelineRegistryTest, ComputePipelines_IdenticalCreateInfo_CompiledOnce)
+{
+    auto shader = createShader();
+
+    gfx::backend::vulkan::core::ComputePipelineCreateInfo createInfo{};
+    createInfo.module = shader->handle();
+    createInfo.entryPoint = "main";
+
+    auto before = registry->getStats();
+    std::vector<std::unique_ptr<gfx::backend::vulkan::core::ComputePipeline>> pipelines;
+    for (int i = 0; i < 100; ++i) {
+        pipelines.push_back(std::make_unique<gfx::backend::vulkan::core::ComputePipeline>(device.get(), createInfo));
+    }
+
+    auto stats = registry->getStats();
+    EXPECT_EQ(stats.pipelineCount, before.pipelineCount + 1);
+    EXPECT_EQ(stats.layoutCount, before.layoutCount + 1);
+    EXPECT_EQ(stats.pipelineHits, before.pipelineHits + 99);
+
+    pipelines.clear();
+    EXPECT_EQ(registry->getStats().pipelineCount, before.pipelineCount);
+    EXPECT_EQ(registry->getStats().layoutCount, before.layoutCount);
+}
+
+TEST_F(VulkanPipelineRegistryTest, AcquirePipeline_ExistingKey_DoesNotCallCreate)
+{
+    auto shader = createShader();
+
+    gfx::backend::vulkan::core::ComputePipelineCreateInfo createInfo{};
+    createInfo.module = shader->handle();
+    createInfo.entryPoint = "main";
+    gfx::backend::vulkan::core::ComputePipeline pipeline(device.get(), createInfo);
+
+    auto key = gfx::backend::vulkan::core::PipelineRegistry::makeKey(createInfo, pipeline.layout());
+    bool created = false;
+    VkPipeline shared = registry->acquirePipeline(key, [&]() {
+        created = true;
+        return VkPipeline(VK_NULL_HANDLE);
+    });
+
+    EXPECT_FALSE(created);
+    EXPECT_EQ(shared, pipeline.handle());
+    registry->releasePipeline(shared);
+}
+
+TEST_F(VulkanPipelineRegistryTest, ForgetShaderModule_StopsSharingPipeline)
+{
+    auto shader = createShader();
+
+    gfx::backend::vulkan::core::ComputePipelineCreateInfo createInfo{};
+    createInfo.module = shader->handle();
+    createInfo.entryPoint = "main";
+
+    gfx::backend::vulkan::core::ComputePipeline first(device.get(), createInfo);
+    registry->forgetShaderModule(shader->handle());
+    gfx::backend::vulkan::core::ComputePipeline second(device.get(), createInfo);
+
+    EXPECT_NE(first.handle(), second.handle());
+}
+
+// ============================================================================
+// Key Tests
+// ============================================================================
+
+TEST_F(VulkanPipelineRegistryTest, MakeKey_RenderState_AffectsKey)
+{
+    gfx::backend::vulkan::core::RenderPipelineCreateInfo createInfo{};
+    createInfo.vertex.entryPoint = "main";
+    createInfo.primitive.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    createInfo.primitive.polygonMode = VK_POLYGON_MODE_FILL;
+    createInfo.primitive.cullMode = VK_CULL_MODE_NONE;
+    createInfo.primitive.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+
+    auto base = gfx::backend::vulkan::core::PipelineRegistry::makeKey(createInfo, VK_NULL_HANDLE);
+    EXPECT_EQ(base.data, gfx::backend::vulkan::core::PipelineRegistry::makeKey(createInfo, VK_NULL_HANDLE).data);
+
+    auto culled = createInfo;
+    culled.primitive.cullMode = VK_CULL_MODE_BACK_BIT;
+    EXPECT_NE(base.data, gfx::backend::vulkan::core::PipelineRegistry::makeKey(culled, VK_NULL_HANDLE).data);
+
+    auto withDepth = createInfo;
+    withDepth.depthStencil = gfx::backend::vulkan::core::DepthStencilState{ VK_FORMAT_D32_SFLOAT, true, VK_COMPARE_OP_LESS };
+    EXPECT_NE(base.data, gfx::backend::vulkan::core::PipelineRegistry::makeKey(withDepth, VK_NULL_HANDLE).data);
+
+    auto otherEntryPoint = createInfo;
+    otherEntryPoint.vertex.entryPoint = "vs_main";
+    EXPECT_NE(base.data, gfx::backend::vulkan::core::PipelineRegistry::makeKey(otherEntryPoint, VK_NULL_HANDLE).data);
+}
+
+
+// ============================================================================
+// Push Constant Tests
+// ============================================================================
+
+TEST(VulkanPipelineRegistryPushConstantTest, PushConstantStages_UnionsOverlappingRanges)
+{
+    const std::vector<VkPushConstantRange> ranges = {
+        { VK_SHADER_STAGE_VERTEX_BIT, 0, 16 },
+        { VK_SHADER_STAGE_FRAGMENT_BIT, 8, 16 },
+    };
+
+    using gfx::backend::vulkan::core::PipelineRegistry;
+    EXPECT_EQ(PipelineRegistry::pushConstantStages(ranges, 0, 8), static_cast<VkShaderStageFlags>(VK_SHADER_STAGE_VERTEX_BIT));
+    EXPECT_EQ(PipelineRegistry::pushConstantStages(ranges, 16, 8), static_cast<VkShaderStageFlags>(VK_SHADER_STAGE_FRAGMENT_BIT));
+    EXPECT_EQ(PipelineRegistry::pushConstantStages(ranges, 4, 8), static_cast<VkShaderStageFlags>(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT));
+}
+
+TEST(VulkanPipelineRegistryPushConstantTest, PushConstantStages_UncoveredBytes_ReturnsZero)
+{
+    const std::vector<VkPushConstantRange> ranges = {
+        { VK_SHADER_STAGE_COMPUTE_BIT, 0, 8 },
+        { VK_SHADER_STAGE_COMPUTE_BIT, 16, 8 },
+    };
+
+    using gfx::backend::vulkan::core::PipelineRegistry;
+    EXPECT_EQ(PipelineRegistry::pushConstantStages(ranges, 0, 24), 0u);
+    EXPECT_EQ(PipelineRegistry::pushConstantStages(ranges, 20, 8), 0u);
+    EXPECT_EQ(PipelineRegistry::pushConstantStages({}, 0, 4), 0u);
+    EXPECT_EQ(PipelineRegistry::pushConstantStages(ranges, 16, 8), static_cast<VkShaderStageFlags>(VK_SHADER_STAGE_COMPUTE_BIT));
+}
+
+} // namespace
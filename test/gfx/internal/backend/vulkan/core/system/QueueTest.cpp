@@ -1,10 +1,18 @@
+#include <backend/vulkan/core/command/CommandEncoder.h>
+#include <backend/vulkan/core/resource/Buffer.h>
 #include <backend/vulkan/core/system/Adapter.h>
 #include <backend/vulkan/core/system/Device.h>
 #include <backend/vulkan/core/system/Instance.h>
 #include <backend/vulkan/core/system/Queue.h>
+#include <backend/vulkan/core/sync/Fence.h>
+#include <backend/vulkan/core/sync/Semaphore.h>
+#include <backend/vulkan/core/util/CommandExecutor.h>
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <vector>
+
 // Test Vulkan core Queue class
 // These tests verify the internal queue implementation, not the public API
 
@@ -36,6 +44,31 @@ protected:
         }
     }
 
+    std::unique_ptr<gfx::backend::vulkan::core::Buffer> createBuffer(size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memoryProperties)
+    {
+        gfx::backend::vulkan::core::BufferCreateInfo createInfo{};
+        createInfo.size = size;
+        createInfo.usage = usage;
+        createInfo.memoryProperties = memoryProperties;
+        return std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), createInfo);
+    }
+
+    // Copies a device-local buffer into host-visible memory and returns its contents
+    std::vector<uint8_t> readBack(gfx::backend::vulkan::core::Buffer* source, size_t size)
+    {
+        auto readback = createBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        gfx::backend::vulkan::core::CommandExecutor executor(queue);
+        executor.execute([&](VkCommandBuffer cmd) {
+            VkBufferCopy region{};
+            region.size = size;
+            vkCmdCopyBuffer(cmd, source->handle(), readback->handle(), 1, &region);
+        });
+
+        std::vector<uint8_t> result(size);
+        std::memcpy(result.data(), readback->map(0, size), size);
+        return result;
+    }
+
     std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
     gfx::backend::vulkan::core::Adapter* adapter = nullptr;
     std::unique_ptr<gfx::backend::vulkan::core::Device> device;
@@ -251,4 +284,299 @@ TEST_F(VulkanQueueTest, AccessQueueAfterMultipleWaits_RemainsValid)
     EXPECT_NE(queue->family(), UINT32_MAX);
 }
 
+// ============================================================================
+// Staged Upload Tests
+// ============================================================================
+
+TEST_F(VulkanQueueTest, WriteBuffer_DeviceLocal_UploadsThroughStagingRing)
+{
+    constexpr size_t SIZE = 1024;
+    auto buffer = createBuffer(SIZE, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    std::vector<uint8_t> data(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    queue->writeBuffer(buffer.get(), 0, data.data(), SIZE);
+
+    EXPECT_EQ(readBack(buffer.get(), SIZE), data);
+}
+
+TEST_F(VulkanQueueTest, WriteBuffer_RepeatedWrites_LastWriteWins)
+{
+    constexpr size_t SIZE = 256;
+    auto buffer = createBuffer(SIZE, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    // Several uploads recorded before any submit must apply in order
+    std::vector<uint8_t> data(SIZE);
+    for (uint8_t value = 1; value <= 8; ++value) {
+        std::fill(data.begin(), data.end(), value);
+        queue->writeBuffer(buffer.get(), 0, data.data(), SIZE);
+    }
+
+    EXPECT_EQ(readBack(buffer.get(), SIZE), data);
+}
+
+TEST_F(VulkanQueueTest, WriteBuffer_LargerThanRing_GrowsRing)
+{
+    constexpr size_t SIZE = 16 * 1024 * 1024;
+    auto buffer = createBuffer(SIZE, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    std::vector<uint8_t> data(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        data[i] = static_cast<uint8_t>(i ^ (i >> 8));
+    }
+    queue->writeBuffer(buffer.get(), 0, data.data(), SIZE);
+
+    EXPECT_EQ(readBack(buffer.get(), SIZE), data);
+}
+
+TEST_F(VulkanQueueTest, WriteBuffer_ManySmallWrites_LandAtTheirOffsets)
+{
+    // Many small uploads share the ring and one batch; each must land where it was written
+    constexpr size_t CHUNK = 256;
+    constexpr size_t CHUNK_COUNT = 1024;
+    constexpr size_t SIZE = CHUNK * CHUNK_COUNT;
+    auto buffer = createBuffer(SIZE, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    std::vector<uint8_t> expected(SIZE);
+    std::vector<uint8_t> chunk(CHUNK);
+    // Write the chunks back to front so ring order and buffer order differ
+    for (size_t i = CHUNK_COUNT; i-- > 0;) {
+        for (size_t j = 0; j < CHUNK; ++j) {
+            chunk[j] = static_cast<uint8_t>(i * 31 + j);
+        }
+        queue->writeBuffer(buffer.get(), i * CHUNK, chunk.data(), CHUNK);
+        std::memcpy(expected.data() + i * CHUNK, chunk.data(), CHUNK);
+    }
+
+    EXPECT_EQ(readBack(buffer.get(), SIZE), expected);
+}
+
+// ============================================================================
+// Submit Tests
+// ============================================================================
+
+TEST_F(VulkanQueueTest, Submit_WaitStageMask_WaitsForTimelineValue)
+{
+    gfx::backend::vulkan::core::SemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.type = gfx::backend::vulkan::core::SemaphoreType::Timeline;
+    semaphoreInfo.initialValue = 0;
+    gfx::backend::vulkan::core::Semaphore waitSemaphore(device.get(), semaphoreInfo);
+    gfx::backend::vulkan::core::Semaphore signalSemaphore(device.get(), semaphoreInfo);
+
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    encoder.end();
+
+    gfx::backend::vulkan::core::CommandEncoder* encoders[] = { &encoder };
+    gfx::backend::vulkan::core::Semaphore* waitSemaphores[] = { &waitSemaphore };
+    gfx::backend::vulkan::core::Semaphore* signalSemaphores[] = { &signalSemaphore };
+    uint64_t waitValues[] = { 1 };
+    uint64_t signalValues[] = { 1 };
+
+    gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+    submitInfo.commandEncoders = encoders;
+    submitInfo.commandEncoderCount = 1;
+    submitInfo.waitSemaphores = waitSemaphores;
+    submitInfo.waitValues = waitValues;
+    submitInfo.waitStageMasks = { VK_PIPELINE_STAGE_TRANSFER_BIT };
+    submitInfo.waitSemaphoreCount = 1;
+    submitInfo.signalSemaphores = signalSemaphores;
+    submitInfo.signalValues = signalValues;
+    submitInfo.signalSemaphoreCount = 1;
+    ASSERT_EQ(queue->submit(submitInfo), VK_SUCCESS);
+
+    EXPECT_EQ(signalSemaphore.getValue(), 0u);
+
+    waitSemaphore.signal(1);
+    EXPECT_EQ(signalSemaphore.wait(1, UINT64_MAX), VK_SUCCESS);
+    EXPECT_EQ(signalSemaphore.getValue(), 1u);
+}
+
+TEST_F(VulkanQueueTest, Submit_DefaultWaitStage_SignalsFence)
+{
+    gfx::backend::vulkan::core::SemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.type = gfx::backend::vulkan::core::SemaphoreType::Timeline;
+    semaphoreInfo.initialValue = 1;
+    gfx::backend::vulkan::core::Semaphore waitSemaphore(device.get(), semaphoreInfo);
+
+    gfx::backend::vulkan::core::FenceCreateInfo fenceInfo{};
+    fenceInfo.signaled = false;
+    gfx::backend::vulkan::core::Fence fence(device.get(), fenceInfo);
+
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    encoder.end();
+
+    gfx::backend::vulkan::core::CommandEncoder* encoders[] = { &encoder };
+    gfx::backend::vulkan::core::Semaphore* waitSemaphores[] = { &waitSemaphore };
+    uint64_t waitValues[] = { 1 };
+
+    // A 0 entry falls back to the default stage
+    gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+    submitInfo.commandEncoders = encoders;
+    submitInfo.commandEncoderCount = 1;
+    submitInfo.signalFence = &fence;
+    submitInfo.waitSemaphores = waitSemaphores;
+    submitInfo.waitValues = waitValues;
+    submitInfo.waitStageMasks = { 0 };
+    submitInfo.waitSemaphoreCount = 1;
+    ASSERT_EQ(queue->submit(submitInfo), VK_SUCCESS);
+
+    EXPECT_EQ(fence.wait(UINT64_MAX), VK_SUCCESS);
+}
+
+TEST_F(VulkanQueueTest, MarkSerial_SignaledByNextSubmit)
+{
+    if (!device->supportsTimelineSemaphores()) {
+        GTEST_SKIP() << "Timeline semaphores not supported";
+    }
+
+    // A serial is only needed once the queue got work
+    gfx::backend::vulkan::core::SubmitInfo emptySubmit{};
+    ASSERT_EQ(queue->submit(emptySubmit), VK_SUCCESS);
+
+    uint64_t serial = queue->markSerial();
+    EXPECT_GT(serial, queue->getCompletedSerial());
+    // Marking again before a submit returns the same serial
+    EXPECT_EQ(queue->markSerial(), serial);
+
+    gfx::backend::vulkan::core::FenceCreateInfo fenceInfo{};
+    fenceInfo.signaled = false;
+    gfx::backend::vulkan::core::Fence fence(device.get(), fenceInfo);
+
+    gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+    encoder.end();
+
+    gfx::backend::vulkan::core::CommandEncoder* encoders[] = { &encoder };
+    gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+    submitInfo.commandEncoders = encoders;
+    submitInfo.commandEncoderCount = 1;
+    submitInfo.signalFence = &fence;
+    ASSERT_EQ(queue->submit(submitInfo), VK_SUCCESS);
+
+    EXPECT_EQ(fence.wait(UINT64_MAX), VK_SUCCESS);
+    EXPECT_GE(queue->getCompletedSerial(), serial);
+    // The submit carried the serial, no work came after it
+    EXPECT_EQ(queue->markSerial(), serial);
+}
+
+TEST_F(VulkanQueueTest, InternalSubmit_SignalsSerial)
+{
+    if (!device->supportsTimelineSemaphores()) {
+        GTEST_SKIP() << "Timeline semaphores not supported";
+    }
+
+    gfx::backend::vulkan::core::FenceCreateInfo fenceInfo{};
+    fenceInfo.signaled = false;
+    gfx::backend::vulkan::core::Fence fence(device.get(), fenceInfo);
+
+    uint64_t before = queue->getCompletedSerial();
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    ASSERT_EQ(queue->submit(submitInfo, fence.handle()), VK_SUCCESS);
+    EXPECT_EQ(fence.wait(UINT64_MAX), VK_SUCCESS);
+
+    // Nothing else has to be submitted for destroys made meanwhile to complete
+    EXPECT_GT(queue->getCompletedSerial(), before);
+    EXPECT_EQ(queue->markSerial(), queue->getCompletedSerial());
+}
+
+TEST_F(VulkanQueueTest, SubmitSerial_SignalsWithoutOtherWork)
+{
+    if (!device->supportsTimelineSemaphores()) {
+        GTEST_SKIP() << "Timeline semaphores not supported";
+    }
+
+    gfx::backend::vulkan::core::SubmitInfo emptySubmit{};
+    ASSERT_EQ(queue->submit(emptySubmit), VK_SUCCESS);
+
+    uint64_t serial = 0;
+    ASSERT_EQ(queue->submitSerial(&serial), VK_SUCCESS);
+    EXPECT_GT(serial, 0u);
+
+    // Nothing else is submitted, the serial's signal went out on its own
+    ASSERT_NE(queue->getSerialSemaphore(), nullptr);
+    EXPECT_EQ(queue->getSerialSemaphore()->wait(serial, UINT64_MAX), VK_SUCCESS);
+    EXPECT_GE(queue->getCompletedSerial(), serial);
+}
+
+TEST_F(VulkanQueueTest, SubmitBatch_SignalsInOrder)
+{
+    gfx::backend::vulkan::core::SemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.type = gfx::backend::vulkan::core::SemaphoreType::Timeline;
+    semaphoreInfo.initialValue = 0;
+    gfx::backend::vulkan::core::Semaphore semaphore(device.get(), semaphoreInfo);
+
+    gfx::backend::vulkan::core::Semaphore* semaphores[] = { &semaphore };
+    uint64_t firstValue = 1;
+    uint64_t secondValue = 2;
+
+    gfx::backend::vulkan::core::SubmitInfo submitInfos[2]{};
+    submitInfos[0].signalSemaphores = semaphores;
+    submitInfos[0].signalValues = &firstValue;
+    submitInfos[0].signalSemaphoreCount = 1;
+    submitInfos[1].waitSemaphores = semaphores;
+    submitInfos[1].waitValues = &firstValue;
+    submitInfos[1].waitSemaphoreCount = 1;
+    submitInfos[1].signalSemaphores = semaphores;
+    submitInfos[1].signalValues = &secondValue;
+    submitInfos[1].signalSemaphoreCount = 1;
+    ASSERT_EQ(queue->submit(submitInfos, 2), VK_SUCCESS);
+
+    EXPECT_EQ(semaphore.wait(2, UINT64_MAX), VK_SUCCESS);
+}
+
+TEST_F(VulkanQueueTest, DeferredSubmit_HeldBackUntilFlush)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+    deviceInfo.deferSubmits = true;
+    gfx::backend::vulkan::core::Device deferredDevice(adapter, deviceInfo);
+    gfx::backend::vulkan::core::Queue* deferredQueue = deferredDevice.getQueue();
+
+    gfx::backend::vulkan::core::SemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.type = gfx::backend::vulkan::core::SemaphoreType::Timeline;
+    semaphoreInfo.initialValue = 0;
+    gfx::backend::vulkan::core::Semaphore semaphore(&deferredDevice, semaphoreInfo);
+
+    gfx::backend::vulkan::core::Semaphore* semaphores[] = { &semaphore };
+    uint64_t values[] = { 1, 2 };
+
+    gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+    submitInfo.signalSemaphores = semaphores;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.signalValues = &values[0];
+    ASSERT_EQ(deferredQueue->submit(submitInfo), VK_SUCCESS);
+    submitInfo.signalValues = &values[1];
+    ASSERT_EQ(deferredQueue->submit(submitInfo), VK_SUCCESS);
+
+    // Nothing reached the GPU yet, so nothing can have signaled
+    EXPECT_EQ(semaphore.getValue(), 0u);
+
+    ASSERT_EQ(deferredQueue->flush(), VK_SUCCESS);
+    EXPECT_EQ(semaphore.wait(2, UINT64_MAX), VK_SUCCESS);
+}
+
+TEST_F(VulkanQueueTest, DeferredSubmit_HostWaitFlushes)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+    deviceInfo.deferSubmits = true;
+    gfx::backend::vulkan::core::Device deferredDevice(adapter, deviceInfo);
+
+    gfx::backend::vulkan::core::SemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.type = gfx::backend::vulkan::core::SemaphoreType::Timeline;
+    semaphoreInfo.initialValue = 0;
+    gfx::backend::vulkan::core::Semaphore semaphore(&deferredDevice, semaphoreInfo);
+
+    gfx::backend::vulkan::core::Semaphore* semaphores[] = { &semaphore };
+    uint64_t signalValue = 1;
+
+    gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+    submitInfo.signalSemaphores = semaphores;
+    submitInfo.signalValues = &signalValue;
+    submitInfo.signalSemaphoreCount = 1;
+    ASSERT_EQ(deferredDevice.getQueue()->submit(submitInfo), VK_SUCCESS);
+
+    EXPECT_EQ(semaphore.wait(1, UINT64_MAX), VK_SUCCESS);
+}
+
 } // namespace
@@ -0,0 +1,237 @@
+#include <backend/vulkan/core/command/CommandEncoder.h>
+#include <backend/vulkan/core/resource/Buffer.h>
+#include <backend/vulkan/core/resource/Texture.h>
+#include <backend/vulkan/core/sync/Fence.h>
+#include <backend/vulkan/core/sync/Semaphore.h>
+#include <backend/vulkan/core/system/Adapter.h>
+#include <backend/vulkan/core/system/Device.h>
+#include <backend/vulkan/core/system/Instance.h>
+#include <backend/vulkan/core/system/Queue.h>
+#include <backend/vulkan/core/system/UploadEngine.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Test Vulkan core UploadEngine class
+// These tests verify the internal upload engine implementation, not the public API
+
+namespace {
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class VulkanUploadEngineTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        try {
+            gfx::backend::vulkan::core::InstanceCreateInfo instInfo{};
+            instInfo.enabledExtensions = {};
+            instance = std::make_unique<gfx::backend::vulkan::core::Instance>(instInfo);
+
+            gfx::backend::vulkan::core::AdapterCreateInfo adapterInfo{};
+            adapterInfo.adapterIndex = 0;
+            adapter = instance->requestAdapter(adapterInfo);
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "Failed to set up Vulkan: " << e.what();
+        }
+
+        auto supported = adapter->enumerateSupportedExtensions();
+        bool hasUploadQueue = std::any_of(supported.begin(), supported.end(), [](const char* name) {
+            return strcmp(name, gfx::backend::vulkan::core::extensions::UPLOAD_QUEUE) == 0;
+        });
+        if (!hasUploadQueue) {
+            GTEST_SKIP() << "Upload queue not supported";
+        }
+
+        try {
+            gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+            deviceInfo.enabledExtensions = { gfx::backend::vulkan::core::extensions::UPLOAD_QUEUE };
+            device = std::make_unique<gfx::backend::vulkan::core::Device>(adapter, deviceInfo);
+            uploadEngine = device->getUploadEngine();
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "Failed to create device: " << e.what();
+        }
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Buffer> createBuffer(size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memoryProperties)
+    {
+        gfx::backend::vulkan::core::BufferCreateInfo createInfo{};
+        createInfo.size = size;
+        createInfo.usage = usage;
+        createInfo.memoryProperties = memoryProperties;
+        return std::make_unique<gfx::backend::vulkan::core::Buffer>(device.get(), createInfo);
+    }
+
+    // Copies the buffer into host-visible memory on the graphics queue, waiting on the upload first
+    std::vector<uint8_t> readBackAfter(uint64_t uploadValue, gfx::backend::vulkan::core::Buffer* source, size_t size)
+    {
+        auto readback = createBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        gfx::backend::vulkan::core::CommandEncoder encoder(device.get());
+        encoder.begin();
+        encoder.copyBufferToBuffer(source, 0, readback.get(), 0, size);
+        encoder.end();
+
+        gfx::backend::vulkan::core::FenceCreateInfo fenceInfo{};
+        fenceInfo.signaled = false;
+        gfx::backend::vulkan::core::Fence fence(device.get(), fenceInfo);
+
+        gfx::backend::vulkan::core::CommandEncoder* encoders[] = { &encoder };
+        gfx::backend::vulkan::core::Semaphore* waitSemaphores[] = { uploadEngine->getSemaphore() };
+        uint64_t waitValues[] = { uploadValue };
+
+        gfx::backend::vulkan::core::SubmitInfo submitInfo{};
+        submitInfo.commandEncoders = encoders;
+        submitInfo.commandEncoderCount = 1;
+        submitInfo.signalFence = &fence;
+        submitInfo.waitSemaphores = waitSemaphores;
+        submitInfo.waitValues = waitValues;
+        submitInfo.waitSemaphoreCount = 1;
+        EXPECT_EQ(device->getQueue()->submit(submitInfo), VK_SUCCESS);
+        EXPECT_EQ(fence.wait(UINT64_MAX), VK_SUCCESS);
+
+        std::vector<uint8_t> result(size);
+        std::memcpy(result.data(), readback->map(0, size), size);
+        return result;
+    }
+
+    std::unique_ptr<gfx::backend::vulkan::core::Instance> instance;
+    gfx::backend::vulkan::core::Adapter* adapter = nullptr;
+    std::unique_ptr<gfx::backend::vulkan::core::Device> device;
+    gfx::backend::vulkan::core::UploadEngine* uploadEngine = nullptr;
+};
+
+// ============================================================================
+// Setup Tests
+// ============================================================================
+
+TEST_F(VulkanUploadEngineTest, Device_WithExtension_HasUploadEngine)
+{
+    ASSERT_NE(uploadEngine, nullptr);
+    ASSERT_NE(uploadEngine->getSemaphore(), nullptr);
+    EXPECT_EQ(uploadEngine->getSemaphore()->getType(), gfx::backend::vulkan::core::SemaphoreType::Timeline);
+}
+
+TEST_F(VulkanUploadEngineTest, Device_WithoutExtension_HasNoUploadEngine)
+{
+    gfx::backend::vulkan::core::DeviceCreateInfo deviceInfo{};
+    gfx::backend::vulkan::core::Device plainDevice(adapter, deviceInfo);
+
+    EXPECT_EQ(plainDevice.getUploadEngine(), nullptr);
+}
+
+TEST_F(VulkanUploadEngineTest, DedicatedQueue_MatchesAdapterTransferFamily)
+{
+    bool hasTransferFamily = adapter->getTransferQueueFamily() != UINT32_MAX;
+    EXPECT_EQ(uploadEngine->hasDedicatedQueue(), hasTransferFamily);
+    if (hasTransferFamily) {
+        EXPECT_NE(device->getQueueByIndex(adapter->getTransferQueueFamily(), 0), nullptr);
+    }
+}
+
+// ============================================================================
+// Buffer Upload Tests
+// ============================================================================
+
+TEST_F(VulkanUploadEngineTest, UploadBuffer_ReturnsIncreasingValues)
+{
+    auto buffer = createBuffer(1024, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    std::vector<uint8_t> data(1024, 0x11);
+
+    uint64_t first = uploadEngine->uploadBuffer(buffer.get(), 0, data.data(), data.size());
+    uint64_t second = uploadEngine->uploadBuffer(buffer.get(), 0, data.data(), data.size());
+
+    EXPECT_GT(first, 0u);
+    EXPECT_EQ(second, first + 1);
+    EXPECT_EQ(uploadEngine->getSemaphore()->wait(second, UINT64_MAX), VK_SUCCESS);
+    EXPECT_GE(uploadEngine->getSemaphore()->getValue(), second);
+}
+
+TEST_F(VulkanUploadEngineTest, UploadBuffer_DeviceLocal_VisibleToGraphicsQueue)
+{
+    const size_t size = 256 * 1024;
+    auto buffer = createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    uint64_t value = uploadEngine->uploadBuffer(buffer.get(), 0, data.data(), data.size());
+    EXPECT_EQ(readBackAfter(value, buffer.get(), size), data);
+}
+
+TEST_F(VulkanUploadEngineTest, UploadBuffer_LargerThanStagingRing_Succeeds)
+{
+    const size_t size = 32 * 1024 * 1024;
+    auto buffer = createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    std::vector<uint8_t> data(size, 0x3c);
+    uint64_t value = uploadEngine->uploadBuffer(buffer.get(), 0, data.data(), data.size());
+
+    auto result = readBackAfter(value, buffer.get(), size);
+    EXPECT_EQ(result.front(), 0x3c);
+    EXPECT_EQ(result.back(), 0x3c);
+}
+
+TEST_F(VulkanUploadEngineTest, UploadBuffer_HostVisible_WritesDirectly)
+{
+    auto buffer = createBuffer(64, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    std::vector<uint8_t> data(64, 0x42);
+
+    uploadEngine->uploadBuffer(buffer.get(), 0, data.data(), data.size());
+
+    EXPECT_EQ(std::memcmp(buffer->map(0, 64), data.data(), 64), 0);
+}
+
+// ============================================================================
+// Texture Upload Tests
+// ============================================================================
+
+TEST_F(VulkanUploadEngineTest, UploadTexture_WholeMip_SetsFinalLayout)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo createInfo{};
+    createInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    createInfo.size = { 64, 64, 1 };
+    createInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    createInfo.mipLevelCount = 1;
+    createInfo.imageType = VK_IMAGE_TYPE_2D;
+    createInfo.arrayLayers = 1;
+    gfx::backend::vulkan::core::Texture texture(device.get(), createInfo);
+
+    std::vector<uint8_t> pixels(64 * 64 * 4, 0xff);
+    uint64_t value = uploadEngine->uploadTexture(&texture, { 0, 0, 0 }, 0, pixels.data(), pixels.size(), { 64, 64, 1 }, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    EXPECT_EQ(texture.getLayout(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(uploadEngine->getSemaphore()->wait(value, UINT64_MAX), VK_SUCCESS);
+    device->waitIdle();
+}
+
+TEST_F(VulkanUploadEngineTest, UploadTexture_OneMip_LeavesOtherMipsAlone)
+{
+    gfx::backend::vulkan::core::TextureCreateInfo createInfo{};
+    createInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    createInfo.size = { 64, 64, 1 };
+    createInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    createInfo.sampleCount = VK_SAMPLE_COUNT_1_BIT;
+    createInfo.mipLevelCount = 2;
+    createInfo.imageType = VK_IMAGE_TYPE_2D;
+    createInfo.arrayLayers = 1;
+    gfx::backend::vulkan::core::Texture texture(device.get(), createInfo);
+
+    std::vector<uint8_t> pixels(32 * 32 * 4, 0xff);
+    uint64_t value = uploadEngine->uploadTexture(&texture, { 0, 0, 0 }, 1, pixels.data(), pixels.size(), { 32, 32, 1 }, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    EXPECT_EQ(texture.getLayout(1, 0), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(texture.getLayout(0, 0), VK_IMAGE_LAYOUT_UNDEFINED);
+    EXPECT_EQ(uploadEngine->getSemaphore()->wait(value, UINT64_MAX), VK_SUCCESS);
+    device->waitIdle();
+}
+
+} // namespace
@@ -0,0 +1,78 @@
+#include <backend/webgpu/core/command/ImmediateDataRing.h>
+#include <backend/webgpu/core/system/Device.h>
+#include <backend/webgpu/core/system/Instance.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+namespace {
+
+class WebGPUImmediateDataRingTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        try {
+            gfx::backend::webgpu::core::InstanceCreateInfo instInfo{};
+            instance = std::make_unique<gfx::backend::webgpu::core::Instance>(instInfo);
+
+            gfx::backend::webgpu::core::AdapterCreateInfo adapterInfo{};
+            adapterInfo.adapterIndex = 0;
+            adapter = instance->requestAdapter(adapterInfo);
+
+            gfx::backend::webgpu::core::DeviceCreateInfo deviceInfo{};
+            device = std::make_unique<gfx::backend::webgpu::core::Device>(adapter, deviceInfo);
+        } catch (const std::exception& e) {
+            GTEST_SKIP() << "WebGPU not available: " << e.what();
+        }
+    }
+
+    std::unique_ptr<gfx::backend::webgpu::core::Instance> instance;
+    gfx::backend::webgpu::core::Adapter* adapter = nullptr;
+    std::unique_ptr<gfx::backend::webgpu::core::Device> device;
+};
+
+const std::array<uint8_t, gfx::backend::webgpu::core::MAX_IMMEDIATE_DATA_SIZE> DATA{};
+
+TEST_F(WebGPUImmediateDataRingTest, Push_ReturnsDistinctAlignedSlots)
+{
+    gfx::backend::webgpu::core::ImmediateDataRing ring(device.get());
+
+    auto first = ring.push(DATA.data(), static_cast<uint32_t>(DATA.size()));
+    auto second = ring.push(DATA.data(), static_cast<uint32_t>(DATA.size()));
+
+    const uint32_t alignment = device->getLimits().minUniformBufferOffsetAlignment;
+    EXPECT_NE(first.bindGroup, nullptr);
+    EXPECT_EQ(first.bindGroup, second.bindGroup);
+    EXPECT_NE(first.offset, second.offset);
+    EXPECT_EQ(first.offset % alignment, 0u);
+    EXPECT_EQ(second.offset % alignment, 0u);
+    EXPECT_EQ(ring.chunkCount(), 1u);
+}
+
+TEST_F(WebGPUImmediateDataRingTest, Push_GrowsWhenChunkIsFull)
+{
+    gfx::backend::webgpu::core::ImmediateDataRing ring(device.get());
+
+    for (int i = 0; i < 300; ++i) {
+        ring.push(DATA.data(), static_cast<uint32_t>(DATA.size()));
+    }
+
+    EXPECT_EQ(ring.chunkCount(), 2u);
+}
+
+TEST_F(WebGPUImmediateDataRingTest, Reset_ReusesChunks)
+{
+    gfx::backend::webgpu::core::ImmediateDataRing ring(device.get());
+
+    auto first = ring.push(DATA.data(), static_cast<uint32_t>(DATA.size()));
+    ring.reset();
+    auto second = ring.push(DATA.data(), static_cast<uint32_t>(DATA.size()));
+
+    EXPECT_EQ(first.bindGroup, second.bindGroup);
+    EXPECT_EQ(first.offset, second.offset);
+    EXPECT_EQ(ring.chunkCount(), 1u);
+}
+
+} // namespace
@@ -1,6 +1,7 @@
 #include <backend/webgpu/core/resource/Sampler.h>
 #include <backend/webgpu/core/system/Device.h>
 #include <backend/webgpu/core/system/Instance.h>
+#include <backend/webgpu/core/system/SamplerCache.h>
 
 #include <gtest/gtest.h>
 
@@ -140,4 +141,30 @@ TEST_F(WebGPUSamplerTest, Destructor_CleansUpResources)
     SUCCEED();
 }
 
+TEST_F(WebGPUSamplerTest, IdenticalCreateInfos_ShareHandle)
+{
+    gfx::backend::webgpu::core::SamplerCreateInfo createInfo{};
+    createInfo.minFilter = WGPUFilterMode_Linear;
+    createInfo.magFilter = WGPUFilterMode_Linear;
+    createInfo.mipmapFilter = WGPUMipmapFilterMode_Linear;
+    createInfo.addressModeU = WGPUAddressMode_Repeat;
+    createInfo.addressModeV = WGPUAddressMode_Repeat;
+    createInfo.addressModeW = WGPUAddressMode_Repeat;
+
+    auto* cache = device->getSamplerCache();
+    auto before = cache->getStats();
+
+    auto first = std::make_unique<gfx::backend::webgpu::core::Sampler>(device.get(), createInfo);
+    auto second = std::make_unique<gfx::backend::webgpu::core::Sampler>(device.get(), createInfo);
+
+    EXPECT_EQ(first->handle(), second->handle());
+    EXPECT_EQ(cache->getStats().samplerCount, before.samplerCount + 1);
+    EXPECT_EQ(cache->getStats().hitCount, before.hitCount + 1);
+
+    first.reset();
+    EXPECT_EQ(cache->getStats().samplerCount, before.samplerCount + 1);
+    second.reset();
+    EXPECT_EQ(cache->getStats().samplerCount, before.samplerCount);
+}
+
 } // anonymous namespace
@@ -54,6 +54,24 @@ TEST_F(WebGPUFenceTest, MultipleFences_IndependentState)
     EXPECT_TRUE(fence2->isSignaled());
 }
 
+TEST_F(WebGPUFenceTest, IsPending_WithoutSubmit_ReturnsFalse)
+{
+    auto fence = std::make_unique<gfx::backend::webgpu::core::Fence>(false);
+    EXPECT_FALSE(fence->isPending());
+
+    fence->signal();
+    EXPECT_FALSE(fence->isPending());
+}
+
+TEST_F(WebGPUFenceTest, Wait_Unsubmitted_ReturnsFalse)
+{
+    auto fence = std::make_unique<gfx::backend::webgpu::core::Fence>(false);
+
+    // Nothing will signal it, so waiting must not block
+    EXPECT_FALSE(fence->wait(1000000));
+    EXPECT_FALSE(fence->isSignaled());
+}
+
 TEST_F(WebGPUFenceTest, Destructor_CleansUpResources)
 {
     {
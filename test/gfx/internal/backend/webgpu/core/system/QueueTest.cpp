@@ -1,4 +1,7 @@
+#include <backend/webgpu/core/command/CommandEncoder.h>
 #include <backend/webgpu/core/resource/Buffer.h>
+#include <backend/webgpu/core/sync/Fence.h>
+#include <backend/webgpu/core/sync/Semaphore.h>
 #include <backend/webgpu/core/system/Device.h>
 #include <backend/webgpu/core/system/Instance.h>
 #include <backend/webgpu/core/system/Queue.h>
@@ -35,6 +38,32 @@ protected:
         }
     }
 
+    std::unique_ptr<gfx::backend::webgpu::core::Buffer> createBuffer(size_t size)
+    {
+        gfx::backend::webgpu::core::BufferCreateInfo bufferInfo{};
+        bufferInfo.size = size;
+        bufferInfo.usage = WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc;
+        return std::make_unique<gfx::backend::webgpu::core::Buffer>(device.get(), bufferInfo);
+    }
+
+    // Submits copyCount copies of size bytes
+    void submitCopies(gfx::backend::webgpu::core::Buffer* source, gfx::backend::webgpu::core::Buffer* destination, uint64_t size, uint32_t copyCount, gfx::backend::webgpu::core::Fence* fence)
+    {
+        gfx::backend::webgpu::core::CommandEncoderCreateInfo encoderInfo{};
+        gfx::backend::webgpu::core::CommandEncoder encoder(device.get(), encoderInfo);
+        for (uint32_t i = 0; i < copyCount; ++i) {
+            encoder.copyBufferToBuffer(source, 0, destination, 0, size);
+        }
+
+        gfx::backend::webgpu::core::CommandEncoder* encoders[] = { &encoder };
+        gfx::backend::webgpu::core::SubmitInfo submitInfo{};
+        submitInfo.commandEncoders = encoders;
+        submitInfo.commandEncoderCount = 1;
+        submitInfo.signalFence = fence;
+
+        EXPECT_TRUE(queue->submit(submitInfo));
+    }
+
     std::unique_ptr<gfx::backend::webgpu::core::Instance> instance;
     gfx::backend::webgpu::core::Adapter* adapter = nullptr;
     std::unique_ptr<gfx::backend::webgpu::core::Device> device;
@@ -118,4 +147,51 @@ TEST_F(WebGPUQueueTest, WaitIdle_AfterSubmit)
     EXPECT_TRUE(waitSuccess);
 }
 
+TEST_F(WebGPUQueueTest, Submit_WithFence_SignalsOnWait)
+{
+    auto source = createBuffer(4096);
+    auto destination = createBuffer(4096);
+    gfx::backend::webgpu::core::Fence fence(false);
+
+    submitCopies(source.get(), destination.get(), 4096, 1, &fence);
+
+    EXPECT_TRUE(fence.wait(UINT64_MAX));
+    EXPECT_TRUE(fence.isSignaled());
+
+    // Resetting drops the completed future, the fence stays unsignaled until submitted again
+    fence.reset();
+    EXPECT_FALSE(fence.wait(0));
+}
+
+TEST_F(WebGPUQueueTest, Submit_WithTimelineSignal_ReachesValue)
+{
+    gfx::backend::webgpu::core::Semaphore semaphore(gfx::backend::webgpu::core::SemaphoreType::Timeline, 0);
+    gfx::backend::webgpu::core::Semaphore* signalSemaphores[] = { &semaphore };
+    uint64_t signalValues[] = { 5 };
+
+    gfx::backend::webgpu::core::SubmitInfo submitInfo{};
+    submitInfo.signalSemaphores = signalSemaphores;
+    submitInfo.signalValues = signalValues;
+    submitInfo.signalSemaphoreCount = 1;
+    ASSERT_TRUE(queue->submit(submitInfo));
+
+    EXPECT_TRUE(semaphore.wait(5, UINT64_MAX));
+    EXPECT_EQ(semaphore.getValue(), 5u);
+}
+
+TEST_F(WebGPUQueueTest, Submit_WithFence_HandsOffInsteadOfWaiting)
+{
+    auto source = createBuffer(4096);
+    auto destination = createBuffer(4096);
+    gfx::backend::webgpu::core::Fence fence(true);
+
+    // The submit re-arms the fence with the work-done future instead of waiting on it
+    submitCopies(source.get(), destination.get(), 4096, 1, &fence);
+    EXPECT_TRUE(fence.isPending());
+
+    EXPECT_TRUE(fence.wait(UINT64_MAX));
+    EXPECT_FALSE(fence.isPending());
+    EXPECT_TRUE(fence.isSignaled());
+}
+
 } // anonymous namespace
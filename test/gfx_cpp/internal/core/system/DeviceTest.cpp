@@ -74,6 +74,13 @@ TEST_P(DeviceImplTest, WaitIdle)
     wrapper.waitIdle();
 }
 
+TEST_P(DeviceImplTest, Poll)
+{
+    DeviceImpl wrapper(device);
+    // Should not crash
+    wrapper.poll();
+}
+
 TEST_P(DeviceImplTest, GetLimits)
 {
     DeviceImpl wrapper(device);